@@ -21,6 +21,7 @@
 #include <boost/gil/concepts.hpp>
 #include <boost/gil/device_n.hpp>
 #include <boost/gil/dynamic_step.hpp>
+#include <boost/gil/execution.hpp>
 #include <boost/gil/gray.hpp>
 #include <boost/gil/histogram.hpp>
 #include <boost/gil/image.hpp>
@@ -59,7 +60,9 @@
 #include "boost/gil/extension/image_processing/hough_transform.hpp"
 #include <boost/gil/image_processing/morphology.hpp>
 #include <boost/gil/image_processing/numeric.hpp>
+#include <boost/gil/image_processing/pyramid.hpp>
 #include <boost/gil/image_processing/scaling.hpp>
+#include <boost/gil/image_processing/summed_area_table.hpp>
 #include <boost/gil/image_processing/threshold.hpp>
 
 #endif
@@ -16,8 +16,13 @@
 #include <boost/gil/bit_aligned_pixel_iterator.hpp>
 #include <boost/gil/color_base_algorithm.hpp>
 #include <boost/gil/concepts.hpp>
+#include <boost/gil/execution.hpp>
 #include <boost/gil/image_view.hpp>
 #include <boost/gil/image_view_factory.hpp>
+#include <boost/gil/detail/byte_rows.hpp>
+#include <boost/gil/detail/color_convert_row.hpp>
+#include <boost/gil/detail/correlate_row.hpp>
+#include <boost/gil/detail/lut_row.hpp>
 #include <boost/gil/detail/mp11.hpp>
 #include <boost/gil/detail/type_traits.hpp>
 
@@ -25,6 +30,7 @@
 #include <boost/config.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstring>
 #include <iterator>
@@ -32,6 +38,7 @@
 #include <type_traits>
 #include <typeinfo>
 #include <numeric>
+#include <vector>
 
 namespace boost { namespace gil {
 
@@ -318,13 +325,48 @@ public:
    // when the two color spaces are incompatible, a color conversion is performed
     template <typename V1, typename V2> BOOST_FORCEINLINE
     auto apply_incompatible(const V1& src, const V2& dst) const -> result_type {
-        copy_pixels(color_converted_view<typename V2::value_type>(src,_cc),dst);
+        apply_incompatible(src, dst, is_convert_row_vectorized<CC, typename V1::x_iterator, typename V2::x_iterator>());
     }
 
     // If the two color spaces are compatible, copy_and_convert is just copy
     template <typename V1, typename V2> BOOST_FORCEINLINE
     auto apply_compatible(const V1& src, const V2& dst) const -> result_type {
-         copy_pixels(src,dst);
+        apply_compatible(src, dst, is_convert_row_vectorized<CC, typename V1::x_iterator, typename V2::x_iterator>());
+    }
+
+private:
+    template <typename V1, typename V2>
+    void apply_incompatible(const V1& src, const V2& dst, std::false_type) const {
+        copy_pixels(color_converted_view<typename V2::value_type>(src,_cc),dst);
+    }
+
+    template <typename V1, typename V2>
+    void apply_compatible(const V1& src, const V2& dst, std::false_type) const {
+        copy_pixels(src,dst);
+    }
+
+    // Interleaved 8-bit gray, RGB and RGBA pixels are converted a row at a time with vector instructions
+    template <typename V1, typename V2>
+    void apply_incompatible(const V1& src, const V2& dst, std::true_type) const {
+        convert_rows(src, dst);
+    }
+
+    template <typename V1, typename V2>
+    void apply_compatible(const V1& src, const V2& dst, std::true_type) const {
+        convert_rows(src, dst);
+    }
+
+    template <typename V1, typename V2>
+    void convert_rows(const V1& src, const V2& dst) const {
+        BOOST_ASSERT(src.dimensions() == dst.dimensions());
+        if (src.width() == 0 || src.height() == 0)
+            return;
+        if (src.is_1d_traversable() && dst.is_1d_traversable()) {
+            convert_row(src.row_begin(0), dst.row_begin(0), src.width() * src.height());
+        } else {
+            for (std::ptrdiff_t y = 0; y < src.height(); ++y)
+                convert_row(src.row_begin(y), dst.row_begin(y), src.width());
+        }
     }
 };
 } // namespace detail
@@ -332,7 +374,9 @@ public:
 /// \ingroup ImageViewSTLAlgorithmsCopyAndConvertPixels
 template <typename V1, typename V2,typename CC>
 BOOST_FORCEINLINE
-void copy_and_convert_pixels(const V1& src, const V2& dst,CC cc) {
+auto copy_and_convert_pixels(const V1& src, const V2& dst,CC cc)
+    -> typename std::enable_if<!is_execution_policy<V1>::value>::type
+{
     detail::copy_and_convert_pixels_fn<CC> ccp(cc);
     ccp(src,dst);
 }
@@ -982,9 +1026,9 @@ struct equal_n_fn<planar_pixel_iterator<IC, CS>, planar_pixel_iterator<IC, CS>>
     BOOST_FORCEINLINE
     bool operator()(planar_pixel_iterator<IC, CS> const i1, std::ptrdiff_t n, planar_pixel_iterator<IC, CS> const i2) const
     {
-        // FIXME: ptrdiff_t vs size_t
-        constexpr std::ptrdiff_t byte_size = n * sizeof(typename std::iterator_traits<IC>::value_type);
-        for (std::ptrdiff_t i = 0; i < mp11::mp_size<CS>::value; ++i)
+        std::size_t const byte_size =
+            static_cast<std::size_t>(n) * sizeof(typename std::iterator_traits<IC>::value_type);
+        for (int i = 0; i < static_cast<int>(mp11::mp_size<CS>::value); ++i)
         {
             if (memcmp(dynamic_at_c(i1, i), dynamic_at_c(i2, i), byte_size) != 0)
                 return false;
@@ -1138,7 +1182,9 @@ F transform_pixels(const View1& src,const View2& dst, F fun) {
 /// \ingroup ImageViewSTLAlgorithmsTransformPixels
 /// \brief transform_pixels with two sources
 template <typename View1, typename View2, typename View3, typename F> BOOST_FORCEINLINE
-F transform_pixels(const View1& src1, const View2& src2,const View3& dst, F fun) {
+auto transform_pixels(const View1& src1, const View2& src2,const View3& dst, F fun)
+    -> typename std::enable_if<!is_execution_policy<View1>::value, F>::type
+{
     for (std::ptrdiff_t y=0; y<dst.height(); ++y) {
         typename View1::x_iterator srcIt1=src1.row_begin(y);
         typename View2::x_iterator srcIt2=src2.row_begin(y);
@@ -1171,7 +1217,9 @@ F transform_pixel_positions(const View1& src,const View2& dst, F fun) {
 /// \ingroup ImageViewSTLAlgorithmsTransformPixelPositions
 /// \brief transform_pixel_positions with two sources
 template <typename View1, typename View2, typename View3, typename F> BOOST_FORCEINLINE
-F transform_pixel_positions(const View1& src1,const View2& src2,const View3& dst, F fun) {
+auto transform_pixel_positions(const View1& src1,const View2& src2,const View3& dst, F fun)
+    -> typename std::enable_if<!is_execution_policy<View1>::value, F>::type
+{
     BOOST_ASSERT(src1.dimensions() == dst.dimensions());
     BOOST_ASSERT(src2.dimensions() == dst.dimensions());
     typename View1::xy_locator loc1=src1.xy_at(0,0);
@@ -1186,6 +1234,361 @@ F transform_pixel_positions(const View1& src1,const View2& src2,const View3& dst
     return fun;
 }
 
+//////////////////////////////////////////////////////////////////////////////////////
+///
+/// Algorithms with execution policy
+///
+//////////////////////////////////////////////////////////////////////////////////////
+
+/// \defgroup ImageViewSTLAlgorithmsExecutionPolicy Algorithms with execution policy
+/// \ingroup ImageViewSTLAlgorithms
+/// \brief Overloads of the STL-like algorithms processing bands of rows as separate tasks
+///
+/// Each overload runs the corresponding serial algorithm on a band of full-width rows, so the
+/// 1D-traversable and memmove fast paths still apply within each band. Function objects are
+/// copied for each band and may be invoked concurrently, the same as for the C++17 parallel
+/// algorithms, therefore the overloads return \p void instead of the function object.
+
+namespace detail {
+
+template <typename View>
+BOOST_FORCEINLINE
+auto row_band_view(View const& view, std::ptrdiff_t first_row, std::ptrdiff_t last_row) -> View
+{
+    return subimage_view(view, 0, first_row, view.width(), last_row - first_row);
+}
+
+} // namespace detail
+
+/// \ingroup ImageViewSTLAlgorithmsExecutionPolicy
+/// \brief copy_pixels with execution policy
+template
+<
+    typename ExecutionPolicy,
+    typename View1,
+    typename View2,
+    typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+>
+void copy_pixels(ExecutionPolicy const& policy, View1 const& src, View2 const& dst)
+{
+    BOOST_ASSERT(src.dimensions() == dst.dimensions());
+    detail::for_each_row_band(policy, dst.height(), [&](std::ptrdiff_t y0, std::ptrdiff_t y1)
+    {
+        copy_pixels(detail::row_band_view(src, y0, y1), detail::row_band_view(dst, y0, y1));
+    });
+}
+
+/// \ingroup ImageViewSTLAlgorithmsExecutionPolicy
+/// \brief copy_and_convert_pixels with execution policy and user-defined color converter
+template
+<
+    typename ExecutionPolicy,
+    typename View1,
+    typename View2,
+    typename CC,
+    typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+>
+void copy_and_convert_pixels(ExecutionPolicy const& policy, View1 const& src, View2 const& dst, CC cc)
+{
+    BOOST_ASSERT(src.dimensions() == dst.dimensions());
+    detail::for_each_row_band(policy, dst.height(), [&](std::ptrdiff_t y0, std::ptrdiff_t y1)
+    {
+        copy_and_convert_pixels(
+            detail::row_band_view(src, y0, y1), detail::row_band_view(dst, y0, y1), cc);
+    });
+}
+
+/// \ingroup ImageViewSTLAlgorithmsExecutionPolicy
+/// \brief copy_and_convert_pixels with execution policy
+template
+<
+    typename ExecutionPolicy,
+    typename View1,
+    typename View2,
+    typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+>
+void copy_and_convert_pixels(ExecutionPolicy const& policy, View1 const& src, View2 const& dst)
+{
+    BOOST_ASSERT(src.dimensions() == dst.dimensions());
+    detail::for_each_row_band(policy, dst.height(), [&](std::ptrdiff_t y0, std::ptrdiff_t y1)
+    {
+        copy_and_convert_pixels(
+            detail::row_band_view(src, y0, y1), detail::row_band_view(dst, y0, y1));
+    });
+}
+
+/// \ingroup ImageViewSTLAlgorithmsExecutionPolicy
+/// \brief fill_pixels with execution policy
+template
+<
+    typename ExecutionPolicy,
+    typename View,
+    typename Value,
+    typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+>
+void fill_pixels(ExecutionPolicy const& policy, View const& view, Value const& value)
+{
+    detail::for_each_row_band(policy, view.height(), [&](std::ptrdiff_t y0, std::ptrdiff_t y1)
+    {
+        fill_pixels(detail::row_band_view(view, y0, y1), value);
+    });
+}
+
+/// \ingroup ImageViewSTLAlgorithmsExecutionPolicy
+/// \brief for_each_pixel with execution policy
+template
+<
+    typename ExecutionPolicy,
+    typename View,
+    typename F,
+    typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+>
+void for_each_pixel(ExecutionPolicy const& policy, View const& view, F fun)
+{
+    detail::for_each_row_band(policy, view.height(), [&](std::ptrdiff_t y0, std::ptrdiff_t y1)
+    {
+        for_each_pixel(detail::row_band_view(view, y0, y1), fun);
+    });
+}
+
+/// \ingroup ImageViewSTLAlgorithmsExecutionPolicy
+/// \brief generate_pixels with execution policy
+///
+/// The generator is invoked concurrently and in unspecified order,
+/// so only stateless generators give the same result as the serial algorithm.
+template
+<
+    typename ExecutionPolicy,
+    typename View,
+    typename F,
+    typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+>
+void generate_pixels(ExecutionPolicy const& policy, View const& view, F fun)
+{
+    detail::for_each_row_band(policy, view.height(), [&](std::ptrdiff_t y0, std::ptrdiff_t y1)
+    {
+        generate_pixels(detail::row_band_view(view, y0, y1), fun);
+    });
+}
+
+/// \ingroup ImageViewSTLAlgorithmsExecutionPolicy
+/// \brief transform_pixels with execution policy
+template
+<
+    typename ExecutionPolicy,
+    typename View1,
+    typename View2,
+    typename F,
+    typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+>
+void transform_pixels(ExecutionPolicy const& policy, View1 const& src, View2 const& dst, F fun)
+{
+    BOOST_ASSERT(src.dimensions() == dst.dimensions());
+    detail::for_each_row_band(policy, dst.height(), [&](std::ptrdiff_t y0, std::ptrdiff_t y1)
+    {
+        transform_pixels(
+            detail::row_band_view(src, y0, y1), detail::row_band_view(dst, y0, y1), fun);
+    });
+}
+
+/// \ingroup ImageViewSTLAlgorithmsExecutionPolicy
+/// \brief transform_pixels with two sources and execution policy
+template
+<
+    typename ExecutionPolicy,
+    typename View1,
+    typename View2,
+    typename View3,
+    typename F,
+    typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+>
+void transform_pixels(
+    ExecutionPolicy const& policy, View1 const& src1, View2 const& src2, View3 const& dst, F fun)
+{
+    BOOST_ASSERT(src1.dimensions() == dst.dimensions());
+    BOOST_ASSERT(src2.dimensions() == dst.dimensions());
+    detail::for_each_row_band(policy, dst.height(), [&](std::ptrdiff_t y0, std::ptrdiff_t y1)
+    {
+        transform_pixels(
+            detail::row_band_view(src1, y0, y1),
+            detail::row_band_view(src2, y0, y1),
+            detail::row_band_view(dst, y0, y1),
+            fun);
+    });
+}
+
+/// \ingroup ImageViewSTLAlgorithmsExecutionPolicy
+/// \brief transform_pixel_positions with execution policy
+///
+/// Locators passed to the function object may access pixels of the neighbouring bands.
+template
+<
+    typename ExecutionPolicy,
+    typename View1,
+    typename View2,
+    typename F,
+    typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+>
+void transform_pixel_positions(
+    ExecutionPolicy const& policy, View1 const& src, View2 const& dst, F fun)
+{
+    BOOST_ASSERT(src.dimensions() == dst.dimensions());
+    detail::for_each_row_band(policy, dst.height(), [&](std::ptrdiff_t y0, std::ptrdiff_t y1)
+    {
+        transform_pixel_positions(
+            detail::row_band_view(src, y0, y1), detail::row_band_view(dst, y0, y1), fun);
+    });
+}
+
+/// \ingroup ImageViewSTLAlgorithmsExecutionPolicy
+/// \brief transform_pixel_positions with two sources and execution policy
+template
+<
+    typename ExecutionPolicy,
+    typename View1,
+    typename View2,
+    typename View3,
+    typename F,
+    typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+>
+void transform_pixel_positions(
+    ExecutionPolicy const& policy, View1 const& src1, View2 const& src2, View3 const& dst, F fun)
+{
+    BOOST_ASSERT(src1.dimensions() == dst.dimensions());
+    BOOST_ASSERT(src2.dimensions() == dst.dimensions());
+    detail::for_each_row_band(policy, dst.height(), [&](std::ptrdiff_t y0, std::ptrdiff_t y1)
+    {
+        transform_pixel_positions(
+            detail::row_band_view(src1, y0, y1),
+            detail::row_band_view(src2, y0, y1),
+            detail::row_band_view(dst, y0, y1),
+            fun);
+    });
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+// apply_lut
+//////////////////////////////////////////////////////////////////////////////////////
+
+/// \defgroup ImageViewSTLAlgorithmsApplyLut apply_lut
+/// \ingroup ImageViewSTLAlgorithms
+/// \brief Replaces each channel value of a view with its entry in a lookup table.
+///
+/// The source channels must be integral of at most 16 bits. The table holds one entry per
+/// source channel value, entry \c i being the result for the value \c min+i, where \c min
+/// is the smallest value of the channel, so 256 entries for 8-bit channels and 65536 entries
+/// for 16-bit channels. Entries are converted to the destination channel with \c static_cast,
+/// so tone curves may be given in any arithmetic type.
+///
+/// Interleaved 8-bit views of the same pixel type look up whole rows as arrays of bytes.
+
+namespace detail {
+
+template <typename ExecutionPolicy, typename SrcView, typename DstView, typename T, std::size_t N>
+void apply_channel_luts(
+    ExecutionPolicy const& policy,
+    SrcView const& src,
+    DstView const& dst,
+    std::array<T const*, N> const& tables,
+    std::false_type)
+{
+    for_each_row_band(policy, dst.height(), [&](std::ptrdiff_t y0, std::ptrdiff_t y1)
+    {
+        for (std::ptrdiff_t y = y0; y < y1; ++y)
+            apply_lut_pixels(src.row_begin(y), dst.row_begin(y), dst.width(), tables);
+    });
+}
+
+template <typename ExecutionPolicy, typename SrcView, typename DstView, typename T, std::size_t N>
+void apply_channel_luts(
+    ExecutionPolicy const& policy,
+    SrcView const& src,
+    DstView const& dst,
+    std::array<T const*, N> const& tables,
+    std::true_type)
+{
+    for_each_row_band(policy, dst.height(), [&](std::ptrdiff_t y0, std::ptrdiff_t y1)
+    {
+        for (std::ptrdiff_t y = y0; y < y1; ++y)
+        {
+            apply_lut_bytes(
+                reinterpret_cast<std::uint8_t const*>(&src.row_begin(y)[0]),
+                reinterpret_cast<std::uint8_t*>(&dst.row_begin(y)[0]), dst.width(), tables);
+        }
+    });
+}
+
+/// \brief Looks up each channel of the source view in its own table, entry \c i of the
+/// tables being the destination channel value for the source value \c min+i
+template <typename ExecutionPolicy, typename SrcView, typename DstView, typename T, std::size_t N>
+void apply_channel_luts(
+    ExecutionPolicy const& policy,
+    SrcView const& src,
+    DstView const& dst,
+    std::array<T const*, N> const& tables)
+{
+    static_assert(is_lut_index_channel<typename channel_type<SrcView>::type>::value,
+        "Lookup tables require integral source channels of at most 16 bits");
+    static_assert(N == num_channels<SrcView>::value, "One table per channel is required");
+    static_assert(std::is_same<T, typename base_channel_type<
+        typename channel_type<DstView>::type>::type>::value,
+        "Tables must hold values of the destination channel type");
+    BOOST_ASSERT(src.dimensions() == dst.dimensions());
+    apply_channel_luts(policy, src, dst, tables, is_byte_row_views<SrcView, DstView>());
+}
+
+} // namespace detail
+
+/// \ingroup ImageViewSTLAlgorithmsApplyLut
+/// \brief Replaces each channel value of a view with its entry in a lookup table, processing
+/// bands of rows according to an execution policy
+/// \param lut - Table indexable with \c std::size_t and providing its size, such as
+/// \c std::vector or \c std::array, holding at least detail::lut_extent entries.
+template
+<
+    typename ExecutionPolicy,
+    typename SrcView,
+    typename DstView,
+    typename Lut,
+    typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+>
+void apply_lut(
+    ExecutionPolicy const& policy, SrcView const& src, DstView const& dst, Lut const& lut)
+{
+    gil_function_requires<ImageViewConcept<SrcView>>();
+    gil_function_requires<MutableImageViewConcept<DstView>>();
+    static_assert(
+        color_spaces_are_compatible
+        <
+            typename color_space_type<SrcView>::type,
+            typename color_space_type<DstView>::type
+        >::value,
+        "Source and destination views must have pixels with the same color space");
+
+    using src_channel_t = typename channel_type<SrcView>::type;
+    using dst_value_t = typename base_channel_type<typename channel_type<DstView>::type>::type;
+    static_assert(detail::is_lut_index_channel<src_channel_t>::value,
+        "Lookup tables require integral source channels of at most 16 bits");
+
+    detail::check_lut_size<detail::lut_extent<src_channel_t>::value>(lut);
+
+    std::vector<dst_value_t> table(detail::lut_extent<src_channel_t>::value);
+    for (std::size_t i = 0; i < table.size(); ++i)
+        table[i] = static_cast<dst_value_t>(lut[i]);
+
+    std::array<dst_value_t const*, num_channels<SrcView>::value> tables;
+    tables.fill(table.data());
+    detail::apply_channel_luts(policy, src, dst, tables);
+}
+
+/// \ingroup ImageViewSTLAlgorithmsApplyLut
+/// \brief Replaces each channel value of a view with its entry in a lookup table
+template <typename SrcView, typename DstView, typename Lut>
+void apply_lut(SrcView const& src, DstView const& dst, Lut const& lut)
+{
+    apply_lut(execution::seq, src, dst, lut);
+}
+
 
 // Code below this line is moved here from <boost/gil/extension/numeric/algorithm.hpp>
 
@@ -1289,7 +1692,8 @@ T inner_product_k(
         first1, first2, init, binary_op1, binary_op2);
 }
 
-/// \brief 1D un-guarded cross-correlation with a variable-size kernel
+namespace detail {
+
 template
 <
     typename PixelAccum,
@@ -1304,7 +1708,30 @@ auto correlate_pixels_n(
     SrcIterator src_end,
     KernelIterator kernel_begin,
     Size kernel_size,
-    DstIterator dst_begin)
+    DstIterator dst_begin,
+    std::true_type) // vectorized
+    -> DstIterator
+{
+    return correlate_row<PixelAccum>(
+        src_begin, src_end, kernel_begin, static_cast<std::size_t>(kernel_size), dst_begin);
+}
+
+template
+<
+    typename PixelAccum,
+    typename SrcIterator,
+    typename KernelIterator,
+    typename Size,
+    typename DstIterator
+>
+inline
+auto correlate_pixels_n(
+    SrcIterator src_begin,
+    SrcIterator src_end,
+    KernelIterator kernel_begin,
+    Size kernel_size,
+    DstIterator dst_begin,
+    std::false_type) // generic
     -> DstIterator
 {
     using src_pixel_ref_t = typename pixel_proxy
@@ -1337,7 +1764,6 @@ auto correlate_pixels_n(
     return dst_begin;
 }
 
-/// \brief 1D un-guarded cross-correlation with a fixed-size kernel
 template
 <
     std::size_t Size,
@@ -1351,7 +1777,28 @@ auto correlate_pixels_k(
     SrcIterator src_begin,
     SrcIterator src_end,
     KernelIterator kernel_begin,
-    DstIterator dst_begin)
+    DstIterator dst_begin,
+    std::true_type) // vectorized
+    -> DstIterator
+{
+    return correlate_row<PixelAccum>(src_begin, src_end, kernel_begin, Size, dst_begin);
+}
+
+template
+<
+    std::size_t Size,
+    typename PixelAccum,
+    typename SrcIterator,
+    typename KernelIterator,
+    typename DstIterator
+>
+inline
+auto correlate_pixels_k(
+    SrcIterator src_begin,
+    SrcIterator src_end,
+    KernelIterator kernel_begin,
+    DstIterator dst_begin,
+    std::false_type) // generic
     -> DstIterator
 {
     using src_pixel_ref_t = typename pixel_proxy
@@ -1383,6 +1830,58 @@ auto correlate_pixels_k(
     return dst_begin;
 }
 
+} // namespace detail
+
+/// \brief 1D un-guarded cross-correlation with a variable-size kernel
+///
+/// Rows of interleaved pixels of \p PixelAccum = pixel<float, Layout> with up to four channels
+/// are correlated with a float kernel using vector instructions, when available.
+template
+<
+    typename PixelAccum,
+    typename SrcIterator,
+    typename KernelIterator,
+    typename Size,
+    typename DstIterator
+>
+inline
+auto correlate_pixels_n(
+    SrcIterator src_begin,
+    SrcIterator src_end,
+    KernelIterator kernel_begin,
+    Size kernel_size,
+    DstIterator dst_begin)
+    -> DstIterator
+{
+    return detail::correlate_pixels_n<PixelAccum>(
+        src_begin, src_end, kernel_begin, kernel_size, dst_begin,
+        detail::is_correlate_row_vectorized<PixelAccum, SrcIterator, KernelIterator>());
+}
+
+/// \brief 1D un-guarded cross-correlation with a fixed-size kernel
+///
+/// Uses the same vectorized code as correlate_pixels_n.
+template
+<
+    std::size_t Size,
+    typename PixelAccum,
+    typename SrcIterator,
+    typename KernelIterator,
+    typename DstIterator
+>
+inline
+auto correlate_pixels_k(
+    SrcIterator src_begin,
+    SrcIterator src_end,
+    KernelIterator kernel_begin,
+    DstIterator dst_begin)
+    -> DstIterator
+{
+    return detail::correlate_pixels_k<Size, PixelAccum>(
+        src_begin, src_end, kernel_begin, dst_begin,
+        detail::is_correlate_row_vectorized<PixelAccum, SrcIterator, KernelIterator>());
+}
+
 /// \brief destination is set to be product of the source and a scalar
 /// \tparam PixelAccum - TODO
 /// \tparam SrcView Models ImageViewConcept
@@ -0,0 +1,366 @@
+//
+// Copyright 2026 Boost.GIL Contributors
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#ifndef BOOST_GIL_DETAIL_BINARY_MORPHOLOGY_HPP
+#define BOOST_GIL_DETAIL_BINARY_MORPHOLOGY_HPP
+
+#include <boost/gil/bit_aligned_pixel_iterator.hpp>
+#include <boost/gil/channel.hpp>
+#include <boost/gil/metafunctions.hpp>
+#include <boost/gil/point.hpp>
+#include <boost/gil/detail/simd.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace boost { namespace gil { namespace detail {
+
+// Morphology of binary masks stored one bit per pixel, as in views of
+// bit_aligned_image1_type<1, gray_layout_t>::type.
+//
+// The rows of a mask are copied into 64-bit words, pixel x in bit x % 64 of word x / 64, and
+// the pixels covered by a structuring element are combined with word shifts and ORs, 64 pixels
+// at a time. Bits past the width of a row are kept cleared. Only dilation is implemented here:
+// erosion is the dilation of the inverted mask, inverted back.
+
+template <typename Iterator>
+struct is_binary_mask_iterator : std::false_type {};
+
+template <typename Reference>
+struct is_binary_mask_iterator<bit_aligned_pixel_iterator<Reference>>
+    : std::integral_constant<bool, Reference::bit_size == 1>
+{};
+
+/// \brief Determines whether a view holds pixels of a single bit
+template <typename View>
+struct is_binary_mask_view : is_binary_mask_iterator<typename View::x_iterator> {};
+
+/// \brief Returns the number of 64-bit words holding \p width bits
+inline auto bit_row_words(std::ptrdiff_t width) -> std::ptrdiff_t
+{
+    return (width + 63) / 64;
+}
+
+/// \brief Returns the mask of the bits of the last word of a row which hold pixels
+inline auto bit_row_last_mask(std::ptrdiff_t width) -> std::uint64_t
+{
+    int const used = static_cast<int>(width % 64);
+    return used == 0 ? ~std::uint64_t(0) : (std::uint64_t(1) << used) - 1;
+}
+
+/// \brief Copies a row of \p width bits starting at bit \p first_bit of \p bytes into words,
+/// inverted if requested
+template <typename Byte>
+void load_bit_row(
+    Byte* bytes, int first_bit, std::ptrdiff_t width, std::uint64_t* words, bool invert)
+{
+    std::ptrdiff_t const byte_count = (first_bit + width + 7) / 8;
+    std::ptrdiff_t const word_count = bit_row_words(width);
+    auto const byte_at = [&](std::ptrdiff_t index) -> std::uint64_t
+    {
+        return index < byte_count ? static_cast<std::uint64_t>(bytes[index]) : 0;
+    };
+    for (std::ptrdiff_t i = 0; i < word_count; ++i)
+    {
+        std::uint64_t low = 0;
+        for (int k = 0; k < 8; ++k)
+            low |= byte_at(8 * i + k) << (8 * k);
+        std::uint64_t word = low >> first_bit;
+        if (first_bit != 0)
+            word |= byte_at(8 * i + 8) << (64 - first_bit);
+        words[i] = invert ? ~word : word;
+    }
+    words[word_count - 1] &= bit_row_last_mask(width);
+}
+
+/// \brief Copies words into a row of \p width bits starting at bit \p first_bit of \p bytes,
+/// inverted if requested, leaving the other bits of the bytes unchanged
+inline void store_bit_row(
+    std::uint64_t const* words,
+    unsigned char* bytes,
+    int first_bit,
+    std::ptrdiff_t width,
+    bool invert)
+{
+    std::ptrdiff_t const byte_count = (first_bit + width + 7) / 8;
+    std::ptrdiff_t const word_count = bit_row_words(width);
+    for (std::ptrdiff_t j = 0; j < byte_count; ++j)
+    {
+        // Pixels of the byte, starting at pixel 8 * j - first_bit
+        std::uint64_t value;
+        if (j == 0)
+        {
+            value = words[0] << first_bit;
+        }
+        else
+        {
+            std::ptrdiff_t const position = 8 * j - first_bit;
+            std::ptrdiff_t const q = position / 64;
+            int const r = static_cast<int>(position % 64);
+            value = words[q] >> r;
+            if (r > 56 && q + 1 < word_count)
+                value |= words[q + 1] << (64 - r);
+        }
+        if (invert)
+            value = ~value;
+
+        unsigned mask = 0xFFu;
+        if (j == 0)
+            mask &= 0xFFu << first_bit;
+        std::ptrdiff_t const end = first_bit + width - 8 * j;
+        if (end < 8)
+            mask &= (1u << end) - 1;
+        bytes[j] = static_cast<unsigned char>(
+            (bytes[j] & ~mask) | (static_cast<unsigned>(value) & mask));
+    }
+}
+
+/// \brief ORs into bit x of \p dst the bit x + \p shift of \p src, taking bits outside \p src
+/// as cleared
+inline void or_shifted_bits(
+    std::uint64_t* dst,
+    std::ptrdiff_t dst_words,
+    std::uint64_t const* src,
+    std::ptrdiff_t src_words,
+    std::ptrdiff_t shift)
+{
+    if (shift >= 0)
+    {
+        std::ptrdiff_t const q = shift / 64;
+        int const r = static_cast<int>(shift % 64);
+        std::ptrdiff_t const count = (std::min)(dst_words, src_words - q);
+        for (std::ptrdiff_t i = 0; i < count; ++i)
+        {
+            std::uint64_t value = src[i + q] >> r;
+            if (r != 0 && i + q + 1 < src_words)
+                value |= src[i + q + 1] << (64 - r);
+            dst[i] |= value;
+        }
+    }
+    else
+    {
+        std::ptrdiff_t const q = -shift / 64;
+        int const r = static_cast<int>(-shift % 64);
+        std::ptrdiff_t const count = (std::min)(dst_words, src_words + q + 1);
+        for (std::ptrdiff_t i = q; i < count; ++i)
+        {
+            std::uint64_t value = i - q < src_words ? src[i - q] << r : 0;
+            if (r != 0 && i - q >= 1)
+                value |= src[i - q - 1] >> (64 - r);
+            dst[i] |= value;
+        }
+    }
+}
+
+/// \brief Dilates a mask by the rectangle covering columns x - \p left to x + \p right and rows
+/// y - \p top to y + \p bottom, with a pass along the rows and a pass along the columns.
+///
+/// Each pass ORs windows of doubling length, so a window of length n costs about log2(n) word
+/// operations per 64 pixels.
+/// \param rows - Words of the \p height rows of the mask, replaced with the result.
+inline void binary_dilate_rectangle(
+    std::vector<std::uint64_t>& rows,
+    std::ptrdiff_t width,
+    std::ptrdiff_t height,
+    std::ptrdiff_t left,
+    std::ptrdiff_t right,
+    std::ptrdiff_t top,
+    std::ptrdiff_t bottom)
+{
+    std::ptrdiff_t const words = bit_row_words(width);
+    std::uint64_t const last_mask = bit_row_last_mask(width);
+
+    // Windows along the rows, in a row padded so that bit i holds pixel i - left
+    std::ptrdiff_t const columns = left + right + 1;
+    std::ptrdiff_t const padded_words = bit_row_words(width + columns - 1);
+    std::vector<std::uint64_t> padded(static_cast<std::size_t>(padded_words));
+    std::vector<std::uint64_t> previous(padded.size());
+    auto const or_window = [&](std::ptrdiff_t shift)
+    {
+        previous = padded;
+        or_shifted_bits(padded.data(), padded_words, previous.data(), padded_words, shift);
+    };
+    for (std::ptrdiff_t y = 0; y < height && columns > 1; ++y)
+    {
+        std::uint64_t* row = rows.data() + y * words;
+        std::fill(padded.begin(), padded.end(), std::uint64_t(0));
+        or_shifted_bits(padded.data(), padded_words, row, words, -left);
+        std::ptrdiff_t span = 1;
+        for (; 2 * span <= columns; span *= 2)
+            or_window(span);
+        if (span < columns)
+            or_window(columns - span);
+        std::copy(padded.begin(), padded.begin() + words, row);
+        row[words - 1] &= last_mask;
+    }
+
+    // Windows along the columns, in rows padded so that row i holds row i - top
+    std::ptrdiff_t const lines = top + bottom + 1;
+    if (lines == 1)
+        return;
+    std::vector<std::uint64_t> columns_rows(
+        static_cast<std::size_t>((height + lines - 1) * words), std::uint64_t(0));
+    std::copy(rows.begin(), rows.end(), columns_rows.begin() + top * words);
+    std::ptrdiff_t const total = height + lines - 1;
+    auto const or_rows = [&](std::ptrdiff_t shift)
+    {
+        // Row i + shift is only updated after row i
+        std::uint64_t* data = columns_rows.data();
+        for (std::ptrdiff_t i = 0; i + shift < total; ++i)
+        {
+            for (std::ptrdiff_t k = 0; k < words; ++k)
+                data[i * words + k] |= data[(i + shift) * words + k];
+        }
+    };
+    std::ptrdiff_t span = 1;
+    for (; 2 * span <= lines; span *= 2)
+        or_rows(span);
+    if (span < lines)
+        or_rows(lines - span);
+    std::copy(columns_rows.begin(), columns_rows.begin() + height * words, rows.begin());
+}
+
+/// \brief Dilates a mask by any structuring element, ORing a shifted row for each offset
+/// \param offsets - Offsets of the pixels covered by the structuring element.
+inline void binary_dilate_offsets(
+    std::vector<std::uint64_t>& rows,
+    std::ptrdiff_t width,
+    std::ptrdiff_t height,
+    std::vector<point<std::ptrdiff_t>> const& offsets)
+{
+    std::ptrdiff_t const words = bit_row_words(width);
+    std::vector<std::uint64_t> result(rows.size(), std::uint64_t(0));
+    for (std::ptrdiff_t y = 0; y < height; ++y)
+    {
+        std::uint64_t* out = result.data() + y * words;
+        for (auto const& offset : offsets)
+        {
+            // Pixels outside the mask are ignored
+            std::ptrdiff_t const row = y + offset.y;
+            if (row >= 0 && row < height)
+                or_shifted_bits(out, words, rows.data() + row * words, words, offset.x);
+        }
+        out[words - 1] &= bit_row_last_mask(width);
+    }
+    rows.swap(result);
+}
+
+/// \brief Sets the bits of the 8-bit values of a row which are not zero
+inline void pack_bit_row(std::uint8_t const* values, std::ptrdiff_t width, std::uint64_t* words)
+{
+    for (std::ptrdiff_t i = 0; i < bit_row_words(width); ++i)
+    {
+        std::uint8_t const* in = values + 64 * i;
+        std::ptrdiff_t const count = (std::min)(std::ptrdiff_t(64), width - 64 * i);
+        std::uint64_t word = 0;
+#if defined(BOOST_GIL_SIMD_AVX2)
+        if (count == 64)
+        {
+            __m256i const zero = _mm256_setzero_si256();
+            auto const zeros = [&](int k) -> std::uint64_t
+            {
+                __m256i const v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(in + k));
+                return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, zero)));
+            };
+            words[i] = ~(zeros(0) | zeros(32) << 32);
+            continue;
+        }
+#elif defined(BOOST_GIL_SIMD_SSE2)
+        if (count == 64)
+        {
+            __m128i const zero = _mm_setzero_si128();
+            for (int k = 0; k < 64; k += 16)
+            {
+                __m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + k));
+                word |= static_cast<std::uint64_t>(
+                    static_cast<std::uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, zero)))) << k;
+            }
+            words[i] = ~word;
+            continue;
+        }
+#endif
+        for (std::ptrdiff_t k = 0; k < count; ++k)
+            word |= static_cast<std::uint64_t>(in[k] != 0) << k;
+        words[i] = word;
+    }
+}
+
+/// \brief Writes \p on for the set bits of a row and \p off for the cleared ones
+inline void unpack_bit_row(
+    std::uint64_t const* words,
+    std::ptrdiff_t width,
+    std::uint8_t* values,
+    std::uint8_t on,
+    std::uint8_t off)
+{
+    std::ptrdiff_t x = 0;
+#if defined(BOOST_GIL_SIMD_SSE2)
+    // Each byte of the group is compared with the bit selecting its pixel
+    __m128i const bits = _mm_setr_epi8(
+        1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+    __m128i const on_values = _mm_set1_epi8(static_cast<char>(on));
+    __m128i const off_values = _mm_set1_epi8(static_cast<char>(off));
+    for (; x + 16 <= width; x += 16)
+    {
+        unsigned const group = static_cast<unsigned>(words[x / 64] >> (x % 64)) & 0xFFFFu;
+        __m128i const spread = _mm_unpacklo_epi64(
+            _mm_set1_epi8(static_cast<char>(group & 0xFFu)),
+            _mm_set1_epi8(static_cast<char>(group >> 8)));
+        __m128i const set = _mm_cmpeq_epi8(_mm_and_si128(spread, bits), bits);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(values + x),
+            _mm_or_si128(_mm_and_si128(set, on_values), _mm_andnot_si128(set, off_values)));
+    }
+#endif
+    for (; x < width; ++x)
+        values[x] = (words[x / 64] >> (x % 64)) & 1 ? on : off;
+}
+
+/// \brief Sets the bits of the pixels of a row which are not zero
+template <typename Iterator>
+void pack_mask_row(Iterator it, std::ptrdiff_t width, std::uint64_t* words, std::true_type)
+{
+    pack_bit_row(reinterpret_cast<std::uint8_t const*>(&it[0]), width, words);
+}
+
+template <typename Iterator>
+void pack_mask_row(Iterator it, std::ptrdiff_t width, std::uint64_t* words, std::false_type)
+{
+    std::fill(words, words + bit_row_words(width), std::uint64_t(0));
+    for (std::ptrdiff_t x = 0; x < width; ++x)
+    {
+        if (it[x][0] != 0)
+            words[x / 64] |= std::uint64_t(1) << (x % 64);
+    }
+}
+
+/// \brief Writes the largest channel value for the set bits of a row and the smallest one for
+/// the others
+template <typename Iterator>
+void unpack_mask_row(std::uint64_t const* words, std::ptrdiff_t width, Iterator it, std::true_type)
+{
+    unpack_bit_row(words, width, reinterpret_cast<std::uint8_t*>(&it[0]), 255, 0);
+}
+
+template <typename Iterator>
+void unpack_mask_row(
+    std::uint64_t const* words, std::ptrdiff_t width, Iterator it, std::false_type)
+{
+    using pixel_t = typename std::iterator_traits<Iterator>::value_type;
+    using channel_t = typename channel_type<pixel_t>::type;
+    pixel_t const on(channel_traits<channel_t>::max_value());
+    pixel_t const off(channel_traits<channel_t>::min_value());
+    for (std::ptrdiff_t x = 0; x < width; ++x)
+        it[x] = (words[x / 64] >> (x % 64)) & 1 ? on : off;
+}
+
+}}} // namespace boost::gil::detail
+
+#endif
@@ -0,0 +1,37 @@
+//
+// Copyright 2026 Boost.GIL Contributors
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#ifndef BOOST_GIL_DETAIL_BYTE_ROWS_HPP
+#define BOOST_GIL_DETAIL_BYTE_ROWS_HPP
+
+#include <boost/gil/metafunctions.hpp>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace boost { namespace gil { namespace detail {
+
+/// \brief Determines whether a view holds interleaved pixels of 8-bit unsigned channels, whose
+/// rows are arrays of bytes for the vectorized fast paths
+template <typename View>
+struct is_byte_row_view : std::integral_constant<bool,
+    std::is_pointer<typename View::x_iterator>::value &&
+    std::is_same<typename channel_type<View>::type, std::uint8_t>::value>
+{};
+
+/// \brief Determines whether both views are byte row views of the same pixel type, whose rows
+/// can be processed byte by byte
+template <typename SrcView, typename DstView>
+struct is_byte_row_views : std::integral_constant<bool,
+    is_byte_row_view<SrcView>::value &&
+    std::is_pointer<typename DstView::x_iterator>::value &&
+    std::is_same<typename SrcView::value_type, typename DstView::value_type>::value>
+{};
+
+}}} // namespace boost::gil::detail
+
+#endif
@@ -0,0 +1,621 @@
+//
+// Copyright 2026 Boost.GIL Contributors
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#ifndef BOOST_GIL_DETAIL_COLOR_CONVERT_ROW_HPP
+#define BOOST_GIL_DETAIL_COLOR_CONVERT_ROW_HPP
+
+#include <boost/gil/color_convert.hpp>
+#include <boost/gil/gray.hpp>
+#include <boost/gil/pixel.hpp>
+#include <boost/gil/rgb.hpp>
+#include <boost/gil/rgba.hpp>
+#include <boost/gil/utilities.hpp>
+#include <boost/gil/detail/mp11.hpp>
+#include <boost/gil/detail/simd.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace boost { namespace gil { namespace detail {
+
+// Vectorized default_color_converter for rows of interleaved 8-bit gray, RGB and RGBA pixels
+// in any channel order. Blocks of 16 pixels are split into one register per channel (plane),
+// converted and interleaved again. The pixels left at the end of a row are converted by
+// default_color_converter, and the vector code uses the same integer arithmetic,
+// so the results are identical to the generic path.
+
+template <typename ChannelMapping>
+struct channel_offsets;
+
+template <template <typename...> class List, typename... Index>
+struct channel_offsets<List<Index...>>
+{
+    /// Position of the k-th semantic channel within the pixel
+    static auto get(int k) -> int
+    {
+        int const offsets[] = {Index::value...};
+        return offsets[k];
+    }
+};
+
+/// \brief Describes interleaved 8-bit pixels handled by the vectorized color conversion
+template <typename Pixel>
+struct convert_row_pixel_traits
+{
+    static constexpr bool is_supported = false;
+};
+
+template <typename ColorSpace, typename ChannelMapping>
+struct convert_row_pixel_traits<pixel<std::uint8_t, layout<ColorSpace, ChannelMapping>>>
+{
+    using color_space_t = ColorSpace;
+    static constexpr bool is_supported =
+        std::is_same<ColorSpace, gray_t>::value ||
+        std::is_same<ColorSpace, rgb_t>::value ||
+        std::is_same<ColorSpace, rgba_t>::value;
+    static constexpr int num_channels = mp11::mp_size<ColorSpace>::value;
+
+    static auto offset(int k) -> int
+    {
+        return channel_offsets<ChannelMapping>::get(k);
+    }
+};
+
+/// \brief Determines whether rows of \p SrcIterator can be converted to \p DstIterator
+/// with the vectorized default color conversion
+template <typename ColorConverter, typename SrcIterator, typename DstIterator>
+struct is_convert_row_vectorized : std::false_type {};
+
+#if defined(BOOST_GIL_SIMD_SSSE3) || defined(BOOST_GIL_SIMD_NEON)
+template <typename SrcPixel, typename DstPixel>
+struct is_convert_row_vectorized<default_color_converter, SrcPixel*, DstPixel*>
+    : std::integral_constant
+    <
+        bool,
+        convert_row_pixel_traits<typename std::remove_const<SrcPixel>::type>::is_supported &&
+        convert_row_pixel_traits<DstPixel>::is_supported &&
+        !std::is_same<typename std::remove_const<SrcPixel>::type, DstPixel>::value
+    >
+{};
+#endif
+
+/// \brief Converts registers holding one channel of 16 pixels each, in color space order
+template <typename Ops, typename SrcColorSpace, typename DstColorSpace>
+struct convert_planes;
+
+template <typename Ops>
+struct convert_planes<Ops, gray_t, rgb_t>
+{
+    using reg = typename Ops::reg;
+    static void apply(reg const* src, reg* dst)
+    {
+        dst[0] = dst[1] = dst[2] = src[0];
+    }
+};
+
+template <typename Ops>
+struct convert_planes<Ops, gray_t, rgba_t>
+{
+    using reg = typename Ops::reg;
+    static void apply(reg const* src, reg* dst)
+    {
+        dst[0] = dst[1] = dst[2] = src[0];
+        dst[3] = Ops::set1(255);
+    }
+};
+
+template <typename Ops>
+struct convert_planes<Ops, rgb_t, gray_t>
+{
+    using reg = typename Ops::reg;
+    static void apply(reg const* src, reg* dst)
+    {
+        dst[0] = Ops::luma(src[0], src[1], src[2]);
+    }
+};
+
+template <typename Ops>
+struct convert_planes<Ops, rgb_t, rgb_t>
+{
+    using reg = typename Ops::reg;
+    static void apply(reg const* src, reg* dst)
+    {
+        dst[0] = src[0];
+        dst[1] = src[1];
+        dst[2] = src[2];
+    }
+};
+
+template <typename Ops>
+struct convert_planes<Ops, rgb_t, rgba_t>
+{
+    using reg = typename Ops::reg;
+    static void apply(reg const* src, reg* dst)
+    {
+        dst[0] = src[0];
+        dst[1] = src[1];
+        dst[2] = src[2];
+        dst[3] = Ops::set1(255);
+    }
+};
+
+template <typename Ops>
+struct convert_planes<Ops, rgba_t, gray_t>
+{
+    using reg = typename Ops::reg;
+    static void apply(reg const* src, reg* dst)
+    {
+        dst[0] = Ops::luma(
+            Ops::premultiply(src[0], src[3]),
+            Ops::premultiply(src[1], src[3]),
+            Ops::premultiply(src[2], src[3]));
+    }
+};
+
+template <typename Ops>
+struct convert_planes<Ops, rgba_t, rgb_t>
+{
+    using reg = typename Ops::reg;
+    static void apply(reg const* src, reg* dst)
+    {
+        dst[0] = Ops::premultiply(src[0], src[3]);
+        dst[1] = Ops::premultiply(src[1], src[3]);
+        dst[2] = Ops::premultiply(src[2], src[3]);
+    }
+};
+
+template <typename Ops>
+struct convert_planes<Ops, rgba_t, rgba_t>
+{
+    using reg = typename Ops::reg;
+    static void apply(reg const* src, reg* dst)
+    {
+        dst[0] = src[0];
+        dst[1] = src[1];
+        dst[2] = src[2];
+        dst[3] = src[3];
+    }
+};
+
+#if defined(BOOST_GIL_SIMD_SSSE3)
+
+/// \brief Shuffle masks splitting 16 interleaved pixels into channel planes and back
+///
+/// A block of 16 pixels with N channels occupies N chunks of 16 bytes.
+/// Plane c is gathered from all chunks, chunk k is gathered from all planes.
+template <typename Pixel>
+struct convert_row_masks
+{
+    using traits_t = convert_row_pixel_traits<Pixel>;
+    static constexpr int n = traits_t::num_channels;
+
+    convert_row_masks()
+    {
+        for (int c = 0; c < n; ++c)
+        {
+            int const offset = traits_t::offset(c);
+            for (int k = 0; k < n; ++k)
+            {
+                for (int j = 0; j < 16; ++j)
+                {
+                    // byte j of plane c comes from byte (n * j + offset) of the block
+                    int const from = n * j + offset;
+                    deinterleave[c][k][j] = static_cast<std::uint8_t>(from / 16 == k ? from % 16 : 0x80);
+
+                    // byte (16 * k + j) of the block comes from pixel to / n of its channel plane
+                    int const to = 16 * k + j;
+                    interleave[k][c][j] = static_cast<std::uint8_t>(to % n == offset ? to / n : 0x80);
+                }
+            }
+        }
+    }
+
+    alignas(16) std::uint8_t deinterleave[4][4][16] = {}; // [plane][chunk][byte]
+    alignas(16) std::uint8_t interleave[4][4][16] = {};   // [chunk][plane][byte]
+};
+
+/// \brief SSSE3 operations on registers holding 16 pixels
+struct convert_row_sse_ops
+{
+    using reg = __m128i;
+    static constexpr std::ptrdiff_t blocks = 1;
+
+    static auto load(std::uint8_t const* p, std::ptrdiff_t /*block_size*/) -> reg
+    {
+        return _mm_loadu_si128(reinterpret_cast<__m128i const*>(p));
+    }
+
+    static void store(std::uint8_t* p, std::ptrdiff_t /*block_size*/, reg v)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+    }
+
+    static auto load_mask(std::uint8_t const* mask) -> reg
+    {
+        return _mm_load_si128(reinterpret_cast<__m128i const*>(mask));
+    }
+
+    static auto shuffle_or(reg result, reg v, reg mask) -> reg
+    {
+        return _mm_or_si128(result, _mm_shuffle_epi8(v, mask));
+    }
+
+    static auto shuffle(reg v, reg mask) -> reg
+    {
+        return _mm_shuffle_epi8(v, mask);
+    }
+
+    static auto set1(std::uint8_t v) -> reg
+    {
+        return _mm_set1_epi8(static_cast<char>(v));
+    }
+
+    // (r * 4915 + g * 9667 + b * 1802 + 8192) >> 14 of 8 pixels with 16-bit channels
+    static auto luma8(reg r, reg g, reg b) -> reg
+    {
+        __m128i const rg_weights = _mm_set1_epi32(4915 | (9667 << 16));
+        __m128i const b_weights = _mm_set1_epi32(1802 | (8192 << 16));
+        __m128i const one = _mm_set1_epi16(1);
+        __m128i const lo = _mm_add_epi32(
+            _mm_madd_epi16(_mm_unpacklo_epi16(r, g), rg_weights),
+            _mm_madd_epi16(_mm_unpacklo_epi16(b, one), b_weights));
+        __m128i const hi = _mm_add_epi32(
+            _mm_madd_epi16(_mm_unpackhi_epi16(r, g), rg_weights),
+            _mm_madd_epi16(_mm_unpackhi_epi16(b, one), b_weights));
+        return _mm_packs_epi32(_mm_srli_epi32(lo, 14), _mm_srli_epi32(hi, 14));
+    }
+
+    static auto luma(reg r, reg g, reg b) -> reg
+    {
+        __m128i const zero = _mm_setzero_si128();
+        return _mm_packus_epi16(
+            luma8(_mm_unpacklo_epi8(r, zero), _mm_unpacklo_epi8(g, zero), _mm_unpacklo_epi8(b, zero)),
+            luma8(_mm_unpackhi_epi8(r, zero), _mm_unpackhi_epi8(g, zero), _mm_unpackhi_epi8(b, zero)));
+    }
+
+    // div255(c * a) of 8 pixels with 16-bit channels, see channel_multiplier_unsigned<uint8_t>
+    static auto multiply8(reg c, reg a) -> reg
+    {
+        __m128i const t = _mm_add_epi16(_mm_mullo_epi16(c, a), _mm_set1_epi16(128));
+        return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+    }
+
+    static auto premultiply(reg c, reg a) -> reg
+    {
+        __m128i const zero = _mm_setzero_si128();
+        return _mm_packus_epi16(
+            multiply8(_mm_unpacklo_epi8(c, zero), _mm_unpacklo_epi8(a, zero)),
+            multiply8(_mm_unpackhi_epi8(c, zero), _mm_unpackhi_epi8(a, zero)));
+    }
+};
+
+#if defined(BOOST_GIL_SIMD_AVX2)
+
+/// \brief AVX2 operations on registers holding two blocks of 16 pixels, one per 128-bit lane
+///
+/// All shuffles and pack/unpack operations stay within the lanes, so the masks and the
+/// arithmetic of convert_row_sse_ops apply to each lane unchanged.
+struct convert_row_avx2_ops
+{
+    using reg = __m256i;
+    static constexpr std::ptrdiff_t blocks = 2;
+
+    static auto load(std::uint8_t const* p, std::ptrdiff_t block_size) -> reg
+    {
+        return _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const*>(p))),
+            _mm_loadu_si128(reinterpret_cast<__m128i const*>(p + block_size)),
+            1);
+    }
+
+    static void store(std::uint8_t* p, std::ptrdiff_t block_size, reg v)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm256_castsi256_si128(v));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p + block_size), _mm256_extracti128_si256(v, 1));
+    }
+
+    static auto load_mask(std::uint8_t const* mask) -> reg
+    {
+        return _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<__m128i const*>(mask)));
+    }
+
+    static auto shuffle_or(reg result, reg v, reg mask) -> reg
+    {
+        return _mm256_or_si256(result, _mm256_shuffle_epi8(v, mask));
+    }
+
+    static auto shuffle(reg v, reg mask) -> reg
+    {
+        return _mm256_shuffle_epi8(v, mask);
+    }
+
+    static auto set1(std::uint8_t v) -> reg
+    {
+        return _mm256_set1_epi8(static_cast<char>(v));
+    }
+
+    static auto luma8(reg r, reg g, reg b) -> reg
+    {
+        __m256i const rg_weights = _mm256_set1_epi32(4915 | (9667 << 16));
+        __m256i const b_weights = _mm256_set1_epi32(1802 | (8192 << 16));
+        __m256i const one = _mm256_set1_epi16(1);
+        __m256i const lo = _mm256_add_epi32(
+            _mm256_madd_epi16(_mm256_unpacklo_epi16(r, g), rg_weights),
+            _mm256_madd_epi16(_mm256_unpacklo_epi16(b, one), b_weights));
+        __m256i const hi = _mm256_add_epi32(
+            _mm256_madd_epi16(_mm256_unpackhi_epi16(r, g), rg_weights),
+            _mm256_madd_epi16(_mm256_unpackhi_epi16(b, one), b_weights));
+        return _mm256_packs_epi32(_mm256_srli_epi32(lo, 14), _mm256_srli_epi32(hi, 14));
+    }
+
+    static auto luma(reg r, reg g, reg b) -> reg
+    {
+        __m256i const zero = _mm256_setzero_si256();
+        return _mm256_packus_epi16(
+            luma8(_mm256_unpacklo_epi8(r, zero), _mm256_unpacklo_epi8(g, zero), _mm256_unpacklo_epi8(b, zero)),
+            luma8(_mm256_unpackhi_epi8(r, zero), _mm256_unpackhi_epi8(g, zero), _mm256_unpackhi_epi8(b, zero)));
+    }
+
+    static auto multiply8(reg c, reg a) -> reg
+    {
+        __m256i const t = _mm256_add_epi16(_mm256_mullo_epi16(c, a), _mm256_set1_epi16(128));
+        return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+    }
+
+    static auto premultiply(reg c, reg a) -> reg
+    {
+        __m256i const zero = _mm256_setzero_si256();
+        return _mm256_packus_epi16(
+            multiply8(_mm256_unpacklo_epi8(c, zero), _mm256_unpacklo_epi8(a, zero)),
+            multiply8(_mm256_unpackhi_epi8(c, zero), _mm256_unpackhi_epi8(a, zero)));
+    }
+};
+
+#endif // BOOST_GIL_SIMD_AVX2
+
+/// \brief Converts the leading blocks of a row, returns the number of converted pixels
+template <typename Ops, typename SrcPixel, typename DstPixel>
+auto convert_row_blocks(std::uint8_t const* src, std::uint8_t* dst, std::ptrdiff_t count)
+    -> std::ptrdiff_t
+{
+    using reg = typename Ops::reg;
+    using src_traits_t = convert_row_pixel_traits<SrcPixel>;
+    using dst_traits_t = convert_row_pixel_traits<DstPixel>;
+    using converter_t = convert_planes
+        <
+            Ops, typename src_traits_t::color_space_t, typename dst_traits_t::color_space_t
+        >;
+    constexpr int src_n = src_traits_t::num_channels;
+    constexpr int dst_n = dst_traits_t::num_channels;
+    constexpr std::ptrdiff_t src_block = 16 * src_n;
+    constexpr std::ptrdiff_t dst_block = 16 * dst_n;
+    constexpr std::ptrdiff_t step = 16 * Ops::blocks;
+
+    static convert_row_masks<SrcPixel> const src_masks;
+    static convert_row_masks<DstPixel> const dst_masks;
+
+    std::ptrdiff_t i = 0;
+    for (; i + step <= count; i += step)
+    {
+        reg chunks[4];
+        reg src_planes[4];
+        reg dst_planes[4];
+
+        // All chunks are loaded before any is stored, so in-place conversion is safe
+        for (int k = 0; k < src_n; ++k)
+            chunks[k] = Ops::load(src + i * src_n + 16 * k, src_block);
+        if (src_n == 1)
+        {
+            src_planes[0] = chunks[0];
+        }
+        else
+        {
+            for (int c = 0; c < src_n; ++c)
+            {
+                src_planes[c] = Ops::shuffle(chunks[0], Ops::load_mask(src_masks.deinterleave[c][0]));
+                for (int k = 1; k < src_n; ++k)
+                    src_planes[c] = Ops::shuffle_or(
+                        src_planes[c], chunks[k], Ops::load_mask(src_masks.deinterleave[c][k]));
+            }
+        }
+
+        converter_t::apply(src_planes, dst_planes);
+
+        if (dst_n == 1)
+        {
+            Ops::store(dst + i * dst_n, dst_block, dst_planes[0]);
+        }
+        else
+        {
+            for (int k = 0; k < dst_n; ++k)
+            {
+                reg chunk = Ops::shuffle(dst_planes[0], Ops::load_mask(dst_masks.interleave[k][0]));
+                for (int c = 1; c < dst_n; ++c)
+                    chunk = Ops::shuffle_or(chunk, dst_planes[c], Ops::load_mask(dst_masks.interleave[k][c]));
+                Ops::store(dst + i * dst_n + 16 * k, dst_block, chunk);
+            }
+        }
+    }
+    return i;
+}
+
+#endif // BOOST_GIL_SIMD_SSSE3
+
+#if defined(BOOST_GIL_SIMD_NEON)
+
+/// \brief NEON operations on registers holding 16 pixels
+struct convert_row_neon_ops
+{
+    using reg = uint8x16_t;
+
+    static auto set1(std::uint8_t v) -> reg
+    {
+        return vdupq_n_u8(v);
+    }
+
+    // (r * 4915 + g * 9667 + b * 1802 + 8192) >> 14 of 4 pixels
+    static auto luma4(uint16x4_t r, uint16x4_t g, uint16x4_t b) -> uint16x4_t
+    {
+        uint32x4_t const sum = vmlal_n_u16(vmlal_n_u16(vmull_n_u16(r, 4915), g, 9667), b, 1802);
+        return vshrn_n_u32(vaddq_u32(sum, vdupq_n_u32(8192)), 14);
+    }
+
+    static auto luma8(uint8x8_t r, uint8x8_t g, uint8x8_t b) -> uint8x8_t
+    {
+        uint16x8_t const r16 = vmovl_u8(r);
+        uint16x8_t const g16 = vmovl_u8(g);
+        uint16x8_t const b16 = vmovl_u8(b);
+        return vmovn_u16(vcombine_u16(
+            luma4(vget_low_u16(r16), vget_low_u16(g16), vget_low_u16(b16)),
+            luma4(vget_high_u16(r16), vget_high_u16(g16), vget_high_u16(b16))));
+    }
+
+    static auto luma(reg r, reg g, reg b) -> reg
+    {
+        return vcombine_u8(
+            luma8(vget_low_u8(r), vget_low_u8(g), vget_low_u8(b)),
+            luma8(vget_high_u8(r), vget_high_u8(g), vget_high_u8(b)));
+    }
+
+    // div255(c * a) of 8 pixels, see channel_multiplier_unsigned<uint8_t>
+    static auto multiply8(uint8x8_t c, uint8x8_t a) -> uint8x8_t
+    {
+        uint16x8_t const t = vaddq_u16(vmull_u8(c, a), vdupq_n_u16(128));
+        return vshrn_n_u16(vaddq_u16(t, vshrq_n_u16(t, 8)), 8);
+    }
+
+    static auto premultiply(reg c, reg a) -> reg
+    {
+        return vcombine_u8(
+            multiply8(vget_low_u8(c), vget_low_u8(a)),
+            multiply8(vget_high_u8(c), vget_high_u8(a)));
+    }
+};
+
+template <int N>
+struct convert_row_neon_memory;
+
+template <>
+struct convert_row_neon_memory<1>
+{
+    static void load(std::uint8_t const* p, uint8x16_t* v) { v[0] = vld1q_u8(p); }
+    static void store(std::uint8_t* p, uint8x16_t const* v) { vst1q_u8(p, v[0]); }
+};
+
+template <>
+struct convert_row_neon_memory<3>
+{
+    static void load(std::uint8_t const* p, uint8x16_t* v)
+    {
+        uint8x16x3_t const t = vld3q_u8(p);
+        v[0] = t.val[0];
+        v[1] = t.val[1];
+        v[2] = t.val[2];
+    }
+
+    static void store(std::uint8_t* p, uint8x16_t const* v)
+    {
+        uint8x16x3_t t;
+        t.val[0] = v[0];
+        t.val[1] = v[1];
+        t.val[2] = v[2];
+        vst3q_u8(p, t);
+    }
+};
+
+template <>
+struct convert_row_neon_memory<4>
+{
+    static void load(std::uint8_t const* p, uint8x16_t* v)
+    {
+        uint8x16x4_t const t = vld4q_u8(p);
+        v[0] = t.val[0];
+        v[1] = t.val[1];
+        v[2] = t.val[2];
+        v[3] = t.val[3];
+    }
+
+    static void store(std::uint8_t* p, uint8x16_t const* v)
+    {
+        uint8x16x4_t t;
+        t.val[0] = v[0];
+        t.val[1] = v[1];
+        t.val[2] = v[2];
+        t.val[3] = v[3];
+        vst4q_u8(p, t);
+    }
+};
+
+/// \brief Converts the leading blocks of a row, returns the number of converted pixels
+template <typename SrcPixel, typename DstPixel>
+auto convert_row_blocks_neon(std::uint8_t const* src, std::uint8_t* dst, std::ptrdiff_t count)
+    -> std::ptrdiff_t
+{
+    using src_traits_t = convert_row_pixel_traits<SrcPixel>;
+    using dst_traits_t = convert_row_pixel_traits<DstPixel>;
+    using converter_t = convert_planes
+        <
+            convert_row_neon_ops,
+            typename src_traits_t::color_space_t,
+            typename dst_traits_t::color_space_t
+        >;
+    constexpr int src_n = src_traits_t::num_channels;
+    constexpr int dst_n = dst_traits_t::num_channels;
+
+    std::ptrdiff_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        // vld3q_u8/vld4q_u8 split the channels in memory order
+        uint8x16_t channels[4];
+        uint8x16_t src_planes[4];
+        uint8x16_t dst_planes[4];
+        convert_row_neon_memory<src_n>::load(src + i * src_n, channels);
+        for (int c = 0; c < src_n; ++c)
+            src_planes[c] = channels[src_traits_t::offset(c)];
+
+        converter_t::apply(src_planes, dst_planes);
+
+        for (int c = 0; c < dst_n; ++c)
+            channels[dst_traits_t::offset(c)] = dst_planes[c];
+        convert_row_neon_memory<dst_n>::store(dst + i * dst_n, channels);
+    }
+    return i;
+}
+
+#endif // BOOST_GIL_SIMD_NEON
+
+/// \brief Converts \p count pixels with default_color_converter, using vector instructions
+/// for all but the last few pixels.
+/// Requires is_convert_row_vectorized<default_color_converter, SrcPixel const*, DstPixel*>.
+template <typename SrcPixel, typename DstPixel>
+void convert_row(SrcPixel const* src, DstPixel* dst, std::ptrdiff_t count)
+{
+    std::ptrdiff_t i = 0;
+#if defined(BOOST_GIL_SIMD_SSSE3)
+    auto const src_bytes = reinterpret_cast<std::uint8_t const*>(src);
+    auto const dst_bytes = reinterpret_cast<std::uint8_t*>(dst);
+    constexpr int src_n = convert_row_pixel_traits<SrcPixel>::num_channels;
+    constexpr int dst_n = convert_row_pixel_traits<DstPixel>::num_channels;
+#if defined(BOOST_GIL_SIMD_AVX2)
+    i = convert_row_blocks<convert_row_avx2_ops, SrcPixel, DstPixel>(src_bytes, dst_bytes, count);
+#endif
+    i += convert_row_blocks<convert_row_sse_ops, SrcPixel, DstPixel>(
+        src_bytes + i * src_n, dst_bytes + i * dst_n, count - i);
+#elif defined(BOOST_GIL_SIMD_NEON)
+    i = convert_row_blocks_neon<SrcPixel, DstPixel>(
+        reinterpret_cast<std::uint8_t const*>(src), reinterpret_cast<std::uint8_t*>(dst), count);
+#endif
+
+    default_color_converter cc;
+    for (; i < count; ++i)
+        cc(src[i], dst[i]);
+}
+
+}}} // namespace boost::gil::detail
+
+#endif
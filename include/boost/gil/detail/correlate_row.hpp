@@ -0,0 +1,311 @@
+//
+// Copyright 2026 Boost.GIL Contributors
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#ifndef BOOST_GIL_DETAIL_CORRELATE_ROW_HPP
+#define BOOST_GIL_DETAIL_CORRELATE_ROW_HPP
+
+#include <boost/gil/channel.hpp>
+#include <boost/gil/pixel.hpp>
+#include <boost/gil/pixel_numeric_operations.hpp>
+#include <boost/gil/detail/mp11.hpp>
+#include <boost/gil/detail/simd.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace boost { namespace gil { namespace detail {
+
+// Vectorized 1D cross-correlation of rows of interleaved float pixels.
+//
+// A row of N-channel float pixels is a flat array of floats, and channel c of output pixel x
+// is the sum over the kernel taps k of src[(x + k) * N + c] * kernel[k]. The same expression
+// computes all channels when the flat index is used instead of (x, c), with the taps N floats
+// apart, so the vector code does not depend on the number of channels nor on their order.
+// Each output value is accumulated tap by tap in kernel order, like the generic
+// correlate_pixels_n, using the same single precision multiplications and additions.
+
+/// \brief Determines whether \p Channel is stored as a single float, like float32_t
+template <typename Channel>
+struct is_float_channel : std::is_same<Channel, float> {};
+
+template <typename MinVal, typename MaxVal>
+struct is_float_channel<scoped_channel_value<float, MinVal, MaxVal>> : std::true_type {};
+
+/// \brief Determines whether \p Iterator points to contiguous float channels
+template
+<
+    typename Iterator,
+    typename Value = typename std::iterator_traits<Iterator>::value_type
+>
+struct is_contiguous_float_iterator
+    : std::integral_constant
+    <
+        bool,
+        is_float_channel<Value>::value &&
+        (std::is_pointer<Iterator>::value ||
+         std::is_same<Iterator, typename std::vector<Value>::iterator>::value ||
+         std::is_same<Iterator, typename std::vector<Value>::const_iterator>::value)
+    >
+{};
+
+/// \brief Determines whether rows of \p SrcIterator can be correlated with kernels
+/// of \p KernelIterator by correlate_row, accumulating in \p PixelAccum
+template <typename PixelAccum, typename SrcIterator, typename KernelIterator>
+struct is_correlate_row_vectorized : std::false_type {};
+
+template <typename Channel, typename Layout, typename SrcPixel, typename KernelIterator>
+struct is_correlate_row_vectorized<pixel<Channel, Layout>, SrcPixel*, KernelIterator>
+    : std::integral_constant
+    <
+        bool,
+        is_float_channel<Channel>::value &&
+        std::is_same<typename std::remove_const<SrcPixel>::type, pixel<Channel, Layout>>::value &&
+        mp11::mp_size<typename Layout::color_space_t>::value <= 4 &&
+        is_contiguous_float_iterator<KernelIterator>::value
+    >
+{};
+
+#if defined(BOOST_GIL_SIMD_SSE2)
+struct correlate_row_sse_ops
+{
+    using reg_t = __m128;
+    static constexpr std::ptrdiff_t width = 4;
+
+    static auto zero() -> reg_t { return _mm_setzero_ps(); }
+    static auto set1(float v) -> reg_t { return _mm_set1_ps(v); }
+    static auto load(float const* p) -> reg_t { return _mm_loadu_ps(p); }
+    static void store(float* p, reg_t v) { _mm_storeu_ps(p, v); }
+    static auto multiply_add(reg_t acc, reg_t a, reg_t b) -> reg_t
+    {
+        return _mm_add_ps(acc, _mm_mul_ps(a, b));
+    }
+};
+#endif
+
+#if defined(BOOST_GIL_SIMD_AVX2)
+struct correlate_row_avx_ops
+{
+    using reg_t = __m256;
+    static constexpr std::ptrdiff_t width = 8;
+
+    static auto zero() -> reg_t { return _mm256_setzero_ps(); }
+    static auto set1(float v) -> reg_t { return _mm256_set1_ps(v); }
+    static auto load(float const* p) -> reg_t { return _mm256_loadu_ps(p); }
+    static void store(float* p, reg_t v) { _mm256_storeu_ps(p, v); }
+    static auto multiply_add(reg_t acc, reg_t a, reg_t b) -> reg_t
+    {
+        return _mm256_add_ps(acc, _mm256_mul_ps(a, b));
+    }
+};
+#endif
+
+#if defined(BOOST_GIL_SIMD_NEON)
+struct correlate_row_neon_ops
+{
+    using reg_t = float32x4_t;
+    static constexpr std::ptrdiff_t width = 4;
+
+    static auto zero() -> reg_t { return vdupq_n_f32(0.0f); }
+    static auto set1(float v) -> reg_t { return vdupq_n_f32(v); }
+    static auto load(float const* p) -> reg_t { return vld1q_f32(p); }
+    static void store(float* p, reg_t v) { vst1q_f32(p, v); }
+    static auto multiply_add(reg_t acc, reg_t a, reg_t b) -> reg_t
+    {
+        // not vmlaq_f32, which may be fused and round differently
+        return vaddq_f32(acc, vmulq_f32(a, b));
+    }
+};
+#endif
+
+/// \brief Kernel taps of a correlation of flat float rows.
+/// Value i of the result is the sum, in row-major kernel order, of
+/// rows[r][i + c * tap_stride] * kernel[r * width + c], for the \p height kernel rows
+/// and \p width kernel columns.
+struct float_taps
+{
+    float const* const* rows;
+    std::size_t height;
+    float const* kernel;
+    std::size_t width;
+    std::ptrdiff_t tap_stride;
+};
+
+/// \brief Computes the first values of \p dst, in blocks of four and one vector registers,
+/// and returns how many were computed. Values are read from \p offset in the rows.
+template <typename Ops>
+auto correlate_row_blocks(
+    float_taps const& taps,
+    std::ptrdiff_t offset,
+    float* dst,
+    std::ptrdiff_t count) -> std::ptrdiff_t
+{
+    using reg_t = typename Ops::reg_t;
+    constexpr std::ptrdiff_t w = Ops::width;
+
+    std::ptrdiff_t i = 0;
+    for (; i + 4 * w <= count; i += 4 * w)
+    {
+        reg_t acc0 = Ops::zero();
+        reg_t acc1 = Ops::zero();
+        reg_t acc2 = Ops::zero();
+        reg_t acc3 = Ops::zero();
+        float const* weight = taps.kernel;
+        for (std::size_t r = 0; r < taps.height; ++r)
+        {
+            float const* s = taps.rows[r] + offset + i;
+            for (std::size_t c = 0; c < taps.width; ++c, ++weight, s += taps.tap_stride)
+            {
+                reg_t const k = Ops::set1(*weight);
+                acc0 = Ops::multiply_add(acc0, Ops::load(s), k);
+                acc1 = Ops::multiply_add(acc1, Ops::load(s + w), k);
+                acc2 = Ops::multiply_add(acc2, Ops::load(s + 2 * w), k);
+                acc3 = Ops::multiply_add(acc3, Ops::load(s + 3 * w), k);
+            }
+        }
+        Ops::store(dst + i, acc0);
+        Ops::store(dst + i + w, acc1);
+        Ops::store(dst + i + 2 * w, acc2);
+        Ops::store(dst + i + 3 * w, acc3);
+    }
+    for (; i + w <= count; i += w)
+    {
+        reg_t acc = Ops::zero();
+        float const* weight = taps.kernel;
+        for (std::size_t r = 0; r < taps.height; ++r)
+        {
+            float const* s = taps.rows[r] + offset + i;
+            for (std::size_t c = 0; c < taps.width; ++c, ++weight, s += taps.tap_stride)
+                acc = Ops::multiply_add(acc, Ops::load(s), Ops::set1(*weight));
+        }
+        Ops::store(dst + i, acc);
+    }
+    return i;
+}
+
+/// \brief Correlates \p count values, read from \p offset in the rows of \p taps
+inline void correlate_row_values(
+    float_taps const& taps,
+    std::ptrdiff_t offset,
+    float* dst,
+    std::ptrdiff_t count)
+{
+    std::ptrdiff_t i = 0;
+#if defined(BOOST_GIL_SIMD_AVX2)
+    i = correlate_row_blocks<correlate_row_avx_ops>(taps, offset, dst, count);
+#endif
+#if defined(BOOST_GIL_SIMD_SSE2)
+    i += correlate_row_blocks<correlate_row_sse_ops>(taps, offset + i, dst + i, count - i);
+#elif defined(BOOST_GIL_SIMD_NEON)
+    i = correlate_row_blocks<correlate_row_neon_ops>(taps, offset, dst, count);
+#endif
+
+    for (; i < count; ++i)
+    {
+        float acc = 0.0f;
+        float const* weight = taps.kernel;
+        for (std::size_t r = 0; r < taps.height; ++r)
+        {
+            float const* s = taps.rows[r] + offset + i;
+            for (std::size_t c = 0; c < taps.width; ++c, ++weight, s += taps.tap_stride)
+                acc += *s * *weight;
+        }
+        dst[i] = acc;
+    }
+}
+
+/// \brief Writes correlated pixels of the accumulator type directly to the destination
+template <typename PixelAccum>
+void correlate_row_store(float_taps const& taps, PixelAccum* dst_begin, std::ptrdiff_t count)
+{
+    constexpr std::ptrdiff_t n = num_channels<PixelAccum>::value;
+    correlate_row_values(taps, 0, reinterpret_cast<float*>(dst_begin), count * n);
+}
+
+/// \brief Correlates blocks of pixels to a buffer and assigns them to the destination,
+/// which may have a different pixel type or be planar
+template <typename PixelAccum, typename DstIterator>
+void correlate_row_store(float_taps const& taps, DstIterator dst_begin, std::ptrdiff_t count)
+{
+    using dst_value_t = typename std::iterator_traits<DstIterator>::value_type;
+    constexpr std::ptrdiff_t n = num_channels<PixelAccum>::value;
+    constexpr std::ptrdiff_t block_size = 256;
+
+    PixelAccum block[block_size];
+    for (std::ptrdiff_t x = 0; x < count; x += block_size)
+    {
+        std::ptrdiff_t const block_count = (std::min)(block_size, count - x);
+        correlate_row_values(taps, x * n, reinterpret_cast<float*>(block), block_count * n);
+        for (std::ptrdiff_t i = 0; i < block_count; ++i, ++dst_begin)
+        {
+            dst_value_t value;
+            pixel_assigns_t<PixelAccum, dst_value_t>()(block[i], value);
+            *dst_begin = value;
+        }
+    }
+}
+
+/// \brief Correlates \p count pixels whose kernel taps are \p tap_stride pixels apart in \p src,
+/// like the pixels of a row (\p tap_stride of 1) or of the rows of a buffer (the buffer width).
+/// Requires is_correlate_row_vectorized<PixelAccum, PixelAccum const*, KernelIterator>.
+template <typename PixelAccum, typename KernelIterator, typename DstIterator>
+void correlate_taps(
+    PixelAccum const* src,
+    std::ptrdiff_t tap_stride,
+    KernelIterator kernel_begin,
+    std::size_t kernel_size,
+    DstIterator dst_begin,
+    std::ptrdiff_t count)
+{
+    constexpr std::ptrdiff_t n = num_channels<PixelAccum>::value;
+    float const* const row = reinterpret_cast<float const*>(src);
+    float_taps const taps{
+        &row, 1, reinterpret_cast<float const*>(&*kernel_begin), kernel_size, tap_stride * n};
+    correlate_row_store<PixelAccum>(taps, dst_begin, count);
+}
+
+/// \brief Correlates \p count pixels with a 2D kernel of \p kernel_height rows, stored in
+/// row-major order, pixel x being computed from the pixels starting at x in each of \p rows.
+/// Requires is_correlate_row_vectorized<PixelAccum, PixelAccum const*, KernelIterator>.
+template <typename PixelAccum, typename KernelIterator, typename DstIterator>
+void correlate_taps_2d(
+    float const* const* rows,
+    std::size_t kernel_height,
+    KernelIterator kernel_begin,
+    std::size_t kernel_width,
+    DstIterator dst_begin,
+    std::ptrdiff_t count)
+{
+    constexpr std::ptrdiff_t n = num_channels<PixelAccum>::value;
+    float_taps const taps{
+        rows, kernel_height, reinterpret_cast<float const*>(&*kernel_begin), kernel_width, n};
+    correlate_row_store<PixelAccum>(taps, dst_begin, count);
+}
+
+/// \brief 1D un-guarded cross-correlation of interleaved float pixels.
+/// Requires is_correlate_row_vectorized<PixelAccum, SrcIterator, KernelIterator>.
+template <typename PixelAccum, typename SrcIterator, typename KernelIterator, typename DstIterator>
+auto correlate_row(
+    SrcIterator src_begin,
+    SrcIterator src_end,
+    KernelIterator kernel_begin,
+    std::size_t kernel_size,
+    DstIterator dst_begin) -> DstIterator
+{
+    std::ptrdiff_t const count = src_end - src_begin;
+    if (count <= 0)
+        return dst_begin;
+
+    correlate_taps<PixelAccum>(&*src_begin, 1, kernel_begin, kernel_size, dst_begin, count);
+    return dst_begin + count;
+}
+
+}}} // namespace boost::gil::detail
+
+#endif
@@ -0,0 +1,307 @@
+//
+// Copyright 2026 Boost.GIL Contributors
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#ifndef BOOST_GIL_DETAIL_DIFFUSION_ROW_HPP
+#define BOOST_GIL_DETAIL_DIFFUSION_ROW_HPP
+
+#include <boost/gil/detail/simd.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace boost { namespace gil { namespace detail {
+
+// Vectorized anisotropic diffusion of rows of interleaved float pixels.
+//
+// The image is a flat array of floats padded with a pixel of zeros on each side, so that the
+// neighbours of channel c of every pixel are the floats one pixel and one padded row apart,
+// and a row is diffused without bounds checks nor dependence on the number of channels.
+// The vector and the scalar code are the same templates over the register operations, so
+// that the values do not depend on where the vectors of a row end.
+
+/// \brief Scalar operations, which diffuse the values past the last vector of a row
+struct diffusion_row_scalar_ops
+{
+    using reg_t = float;
+    static constexpr std::ptrdiff_t width = 1;
+
+    static auto set1(float v) -> reg_t { return v; }
+    static auto load(float const* p) -> reg_t { return *p; }
+    static void store(float* p, reg_t v) { *p = v; }
+    static auto add(reg_t a, reg_t b) -> reg_t { return a + b; }
+    static auto sub(reg_t a, reg_t b) -> reg_t { return a - b; }
+    static auto mul(reg_t a, reg_t b) -> reg_t { return a * b; }
+    static auto div(reg_t a, reg_t b) -> reg_t { return a / b; }
+    static auto sqrt(reg_t v) -> reg_t { return std::sqrt(v); }
+    static auto abs(reg_t v) -> reg_t { return std::abs(v); }
+    // b when a is not a number, like minps
+    static auto min(reg_t a, reg_t b) -> reg_t { return a < b ? a : b; }
+    static auto truncate(reg_t v) -> reg_t { return static_cast<float>(static_cast<int>(v)); }
+    // 2^-n of an integer 0 <= n < 127
+    static auto exp2_neg(reg_t n) -> reg_t
+    {
+        std::int32_t const bits = (127 - static_cast<std::int32_t>(n)) * (1 << 23);
+        float result;
+        std::memcpy(&result, &bits, sizeof(result));
+        return result;
+    }
+};
+
+#if defined(BOOST_GIL_SIMD_SSE2)
+struct diffusion_row_sse_ops
+{
+    using reg_t = __m128;
+    static constexpr std::ptrdiff_t width = 4;
+
+    static auto set1(float v) -> reg_t { return _mm_set1_ps(v); }
+    static auto load(float const* p) -> reg_t { return _mm_loadu_ps(p); }
+    static void store(float* p, reg_t v) { _mm_storeu_ps(p, v); }
+    static auto add(reg_t a, reg_t b) -> reg_t { return _mm_add_ps(a, b); }
+    static auto sub(reg_t a, reg_t b) -> reg_t { return _mm_sub_ps(a, b); }
+    static auto mul(reg_t a, reg_t b) -> reg_t { return _mm_mul_ps(a, b); }
+    static auto div(reg_t a, reg_t b) -> reg_t { return _mm_div_ps(a, b); }
+    static auto sqrt(reg_t v) -> reg_t { return _mm_sqrt_ps(v); }
+    static auto abs(reg_t v) -> reg_t { return _mm_andnot_ps(_mm_set1_ps(-0.0f), v); }
+    static auto min(reg_t a, reg_t b) -> reg_t { return _mm_min_ps(a, b); }
+    static auto truncate(reg_t v) -> reg_t { return _mm_cvtepi32_ps(_mm_cvttps_epi32(v)); }
+    static auto exp2_neg(reg_t n) -> reg_t
+    {
+        __m128i const exponent = _mm_sub_epi32(_mm_set1_epi32(127), _mm_cvttps_epi32(n));
+        return _mm_castsi128_ps(_mm_slli_epi32(exponent, 23));
+    }
+};
+#endif
+
+#if defined(BOOST_GIL_SIMD_AVX2)
+struct diffusion_row_avx_ops
+{
+    using reg_t = __m256;
+    static constexpr std::ptrdiff_t width = 8;
+
+    static auto set1(float v) -> reg_t { return _mm256_set1_ps(v); }
+    static auto load(float const* p) -> reg_t { return _mm256_loadu_ps(p); }
+    static void store(float* p, reg_t v) { _mm256_storeu_ps(p, v); }
+    static auto add(reg_t a, reg_t b) -> reg_t { return _mm256_add_ps(a, b); }
+    static auto sub(reg_t a, reg_t b) -> reg_t { return _mm256_sub_ps(a, b); }
+    static auto mul(reg_t a, reg_t b) -> reg_t { return _mm256_mul_ps(a, b); }
+    static auto div(reg_t a, reg_t b) -> reg_t { return _mm256_div_ps(a, b); }
+    static auto sqrt(reg_t v) -> reg_t { return _mm256_sqrt_ps(v); }
+    static auto abs(reg_t v) -> reg_t { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), v); }
+    static auto min(reg_t a, reg_t b) -> reg_t { return _mm256_min_ps(a, b); }
+    static auto truncate(reg_t v) -> reg_t
+    {
+        return _mm256_cvtepi32_ps(_mm256_cvttps_epi32(v));
+    }
+    static auto exp2_neg(reg_t n) -> reg_t
+    {
+        __m256i const exponent =
+            _mm256_sub_epi32(_mm256_set1_epi32(127), _mm256_cvttps_epi32(n));
+        return _mm256_castsi256_ps(_mm256_slli_epi32(exponent, 23));
+    }
+};
+#endif
+
+// Division and square roots of vectors are AArch64 instructions
+#if defined(BOOST_GIL_SIMD_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+struct diffusion_row_neon_ops
+{
+    using reg_t = float32x4_t;
+    static constexpr std::ptrdiff_t width = 4;
+
+    static auto set1(float v) -> reg_t { return vdupq_n_f32(v); }
+    static auto load(float const* p) -> reg_t { return vld1q_f32(p); }
+    static void store(float* p, reg_t v) { vst1q_f32(p, v); }
+    static auto add(reg_t a, reg_t b) -> reg_t { return vaddq_f32(a, b); }
+    static auto sub(reg_t a, reg_t b) -> reg_t { return vsubq_f32(a, b); }
+    static auto mul(reg_t a, reg_t b) -> reg_t { return vmulq_f32(a, b); }
+    static auto div(reg_t a, reg_t b) -> reg_t { return vdivq_f32(a, b); }
+    static auto sqrt(reg_t v) -> reg_t { return vsqrtq_f32(v); }
+    static auto abs(reg_t v) -> reg_t { return vabsq_f32(v); }
+    static auto min(reg_t a, reg_t b) -> reg_t { return vbslq_f32(vcltq_f32(a, b), a, b); }
+    static auto truncate(reg_t v) -> reg_t { return vcvtq_f32_s32(vcvtq_s32_f32(v)); }
+    static auto exp2_neg(reg_t n) -> reg_t
+    {
+        int32x4_t const exponent = vsubq_s32(vdupq_n_s32(127), vcvtq_s32_f32(n));
+        return vreinterpretq_f32_s32(vshlq_n_s32(exponent, 23));
+    }
+};
+#endif
+
+/// \brief Returns exp(-x) for x >= 0, to two units in the last place of float
+///
+/// exp(-x) is 2^-n e^(n ln 2 - x), with n the integer nearest to x / ln 2, so that the second
+/// factor is a short polynomial and the first is the exponent of a float. ln 2 is split into
+/// a short and a small part, whose multiples by n are exact and negligible.
+template <typename Ops>
+auto diffusion_exp_neg(typename Ops::reg_t x) -> typename Ops::reg_t
+{
+    using reg_t = typename Ops::reg_t;
+    reg_t const clamped = Ops::min(x, Ops::set1(87.0f));
+    reg_t const n =
+        Ops::truncate(Ops::add(Ops::mul(clamped, Ops::set1(1.44269504f)), Ops::set1(0.5f)));
+    reg_t const y = Ops::sub(Ops::sub(Ops::mul(n, Ops::set1(0.693359375f)), clamped),
+                             Ops::mul(n, Ops::set1(2.12194440e-4f)));
+    reg_t p = Ops::set1(1.0f / 720);
+    p = Ops::add(Ops::mul(p, y), Ops::set1(1.0f / 120));
+    p = Ops::add(Ops::mul(p, y), Ops::set1(1.0f / 24));
+    p = Ops::add(Ops::mul(p, y), Ops::set1(1.0f / 6));
+    p = Ops::add(Ops::mul(p, y), Ops::set1(1.0f / 2));
+    p = Ops::add(Ops::mul(p, y), Ops::set1(1.0f));
+    p = Ops::add(Ops::mul(p, y), Ops::set1(1.0f));
+    return Ops::mul(p, Ops::exp2_neg(n));
+}
+
+inline float diffusion_exp_neg(float x)
+{
+    return diffusion_exp_neg<diffusion_row_scalar_ops>(x);
+}
+
+/// \brief Conductivities of gradients, given the reciprocal of kappa
+struct diffusion_perona_malik
+{
+    float inv_kappa;
+    template <typename Ops>
+    auto operator()(Ops, typename Ops::reg_t gradient) const -> typename Ops::reg_t
+    {
+        return diffusion_exp_neg<Ops>(Ops::mul(Ops::abs(gradient), Ops::set1(inv_kappa)));
+    }
+};
+
+struct diffusion_gaussian
+{
+    float inv_kappa;
+    template <typename Ops>
+    auto operator()(Ops, typename Ops::reg_t gradient) const -> typename Ops::reg_t
+    {
+        typename Ops::reg_t const value = Ops::mul(gradient, Ops::set1(inv_kappa));
+        return diffusion_exp_neg<Ops>(Ops::mul(value, value));
+    }
+};
+
+struct diffusion_wide_regions
+{
+    float inv_kappa;
+    template <typename Ops>
+    auto operator()(Ops, typename Ops::reg_t gradient) const -> typename Ops::reg_t
+    {
+        typename Ops::reg_t const value = Ops::mul(gradient, Ops::set1(inv_kappa));
+        typename Ops::reg_t const one = Ops::set1(1.0f);
+        return Ops::div(one, Ops::add(one, Ops::mul(value, value)));
+    }
+};
+
+struct diffusion_more_wide_regions
+{
+    float inv_kappa;
+    template <typename Ops>
+    auto operator()(Ops, typename Ops::reg_t gradient) const -> typename Ops::reg_t
+    {
+        typename Ops::reg_t const value = Ops::mul(gradient, Ops::set1(inv_kappa));
+        typename Ops::reg_t const one = Ops::set1(1.0f);
+        return Ops::div(one, Ops::sqrt(Ops::add(one, Ops::mul(value, value))));
+    }
+};
+
+/// \brief Rows of a padded image around the diffused row, whose pixels are \p step floats
+struct diffusion_rows
+{
+    float const* up;
+    float const* row;
+    float const* down;
+    float* out;
+    std::ptrdiff_t step;
+};
+
+/// \brief Returns the flux conductivity(neighbour - center) * (neighbour - center)
+template <typename Ops, typename Conductivity>
+auto diffusion_flux(typename Ops::reg_t center, float const* neighbour, Conductivity const& g)
+    -> typename Ops::reg_t
+{
+    typename Ops::reg_t const gradient = Ops::sub(Ops::load(neighbour), center);
+    return Ops::mul(g(Ops{}, gradient), gradient);
+}
+
+/// \brief Sums the fluxes from the North, East, South and West neighbours
+struct diffusion_stencil_5points
+{
+    float delta_t;
+    template <typename Ops, typename Conductivity>
+    auto operator()(Ops, diffusion_rows const& rows, std::ptrdiff_t i, Conductivity const& g) const
+        -> typename Ops::reg_t
+    {
+        typename Ops::reg_t const c = Ops::load(rows.row + i);
+        typename Ops::reg_t sum = diffusion_flux<Ops>(c, rows.up + i, g);
+        sum = Ops::add(sum, diffusion_flux<Ops>(c, rows.row + i + rows.step, g));
+        sum = Ops::add(sum, diffusion_flux<Ops>(c, rows.down + i, g));
+        sum = Ops::add(sum, diffusion_flux<Ops>(c, rows.row + i - rows.step, g));
+        return Ops::add(c, Ops::mul(sum, Ops::set1(delta_t)));
+    }
+};
+
+/// \brief Adds half the fluxes from the diagonal neighbours to those of the 5 points stencil
+struct diffusion_stencil_9points
+{
+    float delta_t;
+    template <typename Ops, typename Conductivity>
+    auto operator()(Ops, diffusion_rows const& rows, std::ptrdiff_t i, Conductivity const& g) const
+        -> typename Ops::reg_t
+    {
+        std::ptrdiff_t const step = rows.step;
+        typename Ops::reg_t const c = Ops::load(rows.row + i);
+        typename Ops::reg_t sum = diffusion_flux<Ops>(c, rows.up + i, g);
+        sum = Ops::add(sum, diffusion_flux<Ops>(c, rows.row + i + step, g));
+        sum = Ops::add(sum, diffusion_flux<Ops>(c, rows.down + i, g));
+        sum = Ops::add(sum, diffusion_flux<Ops>(c, rows.row + i - step, g));
+        typename Ops::reg_t diagonal = diffusion_flux<Ops>(c, rows.up + i - step, g);
+        diagonal = Ops::add(diagonal, diffusion_flux<Ops>(c, rows.up + i + step, g));
+        diagonal = Ops::add(diagonal, diffusion_flux<Ops>(c, rows.down + i + step, g));
+        diagonal = Ops::add(diagonal, diffusion_flux<Ops>(c, rows.down + i - step, g));
+        sum = Ops::add(sum, Ops::mul(diagonal, Ops::set1(0.5f)));
+        return Ops::add(c, Ops::mul(sum, Ops::set1(delta_t)));
+    }
+};
+
+/// \brief Diffuses the values from \p i in blocks of vector registers and returns the index
+/// of the first value left
+template <typename Ops, typename Stencil, typename Conductivity>
+auto diffusion_row_blocks(
+    diffusion_rows const& rows,
+    std::ptrdiff_t i,
+    std::ptrdiff_t count,
+    Stencil const& stencil,
+    Conductivity const& g) -> std::ptrdiff_t
+{
+    for (; i + Ops::width <= count; i += Ops::width)
+        Ops::store(rows.out + i, stencil(Ops{}, rows, i, g));
+    return i;
+}
+
+/// \brief Diffuses the \p count floats of a padded row into \p rows.out
+template <typename Stencil, typename Conductivity>
+void diffusion_row(
+    diffusion_rows const& rows,
+    std::ptrdiff_t count,
+    Stencil const& stencil,
+    Conductivity const& g)
+{
+    std::ptrdiff_t i = 0;
+#if defined(BOOST_GIL_SIMD_AVX2)
+    i = diffusion_row_blocks<diffusion_row_avx_ops>(rows, i, count, stencil, g);
+#endif
+#if defined(BOOST_GIL_SIMD_SSE2)
+    i = diffusion_row_blocks<diffusion_row_sse_ops>(rows, i, count, stencil, g);
+#elif defined(BOOST_GIL_SIMD_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+    i = diffusion_row_blocks<diffusion_row_neon_ops>(rows, i, count, stencil, g);
+#endif
+    diffusion_row_blocks<diffusion_row_scalar_ops>(rows, i, count, stencil, g);
+}
+
+}}} // namespace boost::gil::detail
+
+#endif
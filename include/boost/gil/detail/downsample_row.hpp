@@ -0,0 +1,429 @@
+//
+// Copyright 2026 Boost.GIL Contributors
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#ifndef BOOST_GIL_DETAIL_DOWNSAMPLE_ROW_HPP
+#define BOOST_GIL_DETAIL_DOWNSAMPLE_ROW_HPP
+
+#include <boost/gil/detail/simd.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace boost { namespace gil { namespace detail {
+
+// Row kernels of the halving of images by averaging blocks of 2x2 pixels.
+//
+// Rows are flat arrays of N interleaved channels. Pixel x of the output averages pixels 2x and
+// 2x + 1 of two source rows channel by channel, rounding integers to nearest with halves up.
+// The vectorized kernels compute the averages of every channel of the source row with its
+// neighbor in the next pixel, then keep the channels of the even pixels: with shuffles of
+// 32-bit lanes for 1, 2 and 4 channels, byte shuffles for 3 channels.
+
+template <typename T>
+inline auto downsample_average(T a, T b, T c, T d, std::true_type /* integral */) -> T
+{
+    using sum_t = typename std::conditional
+        <
+            (sizeof(T) < 4), std::int32_t,
+            typename std::conditional<std::is_signed<T>::value, std::int64_t, std::uint64_t>::type
+        >::type;
+    return static_cast<T>((sum_t(a) + sum_t(b) + sum_t(c) + sum_t(d) + 2) >> 2);
+}
+
+template <typename T>
+inline auto downsample_average(T a, T b, T c, T d, std::false_type /* integral */) -> T
+{
+    return static_cast<T>((a + b + c + d) * T(0.25));
+}
+
+/// \brief Averages four channel values, rounding integers to nearest
+template <typename T>
+inline auto downsample_average(T a, T b, T c, T d) -> T
+{
+    return downsample_average(a, b, c, d, std::is_integral<T>());
+}
+
+/// \brief Fallback for the rows that are not vectorized, which averages no pixel
+template <typename T, std::size_t N>
+inline auto downsample_2x2_row_vectorized(
+    T const*, T const*, T*, std::ptrdiff_t, std::integral_constant<std::size_t, N>)
+    -> std::ptrdiff_t
+{
+    return 0;
+}
+
+#if defined(BOOST_GIL_SIMD_SSE2)
+/// \brief Moves the channels of the even pixels among eight 16-bit values to the lower half
+inline auto downsample_compact(__m128i v, std::integral_constant<std::size_t, 1>) -> __m128i
+{
+    v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(3, 1, 2, 0));
+    v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(3, 1, 2, 0));
+    return _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 1, 2, 0));
+}
+
+inline auto downsample_compact(__m128i v, std::integral_constant<std::size_t, 2>) -> __m128i
+{
+    return _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 1, 2, 0));
+}
+
+inline auto downsample_compact(__m128i v, std::integral_constant<std::size_t, 4>) -> __m128i
+{
+    return v;
+}
+
+/// \brief Averages 16 channels of two rows of 8-bit channels with the channels \p n values
+/// further, as two vectors of 16-bit values
+inline void downsample_average_sse2(
+    std::uint8_t const* row0, std::uint8_t const* row1, std::size_t n, __m128i& lo, __m128i& hi)
+{
+    __m128i const zero = _mm_setzero_si128();
+    __m128i const two = _mm_set1_epi16(2);
+    __m128i const a = _mm_loadu_si128(reinterpret_cast<__m128i const*>(row0));
+    __m128i const b = _mm_loadu_si128(reinterpret_cast<__m128i const*>(row0 + n));
+    __m128i const c = _mm_loadu_si128(reinterpret_cast<__m128i const*>(row1));
+    __m128i const d = _mm_loadu_si128(reinterpret_cast<__m128i const*>(row1 + n));
+    lo = _mm_add_epi16(
+        _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero)),
+        _mm_add_epi16(_mm_unpacklo_epi8(c, zero), _mm_unpacklo_epi8(d, zero)));
+    hi = _mm_add_epi16(
+        _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero)),
+        _mm_add_epi16(_mm_unpackhi_epi8(c, zero), _mm_unpackhi_epi8(d, zero)));
+    lo = _mm_srli_epi16(_mm_add_epi16(lo, two), 2);
+    hi = _mm_srli_epi16(_mm_add_epi16(hi, two), 2);
+}
+
+/// \brief Averages 8 channels of two rows of 16-bit channels with the channels \p n values
+/// further
+///
+/// The sum of four values may not fit 16 bits, so the quotients and the remainders of their
+/// division by 4 are summed separately.
+inline auto downsample_average_sse2(
+    std::uint16_t const* row0, std::uint16_t const* row1, std::size_t n) -> __m128i
+{
+    __m128i const three = _mm_set1_epi16(3);
+    __m128i const two = _mm_set1_epi16(2);
+    __m128i const a = _mm_loadu_si128(reinterpret_cast<__m128i const*>(row0));
+    __m128i const b = _mm_loadu_si128(reinterpret_cast<__m128i const*>(row0 + n));
+    __m128i const c = _mm_loadu_si128(reinterpret_cast<__m128i const*>(row1));
+    __m128i const d = _mm_loadu_si128(reinterpret_cast<__m128i const*>(row1 + n));
+    __m128i const quotients = _mm_add_epi16(
+        _mm_add_epi16(_mm_srli_epi16(a, 2), _mm_srli_epi16(b, 2)),
+        _mm_add_epi16(_mm_srli_epi16(c, 2), _mm_srli_epi16(d, 2)));
+    __m128i const remainders = _mm_add_epi16(
+        _mm_add_epi16(_mm_and_si128(a, three), _mm_and_si128(b, three)),
+        _mm_add_epi16(_mm_and_si128(c, three), _mm_and_si128(d, three)));
+    return _mm_add_epi16(quotients, _mm_srli_epi16(_mm_add_epi16(remainders, two), 2));
+}
+
+/// \brief Averages pixels of 1, 2 or 4 8-bit channels, 16 output channels at a time, and
+/// returns how many pixels were averaged
+template <std::size_t N, typename std::enable_if<N == 1 || N == 2 || N == 4, int>::type = 0>
+inline auto downsample_2x2_row_vectorized(
+    std::uint8_t const* row0,
+    std::uint8_t const* row1,
+    std::uint8_t* dst,
+    std::ptrdiff_t width,
+    std::integral_constant<std::size_t, N> channels) -> std::ptrdiff_t
+{
+    std::ptrdiff_t const n = static_cast<std::ptrdiff_t>(N);
+    std::ptrdiff_t const size = 2 * width * n;
+    std::ptrdiff_t j = 0;
+    for (; j + 32 + n <= size; j += 32)
+    {
+        __m128i lo0, hi0, lo1, hi1;
+        downsample_average_sse2(row0 + j, row1 + j, N, lo0, hi0);
+        downsample_average_sse2(row0 + j + 16, row1 + j + 16, N, lo1, hi1);
+        __m128i const v0 = _mm_unpacklo_epi64(
+            downsample_compact(lo0, channels), downsample_compact(hi0, channels));
+        __m128i const v1 = _mm_unpacklo_epi64(
+            downsample_compact(lo1, channels), downsample_compact(hi1, channels));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + j / 2), _mm_packus_epi16(v0, v1));
+    }
+    return j / (2 * n);
+}
+
+/// \brief Averages pixels of 1, 2 or 4 16-bit channels, 8 output channels at a time, and
+/// returns how many pixels were averaged
+template <std::size_t N, typename std::enable_if<N == 1 || N == 2 || N == 4, int>::type = 0>
+inline auto downsample_2x2_row_vectorized(
+    std::uint16_t const* row0,
+    std::uint16_t const* row1,
+    std::uint16_t* dst,
+    std::ptrdiff_t width,
+    std::integral_constant<std::size_t, N> channels) -> std::ptrdiff_t
+{
+    std::ptrdiff_t const n = static_cast<std::ptrdiff_t>(N);
+    std::ptrdiff_t const size = 2 * width * n;
+    std::ptrdiff_t j = 0;
+    for (; j + 16 + n <= size; j += 16)
+    {
+        __m128i const v0 = downsample_average_sse2(row0 + j, row1 + j, N);
+        __m128i const v1 = downsample_average_sse2(row0 + j + 8, row1 + j + 8, N);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + j / 2), _mm_unpacklo_epi64(
+            downsample_compact(v0, channels), downsample_compact(v1, channels)));
+    }
+    return j / (2 * n);
+}
+#endif
+
+#if defined(BOOST_GIL_SIMD_SSSE3)
+/// \brief Averages pixels of 3 8-bit channels, 8 pixels at a time, and returns how many pixels
+/// were averaged
+///
+/// The channels of the even pixels among 48 averaged values are gathered from three vectors
+/// into a vector and a half.
+inline auto downsample_2x2_row_vectorized(
+    std::uint8_t const* row0,
+    std::uint8_t const* row1,
+    std::uint8_t* dst,
+    std::ptrdiff_t width,
+    std::integral_constant<std::size_t, 3>) -> std::ptrdiff_t
+{
+    __m128i const first0 = _mm_setr_epi8(0, 1, 2, 6, 7, 8, 12, 13, 14, -1, -1, -1, -1, -1, -1, -1);
+    __m128i const first1 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, 2, 3, 4, 8, 9, 10, 14);
+    __m128i const second1 = _mm_setr_epi8(15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1);
+    __m128i const second2 = _mm_setr_epi8(-1, 0, 4, 5, 6, 10, 11, 12, -1, -1, -1, -1, -1, -1, -1,
+        -1);
+    std::ptrdiff_t const size = 6 * width;
+    std::ptrdiff_t j = 0;
+    for (; j + 48 + 3 <= size; j += 48)
+    {
+        __m128i lo, hi;
+        downsample_average_sse2(row0 + j, row1 + j, 3, lo, hi);
+        __m128i const v0 = _mm_packus_epi16(lo, hi);
+        downsample_average_sse2(row0 + j + 16, row1 + j + 16, 3, lo, hi);
+        __m128i const v1 = _mm_packus_epi16(lo, hi);
+        downsample_average_sse2(row0 + j + 32, row1 + j + 32, 3, lo, hi);
+        __m128i const v2 = _mm_packus_epi16(lo, hi);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + j / 2),
+            _mm_or_si128(_mm_shuffle_epi8(v0, first0), _mm_shuffle_epi8(v1, first1)));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + j / 2 + 16),
+            _mm_or_si128(_mm_shuffle_epi8(v1, second1), _mm_shuffle_epi8(v2, second2)));
+    }
+    return j / 6;
+}
+
+/// \brief Averages pixels of 3 16-bit channels, 4 pixels at a time, and returns how many
+/// pixels were averaged
+inline auto downsample_2x2_row_vectorized(
+    std::uint16_t const* row0,
+    std::uint16_t const* row1,
+    std::uint16_t* dst,
+    std::ptrdiff_t width,
+    std::integral_constant<std::size_t, 3>) -> std::ptrdiff_t
+{
+    // Byte shuffles of 16-bit values: channels 0, 1, 2, 6, 7 of the first vector and 0, 4, 5
+    // of the second, then channel 6 of the second and 2, 3, 4 of the third
+    __m128i const first0 = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 12, 13, 14, 15, -1, -1, -1, -1, -1,
+        -1);
+    __m128i const first1 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 1, 8, 9, 10,
+        11);
+    __m128i const second1 = _mm_setr_epi8(12, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1);
+    __m128i const second2 = _mm_setr_epi8(-1, -1, 4, 5, 6, 7, 8, 9, -1, -1, -1, -1, -1, -1, -1,
+        -1);
+    std::ptrdiff_t const size = 6 * width;
+    std::ptrdiff_t j = 0;
+    for (; j + 24 + 3 <= size; j += 24)
+    {
+        __m128i const v0 = downsample_average_sse2(row0 + j, row1 + j, 3);
+        __m128i const v1 = downsample_average_sse2(row0 + j + 8, row1 + j + 8, 3);
+        __m128i const v2 = downsample_average_sse2(row0 + j + 16, row1 + j + 16, 3);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + j / 2),
+            _mm_or_si128(_mm_shuffle_epi8(v0, first0), _mm_shuffle_epi8(v1, first1)));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + j / 2 + 8),
+            _mm_or_si128(_mm_shuffle_epi8(v1, second1), _mm_shuffle_epi8(v2, second2)));
+    }
+    return j / 6;
+}
+#endif
+
+#if defined(BOOST_GIL_SIMD_NEON)
+// Loads of N channels deinterleave the even and the odd pixels, which pairwise additions sum
+
+inline auto downsample_average_neon(uint8x16_t row0, uint8x16_t row1) -> uint8x8_t
+{
+    return vrshrn_n_u16(vaddq_u16(vpaddlq_u8(row0), vpaddlq_u8(row1)), 2);
+}
+
+inline auto downsample_average_neon(uint16x8_t row0, uint16x8_t row1) -> uint16x4_t
+{
+    return vrshrn_n_u32(vaddq_u32(vpaddlq_u16(row0), vpaddlq_u16(row1)), 2);
+}
+
+inline auto downsample_2x2_row_vectorized(
+    std::uint8_t const* row0,
+    std::uint8_t const* row1,
+    std::uint8_t* dst,
+    std::ptrdiff_t width,
+    std::integral_constant<std::size_t, 1>) -> std::ptrdiff_t
+{
+    std::ptrdiff_t x = 0;
+    for (; x + 8 <= width; x += 8)
+        vst1_u8(dst + x, downsample_average_neon(vld1q_u8(row0 + 2 * x), vld1q_u8(row1 + 2 * x)));
+    return x;
+}
+
+inline auto downsample_2x2_row_vectorized(
+    std::uint8_t const* row0,
+    std::uint8_t const* row1,
+    std::uint8_t* dst,
+    std::ptrdiff_t width,
+    std::integral_constant<std::size_t, 2>) -> std::ptrdiff_t
+{
+    std::ptrdiff_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        uint8x16x2_t const a = vld2q_u8(row0 + 4 * x);
+        uint8x16x2_t const b = vld2q_u8(row1 + 4 * x);
+        uint8x8x2_t result;
+        for (int c = 0; c < 2; ++c)
+            result.val[c] = downsample_average_neon(a.val[c], b.val[c]);
+        vst2_u8(dst + 2 * x, result);
+    }
+    return x;
+}
+
+inline auto downsample_2x2_row_vectorized(
+    std::uint8_t const* row0,
+    std::uint8_t const* row1,
+    std::uint8_t* dst,
+    std::ptrdiff_t width,
+    std::integral_constant<std::size_t, 3>) -> std::ptrdiff_t
+{
+    std::ptrdiff_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        uint8x16x3_t const a = vld3q_u8(row0 + 6 * x);
+        uint8x16x3_t const b = vld3q_u8(row1 + 6 * x);
+        uint8x8x3_t result;
+        for (int c = 0; c < 3; ++c)
+            result.val[c] = downsample_average_neon(a.val[c], b.val[c]);
+        vst3_u8(dst + 3 * x, result);
+    }
+    return x;
+}
+
+inline auto downsample_2x2_row_vectorized(
+    std::uint8_t const* row0,
+    std::uint8_t const* row1,
+    std::uint8_t* dst,
+    std::ptrdiff_t width,
+    std::integral_constant<std::size_t, 4>) -> std::ptrdiff_t
+{
+    std::ptrdiff_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        uint8x16x4_t const a = vld4q_u8(row0 + 8 * x);
+        uint8x16x4_t const b = vld4q_u8(row1 + 8 * x);
+        uint8x8x4_t result;
+        for (int c = 0; c < 4; ++c)
+            result.val[c] = downsample_average_neon(a.val[c], b.val[c]);
+        vst4_u8(dst + 4 * x, result);
+    }
+    return x;
+}
+
+inline auto downsample_2x2_row_vectorized(
+    std::uint16_t const* row0,
+    std::uint16_t const* row1,
+    std::uint16_t* dst,
+    std::ptrdiff_t width,
+    std::integral_constant<std::size_t, 1>) -> std::ptrdiff_t
+{
+    std::ptrdiff_t x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        vst1_u16(dst + x,
+            downsample_average_neon(vld1q_u16(row0 + 2 * x), vld1q_u16(row1 + 2 * x)));
+    }
+    return x;
+}
+
+inline auto downsample_2x2_row_vectorized(
+    std::uint16_t const* row0,
+    std::uint16_t const* row1,
+    std::uint16_t* dst,
+    std::ptrdiff_t width,
+    std::integral_constant<std::size_t, 2>) -> std::ptrdiff_t
+{
+    std::ptrdiff_t x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        uint16x8x2_t const a = vld2q_u16(row0 + 4 * x);
+        uint16x8x2_t const b = vld2q_u16(row1 + 4 * x);
+        uint16x4x2_t result;
+        for (int c = 0; c < 2; ++c)
+            result.val[c] = downsample_average_neon(a.val[c], b.val[c]);
+        vst2_u16(dst + 2 * x, result);
+    }
+    return x;
+}
+
+inline auto downsample_2x2_row_vectorized(
+    std::uint16_t const* row0,
+    std::uint16_t const* row1,
+    std::uint16_t* dst,
+    std::ptrdiff_t width,
+    std::integral_constant<std::size_t, 3>) -> std::ptrdiff_t
+{
+    std::ptrdiff_t x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        uint16x8x3_t const a = vld3q_u16(row0 + 6 * x);
+        uint16x8x3_t const b = vld3q_u16(row1 + 6 * x);
+        uint16x4x3_t result;
+        for (int c = 0; c < 3; ++c)
+            result.val[c] = downsample_average_neon(a.val[c], b.val[c]);
+        vst3_u16(dst + 3 * x, result);
+    }
+    return x;
+}
+
+inline auto downsample_2x2_row_vectorized(
+    std::uint16_t const* row0,
+    std::uint16_t const* row1,
+    std::uint16_t* dst,
+    std::ptrdiff_t width,
+    std::integral_constant<std::size_t, 4>) -> std::ptrdiff_t
+{
+    std::ptrdiff_t x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        uint16x8x4_t const a = vld4q_u16(row0 + 8 * x);
+        uint16x8x4_t const b = vld4q_u16(row1 + 8 * x);
+        uint16x4x4_t result;
+        for (int c = 0; c < 4; ++c)
+            result.val[c] = downsample_average_neon(a.val[c], b.val[c]);
+        vst4_u16(dst + 4 * x, result);
+    }
+    return x;
+}
+#endif
+
+/// \brief Averages the blocks of 2x2 pixels of \p N channels of rows \p row0 and \p row1 of
+/// at least 2 * \p width pixels to \p width pixels
+template <std::size_t N, typename T>
+inline void downsample_2x2_row(T const* row0, T const* row1, T* dst, std::ptrdiff_t width)
+{
+    std::ptrdiff_t const begin = downsample_2x2_row_vectorized(
+        row0, row1, dst, width, std::integral_constant<std::size_t, N>());
+    for (std::ptrdiff_t x = begin; x < width; ++x)
+    {
+        T const* a = row0 + 2 * x * static_cast<std::ptrdiff_t>(N);
+        T const* b = row1 + 2 * x * static_cast<std::ptrdiff_t>(N);
+        T* d = dst + x * static_cast<std::ptrdiff_t>(N);
+        for (std::size_t c = 0; c < N; ++c)
+            d[c] = downsample_average(a[c], a[c + N], b[c], b[c + N]);
+    }
+}
+
+}}} // namespace boost::gil::detail
+
+#endif
@@ -0,0 +1,317 @@
+//
+// Copyright 2026 Boost.GIL Contributors
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#ifndef BOOST_GIL_DETAIL_FFT_HPP
+#define BOOST_GIL_DETAIL_FFT_HPP
+
+#include <boost/gil/detail/math.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+namespace boost { namespace gil { namespace detail {
+
+// Mixed-radix fast Fourier transform of complex sequences whose length has no prime factors
+// other than 2, 3 and 5.
+//
+// The transform is computed by the self-sorting Stockham algorithm: each pass splits every
+// sub-sequence of length n into its r interleaved sub-sequences of length n / r, reading from
+// one buffer and writing to the other, so no bit-reversal permutation is needed and the
+// passes access memory with unit stride.
+
+/// \brief Returns the smallest integer not less than \p n with no prime factors other than
+/// 2, 3 and 5, which is a valid size of fft_plan.
+inline auto fft_good_size(std::size_t n) -> std::size_t
+{
+    std::size_t best = 1;
+    while (best < n)
+        best *= 2;
+
+    for (std::size_t p5 = 1; p5 < best; p5 *= 5)
+    {
+        for (std::size_t p35 = p5; p35 < best; p35 *= 3)
+        {
+            std::size_t size = p35;
+            while (size < n)
+                size *= 2;
+            best = (std::min)(best, size);
+        }
+    }
+    return best;
+}
+
+/// \brief Returns the product of complex numbers, without the special handling of infinities
+/// of std::complex multiplication
+inline auto fft_multiply(std::complex<double> const& a, std::complex<double> const& b)
+    -> std::complex<double>
+{
+    return std::complex<double>(
+        a.real() * b.real() - a.imag() * b.imag(),
+        a.real() * b.imag() + a.imag() * b.real());
+}
+
+/// \brief Precomputed twiddle factors and factorization of a fast Fourier transform size
+class fft_plan
+{
+public:
+    using complex_t = std::complex<double>;
+
+    /// \param size - Length of the transformed sequences, see fft_good_size.
+    explicit fft_plan(std::size_t size) : size_(size), twiddles_(size)
+    {
+        BOOST_ASSERT(size != 0);
+        while (size % 4 == 0)
+        {
+            radices_.push_back(4);
+            size /= 4;
+        }
+        for (std::size_t radix : {2, 3, 5})
+        {
+            while (size % radix == 0)
+            {
+                radices_.push_back(radix);
+                size /= radix;
+            }
+        }
+        BOOST_ASSERT_MSG(size == 1, "FFT size must have no prime factors other than 2, 3 and 5");
+
+        for (std::size_t k = 0; k < size_; ++k)
+        {
+            double const angle = -2.0 * pi * static_cast<double>(k) / static_cast<double>(size_);
+            twiddles_[k] = complex_t(std::cos(angle), std::sin(angle));
+        }
+    }
+
+    auto size() const -> std::size_t { return size_; }
+
+    /// \brief Replaces \p data with its discrete Fourier transform
+    /// \param data - Sequence of size() values.
+    /// \param work - Scratch buffer of size() values.
+    void forward(complex_t* data, complex_t* work) const
+    {
+        transform<false>(data, work);
+    }
+
+    /// \brief Replaces \p data with its inverse discrete Fourier transform, multiplied by size()
+    void inverse(complex_t* data, complex_t* work) const
+    {
+        transform<true>(data, work);
+    }
+
+    /// \brief Applies forward() to the columns of a row-major array
+    /// \param data - Array of size() rows of \p columns values.
+    /// \param work - Scratch buffer of (column_block + 1) * size() values.
+    void forward_columns(complex_t* data, std::size_t columns, complex_t* work) const
+    {
+        transform_columns<false>(data, columns, work);
+    }
+
+    /// \brief Applies inverse() to the columns of a row-major array
+    void inverse_columns(complex_t* data, std::size_t columns, complex_t* work) const
+    {
+        transform_columns<true>(data, columns, work);
+    }
+
+    /// Number of columns copied at once by forward_columns and inverse_columns, which read a few
+    /// adjacent values of each row rather than a single one.
+    static constexpr std::size_t column_block = 4;
+
+private:
+    static auto multiply(complex_t const& a, complex_t const& b) -> complex_t
+    {
+        return fft_multiply(a, b);
+    }
+
+    template <bool Inverse>
+    void transform_columns(complex_t* data, std::size_t columns, complex_t* work) const
+    {
+        std::size_t const block = column_block;
+        complex_t* const scratch = work + block * size_;
+        for (std::size_t x0 = 0; x0 < columns; x0 += block)
+        {
+            std::size_t const count = (std::min)(block, columns - x0);
+            for (std::size_t y = 0; y < size_; ++y)
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                    work[i * size_ + y] = data[y * columns + x0 + i];
+            }
+            for (std::size_t i = 0; i < count; ++i)
+                transform<Inverse>(work + i * size_, scratch);
+            for (std::size_t y = 0; y < size_; ++y)
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                    data[y * columns + x0 + i] = work[i * size_ + y];
+            }
+        }
+    }
+
+    // Multiplies by -i for the forward transform and by i for the inverse
+    template <bool Inverse>
+    static auto rotate(complex_t const& a) -> complex_t
+    {
+        return Inverse ? complex_t(-a.imag(), a.real()) : complex_t(a.imag(), -a.real());
+    }
+
+    template <bool Inverse>
+    auto twiddle(std::size_t k) const -> complex_t
+    {
+        return Inverse ? std::conj(twiddles_[k]) : twiddles_[k];
+    }
+
+    template <bool Inverse>
+    void transform(complex_t* data, complex_t* work) const
+    {
+        complex_t* x = data;
+        complex_t* y = work;
+        std::size_t n = size_;
+        std::size_t stride = 1;
+        for (std::size_t radix : radices_)
+        {
+            std::size_t const m = n / radix;
+            switch (radix)
+            {
+            case 4: pass_4<Inverse>(x, y, m, stride); break;
+            case 2: pass_2<Inverse>(x, y, m, stride); break;
+            case 3: pass_3<Inverse>(x, y, m, stride); break;
+            default: pass_5<Inverse>(x, y, m, stride); break;
+            }
+            std::swap(x, y);
+            n = m;
+            stride *= radix;
+        }
+        if (x != data)
+            std::copy(x, x + size_, data);
+    }
+
+    // Each pass maps x[q + s * (p + k * m)], k < r, to y[q + s * (r * p + j)], j < r, which is
+    // the j-th value of the r-point transform over k multiplied by the twiddle factor of j * p.
+
+    template <bool Inverse>
+    void pass_2(complex_t const* x, complex_t* y, std::size_t m, std::size_t s) const
+    {
+        for (std::size_t p = 0; p < m; ++p)
+        {
+            complex_t const w1 = twiddle<Inverse>(p * s);
+            complex_t const* in = x + s * p;
+            complex_t* out = y + s * 2 * p;
+            for (std::size_t q = 0; q < s; ++q)
+            {
+                complex_t const a0 = in[q];
+                complex_t const a1 = in[q + s * m];
+                out[q] = a0 + a1;
+                out[q + s] = multiply(a0 - a1, w1);
+            }
+        }
+    }
+
+    template <bool Inverse>
+    void pass_3(complex_t const* x, complex_t* y, std::size_t m, std::size_t s) const
+    {
+        double const sin_third = (Inverse ? 1.0 : -1.0) * std::sqrt(3.0) / 2.0;
+        for (std::size_t p = 0; p < m; ++p)
+        {
+            complex_t const w1 = twiddle<Inverse>(p * s);
+            complex_t const w2 = twiddle<Inverse>(2 * p * s);
+            complex_t const* in = x + s * p;
+            complex_t* out = y + s * 3 * p;
+            for (std::size_t q = 0; q < s; ++q)
+            {
+                complex_t const a0 = in[q];
+                complex_t const a1 = in[q + s * m];
+                complex_t const a2 = in[q + 2 * s * m];
+                complex_t const sum = a1 + a2;
+                complex_t const difference = a1 - a2;
+                complex_t const center = a0 - 0.5 * sum;
+                complex_t const side(
+                    -sin_third * difference.imag(), sin_third * difference.real());
+                out[q] = a0 + sum;
+                out[q + s] = multiply(center + side, w1);
+                out[q + 2 * s] = multiply(center - side, w2);
+            }
+        }
+    }
+
+    template <bool Inverse>
+    void pass_4(complex_t const* x, complex_t* y, std::size_t m, std::size_t s) const
+    {
+        for (std::size_t p = 0; p < m; ++p)
+        {
+            complex_t const w1 = twiddle<Inverse>(p * s);
+            complex_t const w2 = twiddle<Inverse>(2 * p * s);
+            complex_t const w3 = twiddle<Inverse>(3 * p * s);
+            complex_t const* in = x + s * p;
+            complex_t* out = y + s * 4 * p;
+            for (std::size_t q = 0; q < s; ++q)
+            {
+                complex_t const a0 = in[q];
+                complex_t const a1 = in[q + s * m];
+                complex_t const a2 = in[q + 2 * s * m];
+                complex_t const a3 = in[q + 3 * s * m];
+                complex_t const t0 = a0 + a2;
+                complex_t const t1 = a0 - a2;
+                complex_t const t2 = a1 + a3;
+                complex_t const t3 = rotate<Inverse>(a1 - a3);
+                out[q] = t0 + t2;
+                out[q + s] = multiply(t1 + t3, w1);
+                out[q + 2 * s] = multiply(t0 - t2, w2);
+                out[q + 3 * s] = multiply(t1 - t3, w3);
+            }
+        }
+    }
+
+    template <bool Inverse>
+    void pass_5(complex_t const* x, complex_t* y, std::size_t m, std::size_t s) const
+    {
+        double const cos_1 = std::cos(2.0 * pi / 5.0);
+        double const cos_2 = std::cos(4.0 * pi / 5.0);
+        double const sin_1 = std::sin(2.0 * pi / 5.0);
+        double const sin_2 = std::sin(4.0 * pi / 5.0);
+        for (std::size_t p = 0; p < m; ++p)
+        {
+            complex_t const w1 = twiddle<Inverse>(p * s);
+            complex_t const w2 = twiddle<Inverse>(2 * p * s);
+            complex_t const w3 = twiddle<Inverse>(3 * p * s);
+            complex_t const w4 = twiddle<Inverse>(4 * p * s);
+            complex_t const* in = x + s * p;
+            complex_t* out = y + s * 5 * p;
+            for (std::size_t q = 0; q < s; ++q)
+            {
+                complex_t const a0 = in[q];
+                complex_t const a1 = in[q + s * m];
+                complex_t const a2 = in[q + 2 * s * m];
+                complex_t const a3 = in[q + 3 * s * m];
+                complex_t const a4 = in[q + 4 * s * m];
+                complex_t const t1 = a1 + a4;
+                complex_t const t2 = a2 + a3;
+                complex_t const t3 = a1 - a4;
+                complex_t const t4 = a2 - a3;
+                complex_t const b1 = a0 + cos_1 * t1 + cos_2 * t2;
+                complex_t const b2 = a0 + cos_2 * t1 + cos_1 * t2;
+                complex_t const d1 = rotate<Inverse>(sin_1 * t3 + sin_2 * t4);
+                complex_t const d2 = rotate<Inverse>(sin_2 * t3 - sin_1 * t4);
+                out[q] = a0 + t1 + t2;
+                out[q + s] = multiply(b1 + d1, w1);
+                out[q + 2 * s] = multiply(b2 + d2, w2);
+                out[q + 3 * s] = multiply(b2 - d2, w3);
+                out[q + 4 * s] = multiply(b1 - d1, w4);
+            }
+        }
+    }
+
+    std::size_t size_;
+    std::vector<std::size_t> radices_;
+    std::vector<complex_t> twiddles_;
+};
+
+}}} // namespace boost::gil::detail
+
+#endif
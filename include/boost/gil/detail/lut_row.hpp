@@ -0,0 +1,168 @@
+//
+// Copyright 2026 Boost.GIL Contributors
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#ifndef BOOST_GIL_DETAIL_LUT_ROW_HPP
+#define BOOST_GIL_DETAIL_LUT_ROW_HPP
+
+#include <boost/gil/channel.hpp>
+#include <boost/gil/color_base_algorithm.hpp>
+#include <boost/gil/metafunctions.hpp>
+#include <boost/gil/detail/simd.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/core/ignore_unused.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace boost { namespace gil { namespace detail {
+
+// Row kernels of apply_lut. A lookup table holds one entry per value of an integral channel
+// of at most 16 bits, entry i being the result for the value min + i.
+
+/// \brief Determines whether the values of a channel can index a lookup table
+template <typename Channel>
+struct is_lut_index_channel : std::integral_constant<bool,
+    std::is_integral<typename base_channel_type<Channel>::type>::value &&
+    !std::is_same<typename base_channel_type<Channel>::type, bool>::value &&
+    sizeof(typename base_channel_type<Channel>::type) <= 2>
+{};
+
+/// \brief Number of entries of the lookup table of a channel
+template <typename Channel>
+struct lut_extent : std::integral_constant<std::size_t, static_cast<std::size_t>(
+    static_cast<long>((std::numeric_limits<typename base_channel_type<Channel>::type>::max)()) -
+    static_cast<long>((std::numeric_limits<typename base_channel_type<Channel>::type>::min)()) +
+    1)>
+{};
+
+/// \brief Checks that a lookup table holds at least \p Extent entries, at compile time for
+/// \c std::array and built-in arrays
+template <std::size_t Extent, typename T, std::size_t N>
+inline void check_lut_size(std::array<T, N> const&)
+{
+    static_assert(N >= Extent, "Lookup table has fewer entries than the source channel values");
+}
+
+template <std::size_t Extent, typename T, std::size_t N>
+inline void check_lut_size(T const (&)[N])
+{
+    static_assert(N >= Extent, "Lookup table has fewer entries than the source channel values");
+}
+
+template <std::size_t Extent, typename Lut>
+inline void check_lut_size(Lut const& lut)
+{
+    BOOST_ASSERT(static_cast<std::size_t>(lut.size()) >= Extent);
+    boost::ignore_unused(lut);
+}
+
+/// \brief Returns the index of the entry of a channel value in its lookup table
+template <typename Channel>
+inline auto lut_index(Channel value) -> std::size_t
+{
+    using base_t = typename base_channel_type<Channel>::type;
+    return static_cast<std::size_t>(static_cast<long>(static_cast<base_t>(value)) -
+        static_cast<long>((std::numeric_limits<base_t>::min)()));
+}
+
+/// \brief Looks up \p count bytes in a table of 256 bytes
+///
+/// Lookups of 256-entry tables are native on AArch64, which uses four 64-byte table lookups
+/// per 16 bytes. Elsewhere emulating them with byte shuffles is slower than loading the
+/// entries, so the loop is only unrolled to keep the loads independent.
+inline void apply_lut_bytes(
+    std::uint8_t const* src, std::uint8_t* dst, std::ptrdiff_t count, std::uint8_t const* table)
+{
+    std::ptrdiff_t i = 0;
+#if defined(BOOST_GIL_SIMD_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+    uint8x16x4_t tables[4];
+    for (int k = 0; k < 4; ++k)
+    {
+        for (int j = 0; j < 4; ++j)
+            tables[k].val[j] = vld1q_u8(table + 64 * k + 16 * j);
+    }
+    uint8x16_t const step = vdupq_n_u8(64);
+    for (; i + 16 <= count; i += 16)
+    {
+        // Indices out of the 64 entries of a table leave the result unchanged
+        uint8x16_t index = vld1q_u8(src + i);
+        uint8x16_t result = vqtbl4q_u8(tables[0], index);
+        index = vsubq_u8(index, step);
+        result = vqtbx4q_u8(result, tables[1], index);
+        index = vsubq_u8(index, step);
+        result = vqtbx4q_u8(result, tables[2], index);
+        index = vsubq_u8(index, step);
+        vst1q_u8(dst + i, vqtbx4q_u8(result, tables[3], index));
+    }
+#endif
+    for (; i + 4 <= count; i += 4)
+    {
+        std::uint8_t const v0 = table[src[i]];
+        std::uint8_t const v1 = table[src[i + 1]];
+        std::uint8_t const v2 = table[src[i + 2]];
+        std::uint8_t const v3 = table[src[i + 3]];
+        dst[i] = v0;
+        dst[i + 1] = v1;
+        dst[i + 2] = v2;
+        dst[i + 3] = v3;
+    }
+    for (; i < count; ++i)
+        dst[i] = table[src[i]];
+}
+
+/// \brief Looks up each channel of \p width interleaved 8-bit pixels in the table of that
+/// channel
+template <std::size_t Channels>
+inline void apply_lut_bytes(
+    std::uint8_t const* src,
+    std::uint8_t* dst,
+    std::ptrdiff_t width,
+    std::array<std::uint8_t const*, Channels> const& tables)
+{
+    bool shared = true;
+    for (std::size_t c = 1; c < Channels; ++c)
+        shared = shared && tables[c] == tables[0];
+    if (shared)
+    {
+        apply_lut_bytes(src, dst, width * static_cast<std::ptrdiff_t>(Channels), tables[0]);
+        return;
+    }
+
+    for (std::ptrdiff_t x = 0; x < width; ++x, src += Channels, dst += Channels)
+    {
+        for (std::size_t c = 0; c < Channels; ++c)
+            dst[c] = tables[c][src[c]];
+    }
+}
+
+/// \brief Looks up each channel of \p width pixels of any layout in the table of that channel
+template <typename SrcIterator, typename DstIterator, typename T, std::size_t Channels>
+inline void apply_lut_pixels(
+    SrcIterator src,
+    DstIterator dst,
+    std::ptrdiff_t width,
+    std::array<T const*, Channels> const& tables)
+{
+    using src_channel_t = typename channel_type<SrcIterator>::type;
+    using dst_channel_t = typename channel_type<DstIterator>::type;
+    for (std::ptrdiff_t x = 0; x < width; ++x)
+    {
+        for (std::size_t c = 0; c < Channels; ++c)
+        {
+            src_channel_t const value = dynamic_at_c(src[x], c);
+            dynamic_at_c(dst[x], c) = dst_channel_t(tables[c][lut_index(value)]);
+        }
+    }
+}
+
+}}} // namespace boost::gil::detail
+
+#endif
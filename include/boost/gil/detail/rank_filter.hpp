@@ -0,0 +1,450 @@
+//
+// Copyright 2026 Boost.GIL Contributors
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#ifndef BOOST_GIL_DETAIL_RANK_FILTER_HPP
+#define BOOST_GIL_DETAIL_RANK_FILTER_HPP
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace boost { namespace gil { namespace detail {
+
+// Rank filters of a single channel.
+//
+// Each filter reads a band of values in row-major order, extended by size - 1 rows and columns,
+// so that output pixel (x, y) has its size x size window at band row y and column x, and passes
+// each output row to write_row(y, values). The filters differ by the data structure selecting
+// the value of the requested rank in the window:
+// - rank_filter_network sorts 3x3 and 5x5 windows of many pixels at once with a median network,
+// - rank_filter_constant_time keeps histograms of the window columns for 8-bit values, and
+//   updates the window histogram in constant time as in S. Perreault, P. Hebert, "Median
+//   filtering in constant time", 2007,
+// - rank_filter_sliding keeps a two-level histogram of the window for 16-bit values, updated
+//   column by column as in T. Huang, G. Yang, G. Tang, "A fast two-dimensional median filtering
+//   algorithm", 1979,
+// - rank_filter_select copies each window and partially sorts it.
+
+/// \brief Determines whether values of \p T index a histogram of at most 2^16 bins
+template <typename T>
+struct is_rank_histogram_value
+    : std::integral_constant<bool, std::is_integral<T>::value && sizeof(T) <= 2>
+{};
+
+/// \brief Maps integral values to histogram bins starting at the smallest value
+template <typename T>
+struct rank_histogram_bins
+{
+    static constexpr std::size_t count = std::size_t(1) << (8 * sizeof(T));
+
+    static auto bin(T value) -> std::size_t
+    {
+        return static_cast<std::size_t>(
+            static_cast<long>(value) - static_cast<long>((std::numeric_limits<T>::min)()));
+    }
+
+    static auto value(std::size_t bin) -> T
+    {
+        return static_cast<T>(
+            static_cast<long>(bin) + static_cast<long>((std::numeric_limits<T>::min)()));
+    }
+};
+
+/// \brief Median of 9 values of index 4 after the compare-exchange operations,
+/// see A. W. Paeth, "Median finding on a 3x3 grid", Graphics Gems, 1990
+inline auto median_9_network() -> std::vector<std::array<std::uint8_t, 2>> const&
+{
+    static std::vector<std::array<std::uint8_t, 2>> const network = {
+        {{1, 2}}, {{4, 5}}, {{7, 8}}, {{0, 1}}, {{3, 4}}, {{6, 7}}, {{1, 2}}, {{4, 5}},
+        {{7, 8}}, {{0, 3}}, {{5, 8}}, {{4, 7}}, {{3, 6}}, {{1, 4}}, {{2, 5}}, {{4, 7}},
+        {{4, 2}}, {{6, 4}}, {{4, 2}}};
+    return network;
+}
+
+/// \brief Median of 25 values of index 12 after the compare-exchange operations, which are
+/// those of Batcher's odd-even merge sort of 32 values that the median depends on
+inline auto median_25_network() -> std::vector<std::array<std::uint8_t, 2>> const&
+{
+    static std::vector<std::array<std::uint8_t, 2>> const network = {
+        {{0, 1}}, {{2, 3}}, {{0, 2}}, {{1, 3}}, {{1, 2}}, {{4, 5}}, {{6, 7}}, {{4, 6}},
+        {{5, 7}}, {{5, 6}}, {{0, 4}}, {{2, 6}}, {{2, 4}}, {{1, 5}}, {{3, 7}}, {{3, 5}},
+        {{1, 2}}, {{3, 4}}, {{5, 6}}, {{8, 9}}, {{10, 11}}, {{8, 10}}, {{9, 11}}, {{9, 10}},
+        {{12, 13}}, {{14, 15}}, {{12, 14}}, {{13, 15}}, {{13, 14}}, {{8, 12}}, {{10, 14}},
+        {{10, 12}}, {{9, 13}}, {{11, 15}}, {{11, 13}}, {{9, 10}}, {{11, 12}}, {{13, 14}},
+        {{0, 8}}, {{4, 12}}, {{4, 8}}, {{2, 10}}, {{6, 14}}, {{6, 10}}, {{2, 4}}, {{6, 8}},
+        {{10, 12}}, {{1, 9}}, {{5, 13}}, {{5, 9}}, {{3, 11}}, {{7, 15}}, {{7, 11}}, {{3, 5}},
+        {{7, 9}}, {{11, 13}}, {{1, 2}}, {{3, 4}}, {{5, 6}}, {{7, 8}}, {{9, 10}}, {{11, 12}},
+        {{13, 14}}, {{16, 17}}, {{18, 19}}, {{16, 18}}, {{17, 19}}, {{17, 18}}, {{20, 21}},
+        {{22, 23}}, {{20, 22}}, {{21, 23}}, {{21, 22}}, {{16, 20}}, {{18, 22}}, {{18, 20}},
+        {{17, 21}}, {{19, 23}}, {{19, 21}}, {{17, 18}}, {{19, 20}}, {{21, 22}}, {{16, 24}},
+        {{20, 24}}, {{18, 20}}, {{22, 24}}, {{19, 21}}, {{17, 18}}, {{19, 20}}, {{21, 22}},
+        {{23, 24}}, {{0, 16}}, {{8, 24}}, {{8, 16}}, {{4, 20}}, {{12, 20}}, {{12, 16}},
+        {{2, 18}}, {{10, 18}}, {{6, 22}}, {{6, 10}}, {{10, 12}}, {{1, 17}}, {{9, 17}},
+        {{5, 21}}, {{13, 21}}, {{13, 17}}, {{3, 19}}, {{11, 19}}, {{7, 23}}, {{7, 11}},
+        {{11, 13}}, {{11, 12}}};
+    return network;
+}
+
+/// \brief Median filter of 3x3 or 5x5 windows by a compare-exchange network
+///
+/// The network is applied to blocks of adjacent pixels, one array per window position, so the
+/// compare-exchange operations are minimum and maximum of arrays, which compilers vectorize.
+template <std::ptrdiff_t Size, typename T, typename F>
+void rank_filter_network(
+    T const* band,
+    std::ptrdiff_t stride,
+    std::ptrdiff_t width,
+    std::ptrdiff_t height,
+    F const& write_row)
+{
+    static_assert(Size == 3 || Size == 5, "Median networks are available for 3x3 and 5x5");
+    constexpr std::ptrdiff_t block = 64;
+    constexpr std::ptrdiff_t area = Size * Size;
+    auto const& network = Size == 3 ? median_9_network() : median_25_network();
+
+    std::vector<std::array<T, block>> values(area);
+    for (auto& v : values)
+        v.fill(T());
+    std::vector<T> row(static_cast<std::size_t>(width));
+    for (std::ptrdiff_t y = 0; y < height; ++y)
+    {
+        for (std::ptrdiff_t x0 = 0; x0 < width; x0 += block)
+        {
+            std::ptrdiff_t const count = (std::min)(block, width - x0);
+            for (std::ptrdiff_t dy = 0; dy < Size; ++dy)
+            {
+                for (std::ptrdiff_t dx = 0; dx < Size; ++dx)
+                {
+                    T const* it = band + (y + dy) * stride + x0 + dx;
+                    std::copy(it, it + count, values[dy * Size + dx].begin());
+                }
+            }
+            for (auto const& exchange : network)
+            {
+                std::array<T, block>& a = values[exchange[0]];
+                std::array<T, block>& b = values[exchange[1]];
+                // Separate results, which the compiler knows not to alias a and b, let the loop
+                // be vectorized without runtime checks
+                std::array<T, block> low;
+                std::array<T, block> high;
+                for (std::ptrdiff_t i = 0; i < block; ++i)
+                {
+                    low[i] = (std::min)(a[i], b[i]);
+                    high[i] = (std::max)(a[i], b[i]);
+                }
+                a = low;
+                b = high;
+            }
+            std::copy_n(values[area / 2].begin(), count, row.begin() + x0);
+        }
+        write_row(y, row.data());
+    }
+}
+
+/// \brief Rank filter of 8-bit values in constant time per pixel
+///
+/// Each column of the band has a histogram of the size values in the rows of the window, split
+/// in 16 coarse bins and 256 fine bins. Moving the window to the right adds the coarse bins of
+/// the entering column and subtracts those of the leaving one. The 16 fine bins under the coarse
+/// bin holding the rank are then brought up to date, from the columns the window moved over
+/// since they were last used or from all columns of the window, whichever is cheaper.
+template <typename T, typename F>
+void rank_filter_constant_time(
+    T const* band,
+    std::ptrdiff_t stride,
+    std::ptrdiff_t width,
+    std::ptrdiff_t height,
+    std::ptrdiff_t size,
+    std::size_t rank,
+    F const& write_row)
+{
+    static_assert(sizeof(T) == 1 && std::is_integral<T>::value, "8-bit values are required");
+    using bins_t = rank_histogram_bins<T>;
+    constexpr std::ptrdiff_t coarse_bins = 16;
+    constexpr std::ptrdiff_t fine_bins = 256;
+    std::ptrdiff_t const columns = width + size - 1;
+
+    std::vector<std::uint16_t> column_coarse(static_cast<std::size_t>(columns * coarse_bins));
+    std::vector<std::uint16_t> column_fine(static_cast<std::size_t>(columns * fine_bins));
+    auto update_columns = [&](std::ptrdiff_t band_row, int change)
+    {
+        T const* it = band + band_row * stride;
+        for (std::ptrdiff_t x = 0; x < columns; ++x)
+        {
+            std::size_t const bin = bins_t::bin(it[x]);
+            std::size_t const index = static_cast<std::size_t>(x);
+            column_coarse[index * coarse_bins + bin / 16] =
+                static_cast<std::uint16_t>(column_coarse[index * coarse_bins + bin / 16] + change);
+            column_fine[index * fine_bins + bin] =
+                static_cast<std::uint16_t>(column_fine[index * fine_bins + bin] + change);
+        }
+    };
+    for (std::ptrdiff_t dy = 0; dy + 1 < size; ++dy)
+        update_columns(dy, 1);
+
+    std::array<std::uint32_t, coarse_bins> coarse;
+    std::array<std::uint32_t, fine_bins> fine;
+    std::array<std::ptrdiff_t, coarse_bins> fine_position;
+    std::vector<T> row(static_cast<std::size_t>(width));
+    for (std::ptrdiff_t y = 0; y < height; ++y)
+    {
+        if (y > 0)
+            update_columns(y - 1, -1);
+        update_columns(y + size - 1, 1);
+
+        coarse.fill(0);
+        for (std::ptrdiff_t x = 0; x < size; ++x)
+        {
+            std::uint16_t const* it = &column_coarse[static_cast<std::size_t>(x * coarse_bins)];
+            for (std::ptrdiff_t b = 0; b < coarse_bins; ++b)
+                coarse[b] += it[b];
+        }
+        fine_position.fill(-1);
+
+        for (std::ptrdiff_t x = 0; x < width; ++x)
+        {
+            if (x > 0)
+            {
+                std::uint16_t const* added =
+                    &column_coarse[static_cast<std::size_t>((x + size - 1) * coarse_bins)];
+                std::uint16_t const* removed =
+                    &column_coarse[static_cast<std::size_t>((x - 1) * coarse_bins)];
+                for (std::ptrdiff_t b = 0; b < coarse_bins; ++b)
+                    coarse[b] = coarse[b] + added[b] - removed[b];
+            }
+
+            std::size_t count = 0;
+            std::ptrdiff_t b = 0;
+            while (count + coarse[b] <= rank)
+                count += coarse[b++];
+
+            // Brings the fine bins of coarse bin b to the window at x
+            std::uint32_t* it_fine = &fine[static_cast<std::size_t>(b * 16)];
+            std::ptrdiff_t const last = fine_position[b];
+            if (last >= 0 && 2 * (x - last) < size)
+            {
+                for (std::ptrdiff_t column = last + 1; column <= x; ++column)
+                {
+                    std::uint16_t const* added = &column_fine[
+                        static_cast<std::size_t>((column + size - 1) * fine_bins + b * 16)];
+                    std::uint16_t const* removed = &column_fine[
+                        static_cast<std::size_t>((column - 1) * fine_bins + b * 16)];
+                    for (std::ptrdiff_t i = 0; i < 16; ++i)
+                        it_fine[i] = it_fine[i] + added[i] - removed[i];
+                }
+            }
+            else
+            {
+                std::fill_n(it_fine, 16, 0u);
+                for (std::ptrdiff_t column = x; column < x + size; ++column)
+                {
+                    std::uint16_t const* added =
+                        &column_fine[static_cast<std::size_t>(column * fine_bins + b * 16)];
+                    for (std::ptrdiff_t i = 0; i < 16; ++i)
+                        it_fine[i] += added[i];
+                }
+            }
+            fine_position[b] = x;
+
+            std::ptrdiff_t i = 0;
+            while (count + it_fine[i] <= rank)
+                count += it_fine[i++];
+            row[static_cast<std::size_t>(x)] = bins_t::value(static_cast<std::size_t>(b * 16 + i));
+        }
+        write_row(y, row.data());
+    }
+}
+
+/// \brief Rank filter of 8-bit or 16-bit values in time proportional to size per pixel
+///
+/// The window histogram has 256 coarse bins and a fine bin per value. The window moves along
+/// the rows alternately to the right and to the left, and down at their ends, so each move
+/// adds and removes size values.
+template <typename T, typename F>
+void rank_filter_sliding(
+    T const* band,
+    std::ptrdiff_t stride,
+    std::ptrdiff_t width,
+    std::ptrdiff_t height,
+    std::ptrdiff_t size,
+    std::size_t rank,
+    F const& write_row)
+{
+    static_assert(is_rank_histogram_value<T>::value, "8-bit or 16-bit values are required");
+    using bins_t = rank_histogram_bins<T>;
+    constexpr std::size_t fine_per_coarse = bins_t::count / 256;
+
+    std::vector<std::uint32_t> coarse(256);
+    std::vector<std::uint32_t> fine(bins_t::count);
+    auto add = [&](T const* it, std::ptrdiff_t step, int change)
+    {
+        for (std::ptrdiff_t i = 0; i < size; ++i, it += step)
+        {
+            std::size_t const bin = bins_t::bin(*it);
+            coarse[bin / fine_per_coarse] += static_cast<std::uint32_t>(change);
+            fine[bin] += static_cast<std::uint32_t>(change);
+        }
+    };
+    auto select = [&]() -> T
+    {
+        std::size_t count = 0;
+        std::size_t b = 0;
+        while (count + coarse[b] <= rank)
+            count += coarse[b++];
+        std::size_t i = b * fine_per_coarse;
+        while (count + fine[i] <= rank)
+            count += fine[i++];
+        return bins_t::value(i);
+    };
+
+    for (std::ptrdiff_t dy = 0; dy < size; ++dy)
+        add(band + dy * stride, 1, 1);
+
+    std::vector<T> row(static_cast<std::size_t>(width));
+    for (std::ptrdiff_t y = 0; y < height; ++y)
+    {
+        bool const to_right = y % 2 == 0;
+        std::ptrdiff_t x = to_right ? 0 : width - 1;
+        if (y > 0)
+        {
+            add(band + (y - 1) * stride + x, 1, -1);
+            add(band + (y + size - 1) * stride + x, 1, 1);
+        }
+        for (std::ptrdiff_t n = 0; n < width; ++n)
+        {
+            if (n > 0)
+            {
+                std::ptrdiff_t const removed = to_right ? x - 1 : x + size;
+                std::ptrdiff_t const added = to_right ? x + size - 1 : x;
+                add(band + y * stride + removed, stride, -1);
+                add(band + y * stride + added, stride, 1);
+            }
+            row[static_cast<std::size_t>(x)] = select();
+            x += to_right ? 1 : -1;
+        }
+        write_row(y, row.data());
+    }
+}
+
+/// \brief Rank filter of any values, partially sorting a copy of each window
+template <typename T, typename F>
+void rank_filter_select(
+    T const* band,
+    std::ptrdiff_t stride,
+    std::ptrdiff_t width,
+    std::ptrdiff_t height,
+    std::ptrdiff_t size,
+    std::size_t rank,
+    F const& write_row)
+{
+    std::vector<T> window(static_cast<std::size_t>(size * size));
+    std::vector<T> row(static_cast<std::size_t>(width));
+    for (std::ptrdiff_t y = 0; y < height; ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < width; ++x)
+        {
+            for (std::ptrdiff_t dy = 0; dy < size; ++dy)
+            {
+                T const* it = band + (y + dy) * stride + x;
+                std::copy(it, it + size, window.begin() + dy * size);
+            }
+            auto const nth = window.begin() + static_cast<std::ptrdiff_t>(rank);
+            std::nth_element(window.begin(), nth, window.end());
+            row[static_cast<std::size_t>(x)] = *nth;
+        }
+        write_row(y, row.data());
+    }
+}
+
+// Dispatches on the number of bytes of histogram values, or 0 for other values
+
+template <typename T, typename F>
+void rank_filter_histogram(
+    T const* band,
+    std::ptrdiff_t stride,
+    std::ptrdiff_t width,
+    std::ptrdiff_t height,
+    std::ptrdiff_t size,
+    std::size_t rank,
+    F const& write_row,
+    std::integral_constant<std::size_t, 1>)
+{
+    // Only the smallest windows are cheaper to slide than the 16 coarse bins of the constant
+    // time filter are to scan
+    if (size > 5)
+        rank_filter_constant_time(band, stride, width, height, size, rank, write_row);
+    else
+        rank_filter_sliding(band, stride, width, height, size, rank, write_row);
+}
+
+template <typename T, typename F>
+void rank_filter_histogram(
+    T const* band,
+    std::ptrdiff_t stride,
+    std::ptrdiff_t width,
+    std::ptrdiff_t height,
+    std::ptrdiff_t size,
+    std::size_t rank,
+    F const& write_row,
+    std::integral_constant<std::size_t, 2>)
+{
+    rank_filter_sliding(band, stride, width, height, size, rank, write_row);
+}
+
+template <typename T, typename F>
+void rank_filter_histogram(
+    T const* band,
+    std::ptrdiff_t stride,
+    std::ptrdiff_t width,
+    std::ptrdiff_t height,
+    std::ptrdiff_t size,
+    std::size_t rank,
+    F const& write_row,
+    std::integral_constant<std::size_t, 0>)
+{
+    rank_filter_select(band, stride, width, height, size, rank, write_row);
+}
+
+/// \brief Rank filter of a band of values, choosing the filter for the size and value type
+template <typename T, typename F>
+void rank_filter_band(
+    T const* band,
+    std::ptrdiff_t stride,
+    std::ptrdiff_t width,
+    std::ptrdiff_t height,
+    std::ptrdiff_t size,
+    std::size_t rank,
+    F const& write_row)
+{
+    BOOST_ASSERT(size % 2 == 1 && rank < static_cast<std::size_t>(size * size));
+    std::size_t const median = static_cast<std::size_t>(size * size / 2);
+    if (size == 3 && rank == median)
+        rank_filter_network<3>(band, stride, width, height, write_row);
+    else if (size == 5 && rank == median)
+        rank_filter_network<5>(band, stride, width, height, write_row);
+    else if (size == 1)
+        rank_filter_select(band, stride, width, height, size, rank, write_row);
+    else
+    {
+        using histogram_bytes_t = std::integral_constant
+        <
+            std::size_t, is_rank_histogram_value<T>::value ? sizeof(T) : 0
+        >;
+        rank_filter_histogram(
+            band, stride, width, height, size, rank, write_row, histogram_bytes_t());
+    }
+}
+
+}}} // namespace boost::gil::detail
+
+#endif
@@ -0,0 +1,1012 @@
+//
+// Copyright 2026 Boost.GIL Contributors
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#ifndef BOOST_GIL_DETAIL_RESAMPLE_ROW_HPP
+#define BOOST_GIL_DETAIL_RESAMPLE_ROW_HPP
+
+#include <boost/gil/channel.hpp>
+#include <boost/gil/color_base_algorithm.hpp>
+#include <boost/gil/execution.hpp>
+#include <boost/gil/metafunctions.hpp>
+#include <boost/gil/detail/simd.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/core/ignore_unused.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace boost { namespace gil { namespace detail {
+
+// Separable resampling of views of interleaved or planar pixels.
+//
+// Each output pixel is a weighted sum of the source pixels around its center mapped to the
+// source, computed as a horizontal pass over the source rows followed by a vertical pass over
+// the horizontally resampled rows. The weights of an axis only depend on the output coordinate,
+// so they are computed once per output column and once per output row rather than once per
+// pixel. When shrinking, the kernel is stretched by the scale factor so that it averages every
+// source pixel instead of skipping some.
+//
+// Rows are processed as flat arrays of channels in the layout of the pixels. 8-bit channels are
+// accumulated in 32-bit fixed point, with 16-bit weights and intermediate values, which keep
+// the overshoot of kernels with negative lobes between the passes; other channels are
+// accumulated in floating point. The horizontally resampled rows are kept in a ring of as many
+// rows as the vertical kernel has taps, so that each band of output rows resamples the source
+// rows it needs once, while they are in cache.
+
+/// \brief Number of fractional bits of the fixed point weights of 8-bit channels
+constexpr int resample_fixed_bits = 14;
+
+/// \brief Number of fractional bits of the horizontally resampled 8-bit channels, which range
+/// over [-256, 256) times the sum of the positive weights
+constexpr int resample_intermediate_bits = 6;
+
+/// \brief Weights of one axis of a separable resampling
+struct resample_axis
+{
+    /// Number of weights stored per output coordinate
+    std::ptrdiff_t taps = 0;
+    /// Index of the source coordinate of the first weight of each output coordinate
+    std::vector<std::ptrdiff_t> first;
+    /// Number of weights used by each output coordinate, the others being zero
+    std::vector<std::ptrdiff_t> count;
+    /// Weights of each output coordinate, normalized to add up to one
+    std::vector<float> weights;
+    /// Weights scaled by 2^resample_fixed_bits, adding up to exactly 2^resample_fixed_bits
+    std::vector<std::int16_t> fixed_weights;
+};
+
+/// \brief Sets the \p count weights of output coordinate \p i of an axis, starting at source
+/// coordinate \p first, from weights adding up to \p total
+inline void set_resample_weights(
+    resample_axis& axis,
+    std::size_t i,
+    std::ptrdiff_t first,
+    double const* w,
+    std::ptrdiff_t count,
+    double total)
+{
+    std::size_t const taps = static_cast<std::size_t>(axis.taps);
+    axis.first[i] = first;
+    axis.count[i] = count;
+    float* weights = axis.weights.data() + i * taps;
+    std::int16_t* fixed = axis.fixed_weights.data() + i * taps;
+    double const one = static_cast<double>(1 << resample_fixed_bits);
+    int fixed_total = 0;
+    std::size_t largest = 0;
+    for (std::size_t k = 0; k < static_cast<std::size_t>(count); ++k)
+    {
+        double const value = w[k] / total;
+        weights[k] = static_cast<float>(value);
+        fixed[k] = static_cast<std::int16_t>(std::lround(value * one));
+        fixed_total += fixed[k];
+        if (w[k] > w[largest])
+            largest = k;
+    }
+    // Constant rows keep their value exactly
+    fixed[largest] = static_cast<std::int16_t>(
+        fixed[largest] + (1 << resample_fixed_bits) - fixed_total);
+}
+
+/// \brief Computes the weights of an axis of \p src_size pixels resampled to \p dst_size pixels
+/// with a kernel
+///
+/// Output pixel i is centered at (i + 0.5) * src_size / dst_size in the source, in units where
+/// source pixel j covers [j, j + 1). \p kernel provides support(), the half width of the kernel
+/// at scale 1, and operator()(double) giving the kernel at an offset from the center. Source
+/// pixels past the borders are dropped and the remaining weights normalized, which repeats the
+/// borders for kernels with no negative lobes.
+template <typename Kernel>
+inline auto make_resample_axis(
+    std::ptrdiff_t src_size, std::ptrdiff_t dst_size, Kernel const& kernel) -> resample_axis
+{
+    BOOST_ASSERT(src_size > 0 && dst_size > 0);
+    double const scale = static_cast<double>(src_size) / static_cast<double>(dst_size);
+    double const filter_scale = (std::max)(scale, 1.0);
+    double const support = kernel.support() * filter_scale;
+
+    resample_axis axis;
+    axis.taps = 2 * static_cast<std::ptrdiff_t>(std::ceil(support)) + 1;
+    std::size_t const size = static_cast<std::size_t>(dst_size);
+    std::size_t const taps = static_cast<std::size_t>(axis.taps);
+    axis.first.resize(size);
+    axis.count.resize(size);
+    axis.weights.assign(size * taps, 0.0f);
+    axis.fixed_weights.assign(size * taps, 0);
+
+    std::vector<double> w(taps);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        double const center = (static_cast<double>(i) + 0.5) * scale;
+        std::ptrdiff_t lo = (std::max)(
+            static_cast<std::ptrdiff_t>(std::floor(center - support + 0.5)), std::ptrdiff_t(0));
+        std::ptrdiff_t hi = (std::min)(
+            static_cast<std::ptrdiff_t>(std::floor(center + support + 0.5)), src_size);
+        hi = (std::min)(hi, lo + axis.taps);
+
+        double total = 0.0;
+        for (std::ptrdiff_t j = lo; j < hi; ++j)
+        {
+            double const value =
+                kernel((static_cast<double>(j) - center + 0.5) / filter_scale);
+            w[static_cast<std::size_t>(j - lo)] = value;
+            total += value;
+        }
+
+        // Drop the zero weights at both ends, so that identity axes take a single tap
+        std::size_t begin = 0;
+        std::size_t end = static_cast<std::size_t>((std::max)(hi - lo, std::ptrdiff_t(0)));
+        while (begin < end && !(std::abs(w[begin]) > 0.0))
+            ++begin;
+        while (end > begin && !(std::abs(w[end - 1]) > 0.0))
+            --end;
+        if (begin == end || !(std::abs(total) > 0.0))
+        {
+            // No source pixel under the kernel, take the nearest one
+            lo = (std::min)(
+                (std::max)(static_cast<std::ptrdiff_t>(center), std::ptrdiff_t(0)), src_size - 1);
+            begin = 0;
+            end = 1;
+            w[0] = 1.0;
+            total = 1.0;
+        }
+
+        set_resample_weights(axis, i, lo + static_cast<std::ptrdiff_t>(begin), w.data() + begin,
+            static_cast<std::ptrdiff_t>(end - begin), total);
+    }
+    return axis;
+}
+
+/// \brief Computes the weights of an axis of \p src_size pixels averaged over the areas of
+/// \p dst_size pixels
+///
+/// Output pixel i covers [i, i + 1) * src_size / dst_size in the source, in units where source
+/// pixel j covers [j, j + 1), and is the mean of the source pixels weighted by the length of
+/// their overlap with it.
+inline auto make_area_axis(std::ptrdiff_t src_size, std::ptrdiff_t dst_size) -> resample_axis
+{
+    BOOST_ASSERT(src_size > 0 && dst_size > 0);
+    double const scale = static_cast<double>(src_size) / static_cast<double>(dst_size);
+
+    resample_axis axis;
+    axis.taps = static_cast<std::ptrdiff_t>(std::ceil(scale)) + 1;
+    std::size_t const size = static_cast<std::size_t>(dst_size);
+    std::size_t const taps = static_cast<std::size_t>(axis.taps);
+    axis.first.resize(size);
+    axis.count.resize(size);
+    axis.weights.assign(size * taps, 0.0f);
+    axis.fixed_weights.assign(size * taps, 0);
+
+    std::vector<double> w(taps);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        // Multiplied out rather than accumulated, so that integer ratios give exact bounds
+        double const lo = static_cast<double>(i) * scale;
+        double const hi = (i + 1 == size) ? static_cast<double>(src_size)
+            : static_cast<double>(i + 1) * scale;
+        std::ptrdiff_t const first = static_cast<std::ptrdiff_t>(std::floor(lo));
+        std::ptrdiff_t const last = (std::min)(
+            (std::min)(static_cast<std::ptrdiff_t>(std::ceil(hi)), src_size), first + axis.taps);
+        double total = 0.0;
+        for (std::ptrdiff_t j = first; j < last; ++j)
+        {
+            double const overlap = (std::min)(hi, static_cast<double>(j + 1)) -
+                (std::max)(lo, static_cast<double>(j));
+            w[static_cast<std::size_t>(j - first)] = overlap;
+            total += overlap;
+        }
+        set_resample_weights(axis, i, first, w.data(), last - first, total);
+    }
+    return axis;
+}
+
+/// \brief Determines whether resampling accumulates channels of type \p T in fixed point
+template <typename T>
+struct is_resample_fixed_point : std::is_same<T, std::uint8_t> {};
+
+/// \brief Type accumulating channels of type \p T resampled in floating point
+template <typename T>
+using resample_accum_t = typename std::conditional
+<
+    std::is_same<T, float>::value || (std::is_integral<T>::value && sizeof(T) <= 2),
+    float,
+    double
+>::type;
+
+template <typename T, typename Accum>
+inline auto resample_round(Accum value, std::true_type /* integral */) -> T
+{
+    Accum const lo = static_cast<Accum>((std::numeric_limits<T>::min)());
+    Accum const hi = static_cast<Accum>((std::numeric_limits<T>::max)());
+    return static_cast<T>(std::floor((std::min)((std::max)(value, lo), hi) + Accum(0.5)));
+}
+
+template <typename T, typename Accum>
+inline auto resample_round(Accum value, std::false_type /* integral */) -> T
+{
+    return static_cast<T>(value);
+}
+
+/// \brief Converts an accumulated value to a channel, rounding and saturating integers
+template <typename T, typename Accum>
+inline auto resample_round(Accum value) -> T
+{
+    return resample_round<T>(value, std::is_integral<T>());
+}
+
+/// \brief Rounds a fixed point sum of 8-bit values to an intermediate value
+inline auto resample_round_intermediate(std::int32_t value) -> std::int16_t
+{
+    value >>= resample_fixed_bits - resample_intermediate_bits;
+    return static_cast<std::int16_t>(value < -32768 ? -32768 : (value > 32767 ? 32767 : value));
+}
+
+/// \brief Saturates a fixed point sum of intermediate values to an 8-bit value
+inline auto resample_round_fixed(std::int32_t value) -> std::uint8_t
+{
+    value >>= resample_fixed_bits + resample_intermediate_bits;
+    return static_cast<std::uint8_t>(value < 0 ? 0 : (value > 255 ? 255 : value));
+}
+
+/// \brief Resamples one pixel of \p N channels horizontally in fixed point from the \p count
+/// pixels starting at \p src
+template <std::size_t N>
+inline void resample_pixel_horizontal(
+    std::uint8_t const* src,
+    std::int16_t const* weights,
+    std::ptrdiff_t count,
+    std::int16_t* dst,
+    std::integral_constant<std::size_t, N>)
+{
+    std::int32_t acc[N];
+    for (std::size_t c = 0; c < N; ++c)
+        acc[c] = 1 << (resample_fixed_bits - resample_intermediate_bits - 1);
+    for (std::ptrdiff_t k = 0; k < count; ++k, src += N)
+    {
+        for (std::size_t c = 0; c < N; ++c)
+            acc[c] += weights[k] * src[c];
+    }
+    for (std::size_t c = 0; c < N; ++c)
+        dst[c] = resample_round_intermediate(acc[c]);
+}
+
+// The vectorized pixels of 3 channels read up to 2 bytes past the last source pixel and write
+// a fourth value to dst.
+
+#if defined(BOOST_GIL_SIMD_SSE2)
+/// \brief Pairs the channels of two adjacent pixels of 3 or 4 channels loaded from \p src
+template <int N>
+inline auto resample_load_pixel_pair(std::uint8_t const* src) -> __m128i
+{
+    __m128i const v = _mm_unpacklo_epi8(
+        _mm_loadl_epi64(reinterpret_cast<__m128i const*>(src)), _mm_setzero_si128());
+    return _mm_unpacklo_epi16(v, _mm_srli_si128(v, 2 * N));
+}
+
+/// \brief Sums the channels of \p count adjacent pixels of 3 or 4 channels times their
+/// weights, two pixels per multiply-add of pairs of 16-bit values
+template <int N>
+inline void resample_pixel_horizontal_sse2(
+    std::uint8_t const* src, std::int16_t const* weights, std::ptrdiff_t count, std::int16_t* dst)
+{
+    __m128i acc = _mm_set1_epi32(1 << (resample_fixed_bits - resample_intermediate_bits - 1));
+    std::ptrdiff_t k = 0;
+    for (; k + 2 <= count; k += 2, src += 2 * N)
+    {
+        std::int32_t pair;
+        std::memcpy(&pair, weights + k, sizeof(pair));
+        acc = _mm_add_epi32(
+            acc, _mm_madd_epi16(resample_load_pixel_pair<N>(src), _mm_set1_epi32(pair)));
+    }
+    if (k < count)
+    {
+        std::int32_t pixel;
+        std::memcpy(&pixel, src, sizeof(pixel));
+        __m128i const zero = _mm_setzero_si128();
+        __m128i const v = _mm_unpacklo_epi16(
+            _mm_unpacklo_epi8(_mm_cvtsi32_si128(pixel), zero), zero);
+        acc = _mm_add_epi32(acc, _mm_madd_epi16(v, _mm_set1_epi32(std::uint16_t(weights[k]))));
+    }
+    acc = _mm_srai_epi32(acc, resample_fixed_bits - resample_intermediate_bits);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packs_epi32(acc, acc));
+}
+
+inline void resample_pixel_horizontal(
+    std::uint8_t const* src,
+    std::int16_t const* weights,
+    std::ptrdiff_t count,
+    std::int16_t* dst,
+    std::integral_constant<std::size_t, 3>)
+{
+    resample_pixel_horizontal_sse2<3>(src, weights, count, dst);
+}
+
+inline void resample_pixel_horizontal(
+    std::uint8_t const* src,
+    std::int16_t const* weights,
+    std::ptrdiff_t count,
+    std::int16_t* dst,
+    std::integral_constant<std::size_t, 4>)
+{
+    resample_pixel_horizontal_sse2<4>(src, weights, count, dst);
+}
+#elif defined(BOOST_GIL_SIMD_NEON)
+/// \brief Sums the channels of \p count adjacent pixels of 3 or 4 channels times their
+/// weights, one pixel per widening multiply-add
+template <int N>
+inline void resample_pixel_horizontal_neon(
+    std::uint8_t const* src, std::int16_t const* weights, std::ptrdiff_t count, std::int16_t* dst)
+{
+    int32x4_t acc = vdupq_n_s32(1 << (resample_fixed_bits - resample_intermediate_bits - 1));
+    for (std::ptrdiff_t k = 0; k < count; ++k, src += N)
+    {
+        std::uint32_t pixel;
+        std::memcpy(&pixel, src, sizeof(pixel));
+        int16x4_t const v = vget_low_s16(
+            vreinterpretq_s16_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(pixel)))));
+        acc = vmlal_n_s16(acc, v, weights[k]);
+    }
+    vst1_s16(dst, vqmovn_s32(vshrq_n_s32(acc, resample_fixed_bits - resample_intermediate_bits)));
+}
+
+inline void resample_pixel_horizontal(
+    std::uint8_t const* src,
+    std::int16_t const* weights,
+    std::ptrdiff_t count,
+    std::int16_t* dst,
+    std::integral_constant<std::size_t, 3>)
+{
+    resample_pixel_horizontal_neon<3>(src, weights, count, dst);
+}
+
+inline void resample_pixel_horizontal(
+    std::uint8_t const* src,
+    std::int16_t const* weights,
+    std::ptrdiff_t count,
+    std::int16_t* dst,
+    std::integral_constant<std::size_t, 4>)
+{
+    resample_pixel_horizontal_neon<4>(src, weights, count, dst);
+}
+#endif
+
+/// \brief Resamples a row of \p width pixels of \p N channels horizontally in fixed point
+///
+/// \p dst must have room for one more value than the resampled row.
+template <std::size_t N>
+inline void resample_row_horizontal(
+    std::uint8_t const* src, std::ptrdiff_t width, std::int16_t* dst, resample_axis const& axis)
+{
+    using channels_t = std::integral_constant<std::size_t, N>;
+    std::size_t const taps = static_cast<std::size_t>(axis.taps);
+    // Pixels whose vectorized loads would read past the row are resampled by the scalar code
+    std::ptrdiff_t const n = static_cast<std::ptrdiff_t>(N);
+    std::ptrdiff_t const end = (width + 2) * n - 8;
+    // Local copies, as the vector stores may alias the axis
+    std::size_t const size = axis.first.size();
+    std::ptrdiff_t const* first = axis.first.data();
+    std::ptrdiff_t const* count = axis.count.data();
+    std::int16_t const* w = axis.fixed_weights.data();
+    for (std::size_t x = 0; x < size; ++x, dst += N, w += taps)
+    {
+        std::uint8_t const* s = src + static_cast<std::size_t>(first[x]) * N;
+        if ((first[x] + count[x]) * n <= end)
+            resample_pixel_horizontal(s, w, count[x], dst, channels_t());
+        else
+            resample_pixel_horizontal<N>(s, w, count[x], dst, channels_t());
+    }
+}
+
+/// \brief Resamples a row of pixels of \p N channels horizontally in floating point
+template <std::size_t N, typename T, typename Accum>
+inline void resample_row_horizontal(
+    T const* src, std::ptrdiff_t, Accum* dst, resample_axis const& axis)
+{
+    std::size_t const taps = static_cast<std::size_t>(axis.taps);
+    for (std::size_t x = 0; x < axis.first.size(); ++x, dst += N)
+    {
+        float const* w = axis.weights.data() + x * taps;
+        T const* s = src + static_cast<std::size_t>(axis.first[x]) * N;
+        Accum acc[N] = {};
+        for (std::ptrdiff_t k = 0; k < axis.count[x]; ++k, s += N)
+        {
+            for (std::size_t c = 0; c < N; ++c)
+                acc[c] += static_cast<Accum>(w[k]) * static_cast<Accum>(s[c]);
+        }
+        for (std::size_t c = 0; c < N; ++c)
+            dst[c] = acc[c];
+    }
+}
+
+#if defined(BOOST_GIL_SIMD_SSE2)
+inline auto resample_load_floats(std::uint16_t const* src) -> __m128
+{
+    __m128i const values = _mm_loadl_epi64(reinterpret_cast<__m128i const*>(src));
+    return _mm_cvtepi32_ps(_mm_unpacklo_epi16(values, _mm_setzero_si128()));
+}
+
+inline auto resample_load_floats(float const* src) -> __m128
+{
+    return _mm_loadu_ps(src);
+}
+
+/// \brief Sums the channels of \p count adjacent pixels of 3 or 4 channels times their
+/// weights, reading and writing 4 values per pixel
+template <typename T>
+inline void resample_pixel_horizontal_sse2(
+    T const* src, float const* weights, std::ptrdiff_t count, std::size_t n, float* dst)
+{
+    __m128 sum = _mm_setzero_ps();
+    for (std::ptrdiff_t k = 0; k < count; ++k, src += n)
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(weights[k]), resample_load_floats(src)));
+    _mm_storeu_ps(dst, sum);
+}
+#elif defined(BOOST_GIL_SIMD_NEON)
+inline auto resample_load_floats(std::uint16_t const* src) -> float32x4_t
+{
+    return vcvtq_f32_u32(vmovl_u16(vld1_u16(src)));
+}
+
+inline auto resample_load_floats(float const* src) -> float32x4_t
+{
+    return vld1q_f32(src);
+}
+
+/// \brief Sums the channels of \p count adjacent pixels of 3 or 4 channels times their
+/// weights, reading and writing 4 values per pixel
+template <typename T>
+inline void resample_pixel_horizontal_neon(
+    T const* src, float const* weights, std::ptrdiff_t count, std::size_t n, float* dst)
+{
+    float32x4_t sum = vdupq_n_f32(0.0f);
+    for (std::ptrdiff_t k = 0; k < count; ++k, src += n)
+        sum = vaddq_f32(sum, vmulq_n_f32(resample_load_floats(src), weights[k]));
+    vst1q_f32(dst, sum);
+}
+#endif
+
+/// \brief Resamples a row of \p width pixels of 16-bit or floating point channels
+/// horizontally in single precision, a pixel of 3 or 4 channels at a time
+///
+/// As for 8-bit channels, pixels of 3 channels read one value past their last tap and write
+/// one value past their result, so the pixels whose taps end the row are computed one channel
+/// at a time.
+template <std::size_t N, typename T>
+inline void resample_row_horizontal_float(
+    T const* src, std::ptrdiff_t width, float* dst, resample_axis const& axis)
+{
+    std::size_t const taps = static_cast<std::size_t>(axis.taps);
+    std::ptrdiff_t const* first = axis.first.data();
+    std::ptrdiff_t const* count = axis.count.data();
+    float const* weights = axis.weights.data();
+    std::ptrdiff_t const n = static_cast<std::ptrdiff_t>(N);
+    std::ptrdiff_t const end = width * n - 4;
+    for (std::size_t x = 0; x < axis.first.size(); ++x, dst += N)
+    {
+        float const* w = weights + x * taps;
+        T const* s = src + first[x] * n;
+#if defined(BOOST_GIL_SIMD_SSE2)
+        if ((first[x] + count[x] - 1) * n <= end)
+        {
+            resample_pixel_horizontal_sse2(s, w, count[x], N, dst);
+            continue;
+        }
+#elif defined(BOOST_GIL_SIMD_NEON)
+        if ((first[x] + count[x] - 1) * n <= end)
+        {
+            resample_pixel_horizontal_neon(s, w, count[x], N, dst);
+            continue;
+        }
+#else
+        boost::ignore_unused(end);
+#endif
+        float acc[N] = {};
+        for (std::ptrdiff_t k = 0; k < count[x]; ++k, s += N)
+        {
+            for (std::size_t c = 0; c < N; ++c)
+                acc[c] += w[k] * static_cast<float>(s[c]);
+        }
+        for (std::size_t c = 0; c < N; ++c)
+            dst[c] = acc[c];
+    }
+}
+
+template <std::size_t N, typename T>
+inline void resample_row_horizontal(
+    T const* src,
+    std::ptrdiff_t width,
+    float* dst,
+    resample_axis const& axis,
+    std::true_type /* vectorized */)
+{
+    resample_row_horizontal_float<N>(src, width, dst, axis);
+}
+
+template <std::size_t N, typename T>
+inline void resample_row_horizontal(
+    T const* src,
+    std::ptrdiff_t width,
+    float* dst,
+    resample_axis const& axis,
+    std::false_type /* vectorized */)
+{
+    resample_row_horizontal<N, T, float>(src, width, dst, axis);
+}
+
+/// \brief Resamples a row of pixels of \p N channels of 16 bits or single precision
+/// horizontally in single precision
+template <std::size_t N, typename T>
+inline auto resample_row_horizontal(
+    T const* src, std::ptrdiff_t width, float* dst, resample_axis const& axis)
+    -> typename std::enable_if
+    <
+        std::is_same<T, std::uint16_t>::value || std::is_same<T, float>::value
+    >::type
+{
+    resample_row_horizontal<N>(src, width, dst, axis,
+        std::integral_constant<bool, N == 3 || N == 4>());
+}
+
+#if defined(BOOST_GIL_SIMD_SSE2)
+/// \brief Combines the first values of \p count rows of intermediate values with fixed point
+/// weights, 16 at a time, two rows per multiply-add of pairs of 16-bit values, and returns how
+/// many were combined
+inline auto resample_rows_vertical_sse2(
+    std::int16_t const* const* rows,
+    std::int16_t const* weights,
+    std::ptrdiff_t count,
+    std::uint8_t* dst,
+    std::size_t size) -> std::size_t
+{
+    __m128i const half =
+        _mm_set1_epi32(1 << (resample_fixed_bits + resample_intermediate_bits - 1));
+    __m128i const zero = _mm_setzero_si128();
+    std::size_t i = 0;
+    for (; i + 16 <= size; i += 16)
+    {
+        __m128i acc[4] = {half, half, half, half};
+        for (std::ptrdiff_t k = 0; k < count; k += 2)
+        {
+            std::int16_t const* row0 = rows[k] + i;
+            __m128i const lo0 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(row0));
+            __m128i const hi0 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(row0 + 8));
+            __m128i lo1 = zero;
+            __m128i hi1 = zero;
+            std::int32_t pair = std::uint16_t(weights[k]);
+            if (k + 1 < count)
+            {
+                std::int16_t const* row1 = rows[k + 1] + i;
+                lo1 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(row1));
+                hi1 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(row1 + 8));
+                std::memcpy(&pair, weights + k, sizeof(pair));
+            }
+            __m128i const w = _mm_set1_epi32(pair);
+            acc[0] = _mm_add_epi32(acc[0], _mm_madd_epi16(_mm_unpacklo_epi16(lo0, lo1), w));
+            acc[1] = _mm_add_epi32(acc[1], _mm_madd_epi16(_mm_unpackhi_epi16(lo0, lo1), w));
+            acc[2] = _mm_add_epi32(acc[2], _mm_madd_epi16(_mm_unpacklo_epi16(hi0, hi1), w));
+            acc[3] = _mm_add_epi32(acc[3], _mm_madd_epi16(_mm_unpackhi_epi16(hi0, hi1), w));
+        }
+        for (int j = 0; j < 4; ++j)
+            acc[j] = _mm_srai_epi32(acc[j], resample_fixed_bits + resample_intermediate_bits);
+        __m128i const lo = _mm_packs_epi32(acc[0], acc[1]);
+        __m128i const hi = _mm_packs_epi32(acc[2], acc[3]);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(lo, hi));
+    }
+    return i;
+}
+#elif defined(BOOST_GIL_SIMD_NEON)
+/// \brief Combines the first values of \p count rows of intermediate values with fixed point
+/// weights, 8 at a time, and returns how many were combined
+inline auto resample_rows_vertical_neon(
+    std::int16_t const* const* rows,
+    std::int16_t const* weights,
+    std::ptrdiff_t count,
+    std::uint8_t* dst,
+    std::size_t size) -> std::size_t
+{
+    int32x4_t const half =
+        vdupq_n_s32(1 << (resample_fixed_bits + resample_intermediate_bits - 1));
+    std::size_t i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        int32x4_t lo = half;
+        int32x4_t hi = half;
+        for (std::ptrdiff_t k = 0; k < count; ++k)
+        {
+            int16x8_t const v = vld1q_s16(rows[k] + i);
+            lo = vmlal_n_s16(lo, vget_low_s16(v), weights[k]);
+            hi = vmlal_n_s16(hi, vget_high_s16(v), weights[k]);
+        }
+        int16x8_t const v = vcombine_s16(
+            vqmovn_s32(vshrq_n_s32(lo, resample_fixed_bits + resample_intermediate_bits)),
+            vqmovn_s32(vshrq_n_s32(hi, resample_fixed_bits + resample_intermediate_bits)));
+        vst1_u8(dst + i, vqmovun_s16(v));
+    }
+    return i;
+}
+#endif
+
+/// \brief Combines \p count rows of \p size intermediate values with fixed point weights
+inline void resample_rows_vertical(
+    std::int16_t const* const* rows,
+    std::int16_t const* weights,
+    std::ptrdiff_t count,
+    std::uint8_t* dst,
+    std::int32_t* acc,
+    std::size_t size)
+{
+    std::size_t begin = 0;
+#if defined(BOOST_GIL_SIMD_SSE2)
+    begin = resample_rows_vertical_sse2(rows, weights, count, dst, size);
+#elif defined(BOOST_GIL_SIMD_NEON)
+    begin = resample_rows_vertical_neon(rows, weights, count, dst, size);
+#endif
+    std::int32_t const half = 1 << (resample_fixed_bits + resample_intermediate_bits - 1);
+    std::fill(acc + begin, acc + size, half);
+    for (std::ptrdiff_t k = 0; k < count; ++k)
+    {
+        std::int16_t const* row = rows[k];
+        std::int32_t const w = weights[k];
+        for (std::size_t i = begin; i < size; ++i)
+            acc[i] += w * row[i];
+    }
+    for (std::size_t i = begin; i < size; ++i)
+        dst[i] = resample_round_fixed(acc[i]);
+}
+
+/// \brief Combines \p count rows of \p size floating point values with weights
+template <typename T, typename Accum>
+inline void resample_rows_vertical(
+    Accum const* const* rows,
+    float const* weights,
+    std::ptrdiff_t count,
+    T* dst,
+    Accum* acc,
+    std::size_t size)
+{
+    std::fill(acc, acc + size, Accum(0));
+    for (std::ptrdiff_t k = 0; k < count; ++k)
+    {
+        Accum const* row = rows[k];
+        Accum const w = static_cast<Accum>(weights[k]);
+        for (std::size_t i = 0; i < size; ++i)
+            acc[i] += w * row[i];
+    }
+    for (std::size_t i = 0; i < size; ++i)
+        dst[i] = resample_round<T>(acc[i]);
+}
+
+/// \brief Sums the first values of \p count rows of single precision values times their
+/// weights, 8 at a time, and returns how many were summed
+inline auto resample_sum_rows(
+    float const* const* rows,
+    float const* weights,
+    std::ptrdiff_t count,
+    float* acc,
+    std::size_t size) -> std::size_t
+{
+    std::size_t i = 0;
+#if defined(BOOST_GIL_SIMD_SSE2)
+    for (; i + 8 <= size; i += 8)
+    {
+        __m128 sum0 = _mm_setzero_ps();
+        __m128 sum1 = _mm_setzero_ps();
+        for (std::ptrdiff_t k = 0; k < count; ++k)
+        {
+            __m128 const w = _mm_set1_ps(weights[k]);
+            sum0 = _mm_add_ps(sum0, _mm_mul_ps(w, _mm_loadu_ps(rows[k] + i)));
+            sum1 = _mm_add_ps(sum1, _mm_mul_ps(w, _mm_loadu_ps(rows[k] + i + 4)));
+        }
+        _mm_storeu_ps(acc + i, sum0);
+        _mm_storeu_ps(acc + i + 4, sum1);
+    }
+#elif defined(BOOST_GIL_SIMD_NEON)
+    for (; i + 8 <= size; i += 8)
+    {
+        float32x4_t sum0 = vdupq_n_f32(0.0f);
+        float32x4_t sum1 = vdupq_n_f32(0.0f);
+        for (std::ptrdiff_t k = 0; k < count; ++k)
+        {
+            sum0 = vaddq_f32(sum0, vmulq_n_f32(vld1q_f32(rows[k] + i), weights[k]));
+            sum1 = vaddq_f32(sum1, vmulq_n_f32(vld1q_f32(rows[k] + i + 4), weights[k]));
+        }
+        vst1q_f32(acc + i, sum0);
+        vst1q_f32(acc + i + 4, sum1);
+    }
+#else
+    boost::ignore_unused(rows, weights, count, acc, size);
+#endif
+    return i;
+}
+
+/// \brief Rounds and saturates \p size single precision values to 16-bit values
+inline void resample_round_values(float const* acc, std::uint16_t* dst, std::size_t size)
+{
+    std::size_t i = 0;
+#if defined(BOOST_GIL_SIMD_SSE2)
+    __m128 const lo = _mm_setzero_ps();
+    __m128 const hi = _mm_set1_ps(65535.0f);
+    __m128 const half = _mm_set1_ps(0.5f);
+    __m128i const bias = _mm_set1_epi32(32768);
+    __m128i const flip = _mm_set1_epi16(-32768);
+    for (; i + 8 <= size; i += 8)
+    {
+        // Values are non-negative, so truncation after adding a half rounds as floor does.
+        // Packing with signed saturation takes values biased to the range of int16.
+        __m128 const v0 = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(acc + i), lo), hi);
+        __m128 const v1 = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(acc + i + 4), lo), hi);
+        __m128i const r0 = _mm_sub_epi32(_mm_cvttps_epi32(_mm_add_ps(v0, half)), bias);
+        __m128i const r1 = _mm_sub_epi32(_mm_cvttps_epi32(_mm_add_ps(v1, half)), bias);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+            _mm_xor_si128(_mm_packs_epi32(r0, r1), flip));
+    }
+#elif defined(BOOST_GIL_SIMD_NEON)
+    float32x4_t const lo = vdupq_n_f32(0.0f);
+    float32x4_t const hi = vdupq_n_f32(65535.0f);
+    float32x4_t const half = vdupq_n_f32(0.5f);
+    for (; i + 8 <= size; i += 8)
+    {
+        float32x4_t const v0 = vminq_f32(vmaxq_f32(vld1q_f32(acc + i), lo), hi);
+        float32x4_t const v1 = vminq_f32(vmaxq_f32(vld1q_f32(acc + i + 4), lo), hi);
+        uint16x4_t const r0 = vmovn_u32(vcvtq_u32_f32(vaddq_f32(v0, half)));
+        uint16x4_t const r1 = vmovn_u32(vcvtq_u32_f32(vaddq_f32(v1, half)));
+        vst1q_u16(dst + i, vcombine_u16(r0, r1));
+    }
+#endif
+    for (; i < size; ++i)
+        dst[i] = resample_round<std::uint16_t>(acc[i]);
+}
+
+inline void resample_round_values(float const* acc, float* dst, std::size_t size)
+{
+    std::copy(acc, acc + size, dst);
+}
+
+/// \brief Combines \p count rows of \p size single precision values with weights to 16-bit
+/// or single precision values
+template <typename T>
+inline auto resample_rows_vertical(
+    float const* const* rows,
+    float const* weights,
+    std::ptrdiff_t count,
+    T* dst,
+    float* acc,
+    std::size_t size)
+    -> typename std::enable_if
+    <
+        std::is_same<T, std::uint16_t>::value || std::is_same<T, float>::value
+    >::type
+{
+    std::size_t const begin = resample_sum_rows(rows, weights, count, acc, size);
+    std::fill(acc + begin, acc + size, 0.0f);
+    for (std::ptrdiff_t k = 0; k < count; ++k)
+    {
+        float const* row = rows[k];
+        float const w = weights[k];
+        for (std::size_t i = begin; i < size; ++i)
+            acc[i] += w * row[i];
+    }
+    resample_round_values(acc, dst, size);
+}
+
+/// \brief Determines whether the channels of a pixel are arithmetic values that can be
+/// resampled, rather than bits of a packed pixel
+template
+<
+    typename Pixel,
+    typename T = typename base_channel_type<typename channel_type<Pixel>::type>::type
+>
+struct is_resample_pixel : std::integral_constant<bool,
+    std::is_arithmetic<T>::value && !std::is_same<T, bool>::value &&
+    sizeof(Pixel) == num_channels<Pixel>::value * sizeof(T)>
+{};
+
+/// \brief Determines whether the rows of a view are flat arrays of channels of type \p T
+template <typename View, typename T>
+struct is_resample_flat_view : std::integral_constant<bool,
+    std::is_pointer<typename View::x_iterator>::value &&
+    is_resample_pixel<typename View::value_type>::value &&
+    std::is_same<typename base_channel_type<typename channel_type<View>::type>::type, T>::value>
+{};
+
+/// \brief Returns row \p y of a view as a flat array of channels, copying it to \p buffer
+/// unless the view stores it so
+template <typename T, typename View>
+inline auto resample_load_row(View const& view, std::ptrdiff_t y, std::vector<T>&, std::true_type)
+    -> T const*
+{
+    return reinterpret_cast<T const*>(&view.row_begin(y)[0]);
+}
+
+template <typename T, typename View>
+inline auto resample_load_row(
+    View const& view, std::ptrdiff_t y, std::vector<T>& buffer, std::false_type) -> T const*
+{
+    std::size_t const n = num_channels<View>::value;
+    auto it = view.row_begin(y);
+    for (std::ptrdiff_t x = 0; x < view.width(); ++x)
+    {
+        for (std::size_t c = 0; c < n; ++c)
+            buffer[static_cast<std::size_t>(x) * n + c] = static_cast<T>(dynamic_at_c(it[x], c));
+    }
+    return buffer.data();
+}
+
+/// \brief Returns where to write row \p y of a view as a flat array of channels
+template <typename T, typename View>
+inline auto resample_row_target(
+    View const& view, std::ptrdiff_t y, std::vector<T>&, std::true_type) -> T*
+{
+    return reinterpret_cast<T*>(&view.row_begin(y)[0]);
+}
+
+template <typename T, typename View>
+inline auto resample_row_target(
+    View const&, std::ptrdiff_t, std::vector<T>& buffer, std::false_type) -> T*
+{
+    return buffer.data();
+}
+
+/// \brief Copies \p buffer to row \p y of a view unless it was written in place
+template <typename T, typename View>
+inline void resample_store_row(View const&, std::ptrdiff_t, std::vector<T> const&, std::true_type)
+{}
+
+template <typename T, typename View>
+inline void resample_store_row(
+    View const& view, std::ptrdiff_t y, std::vector<T> const& buffer, std::false_type)
+{
+    using channel_t = typename channel_type<View>::type;
+    std::size_t const n = num_channels<View>::value;
+    auto it = view.row_begin(y);
+    for (std::ptrdiff_t x = 0; x < view.width(); ++x)
+    {
+        for (std::size_t c = 0; c < n; ++c)
+            dynamic_at_c(it[x], c) = channel_t(buffer[static_cast<std::size_t>(x) * n + c]);
+    }
+}
+
+/// \brief Resamples a view with precomputed weights, \p Intermediate being the type of the
+/// horizontally resampled values
+template
+<
+    typename Intermediate,
+    typename ExecutionPolicy,
+    typename SrcView,
+    typename DstView,
+    typename Weight
+>
+void resample_separable(
+    ExecutionPolicy const& policy,
+    SrcView const& src,
+    DstView const& dst,
+    resample_axis const& x_axis,
+    resample_axis const& y_axis,
+    std::vector<Weight> const& y_weights)
+{
+    using value_t = typename base_channel_type<typename channel_type<SrcView>::type>::type;
+    using accum_t = typename std::conditional
+        <
+            std::is_same<Intermediate, std::int16_t>::value, std::int32_t, Intermediate
+        >::type;
+    std::size_t const n = num_channels<SrcView>::value;
+    std::size_t const src_size = static_cast<std::size_t>(src.width()) * n;
+    std::size_t const dst_size = static_cast<std::size_t>(dst.width()) * n;
+    std::size_t const y_taps = static_cast<std::size_t>(y_axis.taps);
+    using src_flat_t = is_resample_flat_view<SrcView, value_t>;
+    using dst_flat_t = is_resample_flat_view<DstView, value_t>;
+
+    // Room for the value written past the row by the vectorized horizontal pass
+    std::size_t const row_stride = dst_size + 1;
+
+    for_each_row_band(policy, dst.height(), [&](std::ptrdiff_t y0, std::ptrdiff_t y1)
+    {
+        // Row r of the source is resampled to slot r % y_taps of the ring. The rows of an
+        // output row are consecutive, hence in distinct slots.
+        std::vector<Intermediate> ring(y_taps * row_stride);
+        std::vector<std::ptrdiff_t> ring_rows(y_taps, -1);
+        std::vector<value_t> src_buffer(src_flat_t::value ? 0 : src_size);
+        std::vector<value_t> dst_buffer(dst_flat_t::value ? 0 : dst_size);
+        std::vector<accum_t> acc(dst_size);
+        std::vector<Intermediate const*> taps(y_taps);
+        for (std::ptrdiff_t y = y0; y < y1; ++y)
+        {
+            std::size_t const i = static_cast<std::size_t>(y);
+            for (std::ptrdiff_t k = 0; k < y_axis.count[i]; ++k)
+            {
+                std::ptrdiff_t const r = y_axis.first[i] + k;
+                std::size_t const slot = static_cast<std::size_t>(r) % y_taps;
+                Intermediate* row = ring.data() + slot * row_stride;
+                if (ring_rows[slot] != r)
+                {
+                    value_t const* src_row = resample_load_row(src, r, src_buffer, src_flat_t());
+                    resample_row_horizontal<num_channels<SrcView>::value>(
+                        src_row, src.width(), row, x_axis);
+                    ring_rows[slot] = r;
+                }
+                taps[static_cast<std::size_t>(k)] = row;
+            }
+            value_t* target = resample_row_target(dst, y, dst_buffer, dst_flat_t());
+            resample_rows_vertical(
+                taps.data(), y_weights.data() + i * y_taps, y_axis.count[i], target, acc.data(),
+                dst_size);
+            resample_store_row(dst, y, dst_buffer, dst_flat_t());
+        }
+    });
+}
+
+template <typename ExecutionPolicy, typename SrcView, typename DstView>
+void resample_separable(
+    ExecutionPolicy const& policy,
+    SrcView const& src,
+    DstView const& dst,
+    resample_axis const& x_axis,
+    resample_axis const& y_axis,
+    std::true_type /* fixed point */)
+{
+    resample_separable<std::int16_t>(policy, src, dst, x_axis, y_axis, y_axis.fixed_weights);
+}
+
+template <typename ExecutionPolicy, typename SrcView, typename DstView>
+void resample_separable(
+    ExecutionPolicy const& policy,
+    SrcView const& src,
+    DstView const& dst,
+    resample_axis const& x_axis,
+    resample_axis const& y_axis,
+    std::false_type /* fixed point */)
+{
+    using value_t = typename base_channel_type<typename channel_type<SrcView>::type>::type;
+    resample_separable<resample_accum_t<value_t>>(
+        policy, src, dst, x_axis, y_axis, y_axis.weights);
+}
+
+/// \brief Resamples \p src to the dimensions of \p dst with the weights of its axes, in bands
+/// of rows according to an execution policy
+template <typename ExecutionPolicy, typename SrcView, typename DstView>
+void resample_separable(
+    ExecutionPolicy const& policy,
+    SrcView const& src,
+    DstView const& dst,
+    resample_axis const& x_axis,
+    resample_axis const& y_axis)
+{
+    using value_t = typename base_channel_type<typename channel_type<SrcView>::type>::type;
+    static_assert(std::is_same<typename SrcView::value_type, typename DstView::value_type>::value,
+        "Source and destination views must have the same pixel type");
+    static_assert(is_resample_pixel<typename SrcView::value_type>::value,
+        "Resampling requires channels stored as arithmetic values");
+
+    if (src.width() == 0 || src.height() == 0 || dst.width() == 0 || dst.height() == 0)
+        return;
+
+    resample_separable(policy, src, dst, x_axis, y_axis, is_resample_fixed_point<value_t>());
+}
+
+/// \brief Resamples \p src to the dimensions of \p dst with a separable kernel, in bands of
+/// rows according to an execution policy
+template <typename ExecutionPolicy, typename SrcView, typename DstView, typename Kernel>
+void resample_separable(
+    ExecutionPolicy const& policy, SrcView const& src, DstView const& dst, Kernel const& kernel)
+{
+    if (src.width() == 0 || src.height() == 0 || dst.width() == 0 || dst.height() == 0)
+        return;
+
+    resample_separable(policy, src, dst,
+        make_resample_axis(src.width(), dst.width(), kernel),
+        make_resample_axis(src.height(), dst.height(), kernel));
+}
+
+}}} // namespace boost::gil::detail
+
+#endif
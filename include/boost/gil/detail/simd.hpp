@@ -0,0 +1,52 @@
+//
+// Copyright 2026 Boost.GIL Contributors
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#ifndef BOOST_GIL_DETAIL_SIMD_HPP
+#define BOOST_GIL_DETAIL_SIMD_HPP
+
+// Compile-time selection of the instruction sets used by the vectorized fast paths.
+//
+// The instruction sets are taken from the compiler target options (e.g. -mavx2, /arch:AVX2),
+// there is no runtime dispatch. Algorithms fall back to portable scalar code when none of
+// the instruction sets they need is enabled.
+//
+// Define BOOST_GIL_DISABLE_SIMD to use the scalar code only.
+
+#if !defined(BOOST_GIL_DISABLE_SIMD)
+
+#if defined(__AVX2__)
+#define BOOST_GIL_SIMD_AVX2
+#endif
+
+#if defined(__SSSE3__) || defined(__AVX__) || defined(BOOST_GIL_SIMD_AVX2)
+#define BOOST_GIL_SIMD_SSSE3
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) \
+    || defined(BOOST_GIL_SIMD_SSSE3)
+#define BOOST_GIL_SIMD_SSE2
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define BOOST_GIL_SIMD_NEON
+#endif
+
+#endif // !BOOST_GIL_DISABLE_SIMD
+
+#if defined(BOOST_GIL_SIMD_AVX2)
+#include <immintrin.h>
+#elif defined(BOOST_GIL_SIMD_SSSE3)
+#include <tmmintrin.h>
+#elif defined(BOOST_GIL_SIMD_SSE2)
+#include <emmintrin.h>
+#endif
+
+#if defined(BOOST_GIL_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+#endif
@@ -0,0 +1,214 @@
+//
+// Copyright 2026 Boost.GIL Contributors
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#ifndef BOOST_GIL_EXECUTION_HPP
+#define BOOST_GIL_EXECUTION_HPP
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace boost { namespace gil {
+
+/// \defgroup ExecutionPolicy Execution Policies
+/// \ingroup ImageViewAlgorithm
+/// \brief Policies controlling how view algorithms distribute their work
+///
+/// Algorithms taking an execution policy as their first argument split the view into
+/// bands of whole rows and process each band as an independent task. The result is the
+/// same as for the serial algorithm, as long as the function objects involved do not
+/// depend on the order in which the pixels are visited.
+///
+/// An execution policy \p p models the following requirements:
+/// - \p p.concurrency() returns the number of tasks worth running at the same time,
+/// - \p p.bulk_execute(n, f) invokes \p f(i) for every \p i in <tt>[0, n)</tt> and returns
+///   after all invocations completed, rethrowing an exception thrown by any of them.
+///
+/// Custom executors, for example adaptors of an existing thread pool, are enabled
+/// by specializing \p is_execution_policy for them.
+
+namespace execution {
+
+/// \ingroup ExecutionPolicy
+/// \brief Runs all tasks in order on the calling thread
+class sequenced_policy
+{
+public:
+    constexpr auto concurrency() const noexcept -> std::size_t
+    {
+        return 1;
+    }
+
+    template <typename F>
+    void bulk_execute(std::size_t count, F&& f) const
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            f(i);
+    }
+};
+
+/// \ingroup ExecutionPolicy
+/// \brief Runs tasks on up to \p concurrency() threads, the calling thread included
+///
+/// Threads pick tasks dynamically, so bands of uneven cost are balanced between them.
+class parallel_policy
+{
+public:
+    /// \param concurrency Maximum number of threads, zero selects the number of hardware threads
+    constexpr explicit parallel_policy(std::size_t concurrency = 0) noexcept
+        : concurrency_(concurrency)
+    {}
+
+    auto concurrency() const noexcept -> std::size_t
+    {
+        if (concurrency_ != 0)
+            return concurrency_;
+        return (std::max)(std::thread::hardware_concurrency(), 1u);
+    }
+
+    template <typename F>
+    void bulk_execute(std::size_t count, F&& f) const
+    {
+        std::size_t const workers = (std::min)(count, concurrency());
+        if (workers <= 1)
+        {
+            sequenced_policy().bulk_execute(count, f);
+            return;
+        }
+
+        std::atomic<std::size_t> next{0};
+        std::vector<std::exception_ptr> errors(workers);
+        auto work = [&](std::size_t worker)
+        {
+            try
+            {
+                for (std::size_t i = next++; i < count; i = next++)
+                    f(i);
+            }
+            catch (...)
+            {
+                errors[worker] = std::current_exception();
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(workers - 1);
+        for (std::size_t worker = 1; worker < workers; ++worker)
+        {
+            try
+            {
+                threads.emplace_back(work, worker);
+            }
+            catch (std::system_error const&)
+            {
+                break; // remaining tasks are picked up by the threads already running
+            }
+        }
+        work(0);
+        for (auto& thread : threads)
+            thread.join();
+
+        for (auto const& error : errors)
+        {
+            if (error)
+                std::rethrow_exception(error);
+        }
+    }
+
+private:
+    std::size_t concurrency_;
+};
+
+/// \ingroup ExecutionPolicy
+/// \brief Policy object requesting serial execution
+constexpr sequenced_policy seq{};
+
+/// \ingroup ExecutionPolicy
+/// \brief Policy object requesting parallel execution on all hardware threads
+constexpr parallel_policy par{};
+
+} // namespace execution
+
+/// \ingroup ExecutionPolicy
+/// \brief Determines whether a type can be passed as execution policy to view algorithms
+template <typename T>
+struct is_execution_policy : std::false_type {};
+
+template <>
+struct is_execution_policy<execution::sequenced_policy> : std::true_type {};
+
+template <>
+struct is_execution_policy<execution::parallel_policy> : std::true_type {};
+
+namespace detail {
+
+/// \brief Returns the number of bands for_each_row_band splits \p height rows into
+template <typename ExecutionPolicy>
+auto row_band_count(ExecutionPolicy const& policy, std::ptrdiff_t height) -> std::size_t
+{
+    if (height <= 0)
+        return 0;
+    std::size_t const rows = static_cast<std::size_t>(height);
+    std::size_t const concurrency = policy.concurrency();
+    return concurrency > 1 ? (std::min)(rows, 4 * concurrency) : 1;
+}
+
+/// \brief Splits rows <tt>[0, height)</tt> into row_band_count(policy, height) contiguous bands
+/// and invokes \p f(band, first_row, last_row) for each of them according to the execution
+/// policy, \p band being the index of the band. Returns the number of bands.
+///
+/// Bands have distinct indices, so they can own per-band state allocated up front, such as
+/// scratch buffers or partial results summed once all bands are done.
+template <typename ExecutionPolicy, typename F>
+auto for_each_indexed_row_band(ExecutionPolicy const& policy, std::ptrdiff_t height, F const& f)
+    -> std::size_t
+{
+    std::size_t const bands = row_band_count(policy, height);
+    if (bands == 0)
+        return 0;
+    if (bands == 1)
+    {
+        f(std::size_t(0), std::ptrdiff_t(0), height);
+        return 1;
+    }
+    std::size_t const rows = static_cast<std::size_t>(height);
+    policy.bulk_execute(bands, [&](std::size_t band)
+    {
+        f(band,
+          static_cast<std::ptrdiff_t>(band * rows / bands),
+          static_cast<std::ptrdiff_t>((band + 1) * rows / bands));
+    });
+    return bands;
+}
+
+/// \brief Splits rows <tt>[0, height)</tt> into contiguous bands and invokes
+/// \p f(first_row, last_row) for each of them according to the execution policy.
+///
+/// More bands than threads are created, so that threads finishing early can help with the rest.
+template <typename ExecutionPolicy, typename F>
+void for_each_row_band(ExecutionPolicy const& policy, std::ptrdiff_t height, F const& f)
+{
+    for_each_indexed_row_band(policy, height,
+        [&](std::size_t, std::ptrdiff_t first_row, std::ptrdiff_t last_row)
+    {
+        f(first_row, last_row);
+    });
+}
+
+} // namespace detail
+
+}}  // namespace boost::gil
+
+#endif
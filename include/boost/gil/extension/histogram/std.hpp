@@ -114,6 +114,99 @@ void fill_histogram(SrcView const& srcview, std::map<T1, T2>& histogram, bool ac
     });
 }
 
+namespace detail {
+
+/// \ingroup Histogram - STL Containers
+/// \brief Adds the counts of per-thread partial histograms to a random access container
+///
+template <typename Container>
+void add_partial_counts(std::vector<std::vector<std::size_t>> const& partials, Container& histogram)
+{
+    for (std::size_t i = 0; i < histogram.size(); ++i)
+    {
+        std::size_t total = 0;
+        for (auto const& partial : partials)
+            total += partial[i];
+        if (total != 0)
+            add_histogram_count(histogram[i], total);
+    }
+}
+
+} // namespace detail
+
+/// \ingroup Histogram - STL Containers
+/// \brief Overload for std::vector of fill_histogram taking an execution policy
+///
+/// Counts the pixels of each band of rows in a partial histogram of its own, then adds them
+/// up. The result is identical to that of the serial overload.
+///
+template <typename ExecutionPolicy, typename SrcView, typename T>
+auto fill_histogram(
+    ExecutionPolicy const& policy,
+    SrcView const& srcview,
+    std::vector<T>& histogram,
+    bool accumulate = false)
+    -> typename std::enable_if<is_execution_policy<ExecutionPolicy>::value>::type
+{
+    gil_function_requires<ImageViewConcept<SrcView>>();
+    static_assert(std::is_arithmetic<T>::value, "Improper container type for images.");
+    static_assert(
+        std::is_unsigned<typename channel_type<SrcView>::type>::value,
+        "Improper container type for signed images.");
+
+    using channel_t = typename channel_type<SrcView>::type;
+    using pixel_t   = pixel<channel_t, gray_layout_t>;
+
+    if (!accumulate)
+        histogram.clear();
+    histogram.resize((std::numeric_limits<channel_t>::max)() + 1);
+
+    auto const partials = detail::fill_partial_histograms(
+        policy, srcview, std::vector<std::size_t>(histogram.size()),
+        [](std::vector<std::size_t>& partial, auto const& band, std::ptrdiff_t) {
+            for_each_pixel(color_converted_view<pixel_t>(band), [&](pixel_t const& p) {
+                ++partial[static_cast<std::size_t>(p)];
+            });
+        });
+    detail::add_partial_counts(partials, histogram);
+}
+
+/// \ingroup Histogram - STL Containers
+/// \brief Overload for std::array of fill_histogram taking an execution policy
+///
+template <typename ExecutionPolicy, typename SrcView, typename T, std::size_t N>
+auto fill_histogram(
+    ExecutionPolicy const& policy,
+    SrcView const& srcview,
+    std::array<T, N>& histogram,
+    bool accumulate = false)
+    -> typename std::enable_if<is_execution_policy<ExecutionPolicy>::value>::type
+{
+    gil_function_requires<ImageViewConcept<SrcView>>();
+    static_assert(std::is_arithmetic<T>::value && N > 0, "Improper container type for images.");
+    static_assert(
+        std::is_unsigned<typename channel_type<SrcView>::type>::value,
+        "Improper container type for signed images.");
+
+    using channel_t = typename channel_type<SrcView>::type;
+    using pixel_t   = pixel<channel_t, gray_layout_t>;
+
+    const size_t pixel_max = (std::numeric_limits<channel_t>::max)();
+    const float scale      = (histogram.size() - 1.0f) / pixel_max;
+
+    if (!accumulate)
+        std::fill(std::begin(histogram), std::end(histogram), 0);
+
+    auto const partials = detail::fill_partial_histograms(
+        policy, srcview, std::vector<std::size_t>(N),
+        [scale](std::vector<std::size_t>& partial, auto const& band, std::ptrdiff_t) {
+            for_each_pixel(color_converted_view<pixel_t>(band), [&](pixel_t const& p) {
+                ++partial[static_cast<std::size_t>(p * scale)];
+            });
+        });
+    detail::add_partial_counts(partials, histogram);
+}
+
 /// \ingroup Histogram - STL Containers
 /// \brief Overload for std::vector of cumulative_histogram
 ///
@@ -10,9 +10,11 @@
 #ifndef BOOST_GIL_EXTENSION_IMAGE_PROCESSING_DIFFUSION_HPP
 #define BOOST_GIL_EXTENSION_IMAGE_PROCESSING_DIFFUSION_HPP
 
+#include <boost/gil/detail/diffusion_row.hpp>
 #include <boost/gil/detail/math.hpp>
 #include <boost/gil/algorithm.hpp>
 #include <boost/gil/color_base_algorithm.hpp>
+#include <boost/gil/execution.hpp>
 #include <boost/gil/image.hpp>
 #include <boost/gil/image_view.hpp>
 #include <boost/gil/image_view_factory.hpp>
@@ -20,8 +22,13 @@
 #include <boost/gil/point.hpp>
 #include <boost/gil/typedefs.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <functional>
 #include <numeric>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace boost { namespace gil {
@@ -348,22 +355,52 @@ void default_anisotropic_diffusion(const InputView& input, const OutputView& out
                           brightness_function::identity{}, conductivity::gaussian_conductivity{kappa});
 }
 
-/// \brief Performs diffusion according to Perona-Malik equation
-///
-/// WARNING: Output channel type must be floating point,
-/// otherwise there will be loss in accuracy which most
-/// probably will lead to incorrect results (input will be unchanged).
-/// Anisotropic diffusion is a smoothing algorithm that respects
-/// edge boundaries and can work as an edge detector if suitable
-/// iteration count is set and grayscale image view is used
-/// as an input
-template <typename InputView, typename OutputView,
-          typename LaplaceStrategy = laplace_function::stencil_9points_standard,
-          typename BrightnessFunction = brightness_function::identity,
-          typename DiffusivityFunction = conductivity::gaussian_conductivity>
-void anisotropic_diffusion(const InputView& input, const OutputView& output, unsigned int num_iter,
+namespace detail {
+
+/// \brief Diffuses the interior of the zero padded image \p result into \p scratch_result,
+/// pixel by pixel through the stencil, brightness and diffusivity functions, in bands of rows
+template <typename ExecutionPolicy, typename View, typename LaplaceStrategy,
+          typename BrightnessFunction, typename DiffusivityFunction>
+void anisotropic_diffusion_iteration(ExecutionPolicy const& policy, View const& result,
+                                     View const& scratch_result, LaplaceStrategy const& laplace,
+                                     BrightnessFunction const& brightness,
+                                     DiffusivityFunction const& diffusivity)
+{
+    using pixel_type = typename View::value_type;
+    using channel_type = typename channel_type<pixel_type>::type;
+    for_each_row_band(policy, result.height() - 2, [&](std::ptrdiff_t y0, std::ptrdiff_t y1) {
+        // The functions are called through non-const members
+        LaplaceStrategy band_laplace = laplace;
+        BrightnessFunction band_brightness = brightness;
+        DiffusivityFunction band_diffusivity = diffusivity;
+        for (std::ptrdiff_t y = y0 + 1; y < y1 + 1; ++y)
+        {
+            for (std::ptrdiff_t x = 1; x < result.width() - 1; ++x)
+            {
+                auto stencil = band_laplace.compute_laplace(result, point_t(x, y));
+                auto brightness_stencil = band_brightness(stencil);
+                laplace_function::stencil_type<pixel_type> diffusivity_stencil;
+                std::transform(brightness_stencil.begin(), brightness_stencil.end(),
+                               diffusivity_stencil.begin(), band_diffusivity);
+                laplace_function::stencil_type<pixel_type> product_stencil;
+                std::transform(stencil.begin(), stencil.end(), diffusivity_stencil.begin(),
+                               product_stencil.begin(), [](pixel_type lhs, pixel_type rhs) {
+                                   static_transform(lhs, rhs, lhs, std::multiplies<channel_type>{});
+                                   return lhs;
+                               });
+                static_transform(result(x, y), band_laplace.reduce(product_stencil),
+                                 scratch_result(x, y), std::plus<channel_type>{});
+            }
+        }
+    });
+}
+
+template <typename ExecutionPolicy, typename InputView, typename OutputView,
+          typename LaplaceStrategy, typename BrightnessFunction, typename DiffusivityFunction>
+void anisotropic_diffusion(ExecutionPolicy const& policy, const InputView& input,
+                           const OutputView& output, unsigned int num_iter,
                            LaplaceStrategy laplace, BrightnessFunction brightness,
-                           DiffusivityFunction diffusivity)
+                           DiffusivityFunction diffusivity, std::false_type /* float rows */)
 {
     using input_pixel_type = typename InputView::value_type;
     using pixel_type = typename OutputView::value_type;
@@ -393,32 +430,214 @@ void anisotropic_diffusion(const InputView& input, const OutputView& output, uns
 
     for (unsigned int iteration = 0; iteration < num_iter; ++iteration)
     {
-        for (std::ptrdiff_t relative_y = 0; relative_y < height; ++relative_y)
+        anisotropic_diffusion_iteration(policy, result, scratch_result, laplace, brightness,
+                                        diffusivity);
+        using std::swap;
+        swap(result, scratch_result);
+    }
+
+    copy_pixels(subimage_view(result, 1, 1, width, height), output);
+}
+
+/// \brief Conductivities of float gradients, computed in vector registers
+inline diffusion_perona_malik
+make_diffusion_conductivity(conductivity::perona_malik_conductivity const& c)
+{
+    return {static_cast<float>(1.0 / c.kappa)};
+}
+
+inline diffusion_gaussian make_diffusion_conductivity(conductivity::gaussian_conductivity const& c)
+{
+    return {static_cast<float>(1.0 / c.kappa)};
+}
+
+inline diffusion_wide_regions
+make_diffusion_conductivity(conductivity::wide_regions_conductivity const& c)
+{
+    return {static_cast<float>(1.0 / c.kappa)};
+}
+
+inline diffusion_more_wide_regions
+make_diffusion_conductivity(conductivity::more_wide_regions_conductivity const& c)
+{
+    return {static_cast<float>(1.0 / c.kappa)};
+}
+
+/// \brief Stencils of float rows, computed in vector registers
+inline diffusion_stencil_5points make_diffusion_stencil(laplace_function::stencil_5points const& s)
+{
+    return {static_cast<float>(s.delta_t)};
+}
+
+inline diffusion_stencil_9points
+make_diffusion_stencil(laplace_function::stencil_9points_standard const& s)
+{
+    return {static_cast<float>(s.delta_t)};
+}
+
+/// \brief Determines whether the stencil of float rows is computed in vector registers
+template <typename LaplaceStrategy, typename = void>
+struct is_diffusion_stencil : std::false_type
+{
+};
+
+template <typename LaplaceStrategy>
+struct is_diffusion_stencil<
+    LaplaceStrategy, decltype(void(make_diffusion_stencil(std::declval<LaplaceStrategy>())))>
+    : std::true_type
+{
+};
+
+/// \brief Determines whether the conductivity of float gradients is computed in vector registers
+template <typename DiffusivityFunction, typename = void>
+struct is_diffusion_conductivity : std::false_type
+{
+};
+
+template <typename DiffusivityFunction>
+struct is_diffusion_conductivity<
+    DiffusivityFunction,
+    decltype(void(make_diffusion_conductivity(std::declval<DiffusivityFunction>())))>
+    : std::true_type
+{
+};
+
+/// \brief Determines whether anisotropic_diffusion can diffuse the channels of the output
+/// view as rows of floats, with a stencil and conductivity it computes itself
+template <typename OutputView, typename LaplaceStrategy, typename BrightnessFunction,
+          typename DiffusivityFunction, typename = void>
+struct is_diffusion_float_rows : std::false_type
+{
+};
+
+template <typename OutputView, typename LaplaceStrategy, typename BrightnessFunction,
+          typename DiffusivityFunction>
+struct is_diffusion_float_rows<
+    OutputView, LaplaceStrategy, BrightnessFunction, DiffusivityFunction,
+    typename std::enable_if<
+        std::is_same<typename base_channel_type<typename channel_type<OutputView>::type>::type,
+                     float>::value &&
+        is_diffusion_stencil<LaplaceStrategy>::value &&
+        std::is_same<BrightnessFunction, brightness_function::identity>::value &&
+        is_diffusion_conductivity<DiffusivityFunction>::value>::type>
+    : std::true_type
+{
+};
+
+/// \brief Diffuses the channels as rows of floats in two zero padded buffers, in turn read
+/// and written by each iteration
+///
+/// The padding holds the zero pixels around the image, so that all pixels are diffused
+/// without bounds checks.
+template <typename ExecutionPolicy, typename InputView, typename OutputView,
+          typename LaplaceStrategy, typename BrightnessFunction, typename DiffusivityFunction>
+void anisotropic_diffusion(ExecutionPolicy const& policy, const InputView& input,
+                           const OutputView& output, unsigned int num_iter,
+                           LaplaceStrategy laplace, BrightnessFunction,
+                           DiffusivityFunction diffusivity, std::true_type /* float rows */)
+{
+    constexpr std::ptrdiff_t channels = num_channels<OutputView>::value;
+    const auto width = input.width();
+    const auto height = input.height();
+    const std::ptrdiff_t stride = (width + 2) * channels;
+    const std::size_t size = static_cast<std::size_t>(stride * (height + 2));
+    std::vector<float> result(size, 0.0f);
+    std::vector<float> scratch_result(size, 0.0f);
+    auto const at = [stride](std::vector<float>& buffer, std::ptrdiff_t y) {
+        return buffer.data() + (y + 1) * stride + channels;
+    };
+
+    for (std::ptrdiff_t y = 0; y < height; ++y)
+    {
+        float* out = at(result, y);
+        auto it = input.row_begin(y);
+        for (std::ptrdiff_t x = 0; x < width; ++x)
         {
-            for (std::ptrdiff_t relative_x = 0; relative_x < width; ++relative_x)
+            for (std::ptrdiff_t c = 0; c < channels; ++c)
+                *out++ = static_cast<float>(it[x][c]);
+        }
+    }
+
+    auto const stencil = make_diffusion_stencil(laplace);
+    auto const g = make_diffusion_conductivity(diffusivity);
+    for (unsigned int iteration = 0; iteration < num_iter; ++iteration)
+    {
+        for_each_row_band(policy, height, [&](std::ptrdiff_t y0, std::ptrdiff_t y1) {
+            for (std::ptrdiff_t y = y0; y < y1; ++y)
             {
-                auto x = relative_x + 1;
-                auto y = relative_y + 1;
-                auto stencil = laplace.compute_laplace(result, point_t(x, y));
-                auto brightness_stencil = brightness(stencil);
-                laplace_function::stencil_type<pixel_type> diffusivity_stencil;
-                std::transform(brightness_stencil.begin(), brightness_stencil.end(),
-                               diffusivity_stencil.begin(), diffusivity);
-                laplace_function::stencil_type<pixel_type> product_stencil;
-                std::transform(stencil.begin(), stencil.end(), diffusivity_stencil.begin(),
-                               product_stencil.begin(), [](pixel_type lhs, pixel_type rhs) {
-                                   static_transform(lhs, rhs, lhs, std::multiplies<channel_type>{});
-                                   return lhs;
-                               });
-                static_transform(result(x, y), laplace.reduce(product_stencil),
-                                 scratch_result(x, y), std::plus<channel_type>{});
+                float const* row = at(result, y);
+                diffusion_rows const rows{row - stride, row, row + stride, at(scratch_result, y),
+                                          channels};
+                diffusion_row(rows, width * channels, stencil, g);
             }
+        });
+        result.swap(scratch_result);
+    }
+
+    for (std::ptrdiff_t y = 0; y < height; ++y)
+    {
+        float const* in = at(result, y);
+        auto it = output.row_begin(y);
+        for (std::ptrdiff_t x = 0; x < width; ++x)
+        {
+            for (std::ptrdiff_t c = 0; c < channels; ++c)
+                it[x][c] = *in++;
         }
-        using std::swap;
-        swap(result, scratch_result);
     }
+}
 
-    copy_pixels(subimage_view(result, 1, 1, width, height), output);
+} // namespace detail
+
+/// \brief Performs diffusion according to Perona-Malik equation, in bands of rows according
+/// to an execution policy
+///
+/// WARNING: Output channel type must be floating point,
+/// otherwise there will be loss in accuracy which most
+/// probably will lead to incorrect results (input will be unchanged).
+/// Anisotropic diffusion is a smoothing algorithm that respects
+/// edge boundaries and can work as an edge detector if suitable
+/// iteration count is set and grayscale image view is used
+/// as an input
+///
+/// With 32-bit floating point output channels, the 5 or 9 point stencil, the identity
+/// brightness and one of the conductivities above, the channels are diffused as rows of floats
+/// in vector registers, and the exponential conductivities are approximated to about the
+/// float precision without calling std::exp.
+template <typename ExecutionPolicy, typename InputView, typename OutputView,
+          typename LaplaceStrategy = laplace_function::stencil_9points_standard,
+          typename BrightnessFunction = brightness_function::identity,
+          typename DiffusivityFunction = conductivity::gaussian_conductivity,
+          typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0>
+void anisotropic_diffusion(ExecutionPolicy const& policy, const InputView& input,
+                           const OutputView& output, unsigned int num_iter,
+                           LaplaceStrategy laplace, BrightnessFunction brightness,
+                           DiffusivityFunction diffusivity)
+{
+    detail::anisotropic_diffusion(
+        policy, input, output, num_iter, laplace, brightness, diffusivity,
+        detail::is_diffusion_float_rows<OutputView, LaplaceStrategy, BrightnessFunction,
+                                        DiffusivityFunction>());
+}
+
+/// \brief Performs diffusion according to Perona-Malik equation
+///
+/// WARNING: Output channel type must be floating point,
+/// otherwise there will be loss in accuracy which most
+/// probably will lead to incorrect results (input will be unchanged).
+/// Anisotropic diffusion is a smoothing algorithm that respects
+/// edge boundaries and can work as an edge detector if suitable
+/// iteration count is set and grayscale image view is used
+/// as an input
+template <typename InputView, typename OutputView,
+          typename LaplaceStrategy = laplace_function::stencil_9points_standard,
+          typename BrightnessFunction = brightness_function::identity,
+          typename DiffusivityFunction = conductivity::gaussian_conductivity>
+void anisotropic_diffusion(const InputView& input, const OutputView& output, unsigned int num_iter,
+                           LaplaceStrategy laplace, BrightnessFunction brightness,
+                           DiffusivityFunction diffusivity)
+{
+    anisotropic_diffusion(execution::seq, input, output, num_iter, laplace, brightness,
+                          diffusivity);
 }
 
 }} // namespace boost::gil
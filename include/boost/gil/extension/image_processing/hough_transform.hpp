@@ -11,11 +11,18 @@
 
 #include <boost/gil/extension/image_processing/hough_parameter.hpp>
 #include <boost/gil/extension/rasterization/circle.hpp>
+#include <boost/gil/execution.hpp>
+#include <boost/gil/image_view.hpp>
+#include <boost/gil/point.hpp>
 
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <cstdlib>
 #include <iterator>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace boost { namespace gil {
@@ -28,50 +35,231 @@ namespace boost { namespace gil {
 /// Circle and ellipse transforms are very costly to brute force, while
 /// non-brute-forcing algorithms tend to gamble on probabilities.
 
+namespace detail {
+
+/// \brief Returns \p value rounded to the nearest integer, halfway cases away from zero,
+/// like std::llround
+inline auto hough_round(double value) -> std::ptrdiff_t
+{
+    std::ptrdiff_t const truncated = static_cast<std::ptrdiff_t>(value);
+    // exact, as the integer part is
+    double const fraction = value - static_cast<double>(truncated);
+    return truncated + (fraction >= 0.5) - (fraction <= -0.5);
+}
+
+/// \brief Collects the coordinates of the edge pixels, those whose first channel is set,
+/// in row-major order
+template <typename ExecutionPolicy, typename InputView>
+auto hough_edge_points(ExecutionPolicy const& policy, InputView const& input_view)
+    -> std::vector<point_t>
+{
+    std::vector<std::vector<point_t>> band_points(row_band_count(policy, input_view.height()));
+    for_each_indexed_row_band(policy, input_view.height(),
+        [&](std::size_t band, std::ptrdiff_t y0, std::ptrdiff_t y1)
+    {
+        std::vector<point_t>& points = band_points[band];
+        for (std::ptrdiff_t y = y0; y < y1; ++y)
+        {
+            auto const row = input_view.row_begin(y);
+            for (std::ptrdiff_t x = 0; x < input_view.width(); ++x)
+            {
+                if (!row[x][0])
+                {
+                    continue;
+                }
+                points.emplace_back(x, y);
+            }
+        }
+    });
+
+    if (band_points.size() == 1)
+    {
+        return std::move(band_points.front());
+    }
+    std::size_t count = 0;
+    for (auto const& points : band_points)
+    {
+        count += points.size();
+    }
+    std::vector<point_t> edge_points;
+    edge_points.reserve(count);
+    for (auto const& points : band_points)
+    {
+        edge_points.insert(edge_points.end(), points.begin(), points.end());
+    }
+    return edge_points;
+}
+
+} // namespace detail
+
 /// \ingroup HoughTransform
-/// \brief Vote for best fit of a line in parameter space
+/// \brief Vote for best fit of a line in parameter space, splitting the angles into bands
+/// according to an execution policy
 ///
 /// The input must be an edge map with grayscale pixels. Be aware of overflow inside
 /// accumulator array. The theta parameter is best computed through factory function
 /// provided in hough_parameter.hpp
-template <typename InputView, typename OutputView>
-void hough_line_transform(InputView const& input_view, OutputView const& accumulator_array,
+///
+/// The edge pixels are collected first, and each angle, whose sine and cosine are computed
+/// once, counts the votes of all of them for each radius before adding the counts to its
+/// column of the accumulator array. Columns are written by a single band, so the votes are
+/// those of the serial transform.
+template <typename ExecutionPolicy, typename InputView, typename OutputView,
+          typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0>
+void hough_line_transform(ExecutionPolicy const& policy, InputView const& input_view,
+                          OutputView const& accumulator_array,
                           hough_parameter<double> const& theta,
                           hough_parameter<std::ptrdiff_t> const& radius)
 {
+    using channel_t = typename channel_type<OutputView>::type;
+
+    if (radius.step_count == 0 || radius.step_size <= 0 || theta.step_count == 0)
+    {
+        return;
+    }
     std::ptrdiff_t r_lower_bound = radius.start_point;
     std::ptrdiff_t r_upper_bound = r_lower_bound + radius.step_size * (radius.step_count - 1);
 
-    for (std::ptrdiff_t y = 0; y < input_view.height(); ++y)
+    std::vector<point_t> const edge_points = detail::hough_edge_points(policy, input_view);
+    std::vector<double> cos_theta(theta.step_count);
+    std::vector<double> sin_theta(theta.step_count);
+    for (std::size_t theta_index = 0; theta_index < theta.step_count; ++theta_index)
     {
-        for (std::ptrdiff_t x = 0; x < input_view.width(); ++x)
+        double theta_current =
+            theta.start_point + theta.step_size * static_cast<double>(theta_index);
+        cos_theta[theta_index] = std::cos(theta_current);
+        sin_theta[theta_index] = std::sin(theta_current);
+    }
+
+    // votes are counted by radius, from the lower bound, and summed by radius step
+    std::size_t const r_count = static_cast<std::size_t>(r_upper_bound - r_lower_bound) + 1;
+    detail::for_each_row_band(policy, static_cast<std::ptrdiff_t>(theta.step_count),
+        [&](std::ptrdiff_t first_theta, std::ptrdiff_t last_theta)
+    {
+        std::vector<std::uint32_t> votes(r_count);
+        for (std::ptrdiff_t theta_index = first_theta; theta_index < last_theta; ++theta_index)
         {
-            if (!input_view(x, y)[0])
+            double const cos_current = cos_theta[static_cast<std::size_t>(theta_index)];
+            double const sin_current = sin_theta[static_cast<std::size_t>(theta_index)];
+            std::fill(votes.begin(), votes.end(), std::uint32_t(0));
+            for (point_t const& point : edge_points)
             {
-                continue;
+                std::ptrdiff_t current_r =
+                    detail::hough_round(static_cast<double>(point.x) * cos_current +
+                                        static_cast<double>(point.y) * sin_current);
+                std::size_t const r_offset = static_cast<std::size_t>(current_r - r_lower_bound);
+                if (r_offset < r_count)
+                {
+                    ++votes[r_offset];
+                }
             }
 
-            for (std::size_t theta_index = 0; theta_index < theta.step_count; ++theta_index)
+            auto column = accumulator_array.col_begin(theta_index);
+            std::size_t r_offset = 0;
+            for (std::size_t r_index = 0; r_index < radius.step_count; ++r_index)
             {
-                double theta_current =
-                    theta.start_point + theta.step_size * static_cast<double>(theta_index);
-                std::ptrdiff_t current_r =
-                    std::llround(static_cast<double>(x) * std::cos(theta_current) +
-                                 static_cast<double>(y) * std::sin(theta_current));
-                if (current_r < r_lower_bound || current_r > r_upper_bound)
+                std::uint32_t count = 0;
+                std::size_t const r_end =
+                    (std::min)(r_offset + static_cast<std::size_t>(radius.step_size), r_count);
+                for (; r_offset < r_end; ++r_offset)
                 {
-                    continue;
+                    count += votes[r_offset];
+                }
+                if (count != 0)
+                {
+                    auto&& accumulator = column[static_cast<std::ptrdiff_t>(r_index)][0];
+                    accumulator = static_cast<channel_t>(accumulator + count);
                 }
-                std::size_t r_index = static_cast<std::size_t>(
-                    std::llround((current_r - radius.start_point) / radius.step_size));
-                // one more safety guard to not get out of bounds
-                if (r_index < radius.step_count)
+            }
+        }
+    });
+}
+
+/// \ingroup HoughTransform
+/// \brief Vote for best fit of a line in parameter space
+///
+/// The input must be an edge map with grayscale pixels. Be aware of overflow inside
+/// accumulator array. The theta parameter is best computed through factory function
+/// provided in hough_parameter.hpp
+template <typename InputView, typename OutputView>
+void hough_line_transform(InputView const& input_view, OutputView const& accumulator_array,
+                          hough_parameter<double> const& theta,
+                          hough_parameter<std::ptrdiff_t> const& radius)
+{
+    hough_line_transform(execution::seq, input_view, accumulator_array, theta, radius);
+}
+
+/// \ingroup HoughTransform
+/// \brief Find the strongest peaks of an accumulator array
+///
+/// Peaks are the elements of at least \p threshold votes that are not smaller than their
+/// eight neighbours. They are taken by decreasing votes, ties in row-major order, skipping
+/// those within \p suppression_radius elements along both axes of a peak already taken,
+/// until \p max_count peaks are found. Returns their positions in the accumulator array.
+template <typename AccumulatorView>
+auto hough_peaks(AccumulatorView const& accumulator_array, std::size_t max_count,
+                 typename channel_type<AccumulatorView>::type threshold,
+                 point_t suppression_radius = point_t(1, 1)) -> std::vector<point_t>
+{
+    using channel_t = typename channel_type<AccumulatorView>::type;
+    std::ptrdiff_t const width = accumulator_array.width();
+    std::ptrdiff_t const height = accumulator_array.height();
+
+    std::vector<std::pair<channel_t, point_t>> candidates;
+    for (std::ptrdiff_t y = 0; y < height; ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < width; ++x)
+        {
+            channel_t const votes = accumulator_array(x, y)[0];
+            if (votes < threshold)
+            {
+                continue;
+            }
+            bool is_maximum = true;
+            for (std::ptrdiff_t ny = (std::max)(y - 1, std::ptrdiff_t(0));
+                 is_maximum && ny < (std::min)(y + 2, height); ++ny)
+            {
+                for (std::ptrdiff_t nx = (std::max)(x - 1, std::ptrdiff_t(0));
+                     nx < (std::min)(x + 2, width); ++nx)
                 {
-                    accumulator_array(theta_index, r_index)[0] += 1;
+                    if (votes < accumulator_array(nx, ny)[0])
+                    {
+                        is_maximum = false;
+                        break;
+                    }
                 }
             }
+            if (is_maximum)
+            {
+                candidates.emplace_back(votes, point_t(x, y));
+            }
+        }
+    }
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [](std::pair<channel_t, point_t> const& lhs,
+                        std::pair<channel_t, point_t> const& rhs) {
+                         return rhs.first < lhs.first;
+                     });
+
+    std::vector<point_t> peaks;
+    for (auto const& candidate : candidates)
+    {
+        if (peaks.size() >= max_count)
+        {
+            break;
+        }
+        point_t const position = candidate.second;
+        bool const is_suppressed =
+            std::any_of(peaks.begin(), peaks.end(), [&](point_t const& peak) {
+                return std::abs(peak.x - position.x) <= suppression_radius.x &&
+                       std::abs(peak.y - position.y) <= suppression_radius.y;
+            });
+        if (!is_suppressed)
+        {
+            peaks.push_back(position);
         }
     }
+    return peaks;
 }
 
 /// \ingroup HoughTransform
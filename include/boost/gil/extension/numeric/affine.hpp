@@ -168,6 +168,122 @@ boost::gil::matrix3x2<F> center_rotate(boost::gil::point<T> dims,F rads)
     return scale *  translate * rotate;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////
+///
+/// Matrix to do 2D projective transformations, or homographies. Points are row vectors
+/// [x y 1], as for matrix3x2, whose last column is [g h i] instead of [0 0 1]:
+///
+///     x' = (a x + c y + e) / (g x + h y + i)
+///     y' = (b x + d y + f) / (g x + h y + i)
+///
+////////////////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class matrix3x3 {
+public:
+    matrix3x3() : a(1), b(0), c(0), d(1), e(0), f(0), g(0), h(0), i(1) {}
+    matrix3x3(T A, T B, T C, T D, T E, T F, T G, T H, T I)
+        : a(A), b(B), c(C), d(D), e(E), f(F), g(G), h(H), i(I) {}
+    matrix3x3(matrix3x2<T> const& m)
+        : a(m.a), b(m.b), c(m.c), d(m.d), e(m.e), f(m.f), g(0), h(0), i(1) {}
+
+    matrix3x3& operator*=(matrix3x3 const& m) { (*this) = (*this) * m; return *this; }
+
+    /// \brief Returns the homography mapping the corners (0, 0), (1, 0), (1, 1) and (0, 1) of
+    /// the unit square to the corners \p q of a quadrilateral
+    static matrix3x3 get_square_to_quad(point<T> const (&q)[4])
+    {
+        T const dx1 = q[1].x - q[2].x;
+        T const dy1 = q[1].y - q[2].y;
+        T const dx2 = q[3].x - q[2].x;
+        T const dy2 = q[3].y - q[2].y;
+        T const dx3 = q[0].x - q[1].x + q[2].x - q[3].x;
+        T const dy3 = q[0].y - q[1].y + q[2].y - q[3].y;
+        T const den = dx1 * dy2 - dx2 * dy1;
+        T const G = (dx3 * dy2 - dx2 * dy3) / den;
+        T const H = (dx1 * dy3 - dx3 * dy1) / den;
+        return matrix3x3(
+            q[1].x - q[0].x + G * q[1].x, q[1].y - q[0].y + G * q[1].y,
+            q[3].x - q[0].x + H * q[3].x, q[3].y - q[0].y + H * q[3].y,
+            q[0].x, q[0].y,
+            G, H, 1);
+    }
+
+    /// \brief Returns the homography mapping the corners \p from of a quadrilateral to the
+    /// corners \p to of another
+    ///
+    /// To correct the perspective of a quadrilateral of the source, map the corners of the
+    /// destination to it and resample with the result.
+    static matrix3x3 get_quad_to_quad(point<T> const (&from)[4], point<T> const (&to)[4])
+    {
+        return inverse(get_square_to_quad(from)) * get_square_to_quad(to);
+    }
+
+    T a, b, c, d, e, f, g, h, i;
+};
+
+template <typename T> BOOST_FORCEINLINE
+matrix3x3<T> operator*(matrix3x3<T> const& m1, matrix3x3<T> const& m2)
+{
+    return matrix3x3<T>(
+        m1.a * m2.a + m1.b * m2.c + m1.g * m2.e,
+        m1.a * m2.b + m1.b * m2.d + m1.g * m2.f,
+        m1.c * m2.a + m1.d * m2.c + m1.h * m2.e,
+        m1.c * m2.b + m1.d * m2.d + m1.h * m2.f,
+        m1.e * m2.a + m1.f * m2.c + m1.i * m2.e,
+        m1.e * m2.b + m1.f * m2.d + m1.i * m2.f,
+        m1.a * m2.g + m1.b * m2.h + m1.g * m2.i,
+        m1.c * m2.g + m1.d * m2.h + m1.h * m2.i,
+        m1.e * m2.g + m1.f * m2.h + m1.i * m2.i);
+}
+
+template <typename T, typename F>
+BOOST_FORCEINLINE
+point<F> operator*(point<T> const& p, matrix3x3<F> const& m)
+{
+    F const x = static_cast<F>(p.x);
+    F const y = static_cast<F>(p.y);
+    F const w = m.g * x + m.h * y + m.i;
+    return { (m.a * x + m.c * y + m.e) / w, (m.b * x + m.d * y + m.f) / w };
+}
+
+template <typename F>
+struct mapping_traits<matrix3x3<F>>
+{
+    using result_type = point<F>;
+};
+
+template <typename F, typename F2>
+BOOST_FORCEINLINE
+point<F> transform(matrix3x3<F> const& mat, point<F2> const& src)
+{
+    return src * mat;
+}
+
+/// Returns the inverse of the given projective transformation matrix
+///
+/// \warning Floating point arithmetic, use Boost.Rational if precision maters
+template <typename T>
+boost::gil::matrix3x3<T> inverse(boost::gil::matrix3x3<T> m)
+{
+    T const ca = m.d * m.i - m.h * m.f;
+    T const cc = m.h * m.e - m.c * m.i;
+    T const ce = m.c * m.f - m.d * m.e;
+    T const determinant = m.a * ca + m.b * cc + m.g * ce;
+
+    boost::gil::matrix3x3<T> res;
+    res.a = ca / determinant;
+    res.b = (m.g * m.f - m.b * m.i) / determinant;
+    res.g = (m.b * m.h - m.g * m.d) / determinant;
+    res.c = cc / determinant;
+    res.d = (m.a * m.i - m.g * m.e) / determinant;
+    res.h = (m.g * m.c - m.a * m.h) / determinant;
+    res.e = ce / determinant;
+    res.f = (m.b * m.e - m.a * m.f) / determinant;
+    res.i = (m.a * m.d - m.b * m.c) / determinant;
+
+    return res;
+}
+
 }} // namespace boost::gil
 
 #endif
\ No newline at end of file
@@ -0,0 +1,323 @@
+//
+// Copyright 2026 Boost.GIL Contributors
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#ifndef BOOST_GIL_EXTENSION_NUMERIC_REMAP_HPP
+#define BOOST_GIL_EXTENSION_NUMERIC_REMAP_HPP
+
+#include <boost/gil/extension/numeric/affine.hpp>
+#include <boost/gil/extension/numeric/resample.hpp>
+#include <boost/gil/extension/numeric/sampler.hpp>
+#include <boost/gil/execution.hpp>
+#include <boost/gil/point.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace boost { namespace gil {
+
+///////////////////////////////////////////////////////////////////////////
+////
+////   remap_pixels: resample the source view at source coordinates computed once per
+////   destination pixel and stored in a remap_table
+////
+///////////////////////////////////////////////////////////////////////////
+
+/// \brief Source coordinates of each pixel of a destination, transformed once by a mapping
+/// function and reused by remap_pixels for any number of source views
+/// \ingroup ImageAlgorithms
+///
+/// The coordinates are stored in fixed point with fraction_bits fractional bits, rounded to
+/// the nearest, which are the phases of the bicubic and Lanczos samplers and the weights of
+/// the bilinear sampler. Coordinates too large to store, or not numbers, are stored as
+/// unmapped, which lies outside any source.
+class remap_table
+{
+public:
+    /// \brief Number of fractional bits of the coordinates
+    static constexpr int fraction_bits = detail::sampler_phase_bits;
+
+    /// \brief Fixed point coordinate of the pixels mapped outside any source
+    static constexpr std::int32_t unmapped = (std::numeric_limits<std::int32_t>::min)();
+
+    remap_table() = default;
+
+    /// \brief Transforms the coordinates of the pixels of a destination of dimensions \p dims
+    /// with \p dst_to_src, in bands of rows according to an execution policy
+    template
+    <
+        typename ExecutionPolicy,
+        typename MapFn,
+        typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+    >
+    remap_table(ExecutionPolicy const& policy, point_t const& dims, MapFn const& dst_to_src)
+        : dimensions_(dims)
+        , coordinates_(2 * static_cast<std::size_t>(dims.x) * static_cast<std::size_t>(dims.y))
+    {
+        detail::for_each_row_band(policy, dims.y, [&](std::ptrdiff_t y0, std::ptrdiff_t y1)
+        {
+            point_t p;
+            for (p.y = y0; p.y < y1; ++p.y)
+            {
+                std::int32_t* it = coordinates_.data() + 2 * p.y * dims.x;
+                for (p.x = 0; p.x < dims.x; ++p.x)
+                {
+                    auto const q = transform(dst_to_src, p);
+                    *it++ = to_fixed(static_cast<double>(q.x));
+                    *it++ = to_fixed(static_cast<double>(q.y));
+                }
+            }
+        });
+    }
+
+    template <typename MapFn>
+    remap_table(point_t const& dims, MapFn const& dst_to_src)
+        : remap_table(execution::seq, dims, dst_to_src)
+    {}
+
+    auto dimensions() const -> point_t { return dimensions_; }
+    auto width() const -> std::ptrdiff_t { return dimensions_.x; }
+    auto height() const -> std::ptrdiff_t { return dimensions_.y; }
+
+    /// \brief Fixed point source coordinates of the destination pixel (\p x, \p y)
+    auto coordinates(std::ptrdiff_t x, std::ptrdiff_t y) const -> point<std::int32_t>
+    {
+        std::int32_t const* it = row_begin(y) + 2 * x;
+        return {it[0], it[1]};
+    }
+
+    /// \brief Interleaved fixed point source coordinates x, y of the pixels of row \p y
+    auto row_begin(std::ptrdiff_t y) const -> std::int32_t const*
+    {
+        BOOST_ASSERT(y >= 0 && y < dimensions_.y);
+        return coordinates_.data() + 2 * y * dimensions_.x;
+    }
+
+private:
+    static auto to_fixed(double p) -> std::int32_t
+    {
+        double const limit = static_cast<double>(1 << 30);
+        double const q = std::floor(p * static_cast<double>(1 << fraction_bits) + 0.5);
+        return q > -limit && q < limit ? static_cast<std::int32_t>(q) : unmapped;
+    }
+
+    point_t dimensions_;
+    std::vector<std::int32_t> coordinates_;
+};
+
+namespace detail {
+
+/// \brief Samples a destination row at the nearest source pixels, rounding halfway below 0 to
+/// -1 as iround does
+template <typename SrcView, typename DstView>
+void remap_row_pixels(
+    SrcView const& src,
+    DstView const& dst,
+    std::ptrdiff_t y,
+    std::int32_t const* coordinates,
+    nearest_neighbor_sampler)
+{
+    std::int32_t const half = 1 << (remap_table::fraction_bits - 1);
+    typename DstView::x_iterator const dst_it = dst.row_begin(y);
+    typename SrcView::xy_locator const origin = src.xy_at(0, 0);
+    for (std::ptrdiff_t x = 0; x < dst.width(); ++x, coordinates += 2)
+    {
+        std::int64_t const u = std::int64_t(coordinates[0]) + half;
+        std::int64_t const v = std::int64_t(coordinates[1]) + half;
+        std::ptrdiff_t const sx = static_cast<std::ptrdiff_t>(u >> remap_table::fraction_bits);
+        std::ptrdiff_t const sy = static_cast<std::ptrdiff_t>(v >> remap_table::fraction_bits);
+        if (u > 0 && v > 0 && sx < src.width() && sy < src.height())
+            dst_it[x] = origin(sx, sy);
+    }
+}
+
+/// \brief Samples a destination row bilinearly, repeating the border pixels as the sampler
+/// does and rounding integer channels to nearest
+template <typename SrcView, typename DstView>
+void remap_row_pixels(
+    SrcView const& src,
+    DstView const& dst,
+    std::ptrdiff_t y,
+    std::int32_t const* coordinates,
+    bilinear_sampler)
+{
+    using value_t = typename base_channel_type<typename channel_type<SrcView>::type>::type;
+    int const shift = affine_warp_bits - remap_table::fraction_bits;
+    typename DstView::x_iterator const dst_it = dst.row_begin(y);
+    typename SrcView::xy_locator const origin = src.xy_at(0, 0);
+    std::ptrdiff_t const max_x = src.width() - 1;
+    std::ptrdiff_t const max_y = src.height() - 1;
+    for (std::ptrdiff_t x = 0; x < dst.width(); ++x, coordinates += 2)
+    {
+        std::ptrdiff_t const x0 = coordinates[0] >> remap_table::fraction_bits;
+        std::ptrdiff_t const y0 = coordinates[1] >> remap_table::fraction_bits;
+        if (x0 < -1 || y0 < -1 || x0 > max_x || y0 > max_y)
+            continue;
+
+        affine_warp_bilinear<SrcView>(origin,
+            (std::max)(x0, std::ptrdiff_t(0)), (std::min)(x0 + 1, max_x),
+            (std::max)(y0, std::ptrdiff_t(0)), (std::min)(y0 + 1, max_y),
+            std::int64_t(coordinates[0]) * (std::int64_t(1) << shift),
+            std::int64_t(coordinates[1]) * (std::int64_t(1) << shift),
+            dst_it[x], is_resample_fixed_point<value_t>());
+    }
+}
+
+/// \brief Samples a destination row with the tabulated kernel of a sampler, whose phases are
+/// the fractions of the coordinates
+///
+/// The pixels whose taps lie in the source are sampled without clamping the taps.
+template <typename SrcView, typename DstView, typename Sampler>
+void remap_row_pixels(
+    SrcView const& src,
+    DstView const& dst,
+    std::ptrdiff_t y,
+    std::int32_t const* coordinates,
+    Sampler const&)
+{
+    using value_t = typename base_channel_type<typename channel_type<SrcView>::type>::type;
+    using fixed_t = is_resample_fixed_point<value_t>;
+    constexpr int radius = sampler_kernel<Sampler>::radius;
+    constexpr int taps = 2 * radius;
+    std::int32_t const phase_mask = (1 << remap_table::fraction_bits) - 1;
+    auto const weights = sampler_weights(sampler_kernel<Sampler>::phases(), fixed_t());
+    typename DstView::x_iterator const dst_it = dst.row_begin(y);
+    typename SrcView::xy_locator const origin = src.xy_at(0, 0);
+    std::ptrdiff_t const max_x = src.width() - 1;
+    std::ptrdiff_t const max_y = src.height() - 1;
+    std::ptrdiff_t xs[taps];
+    std::ptrdiff_t ys[taps];
+    for (std::ptrdiff_t x = 0; x < dst.width(); ++x, coordinates += 2)
+    {
+        std::ptrdiff_t const x0 = coordinates[0] >> remap_table::fraction_bits;
+        std::ptrdiff_t const y0 = coordinates[1] >> remap_table::fraction_bits;
+        if (x0 < -1 || y0 < -1 || x0 > max_x || y0 > max_y)
+            continue;
+
+        bool const clamp =
+            x0 < radius - 1 || y0 < radius - 1 || x0 + radius > max_x || y0 + radius > max_y;
+        for (int t = 0; t < taps; ++t)
+        {
+            xs[t] = x0 + t - radius + 1;
+            ys[t] = y0 + t - radius + 1;
+            if (clamp)
+            {
+                xs[t] = (std::min)((std::max)(xs[t], std::ptrdiff_t(0)), max_x);
+                ys[t] = (std::min)((std::max)(ys[t], std::ptrdiff_t(0)), max_y);
+            }
+        }
+        sample_taps<taps, SrcView>(origin, xs, ys,
+            weights + (coordinates[0] & phase_mask) * taps,
+            weights + (coordinates[1] & phase_mask) * taps, dst_it[x], fixed_t());
+    }
+}
+
+/// \brief Samples a destination row with the sampler at the stored coordinates
+template <typename SrcView, typename DstView, typename Sampler>
+void remap_row_sampled(
+    SrcView const& src,
+    DstView const& dst,
+    std::ptrdiff_t y,
+    std::int32_t const* coordinates,
+    Sampler const& sampler)
+{
+    double const scale = 1.0 / static_cast<double>(1 << remap_table::fraction_bits);
+    typename DstView::x_iterator const dst_it = dst.row_begin(y);
+    for (std::ptrdiff_t x = 0; x < dst.width(); ++x, coordinates += 2)
+    {
+        point<double> const p(coordinates[0] * scale, coordinates[1] * scale);
+        sample(sampler, src, p, dst_it[x]);
+    }
+}
+
+template <typename SrcView, typename DstView, typename Sampler>
+void remap_row(
+    SrcView const& src,
+    DstView const& dst,
+    std::ptrdiff_t y,
+    std::int32_t const* coordinates,
+    Sampler const& sampler,
+    std::true_type /* fixed point steps */)
+{
+    remap_row_pixels(src, dst, y, coordinates, sampler);
+}
+
+template <typename SrcView, typename DstView, typename Sampler>
+void remap_row(
+    SrcView const& src,
+    DstView const& dst,
+    std::ptrdiff_t y,
+    std::int32_t const* coordinates,
+    Sampler const& sampler,
+    std::false_type /* fixed point steps */)
+{
+    remap_row_sampled(src, dst, y, coordinates, sampler);
+}
+
+} // namespace detail
+
+/// \brief Set each pixel in the destination view as the result of a sampling function at the
+/// source coordinates stored for it in a remap table, in bands of rows according to an
+/// execution policy
+/// \ingroup ImageAlgorithms
+///
+/// Pixels mapped outside the source are left unchanged. The samplers and views sampled in
+/// fixed point by resample_pixels with a matrix3x2 mapping read the source directly at the
+/// stored coordinates; the results of the bicubic and Lanczos samplers are those of
+/// resample_pixels with the mapping the table was made with. Other samplers and views are
+/// sampled at the stored coordinates.
+template
+<
+    typename Sampler,
+    typename ExecutionPolicy,
+    typename SrcView,
+    typename DstView,
+    typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+>
+void remap_pixels(
+    ExecutionPolicy const& policy,
+    SrcView const& src_view,
+    DstView const& dst_view,
+    remap_table const& table,
+    Sampler sampler = Sampler())
+{
+    BOOST_ASSERT(table.dimensions() == dst_view.dimensions());
+    if (src_view.width() == 0 || src_view.height() == 0)
+        return;
+
+    detail::for_each_row_band(policy, dst_view.height(), [&](std::ptrdiff_t y0, std::ptrdiff_t y1)
+    {
+        for (std::ptrdiff_t y = y0; y < y1; ++y)
+        {
+            detail::remap_row(src_view, dst_view, y, table.row_begin(y), sampler,
+                detail::is_affine_warp<Sampler, SrcView, DstView>());
+        }
+    });
+}
+
+/// \brief Set each pixel in the destination view as the result of a sampling function at the
+/// source coordinates stored for it in a remap table
+/// \ingroup ImageAlgorithms
+template <typename Sampler, typename SrcView, typename DstView>
+void remap_pixels(
+    SrcView const& src_view,
+    DstView const& dst_view,
+    remap_table const& table,
+    Sampler sampler = Sampler())
+{
+    remap_pixels(execution::seq, src_view, dst_view, table, sampler);
+}
+
+}}  // namespace boost::gil
+
+#endif // BOOST_GIL_EXTENSION_NUMERIC_REMAP_HPP
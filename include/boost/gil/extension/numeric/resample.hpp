@@ -9,15 +9,23 @@
 #define BOOST_GIL_EXTENSION_NUMERIC_RESAMPLE_HPP
 
 #include <boost/gil/extension/numeric/affine.hpp>
+#include <boost/gil/extension/numeric/sampler.hpp>
 #include <boost/gil/extension/dynamic_image/dynamic_image_all.hpp>
+#include <boost/gil/execution.hpp>
+#include <boost/gil/detail/resample_row.hpp>
 
 #include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <type_traits>
 
 namespace boost { namespace gil {
 
 // Support for generic image resampling
-// NOTE: The code is for example use only. It is not optimized for performance
+// Affine warps step fixed-point source coordinates along the rows, and resize_view resamples
+// same-typed pixels in two separable passes. Other mappings are sampled one pixel at a time.
 
 ///////////////////////////////////////////////////////////////////////////
 ////
@@ -27,6 +35,576 @@ namespace boost { namespace gil {
 
 template <typename MapFn> struct mapping_traits {};
 
+namespace detail {
+
+/// \brief Number of fractional bits of the source coordinates stepped along the rows of an
+/// affine warp
+constexpr int affine_warp_bits = 32;
+
+/// \brief Number of fractional bits of the bilinear weights of 8-bit channels, small enough
+/// for the weighted sum of four channels to fit 32 bits
+constexpr int affine_warp_weight_bits = 11;
+
+/// \brief Returns \p a / \p b rounded down, for a positive \p b
+inline auto affine_warp_floor_div(std::int64_t a, std::int64_t b) -> std::int64_t
+{
+    std::int64_t const q = a / b;
+    return a % b != 0 && a < 0 ? q - 1 : q;
+}
+
+/// \brief Narrows the steps <tt>[first, last)</tt> of a row to those at which the fixed point
+/// coordinate <tt>u + k * du</tt> lies in <tt>[lo, hi)</tt>
+inline void affine_warp_clip(
+    std::int64_t u,
+    std::int64_t du,
+    std::int64_t lo,
+    std::int64_t hi,
+    std::ptrdiff_t& first,
+    std::ptrdiff_t& last)
+{
+    std::int64_t begin = first;
+    std::int64_t end = last;
+    if (du > 0)
+    {
+        begin = (std::max)(begin, -affine_warp_floor_div(u - lo, du));
+        end = (std::min)(end, -affine_warp_floor_div(u - hi, du));
+    }
+    else if (du < 0)
+    {
+        begin = (std::max)(begin, affine_warp_floor_div(u - hi, -du) + 1);
+        end = (std::min)(end, affine_warp_floor_div(u - lo, -du) + 1);
+    }
+    else if (u < lo || u >= hi)
+    {
+        end = begin;
+    }
+    first = static_cast<std::ptrdiff_t>(begin);
+    last = static_cast<std::ptrdiff_t>((std::max)(begin, end));
+}
+
+/// \brief Source coordinates of the pixels of a destination row, stepped in fixed point from
+/// the pixel \p first
+struct affine_warp_row
+{
+    std::ptrdiff_t first = 0;
+    std::ptrdiff_t last = 0;
+    std::int64_t u = 0;
+    std::int64_t v = 0;
+    std::int64_t du = 0;
+    std::int64_t dv = 0;
+};
+
+/// \brief Maps row \p y of a destination of \p width pixels to the source, keeping the pixels
+/// whose source coordinates lie within a pixel or two of the source of \p size pixels
+///
+/// The span is found in floating point so that the fixed point coordinates cannot overflow;
+/// the samplers clip it exactly.
+template <typename F>
+auto make_affine_warp_row(
+    matrix3x2<F> const& m,
+    std::ptrdiff_t y,
+    std::ptrdiff_t width,
+    point_t const& size) -> affine_warp_row
+{
+    double const one = static_cast<double>(std::int64_t(1) << affine_warp_bits);
+    double const a = static_cast<double>(m.a);
+    double const b = static_cast<double>(m.b);
+    double const px = static_cast<double>(m.c) * static_cast<double>(y) + static_cast<double>(m.e);
+    double const py = static_cast<double>(m.d) * static_cast<double>(y) + static_cast<double>(m.f);
+
+    // The x for which p + x * delta lies in [-2, size + 2]
+    double first = 0.0;
+    double last = static_cast<double>(width - 1);
+    auto const narrow = [&](double p, double delta, std::ptrdiff_t extent)
+    {
+        double const lo = -2.0 - p;
+        double const hi = static_cast<double>(extent) + 2.0 - p;
+        if (delta > 0.0)
+        {
+            first = (std::max)(first, std::floor(lo / delta) - 1.0);
+            last = (std::min)(last, std::ceil(hi / delta) + 1.0);
+        }
+        else if (delta < 0.0)
+        {
+            first = (std::max)(first, std::floor(hi / delta) - 1.0);
+            last = (std::min)(last, std::ceil(lo / delta) + 1.0);
+        }
+        else if (!(lo <= 0.0 && 0.0 <= hi))
+        {
+            last = -1.0;
+        }
+    };
+    narrow(px, a, size.x);
+    narrow(py, b, size.y);
+
+    affine_warp_row row;
+    if (!(first <= last))
+        return row;
+    row.first = static_cast<std::ptrdiff_t>(first);
+    row.last = static_cast<std::ptrdiff_t>(last) + 1;
+    row.u = std::llround((px + a * first) * one);
+    row.v = std::llround((py + b * first) * one);
+    row.du = std::llround(a * one);
+    row.dv = std::llround(b * one);
+    return row;
+}
+
+/// \brief Samples a destination row at the nearest source pixels, leaving the pixels mapped
+/// outside the source unchanged
+template <typename SrcView, typename DstView>
+void affine_warp_row_pixels(
+    SrcView const& src,
+    DstView const& dst,
+    std::ptrdiff_t y,
+    affine_warp_row row,
+    nearest_neighbor_sampler)
+{
+    // Rounding to nearest is rounding down from half a pixel further, where iround sends the
+    // coordinates halfway below 0 to -1
+    std::int64_t const half = std::int64_t(1) << (affine_warp_bits - 1);
+    std::int64_t const u = row.u + half;
+    std::int64_t const v = row.v + half;
+    std::ptrdiff_t first = 0;
+    std::ptrdiff_t last = row.last - row.first;
+    affine_warp_clip(u, row.du, 1, std::int64_t(src.width()) << affine_warp_bits, first, last);
+    affine_warp_clip(v, row.dv, 1, std::int64_t(src.height()) << affine_warp_bits, first, last);
+
+    typename DstView::x_iterator const dst_it = dst.row_begin(y) + row.first;
+    typename SrcView::xy_locator const origin = src.xy_at(0, 0);
+    for (std::ptrdiff_t k = first; k < last; ++k)
+    {
+        std::ptrdiff_t const sx = static_cast<std::ptrdiff_t>((u + k * row.du) >> affine_warp_bits);
+        std::ptrdiff_t const sy = static_cast<std::ptrdiff_t>((v + k * row.dv) >> affine_warp_bits);
+        dst_it[k] = origin(sx, sy);
+    }
+}
+
+/// \brief Interpolates two channels with weights summing to one, in fixed or floating point
+template <typename Accum>
+struct affine_warp_lerp
+{
+    Accum w0;
+    Accum w1;
+
+    template <typename Channel0, typename Channel1>
+    auto operator()(Channel0 const& c0, Channel1 const& c1) const -> Accum
+    {
+        return static_cast<Accum>(c0) * w0 + static_cast<Accum>(c1) * w1;
+    }
+};
+
+/// \brief Rounds the fixed point sums of the bilinear interpolation of 8-bit channels
+template <typename Channel>
+struct affine_warp_round_fixed
+{
+    int w0;
+    int w1;
+
+    auto operator()(int c0, int c1) const -> Channel
+    {
+        int const half = 1 << (2 * affine_warp_weight_bits - 1);
+        return static_cast<Channel>((c0 * w0 + c1 * w1 + half) >> (2 * affine_warp_weight_bits));
+    }
+};
+
+/// \brief Rounds and saturates the floating point sums of a bilinear interpolation
+template <typename Channel, typename Accum>
+struct affine_warp_round
+{
+    Accum w0;
+    Accum w1;
+
+    auto operator()(Accum c0, Accum c1) const -> Channel
+    {
+        using value_t = typename base_channel_type<Channel>::type;
+        return Channel(resample_round<value_t>(c0 * w0 + c1 * w1));
+    }
+};
+
+/// \brief Interpolates to \p result the pixels \p x0, \p x1 of the rows \p y0, \p y1 of a view
+/// of 8-bit channels located at \p origin, at the fractions of the fixed point coordinates
+/// \p u, \p v
+///
+/// The channels are interpolated in registers through the color base algorithms, since a
+/// loop over them would go through memory that the 8-bit stores may alias.
+template <typename SrcView, typename DstPixel>
+BOOST_FORCEINLINE
+void affine_warp_bilinear(
+    typename SrcView::xy_locator const& origin,
+    std::ptrdiff_t x0,
+    std::ptrdiff_t x1,
+    std::ptrdiff_t y0,
+    std::ptrdiff_t y1,
+    std::int64_t u,
+    std::int64_t v,
+    DstPixel&& result,
+    std::true_type /* fixed point */)
+{
+    using channel_t = typename channel_type<SrcView>::type;
+    using accum_pixel_t = pixel<int, typename SrcView::value_type::layout_t>;
+    int const shift = affine_warp_bits - affine_warp_weight_bits;
+    int const one = 1 << affine_warp_weight_bits;
+    int const fx = static_cast<int>((u >> shift) & (one - 1));
+    int const fy = static_cast<int>((v >> shift) & (one - 1));
+    affine_warp_lerp<int> const lerp{one - fx, fx};
+    accum_pixel_t top;
+    accum_pixel_t bottom;
+    static_transform(origin(x0, y0), origin(x1, y0), top, lerp);
+    static_transform(origin(x0, y1), origin(x1, y1), bottom, lerp);
+    static_transform(top, bottom, result, affine_warp_round_fixed<channel_t>{one - fy, fy});
+}
+
+template <typename SrcView, typename DstPixel>
+BOOST_FORCEINLINE
+void affine_warp_bilinear(
+    typename SrcView::xy_locator const& origin,
+    std::ptrdiff_t x0,
+    std::ptrdiff_t x1,
+    std::ptrdiff_t y0,
+    std::ptrdiff_t y1,
+    std::int64_t u,
+    std::int64_t v,
+    DstPixel&& result,
+    std::false_type /* fixed point */)
+{
+    using channel_t = typename channel_type<SrcView>::type;
+    using accum_t = resample_accum_t<typename base_channel_type<channel_t>::type>;
+    using accum_pixel_t = pixel<accum_t, typename SrcView::value_type::layout_t>;
+    std::int64_t const mask = (std::int64_t(1) << affine_warp_bits) - 1;
+    accum_t const scale = accum_t(1) / static_cast<accum_t>(std::int64_t(1) << affine_warp_bits);
+    accum_t const fx = static_cast<accum_t>(u & mask) * scale;
+    accum_t const fy = static_cast<accum_t>(v & mask) * scale;
+    affine_warp_lerp<accum_t> const lerp{1 - fx, fx};
+    accum_pixel_t top;
+    accum_pixel_t bottom;
+    static_transform(origin(x0, y0), origin(x1, y0), top, lerp);
+    static_transform(origin(x0, y1), origin(x1, y1), bottom, lerp);
+    static_transform(top, bottom, result, affine_warp_round<channel_t, accum_t>{1 - fy, fy});
+}
+
+/// \brief Samples a destination row bilinearly, leaving the pixels mapped outside the source
+/// unchanged
+///
+/// The pixels whose four neighbours lie in the source are interpolated without bounds checks;
+/// the others, within a pixel of the borders, repeat the border pixels as the sampler does.
+template <typename SrcView, typename DstView>
+void affine_warp_row_pixels(
+    SrcView const& src,
+    DstView const& dst,
+    std::ptrdiff_t y,
+    affine_warp_row row,
+    bilinear_sampler)
+{
+    using value_t = typename base_channel_type<typename channel_type<SrcView>::type>::type;
+    using fixed_t = is_resample_fixed_point<value_t>;
+    std::int64_t const one = std::int64_t(1) << affine_warp_bits;
+    std::int64_t const width = std::int64_t(src.width()) << affine_warp_bits;
+    std::int64_t const height = std::int64_t(src.height()) << affine_warp_bits;
+
+    std::ptrdiff_t first = 0;
+    std::ptrdiff_t last = row.last - row.first;
+    affine_warp_clip(row.u, row.du, -one, width, first, last);
+    affine_warp_clip(row.v, row.dv, -one, height, first, last);
+    std::ptrdiff_t inner_first = first;
+    std::ptrdiff_t inner_last = last;
+    affine_warp_clip(row.u, row.du, 0, width - one, inner_first, inner_last);
+    affine_warp_clip(row.v, row.dv, 0, height - one, inner_first, inner_last);
+    if (inner_first == inner_last)
+        inner_first = inner_last = last;
+
+    typename DstView::x_iterator const dst_it = dst.row_begin(y) + row.first;
+    typename SrcView::xy_locator const origin = src.xy_at(0, 0);
+    std::ptrdiff_t const max_x = src.width() - 1;
+    std::ptrdiff_t const max_y = src.height() - 1;
+    auto const border = [&](std::ptrdiff_t k)
+    {
+        std::int64_t const u = row.u + k * row.du;
+        std::int64_t const v = row.v + k * row.dv;
+        std::ptrdiff_t const x = static_cast<std::ptrdiff_t>(u >> affine_warp_bits);
+        std::ptrdiff_t const y0 = static_cast<std::ptrdiff_t>(v >> affine_warp_bits);
+        affine_warp_bilinear<SrcView>(origin,
+            (std::max)(x, std::ptrdiff_t(0)), (std::min)(x + 1, max_x),
+            (std::max)(y0, std::ptrdiff_t(0)), (std::min)(y0 + 1, max_y), u, v, dst_it[k],
+            fixed_t());
+    };
+    for (std::ptrdiff_t k = first; k < inner_first; ++k)
+        border(k);
+    for (std::ptrdiff_t k = inner_first; k < inner_last; ++k)
+    {
+        std::int64_t const u = row.u + k * row.du;
+        std::int64_t const v = row.v + k * row.dv;
+        std::ptrdiff_t const x = static_cast<std::ptrdiff_t>(u >> affine_warp_bits);
+        std::ptrdiff_t const y0 = static_cast<std::ptrdiff_t>(v >> affine_warp_bits);
+        affine_warp_bilinear<SrcView>(origin, x, x + 1, y0, y0 + 1, u, v, dst_it[k], fixed_t());
+    }
+    for (std::ptrdiff_t k = inner_last; k < last; ++k)
+        border(k);
+}
+
+/// \brief Samples a destination row with the tabulated kernel of a sampler, leaving the pixels
+/// mapped outside the source unchanged
+///
+/// The coordinates are rounded to the nearest phase as by the sampler. The pixels whose taps
+/// lie in the source are sampled without bounds checks; the others repeat the border pixels.
+template <typename SrcView, typename DstView, typename Sampler>
+void affine_warp_row_pixels(
+    SrcView const& src,
+    DstView const& dst,
+    std::ptrdiff_t y,
+    affine_warp_row row,
+    Sampler const&)
+{
+    using value_t = typename base_channel_type<typename channel_type<SrcView>::type>::type;
+    using fixed_t = is_resample_fixed_point<value_t>;
+    constexpr int radius = sampler_kernel<Sampler>::radius;
+    constexpr int taps = 2 * radius;
+    int const phase_shift = affine_warp_bits - sampler_phase_bits;
+    std::int64_t const phase_mask = (std::int64_t(1) << sampler_phase_bits) - 1;
+    std::int64_t const one = std::int64_t(1) << affine_warp_bits;
+    std::int64_t const width = std::int64_t(src.width()) << affine_warp_bits;
+    std::int64_t const height = std::int64_t(src.height()) << affine_warp_bits;
+    std::int64_t const half = std::int64_t(1) << (phase_shift - 1);
+    std::int64_t const u = row.u + half;
+    std::int64_t const v = row.v + half;
+
+    std::ptrdiff_t first = 0;
+    std::ptrdiff_t last = row.last - row.first;
+    affine_warp_clip(u, row.du, -one, width, first, last);
+    affine_warp_clip(v, row.dv, -one, height, first, last);
+    std::ptrdiff_t inner_first = first;
+    std::ptrdiff_t inner_last = last;
+    affine_warp_clip(u, row.du, (radius - 1) * one, width - radius * one, inner_first, inner_last);
+    affine_warp_clip(v, row.dv, (radius - 1) * one, height - radius * one, inner_first,
+        inner_last);
+    if (inner_first == inner_last)
+        inner_first = inner_last = last;
+
+    auto const weights = sampler_weights(sampler_kernel<Sampler>::phases(), fixed_t());
+    typename DstView::x_iterator const dst_it = dst.row_begin(y) + row.first;
+    typename SrcView::xy_locator const origin = src.xy_at(0, 0);
+    std::ptrdiff_t const max_x = src.width() - 1;
+    std::ptrdiff_t const max_y = src.height() - 1;
+    std::ptrdiff_t xs[taps];
+    std::ptrdiff_t ys[taps];
+    auto const sample_at = [&](std::ptrdiff_t k, bool clamp)
+    {
+        std::int64_t const uk = u + k * row.du;
+        std::int64_t const vk = v + k * row.dv;
+        std::ptrdiff_t const x = static_cast<std::ptrdiff_t>(uk >> affine_warp_bits) - radius + 1;
+        std::ptrdiff_t const y0 = static_cast<std::ptrdiff_t>(vk >> affine_warp_bits) - radius + 1;
+        for (int t = 0; t < taps; ++t)
+        {
+            xs[t] = x + t;
+            ys[t] = y0 + t;
+            if (clamp)
+            {
+                xs[t] = (std::min)((std::max)(xs[t], std::ptrdiff_t(0)), max_x);
+                ys[t] = (std::min)((std::max)(ys[t], std::ptrdiff_t(0)), max_y);
+            }
+        }
+        sample_taps<taps, SrcView>(origin, xs, ys,
+            weights + ((uk >> phase_shift) & phase_mask) * taps,
+            weights + ((vk >> phase_shift) & phase_mask) * taps, dst_it[k], fixed_t());
+    };
+    for (std::ptrdiff_t k = first; k < inner_first; ++k)
+        sample_at(k, true);
+    for (std::ptrdiff_t k = inner_first; k < inner_last; ++k)
+        sample_at(k, false);
+    for (std::ptrdiff_t k = inner_last; k < last; ++k)
+        sample_at(k, true);
+}
+
+/// \brief Determines whether resample_pixels with a sampler can step the source coordinates of
+/// an affine mapping along the rows of the destination
+template <typename Sampler, typename SrcView, typename DstView, typename = void>
+struct is_affine_warp : std::false_type {};
+
+template <typename SrcView, typename DstView>
+struct is_affine_warp<nearest_neighbor_sampler, SrcView, DstView> : std::true_type {};
+
+template <typename SrcView, typename DstView>
+struct is_affine_warp
+<
+    bilinear_sampler,
+    SrcView,
+    DstView,
+    typename std::enable_if
+    <
+        std::is_same<typename SrcView::value_type, typename DstView::value_type>::value
+    >::type
+> : is_resample_pixel<typename SrcView::value_type>
+{};
+
+template <typename Sampler, typename SrcView, typename DstView>
+struct is_affine_warp
+<
+    Sampler,
+    SrcView,
+    DstView,
+    typename std::enable_if
+    <
+        is_kernel_sampler<Sampler>::value &&
+        std::is_same<typename SrcView::value_type, typename DstView::value_type>::value
+    >::type
+> : is_resample_pixel<typename SrcView::value_type>
+{};
+
+/// \brief Transforms and samples one destination pixel at a time, in bands of rows
+template
+<
+    typename ExecutionPolicy,
+    typename SrcView,
+    typename DstView,
+    typename MapFn,
+    typename Sampler
+>
+void sample_pixels(
+    ExecutionPolicy const& policy,
+    SrcView const& src_view,
+    DstView const& dst_view,
+    MapFn const& dst_to_src,
+    Sampler const& sampler)
+{
+    for_each_row_band(policy, dst_view.height(), [&](std::ptrdiff_t y0, std::ptrdiff_t y1)
+    {
+        typename DstView::point_t dst_p;
+        for (dst_p.y = y0; dst_p.y < y1; ++dst_p.y)
+        {
+            typename DstView::x_iterator xit = dst_view.row_begin(dst_p.y);
+            for (dst_p.x = 0; dst_p.x < dst_view.width(); ++dst_p.x)
+                sample(sampler, src_view, transform(dst_to_src, dst_p), xit[dst_p.x]);
+        }
+    });
+}
+
+template
+<
+    typename ExecutionPolicy,
+    typename SrcView,
+    typename DstView,
+    typename F,
+    typename Sampler
+>
+void warp_pixels(
+    ExecutionPolicy const& policy,
+    SrcView const& src_view,
+    DstView const& dst_view,
+    matrix3x2<F> const& dst_to_src,
+    Sampler const& sampler,
+    std::true_type /* affine */)
+{
+    if (src_view.width() == 0 || src_view.height() == 0)
+        return;
+
+    // Steps of over a million pixels along the rows would overflow the fixed point coordinates
+    double const max_step = static_cast<double>(1 << 20);
+    if (!(std::abs(static_cast<double>(dst_to_src.a)) < max_step &&
+        std::abs(static_cast<double>(dst_to_src.b)) < max_step))
+    {
+        sample_pixels(policy, src_view, dst_view, dst_to_src, sampler);
+        return;
+    }
+
+    for_each_row_band(policy, dst_view.height(), [&](std::ptrdiff_t y0, std::ptrdiff_t y1)
+    {
+        for (std::ptrdiff_t y = y0; y < y1; ++y)
+        {
+            affine_warp_row const row =
+                make_affine_warp_row(dst_to_src, y, dst_view.width(), src_view.dimensions());
+            if (row.first < row.last)
+                affine_warp_row_pixels(src_view, dst_view, y, row, sampler);
+        }
+    });
+}
+
+template
+<
+    typename ExecutionPolicy,
+    typename SrcView,
+    typename DstView,
+    typename F,
+    typename Sampler
+>
+void warp_pixels(
+    ExecutionPolicy const& policy,
+    SrcView const& src_view,
+    DstView const& dst_view,
+    matrix3x2<F> const& dst_to_src,
+    Sampler const& sampler,
+    std::false_type /* affine */)
+{
+    sample_pixels(policy, src_view, dst_view, dst_to_src, sampler);
+}
+
+template
+<
+    typename ExecutionPolicy,
+    typename SrcView,
+    typename DstView,
+    typename MapFn,
+    typename Sampler
+>
+void warp_pixels(
+    ExecutionPolicy const& policy,
+    SrcView const& src_view,
+    DstView const& dst_view,
+    MapFn const& dst_to_src,
+    Sampler const& sampler)
+{
+    sample_pixels(policy, src_view, dst_view, dst_to_src, sampler);
+}
+
+template
+<
+    typename ExecutionPolicy,
+    typename SrcView,
+    typename DstView,
+    typename F,
+    typename Sampler
+>
+void warp_pixels(
+    ExecutionPolicy const& policy,
+    SrcView const& src_view,
+    DstView const& dst_view,
+    matrix3x2<F> const& dst_to_src,
+    Sampler const& sampler)
+{
+    warp_pixels(policy, src_view, dst_view, dst_to_src, sampler,
+        is_affine_warp<Sampler, SrcView, DstView>());
+}
+
+} // namespace detail
+
+/// \brief Set each pixel in the destination view as the result of a sampling function over the
+/// transformed coordinates of the source view, in bands of rows according to an execution policy
+/// \ingroup ImageAlgorithms
+///
+/// With a matrix3x2 mapping and a nearest_neighbor_sampler, or a bilinear_sampler,
+/// bicubic_sampler or lanczos_sampler and views of the same pixel type, the source coordinates
+/// are stepped along each destination row by constant deltas in fixed point, and each row is
+/// clipped once to the pixels mapped inside the source, which are sampled without bounds
+/// checks. Bilinear results are computed in fixed point for 8-bit channels and rounded to
+/// nearest for integer channels, where the sampler truncates. Other mappings and samplers
+/// transform and sample one destination pixel at a time.
+template
+<
+    typename Sampler,
+    typename ExecutionPolicy,
+    typename SrcView,
+    typename DstView,
+    typename MapFn,
+    typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+>
+void resample_pixels(
+    ExecutionPolicy const& policy,
+    SrcView const& src_view,
+    DstView const& dst_view,
+    MapFn const& dst_to_src,
+    Sampler sampler = Sampler())
+{
+    detail::warp_pixels(policy, src_view, dst_view, dst_to_src, sampler);
+}
+
 /// \brief Set each pixel in the destination view as the result of a sampling function over the transformed coordinates of the source view
 /// \ingroup ImageAlgorithms
 ///
@@ -37,15 +615,7 @@ template <typename Sampler,        // Models SamplerConcept
           typename MapFn>        // Models MappingFunctionConcept
 void resample_pixels(const SrcView& src_view, const DstView& dst_view, const MapFn& dst_to_src, Sampler sampler=Sampler())
 {
-    typename DstView::point_t dst_dims=dst_view.dimensions();
-    typename DstView::point_t dst_p;
-
-    for (dst_p.y=0; dst_p.y<dst_dims.y; ++dst_p.y) {
-        typename DstView::x_iterator xit = dst_view.row_begin(dst_p.y);
-        for (dst_p.x=0; dst_p.x<dst_dims.x; ++dst_p.x) {
-            sample(sampler, src_view, transform(dst_to_src, dst_p), xit[dst_p.x]);
-        }
-    }
+    resample_pixels(execution::seq, src_view, dst_view, dst_to_src, sampler);
 }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -133,9 +703,197 @@ void resample_subimage(const SrcMetaView& src, const DstMetaView& dst,
 ////
 ///////////////////////////////////////////////////////////////////////////
 
+namespace detail {
+
+/// \brief Computes the bilinear weights of an axis of \p src_size pixels resized to \p dst_size
+/// pixels by resize_view, which maps the first and last pixels of the destination to the
+/// first and last pixels of the source
+inline auto make_resize_axis(std::ptrdiff_t src_size, std::ptrdiff_t dst_size) -> resample_axis
+{
+    double const scale = dst_size > 1
+        ? static_cast<double>((std::max)(src_size - 1, std::ptrdiff_t(1))) /
+            static_cast<double>(dst_size - 1)
+        : 0.0;
+    int const one = 1 << resample_fixed_bits;
+
+    resample_axis axis;
+    axis.taps = 2;
+    std::size_t const size = static_cast<std::size_t>(dst_size);
+    axis.first.resize(size);
+    axis.count.resize(size);
+    axis.weights.assign(2 * size, 0.0f);
+    axis.fixed_weights.assign(2 * size, 0);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        double const position = static_cast<double>(i) * scale;
+        std::ptrdiff_t first = static_cast<std::ptrdiff_t>(std::floor(position));
+        double fraction = position - static_cast<double>(first);
+        if (first >= src_size - 1)
+        {
+            // The last source pixel, no neighbour to interpolate with
+            first = src_size - 1;
+            fraction = 0.0;
+        }
+        int const fixed = static_cast<int>(std::lround(fraction * one));
+        // Both neighbours are kept when the second weight is zero, so that the number of
+        // taps of each pixel of a row is predictable
+        axis.first[i] = first;
+        axis.count[i] = first + 1 < src_size ? 2 : 1;
+        axis.weights[2 * i] = static_cast<float>(1.0 - fraction);
+        axis.weights[2 * i + 1] = static_cast<float>(fraction);
+        axis.fixed_weights[2 * i] = static_cast<std::int16_t>(one - fixed);
+        axis.fixed_weights[2 * i + 1] = static_cast<std::int16_t>(fixed);
+    }
+    return axis;
+}
+
+inline auto make_resize_axis(std::ptrdiff_t src_size, std::ptrdiff_t dst_size, bilinear_sampler)
+    -> resample_axis
+{
+    return make_resize_axis(src_size, dst_size);
+}
+
+/// \brief Computes the weights of an axis resized by resize_view with the tabulated kernel of a
+/// sampler, at the phases nearest to the positions of the destination pixels
+///
+/// The taps past the borders are added to the border pixels, as the sampler repeats them.
+template <typename Sampler>
+auto make_resize_axis(std::ptrdiff_t src_size, std::ptrdiff_t dst_size, Sampler const&)
+    -> resample_axis
+{
+    constexpr int radius = sampler_kernel<Sampler>::radius;
+    std::size_t const taps = 2 * radius;
+    resample_axis const& phases = sampler_kernel<Sampler>::phases();
+    double const scale = dst_size > 1
+        ? static_cast<double>((std::max)(src_size - 1, std::ptrdiff_t(1))) /
+            static_cast<double>(dst_size - 1)
+        : 0.0;
+
+    resample_axis axis;
+    axis.taps = static_cast<std::ptrdiff_t>(taps);
+    std::size_t const size = static_cast<std::size_t>(dst_size);
+    axis.first.resize(size);
+    axis.count.resize(size);
+    axis.weights.assign(size * taps, 0.0f);
+    axis.fixed_weights.assign(size * taps, 0);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        std::ptrdiff_t pixel;
+        std::size_t phase;
+        sampler_position(static_cast<double>(i) * scale, pixel, phase);
+        std::ptrdiff_t const lo = pixel - radius + 1;
+        std::ptrdiff_t const first = (std::min)((std::max)(lo, std::ptrdiff_t(0)), src_size - 1);
+        std::ptrdiff_t const last = (std::min)((std::max)(lo + axis.taps, std::ptrdiff_t(1)),
+            src_size);
+        axis.first[i] = first;
+        axis.count[i] = last - first;
+        for (std::size_t k = 0; k < taps; ++k)
+        {
+            std::ptrdiff_t const x = lo + static_cast<std::ptrdiff_t>(k);
+            std::size_t const j = i * taps +
+                static_cast<std::size_t>((std::min)((std::max)(x, first), last - 1) - first);
+            axis.weights[j] += phases.weights[phase * taps + k];
+            axis.fixed_weights[j] = static_cast<std::int16_t>(
+                axis.fixed_weights[j] + phases.fixed_weights[phase * taps + k]);
+        }
+    }
+    return axis;
+}
+
+/// \brief Determines whether resize_view with a sampler can resample the source view to the
+/// destination view in separable passes
+template <typename Sampler, typename SrcView, typename DstView, typename = void>
+struct is_separable_resize : std::false_type {};
+
+template <typename SrcView, typename DstView>
+struct is_separable_resize
+<
+    bilinear_sampler,
+    SrcView,
+    DstView,
+    typename std::enable_if
+    <
+        std::is_same<typename SrcView::value_type, typename DstView::value_type>::value
+    >::type
+> : is_resample_pixel<typename SrcView::value_type>
+{};
+
+template <typename Sampler, typename SrcView, typename DstView>
+struct is_separable_resize
+<
+    Sampler,
+    SrcView,
+    DstView,
+    typename std::enable_if
+    <
+        is_kernel_sampler<Sampler>::value &&
+        std::is_same<typename SrcView::value_type, typename DstView::value_type>::value
+    >::type
+> : is_resample_pixel<typename SrcView::value_type>
+{};
+
+template <typename ExecutionPolicy, typename Sampler, typename SrcView, typename DstView>
+void resize_view(
+    ExecutionPolicy const& policy,
+    SrcView const& src,
+    DstView const& dst,
+    Sampler const& sampler,
+    std::true_type /* separable */)
+{
+    using value_t = typename base_channel_type<typename channel_type<SrcView>::type>::type;
+    if (src.width() == 0 || src.height() == 0 || dst.width() == 0 || dst.height() == 0)
+        return;
+
+    resample_axis const x_axis = make_resize_axis(src.width(), dst.width(), sampler);
+    resample_axis const y_axis = make_resize_axis(src.height(), dst.height(), sampler);
+    resample_separable(policy, src, dst, x_axis, y_axis, is_resample_fixed_point<value_t>());
+}
+
+template <typename ExecutionPolicy, typename Sampler, typename SrcMetaView, typename DstMetaView>
+void resize_view(
+    ExecutionPolicy const&,
+    SrcMetaView const& src,
+    DstMetaView const& dst,
+    Sampler const& sampler,
+    std::false_type /* separable */)
+{
+    resample_subimage(src,dst,0.0,0.0,(double)src.width(),(double)src.height(),0.0,sampler);
+}
+
+} // namespace detail
+
+/// \brief Copy the source view into the destination, scaling to fit, in bands of rows
+/// according to an execution policy
+/// \ingroup ImageAlgorithms
+///
+/// The first and last pixels of each row and column of the destination are sampled at the
+/// first and last pixels of the source. With a bilinear_sampler, a bicubic_sampler or a
+/// lanczos_sampler and views of the same pixel type, the interpolation weights are computed
+/// once per destination row and column and the views are resampled horizontally then
+/// vertically, in fixed point for 8-bit channels; integer results are rounded to nearest.
+/// Other samplers and views are resampled one destination pixel at a time. The kernels are
+/// not widened when shrinking; see scale_lanczos to resample without aliasing.
+template
+<
+    typename Sampler,
+    typename ExecutionPolicy,
+    typename SrcMetaView,
+    typename DstMetaView,
+    typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+>
+void resize_view(
+    ExecutionPolicy const& policy,
+    SrcMetaView const& src,
+    DstMetaView const& dst,
+    Sampler const& sampler = Sampler())
+{
+    detail::resize_view(policy, src, dst, sampler,
+        detail::is_separable_resize<Sampler, SrcMetaView, DstMetaView>());
+}
+
 template <typename Sampler, typename SrcMetaView, typename DstMetaView>
 void resize_view(const SrcMetaView& src, const DstMetaView& dst, const Sampler& sampler=Sampler()) {
-    resample_subimage(src,dst,0.0,0.0,(double)src.width(),(double)src.height(),0.0,sampler);
+    resize_view(execution::seq, src, dst, sampler);
 }
 
 } }  // namespace boost::gil
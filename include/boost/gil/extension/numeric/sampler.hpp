@@ -11,11 +11,20 @@
 
 #include <boost/gil/extension/dynamic_image/dynamic_image_all.hpp>
 #include <boost/gil/pixel_numeric_operations.hpp>
+#include <boost/gil/detail/math.hpp>
+#include <boost/gil/detail/resample_row.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
 
 namespace boost { namespace gil {
 
-// Nearest-neighbor and bilinear image samplers.
-// NOTE: The code is for example use only. It is not optimized for performance
+// Nearest-neighbor, bilinear, bicubic and Lanczos image samplers.
+// The bicubic and Lanczos kernels are tabulated for 256 phases per pixel, and affine warps,
+// resizes and remaps of same-typed pixels sample whole rows in resample.hpp and remap.hpp.
 
 ///////////////////////////////////////////////////////////////////////////
 ////
@@ -184,6 +193,285 @@ bool sample(bilinear_sampler, SrcView const& src, point<F> const& p, DstP& resul
 	return true;
 }
 
+/// \brief A sampler that sets the destination pixel as the bicubic interpolation of the 4x4
+/// closest pixels from the source, with the Catmull-Rom cubic. If outside the bounds, it
+/// doesn't change the destination
+/// \ingroup ImageAlgorithms
+struct bicubic_sampler {};
+
+/// \brief A sampler that sets the destination pixel as the interpolation of the 2N x 2N closest
+/// pixels from the source with a Lanczos window of \p N lobes. If outside the bounds, it doesn't
+/// change the destination
+/// \ingroup ImageAlgorithms
+template <int N>
+struct lanczos_sampler
+{
+    static_assert(N > 0, "Lanczos windows have at least one lobe");
+};
+
+namespace detail {
+
+// The bicubic and Lanczos samplers interpolate with separable kernels, whose weights are
+// tabulated at 2^sampler_phase_bits positions, or phases, between two pixels. The pixels
+// sampled by the kernel are weighted in fixed point for 8-bit channels, as by the separable
+// resampling of resize_view, and in floating point otherwise. Coordinates within a pixel of
+// the borders repeat the border pixels, as the bilinear sampler does.
+
+/// \brief Number of bits of the phases of the kernel samplers
+constexpr int sampler_phase_bits = 8;
+
+/// \brief Catmull-Rom cubic, the cubic convolution kernel of Keys with a = -0.5
+inline auto bicubic_weight(double x) -> double
+{
+    double const a = -0.5;
+    x = std::abs(x);
+    if (x < 1.0)
+        return ((a + 2.0) * x - (a + 3.0)) * x * x + 1.0;
+    if (x < 2.0)
+        return ((a * x - 5.0 * a) * x + 8.0 * a) * x - 4.0 * a;
+    return 0.0;
+}
+
+/// \brief Lanczos window of \p n lobes, sinc(x) sinc(x / n)
+inline auto lanczos_weight(double x, int n) -> double
+{
+    if (!(std::abs(x) > 0.0))
+        return 1.0;
+    if (std::abs(x) >= static_cast<double>(n))
+        return 0.0;
+    double const px = pi * x;
+    return static_cast<double>(n) * std::sin(px) * std::sin(px / static_cast<double>(n)) /
+        (px * px);
+}
+
+/// \brief Computes the weights of the 2 * \p radius taps of a kernel at each phase
+///
+/// The weights of phase p interpolate p / 2^sampler_phase_bits pixels past the pixel
+/// radius - 1 of the taps, and are normalized to add up to one.
+template <typename Kernel>
+inline auto make_sampler_phases(int radius, Kernel const& kernel) -> resample_axis
+{
+    std::size_t const phases = std::size_t(1) << sampler_phase_bits;
+    resample_axis axis;
+    axis.taps = 2 * radius;
+    std::size_t const taps = static_cast<std::size_t>(axis.taps);
+    axis.first.resize(phases);
+    axis.count.resize(phases);
+    axis.weights.assign(phases * taps, 0.0f);
+    axis.fixed_weights.assign(phases * taps, 0);
+
+    std::vector<double> w(taps);
+    for (std::size_t p = 0; p < phases; ++p)
+    {
+        double const fraction = static_cast<double>(p) / static_cast<double>(phases);
+        double total = 0.0;
+        for (std::size_t k = 0; k < taps; ++k)
+        {
+            w[k] = kernel(static_cast<double>(k) - static_cast<double>(radius - 1) - fraction);
+            total += w[k];
+        }
+        set_resample_weights(axis, p, 1 - radius, w.data(), axis.taps, total);
+    }
+    return axis;
+}
+
+/// \brief Radius and phase weights of the kernel of a sampler
+template <typename Sampler>
+struct sampler_kernel;
+
+template <>
+struct sampler_kernel<bicubic_sampler>
+{
+    static constexpr int radius = 2;
+
+    static auto phases() -> resample_axis const&
+    {
+        static resample_axis const table = make_sampler_phases(radius, bicubic_weight);
+        return table;
+    }
+};
+
+template <int N>
+struct sampler_kernel<lanczos_sampler<N>>
+{
+    static constexpr int radius = N;
+
+    static auto phases() -> resample_axis const&
+    {
+        static resample_axis const table =
+            make_sampler_phases(radius, [](double x) { return lanczos_weight(x, N); });
+        return table;
+    }
+};
+
+/// \brief Determines whether a sampler interpolates with a tabulated separable kernel
+template <typename Sampler>
+struct is_kernel_sampler : std::false_type {};
+
+template <>
+struct is_kernel_sampler<bicubic_sampler> : std::true_type {};
+
+template <int N>
+struct is_kernel_sampler<lanczos_sampler<N>> : std::true_type {};
+
+inline auto sampler_weights(resample_axis const& phases, std::true_type /* fixed point */)
+    -> std::int16_t const*
+{
+    return phases.fixed_weights.data();
+}
+
+inline auto sampler_weights(resample_axis const& phases, std::false_type /* fixed point */)
+    -> float const*
+{
+    return phases.weights.data();
+}
+
+/// \brief Interpolates to \p result the pixels of a view of 8-bit channels located at
+/// \p origin, at the \p Taps columns \p xs and rows \p ys, weighted by \p wx and \p wy
+///
+/// Rows are rounded to intermediate values before they are weighted, as by the separable
+/// resampling of 8-bit rows.
+template <int Taps, typename SrcView, typename DstPixel>
+BOOST_FORCEINLINE
+void sample_taps(
+    typename SrcView::xy_locator const& origin,
+    std::ptrdiff_t const* xs,
+    std::ptrdiff_t const* ys,
+    std::int16_t const* wx,
+    std::int16_t const* wy,
+    DstPixel&& result,
+    std::true_type /* fixed point */)
+{
+    using channel_t = typename channel_type<SrcView>::type;
+    using accum_pixel_t = pixel<std::int32_t, typename SrcView::value_type::layout_t>;
+    accum_pixel_t sum(1 << (resample_fixed_bits + resample_intermediate_bits - 1));
+    for (int j = 0; j < Taps; ++j)
+    {
+        accum_pixel_t row(1 << (resample_fixed_bits - resample_intermediate_bits - 1));
+        for (int i = 0; i < Taps; ++i)
+        {
+            std::int32_t const w = wx[i];
+            static_transform(row, origin(xs[i], ys[j]), row, [w](std::int32_t a, channel_t c)
+            {
+                return a + w * static_cast<std::int32_t>(c);
+            });
+        }
+        std::int32_t const w = wy[j];
+        static_transform(sum, row, sum, [w](std::int32_t a, std::int32_t r)
+        {
+            return a + w * resample_round_intermediate(r);
+        });
+    }
+    static_transform(sum, result, [](std::int32_t a)
+    {
+        return channel_t(resample_round_fixed(a));
+    });
+}
+
+template <int Taps, typename SrcView, typename DstPixel>
+BOOST_FORCEINLINE
+void sample_taps(
+    typename SrcView::xy_locator const& origin,
+    std::ptrdiff_t const* xs,
+    std::ptrdiff_t const* ys,
+    float const* wx,
+    float const* wy,
+    DstPixel&& result,
+    std::false_type /* fixed point */)
+{
+    using channel_t = typename channel_type<SrcView>::type;
+    using value_t = typename base_channel_type<channel_t>::type;
+    using accum_t = resample_accum_t<value_t>;
+    using accum_pixel_t = pixel<accum_t, typename SrcView::value_type::layout_t>;
+    accum_pixel_t sum(0);
+    for (int j = 0; j < Taps; ++j)
+    {
+        accum_pixel_t row(0);
+        for (int i = 0; i < Taps; ++i)
+        {
+            accum_t const w = static_cast<accum_t>(wx[i]);
+            static_transform(row, origin(xs[i], ys[j]), row, [w](accum_t a, channel_t c)
+            {
+                return a + w * static_cast<accum_t>(static_cast<value_t>(c));
+            });
+        }
+        accum_t const w = static_cast<accum_t>(wy[j]);
+        static_transform(sum, row, sum, [w](accum_t a, accum_t r) { return a + w * r; });
+    }
+    static_transform(sum, result, [](accum_t a)
+    {
+        return channel_t(resample_round<value_t>(a));
+    });
+}
+
+/// \brief Splits a coordinate into the pixel at or before it and the phase past that pixel,
+/// rounded to the nearest phase
+inline void sampler_position(double p, std::ptrdiff_t& pixel, std::size_t& phase)
+{
+    double const phases = static_cast<double>(1 << sampler_phase_bits);
+    std::ptrdiff_t const q = static_cast<std::ptrdiff_t>(std::floor(p * phases + 0.5));
+    pixel = static_cast<std::ptrdiff_t>(std::floor(static_cast<double>(q) / phases));
+    phase = static_cast<std::size_t>(q - pixel * (std::ptrdiff_t(1) << sampler_phase_bits));
+}
+
+/// \brief Samples a source view with the kernel of a sampler, repeating the border pixels
+template <typename Sampler, typename DstP, typename SrcView, typename F>
+bool sample_kernel(SrcView const& src, point<F> const& p, DstP& result)
+{
+    using src_value_t = typename SrcView::value_type;
+    using value_t = typename base_channel_type<typename channel_type<SrcView>::type>::type;
+    using fixed_t = is_resample_fixed_point<value_t>;
+    static_assert(is_resample_pixel<src_value_t>::value,
+        "Kernel samplers require channels stored as arithmetic values");
+    constexpr int radius = sampler_kernel<Sampler>::radius;
+    constexpr int taps = 2 * radius;
+
+    // The pixels at or before the coordinates range over [-1, size) as for the bilinear sampler
+    double const x = static_cast<double>(p.x);
+    double const y = static_cast<double>(p.y);
+    double const half_phase = 0.5 / static_cast<double>(1 << sampler_phase_bits);
+    if (!(x >= -1.0 - half_phase && x < static_cast<double>(src.width()) - half_phase &&
+        y >= -1.0 - half_phase && y < static_cast<double>(src.height()) - half_phase))
+    {
+        return false;
+    }
+
+    std::ptrdiff_t px;
+    std::ptrdiff_t py;
+    std::size_t phase_x;
+    std::size_t phase_y;
+    sampler_position(x, px, phase_x);
+    sampler_position(y, py, phase_y);
+    std::ptrdiff_t xs[taps];
+    std::ptrdiff_t ys[taps];
+    for (int t = 0; t < taps; ++t)
+    {
+        xs[t] = (std::min)((std::max)(px + t - radius + 1, std::ptrdiff_t(0)), src.width() - 1);
+        ys[t] = (std::min)((std::max)(py + t - radius + 1, std::ptrdiff_t(0)), src.height() - 1);
+    }
+
+    auto const weights = sampler_weights(sampler_kernel<Sampler>::phases(), fixed_t());
+    src_value_t value;
+    sample_taps<taps, SrcView>(src.xy_at(0, 0), xs, ys, weights + phase_x * taps,
+        weights + phase_y * taps, value, fixed_t());
+    color_convert(value, result);
+    return true;
+}
+
+} // namespace detail
+
+template <typename DstP, typename SrcView, typename F>
+bool sample(bicubic_sampler, SrcView const& src, point<F> const& p, DstP& result)
+{
+    return detail::sample_kernel<bicubic_sampler>(src, p, result);
+}
+
+template <int N, typename DstP, typename SrcView, typename F>
+bool sample(lanczos_sampler<N>, SrcView const& src, point<F> const& p, DstP& result)
+{
+    return detail::sample_kernel<lanczos_sampler<N>>(src, p, result);
+}
+
 }}  // namespace boost::gil
 
 #endif
@@ -10,6 +10,8 @@
 #define BOOST_GIL_HISTOGRAM_HPP
 
 #include <boost/gil/concepts/concept_check.hpp>
+#include <boost/gil/execution.hpp>
+#include <boost/gil/image_view_factory.hpp>
 #include <boost/gil/metafunctions.hpp>
 #include <boost/gil/pixel.hpp>
 
@@ -17,8 +19,14 @@
 #include <boost/type_traits.hpp>
 #include <boost/functional/hash.hpp>
 
+#include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstddef>
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <numeric>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -590,6 +598,534 @@ private:
     }
 };
 
+namespace detail {
+
+/// \ingroup Histogram-Helpers
+/// \brief Determines whether a bin type can be an axis of dense_histogram.
+///        Every value of such a type gets its own bin, so only integral types of
+///        at most 16 bits are accepted.
+///
+template <typename T>
+struct is_dense_histogram_bin
+    : std::integral_constant
+    <
+        bool,
+        std::is_integral<T>::value && !std::is_same<T, bool>::value && sizeof(T) <= 2
+    >
+{
+};
+
+/// \ingroup Histogram-Helpers
+/// \brief Number of bins along a dense_histogram axis of type T, 0 for other types
+///
+template <typename T>
+struct dense_histogram_extent
+    : std::integral_constant
+    <
+        std::size_t,
+        is_dense_histogram_bin<T>::value
+            ? static_cast<std::size_t>(
+                  static_cast<long>((std::numeric_limits<T>::max)()) -
+                  static_cast<long>((std::numeric_limits<T>::min)()) + 1)
+            : 0
+    >
+{
+};
+
+/// \ingroup Histogram-Helpers
+/// \brief Number of bins of a dense_histogram, the product of the axis extents
+///
+template <typename... T>
+struct dense_histogram_bin_count : std::integral_constant<std::size_t, 1>
+{
+};
+
+template <typename T, typename... Rest>
+struct dense_histogram_bin_count<T, Rest...>
+    : std::integral_constant
+    <
+        std::size_t,
+        dense_histogram_extent<T>::value * dense_histogram_bin_count<Rest...>::value
+    >
+{
+};
+
+/// \ingroup Histogram-Helpers
+/// \brief Adds count to a bin, giving the value that count increments by one would give
+///
+template <typename T>
+auto add_histogram_count(T& bin, std::size_t count)
+    -> typename std::enable_if<!std::is_floating_point<T>::value>::type
+{
+    bin = static_cast<T>(bin + count);
+}
+
+/// \ingroup Histogram-Helpers
+/// \brief Adds count to a floating-point bin, giving the value that count increments by one
+///        would give. Integral bins are exact up to 2^digits, other bins are incremented one
+///        by one, to round like the serial fill does.
+///
+template <typename T>
+auto add_histogram_count(T& bin, std::size_t count)
+    -> typename std::enable_if<std::is_floating_point<T>::value>::type
+{
+    T const exact_limit = std::ldexp(T(1), std::numeric_limits<T>::digits);
+    T whole;
+    bool const is_whole = !(std::abs(std::modf(bin, &whole)) > T(0));
+    if (is_whole && std::abs(bin) + static_cast<T>(count) <= exact_limit)
+    {
+        bin += static_cast<T>(count);
+    }
+    else
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            ++bin;
+    }
+}
+
+/// \ingroup Histogram-Helpers
+/// \brief Largest number of bins of a dense_histogram, 8 MiB of counts
+///
+constexpr std::size_t dense_histogram_max_bin_count = std::size_t(1) << 20;
+
+}  //namespace detail
+
+///
+/// \class boost::gil::dense_histogram
+/// \ingroup Histogram
+/// \brief Histogram over integral bin types of at most 16 bits, stored in a flat array.
+///
+/// Provides the interface of histogram, but keeps one bin for every key that the bin types
+/// can represent, in row-major order of the keys. Finding a bin is an index computation
+/// instead of hashing a tuple, so filling costs about one pass over the image.
+/// Since all bins are always present, the class behaves like a histogram filled with
+/// sparsefill = false, size() is the number of bins and iteration visits the keys in
+/// ascending order.
+///
+/// A joint histogram has as many bins as the product of the axis extents,
+/// for example 65536 bins for dense_histogram<std::uint8_t, std::uint8_t>, and at most 2^20.
+///
+/// Since every value has a bin of its own, the bins cannot be widened. The algorithms that
+/// take a bin width use dense_histogram for unit bin width only, and histogram otherwise.
+/// \code
+/// dense_histogram<std::uint8_t> h;
+/// fill_histogram(view(img), h);
+/// \endcode
+///
+template <typename... T>
+class dense_histogram
+{
+    using bin_t = boost::mp11::mp_list<T...>;
+
+    static_assert(
+        boost::mp11::mp_all_of<bin_t, detail::is_dense_histogram_bin>::value,
+        "Dense histogram bins must be integral types of at most 16 bits.");
+    static_assert(
+        detail::dense_histogram_bin_count<T...>::value <= detail::dense_histogram_max_bin_count,
+        "Dense histograms have at most 2^20 bins, use histogram for larger joint histograms.");
+
+public:
+    using key_type    = std::tuple<T...>;
+    using mapped_type = double;
+    using value_type  = std::pair<key_type, mapped_type>;
+    using size_type   = std::size_t;
+
+    /// \brief Forward iterator over the (key, count) pairs of all bins
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = typename dense_histogram::value_type;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = value_type;
+
+        const_iterator() = default;
+        const_iterator(dense_histogram const* hist, std::size_t index) : hist_(hist), index_(index)
+        {
+        }
+
+        auto operator*() const -> value_type
+        {
+            return value_type(key_at(index_), hist_->bins_[index_]);
+        }
+
+        auto operator++() -> const_iterator&
+        {
+            ++index_;
+            return *this;
+        }
+
+        auto operator++(int) -> const_iterator
+        {
+            const_iterator tmp = *this;
+            ++index_;
+            return tmp;
+        }
+
+        friend bool operator==(const_iterator const& a, const_iterator const& b)
+        {
+            return a.index_ == b.index_;
+        }
+
+        friend bool operator!=(const_iterator const& a, const_iterator const& b)
+        {
+            return a.index_ != b.index_;
+        }
+
+    private:
+        dense_histogram const* hist_ = nullptr;
+        std::size_t index_           = 0;
+    };
+    using iterator = const_iterator;
+
+    dense_histogram() : bins_(bin_count(), 0.0) {}
+
+    /// \brief Returns the number of dimensions(axes) the class supports.
+    static constexpr std::size_t dimension()
+    {
+        return sizeof...(T);
+    }
+
+    /// \brief Returns the number of bins, which is the product of the axis extents.
+    static std::size_t bin_count()
+    {
+        return detail::dense_histogram_bin_count<T...>::value;
+    }
+
+    std::size_t size() const { return bins_.size(); }
+
+    /// \brief Sets all bins to zero
+    void clear() { std::fill(bins_.begin(), bins_.end(), 0.0); }
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, bins_.size()); }
+
+    /// \brief Bins in row-major order of the keys, the last axis varying fastest
+    mapped_type* data() { return bins_.data(); }
+    mapped_type const* data() const { return bins_.data(); }
+
+    /// \brief Returns bin value corresponding to specified indices
+    mapped_type& operator()(T... indices)
+    {
+        return bins_[index_of(indices...)];
+    }
+
+    /// \brief Returns bin value corresponding to specified key
+    mapped_type& operator[](key_type const& key)
+    {
+        return bins_[index_of_key(key, boost::mp11::index_sequence_for<T...>{})];
+    }
+
+    mapped_type& at(key_type const& key)
+    {
+        return bins_[index_of_key(key, boost::mp11::index_sequence_for<T...>{})];
+    }
+
+    mapped_type const& at(key_type const& key) const
+    {
+        return bins_[index_of_key(key, boost::mp11::index_sequence_for<T...>{})];
+    }
+
+    /// \brief Checks if the bins of the other histogram have equal counts in this one.
+    ///        Ignores type, and compares the keys after type casting.
+    template <typename OtherType>
+    bool equals(OtherType const& otherhist) const
+    {
+        bool check = (dimension() == otherhist.dimension());
+
+        using other_value_t = typename OtherType::value_type;
+        std::for_each(otherhist.begin(), otherhist.end(), [&](other_value_t const& v) {
+            // counts are whole numbers, equal up to rounding
+            mapped_type const count = at(key_from_tuple(v.first));
+            mapped_type const other_count = static_cast<mapped_type>(v.second);
+            check = check && std::abs(count - other_count) <=
+                std::numeric_limits<mapped_type>::epsilon() *
+                    (std::max)(std::abs(count), std::abs(other_count));
+        });
+        return check;
+    }
+
+    /// \brief Checks if the histogram class is compatible to be used with
+    ///        a GIL image type
+    static constexpr bool is_pixel_compatible()
+    {
+        return true;
+    }
+
+    /// \brief Checks if the histogram class is compatible to be used with
+    ///        the specified tuple type
+    template <typename Tuple>
+    bool is_tuple_compatible(Tuple const&)
+    {
+        return std::tuple_size<Tuple>::value == dimension() &&
+               is_tuple_type_compatible<Tuple>(boost::mp11::make_index_sequence<dimension()>{});
+    }
+
+    /// \brief Returns a key compatible to be used as the histogram key
+    ///        from the input tuple
+    template <std::size_t... Dimensions, typename Tuple>
+    key_type key_from_tuple(Tuple const& t) const
+    {
+        std::size_t const index_list_size = sizeof...(Dimensions);
+        static_assert(
+            (index_list_size != 0 && index_list_size == dimension()) ||
+            std::tuple_size<Tuple>::value == dimension(),
+            "Tuple and histogram key of different sizes");
+
+        using seq1 = boost::mp11::make_index_sequence<dimension()>;
+        using seq2 = boost::mp11::index_sequence<Dimensions...>;
+        using sequence_type = typename std::conditional<index_list_size == 0, seq1, seq2>::type;
+
+        return make_histogram_key(detail::tuple_to_tuple(t, sequence_type{}), seq1{});
+    }
+
+    /// \brief Returns a histogram compatible key from the input pixel which
+    ///        can be directly used
+    template <std::size_t... Dimensions, typename Pixel>
+    key_type key_from_pixel(Pixel const& p) const
+    {
+        std::size_t const index_list_size = sizeof...(Dimensions);
+        static_assert(
+            (index_list_size != 0 && index_list_size == dimension()) ||
+            (index_list_size == 0 && num_channels<Pixel>::value == dimension()),
+            "Pixels and histogram key are not compatible.");
+
+        using seq1 = boost::mp11::make_index_sequence<dimension()>;
+        using seq2 = boost::mp11::index_sequence<Dimensions...>;
+        using sequence_type = typename std::conditional<index_list_size == 0, seq1, seq2>::type;
+
+        return make_histogram_key(detail::pixel_to_tuple(p, sequence_type{}), seq1{});
+    }
+
+    /// \brief Return nearest smaller key to specified histogram key,
+    ///        which is the key itself since every key has a bin
+    key_type nearest_key(key_type const& k) const
+    {
+        return k;
+    }
+
+    /// \brief Fills the histogram with the input image view
+    template <std::size_t... Dimensions, typename SrcView>
+    void fill(
+        SrcView const& srcview,
+        std::size_t bin_width               = 1,
+        bool applymask                      = false,
+        std::vector<std::vector<bool>> mask = {},
+        key_type lower                      = key_type(),
+        key_type upper                      = key_type(),
+        bool setlimits                      = false)
+    {
+        gil_function_requires<ImageViewConcept<SrcView>>();
+        using channel_t = typename channel_type<SrcView>::type;
+
+        if (bin_width == 1 && !applymask && !setlimits)
+        {
+            std::size_t const pixels = static_cast<std::size_t>(srcview.width()) *
+                static_cast<std::size_t>(srcview.height());
+            if (pixels < 4 * bins_.size() || bins_.size() > interleaved_bin_limit)
+            {
+                for (std::ptrdiff_t src_y = 0; src_y < srcview.height(); ++src_y)
+                {
+                    auto const src_end = srcview.row_end(src_y);
+                    for (auto src_it = srcview.row_begin(src_y); src_it != src_end; ++src_it)
+                        ++operator[](key_from_pixel<Dimensions...>(*src_it));
+                }
+                return;
+            }
+
+            // Counts into four interleaved integer tables, so that runs of equal values do not
+            // wait on the increment of the same bin
+            std::size_t const n = bins_.size();
+            std::vector<std::size_t> counts(4 * n, 0);
+            std::ptrdiff_t const width = srcview.width();
+            for (std::ptrdiff_t src_y = 0; src_y < srcview.height(); ++src_y)
+            {
+                auto src_it = srcview.row_begin(src_y);
+                std::ptrdiff_t x = 0;
+                for (; x + 4 <= width; x += 4)
+                {
+                    ++counts[pixel_index<Dimensions...>(src_it[x])];
+                    ++counts[n + pixel_index<Dimensions...>(src_it[x + 1])];
+                    ++counts[2 * n + pixel_index<Dimensions...>(src_it[x + 2])];
+                    ++counts[3 * n + pixel_index<Dimensions...>(src_it[x + 3])];
+                }
+                for (; x < width; ++x)
+                    ++counts[pixel_index<Dimensions...>(src_it[x])];
+            }
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                std::size_t const count = counts[i] + counts[n + i] + counts[2 * n + i] +
+                    counts[3 * n + i];
+                if (count > 0)
+                    detail::add_histogram_count(bins_[i], count);
+            }
+            return;
+        }
+
+        for (std::ptrdiff_t src_y = 0; src_y < srcview.height(); ++src_y)
+        {
+            auto src_it = srcview.row_begin(src_y);
+            for (std::ptrdiff_t src_x = 0; src_x < srcview.width(); ++src_x)
+            {
+                if (applymask && !mask[src_y][src_x])
+                    continue;
+                auto scaled_px = src_it[src_x];
+                static_for_each(scaled_px, [&](channel_t& ch) {
+                    ch = static_cast<channel_t>(ch / bin_width);
+                });
+                auto key = key_from_pixel<Dimensions...>(scaled_px);
+                if (!setlimits ||
+                    (detail::tuple_compare(lower, key) && detail::tuple_compare(key, upper)))
+                    ++operator[](key);
+            }
+        }
+    }
+
+    /// \brief Returns a sub-histogram over specified axes
+    template <std::size_t... Dimensions>
+    dense_histogram<boost::mp11::mp_at<bin_t, boost::mp11::mp_size_t<Dimensions>>...>
+    sub_histogram() const
+    {
+        static_assert(
+            sizeof...(Dimensions) < dimension() &&
+            boost::mp11::mp_max_element
+            <
+                boost::mp11::mp_list_c<std::size_t, Dimensions...>, boost::mp11::mp_less
+            >::value < dimension(),
+            "Index out of Range");
+
+        dense_histogram<boost::mp11::mp_at<bin_t, boost::mp11::mp_size_t<Dimensions>>...> sub_h;
+        std::for_each(begin(), end(), [&](value_type const& v) {
+            sub_h[detail::tuple_to_tuple(v.first, boost::mp11::index_sequence<Dimensions...>{})] +=
+                v.second;
+        });
+        return sub_h;
+    }
+
+    /// \brief Normalize this histogram class
+    void normalize()
+    {
+        double const total = sum();
+        for (auto& bin : bins_)
+            bin /= total;
+    }
+
+    /// \brief Return the sum count of all bins
+    double sum() const
+    {
+        return std::accumulate(bins_.begin(), bins_.end(), 0.0);
+    }
+
+    /// \brief Return the minimum key in histogram
+    key_type min_key() const
+    {
+        return key_at(0);
+    }
+
+    /// \brief Return the maximum key in histogram
+    key_type max_key() const
+    {
+        return key_at(bins_.size() - 1);
+    }
+
+    /// \brief Return sorted keys in a vector
+    std::vector<key_type> sorted_keys() const
+    {
+        std::vector<key_type> keys;
+        keys.reserve(bins_.size());
+        for (std::size_t i = 0; i < bins_.size(); ++i)
+            keys.push_back(key_at(i));
+        return keys;
+    }
+
+private:
+    // Largest number of bins filled through interleaved tables, 2 MiB of counts
+    static constexpr std::size_t interleaved_bin_limit = std::size_t(1) << 16;
+
+    template <std::size_t... Dimensions, typename Pixel>
+    std::size_t pixel_index(Pixel const& p) const
+    {
+        return index_of_key(
+            key_from_pixel<Dimensions...>(p), boost::mp11::index_sequence_for<T...>{});
+    }
+
+    static std::size_t index_of(T... indices)
+    {
+        std::size_t const offsets[] = {static_cast<std::size_t>(
+            static_cast<long>(indices) - static_cast<long>((std::numeric_limits<T>::min)()))...};
+        std::size_t const extents[] = {detail::dense_histogram_extent<T>::value...};
+        std::size_t index = 0;
+        for (std::size_t i = 0; i < sizeof...(T); ++i)
+            index = index * extents[i] + offsets[i];
+        return index;
+    }
+
+    template <std::size_t... I>
+    static std::size_t index_of_key(key_type const& key, boost::mp11::index_sequence<I...>)
+    {
+        return index_of(std::get<I>(key)...);
+    }
+
+    static key_type key_at(std::size_t index)
+    {
+        return key_at(index, boost::mp11::index_sequence_for<T...>{});
+    }
+
+    template <std::size_t... I>
+    static key_type key_at(std::size_t index, boost::mp11::index_sequence<I...>)
+    {
+        std::size_t const extents[] = {detail::dense_histogram_extent<T>::value...};
+        std::size_t offsets[sizeof...(T)];
+        for (std::size_t i = sizeof...(T); i-- > 0;)
+        {
+            offsets[i] = index % extents[i];
+            index /= extents[i];
+        }
+        return std::make_tuple(static_cast<T>(
+            static_cast<long>((std::numeric_limits<T>::min)()) + static_cast<long>(offsets[I]))...);
+    }
+
+    template <typename Tuple, std::size_t... I>
+    static key_type make_histogram_key(Tuple const& t, boost::mp11::index_sequence<I...>)
+    {
+        return std::make_tuple(
+            static_cast<boost::mp11::mp_at<bin_t, boost::mp11::mp_size_t<I>>>(std::get<I>(t))...);
+    }
+
+    template <typename Tuple, std::size_t... I>
+    static constexpr bool is_tuple_type_compatible(boost::mp11::index_sequence<I...>)
+    {
+        using tp = boost::mp11::mp_list
+        <
+            typename std::is_convertible
+            <
+                boost::mp11::mp_at<bin_t, boost::mp11::mp_size_t<I>>,
+                typename std::tuple_element<I, Tuple>::type
+            >::type...
+        >;
+        return boost::mp11::mp_all_of<tp, boost::mp11::mp_to_bool>::value;
+    }
+
+    std::vector<mapped_type> bins_;
+};
+
+namespace detail {
+
+/// \ingroup Histogram-Helpers
+/// \brief Selects dense_histogram for the bin types it supports and histogram otherwise,
+///        to be used with unit bin width only
+///
+template <typename... T>
+using fast_histogram = typename std::conditional
+<
+    boost::mp11::mp_all_of<boost::mp11::mp_list<T...>, is_dense_histogram_bin>::value,
+    dense_histogram<T...>,
+    histogram<T...>
+>::type;
+
+}  //namespace detail
+
 ///
 /// \fn void fill_histogram
 /// \ingroup Histogram Algorithms
@@ -653,6 +1189,192 @@ void fill_histogram(
     hist.template fill<Dimensions...>(srcview, bin_width, applymask, mask, lower, upper, setlimits);
 }
 
+///
+/// \fn void fill_histogram
+/// \ingroup Histogram Algorithms
+/// \brief Overload version of fill_histogram for dense_histogram
+///
+/// Takes the same arguments as the overload for histogram. Every key of a dense histogram
+/// has a bin, so sparsefill has no effect.
+///
+template <std::size_t... Dimensions, typename SrcView, typename... T>
+void fill_histogram(
+    SrcView const& srcview,
+    dense_histogram<T...>& hist,
+    std::size_t bin_width               = 1,
+    bool accumulate                     = false,
+    bool /*sparsefill*/                 = true,
+    bool applymask                      = false,
+    std::vector<std::vector<bool>> mask = {},
+    typename dense_histogram<T...>::key_type lower =
+        (detail::tuple_limit<typename dense_histogram<T...>::key_type>::min)(),
+    typename dense_histogram<T...>::key_type upper =
+        (detail::tuple_limit<typename dense_histogram<T...>::key_type>::max)(),
+    bool setlimits = false)
+{
+    if (!accumulate)
+        hist.clear();
+
+    hist.template fill<Dimensions...>(srcview, bin_width, applymask, mask, lower, upper, setlimits);
+}
+
+namespace detail {
+
+/// \ingroup Histogram-Helpers
+/// \brief Fills one partial histogram per thread, each over a band of rows of the view.
+///        fill(partial, band_view, first_row) is invoked for every band.
+///
+template <typename ExecutionPolicy, typename Partial, typename SrcView, typename Fill>
+auto fill_partial_histograms(
+    ExecutionPolicy const& policy, SrcView const& srcview, Partial const& empty, Fill const& fill)
+    -> std::vector<Partial>
+{
+    std::size_t const rows  = static_cast<std::size_t>(srcview.height());
+    std::size_t const parts = (std::max)(std::size_t(1), (std::min)(policy.concurrency(), rows));
+    std::vector<Partial> partials(parts, empty);
+    policy.bulk_execute(parts, [&](std::size_t part) {
+        auto const first_row = static_cast<std::ptrdiff_t>(part * rows / parts);
+        auto const last_row  = static_cast<std::ptrdiff_t>((part + 1) * rows / parts);
+        fill(
+            partials[part],
+            subimage_view(srcview, 0, first_row, srcview.width(), last_row - first_row),
+            first_row);
+    });
+    return partials;
+}
+
+/// \ingroup Histogram-Helpers
+/// \brief Returns the rows of the mask covering a band of the view
+///
+inline auto band_mask(
+    std::vector<std::vector<bool>> const& mask,
+    bool applymask,
+    std::ptrdiff_t first_row,
+    std::ptrdiff_t rows) -> std::vector<std::vector<bool>>
+{
+    if (!applymask)
+        return {};
+    return std::vector<std::vector<bool>>(
+        mask.begin() + first_row, mask.begin() + first_row + rows);
+}
+
+}  //namespace detail
+
+///
+/// \fn void fill_histogram
+/// \ingroup Histogram Algorithms
+/// \brief Overload version of fill_histogram taking an execution policy
+///
+/// Fills one partial histogram per thread from a band of rows, then adds the partial counts
+/// to the histogram. The result is identical to that of the serial fill_histogram.
+///
+template <std::size_t... Dimensions, typename ExecutionPolicy, typename SrcView, typename... T>
+auto fill_histogram(
+    ExecutionPolicy const& policy,
+    SrcView const& srcview,
+    histogram<T...>& hist,
+    std::size_t bin_width               = 1,
+    bool accumulate                     = false,
+    bool sparsefill                     = true,
+    bool applymask                      = false,
+    std::vector<std::vector<bool>> mask = {},
+    typename histogram<T...>::key_type lower =
+        (detail::tuple_limit<typename histogram<T...>::key_type>::min)(),
+    typename histogram<T...>::key_type upper =
+        (detail::tuple_limit<typename histogram<T...>::key_type>::max)(),
+    bool setlimits = false)
+    -> typename std::enable_if<is_execution_policy<ExecutionPolicy>::value>::type
+{
+    if (policy.concurrency() <= 1)
+    {
+        fill_histogram<Dimensions...>(
+            srcview, hist, bin_width, accumulate, sparsefill, applymask, std::move(mask),
+            lower, upper, setlimits);
+        return;
+    }
+
+    if (!accumulate)
+        hist.clear();
+
+    detail::filler<histogram<T...>::dimension()> f;
+    if (!sparsefill)
+        f(hist, lower, upper, bin_width);
+
+    auto const partials = detail::fill_partial_histograms(
+        policy, srcview, histogram<T...>(),
+        [&](histogram<T...>& partial, auto const& band, std::ptrdiff_t first_row) {
+            partial.template fill<Dimensions...>(
+                band, bin_width, applymask,
+                detail::band_mask(mask, applymask, first_row, band.height()),
+                lower, upper, setlimits);
+        });
+
+    histogram<T...> totals;
+    for (auto const& partial : partials)
+    {
+        for (auto const& v : partial)
+            totals[v.first] += v.second;
+    }
+    for (auto const& v : totals)
+        detail::add_histogram_count(hist[v.first], static_cast<std::size_t>(v.second));
+}
+
+///
+/// \fn void fill_histogram
+/// \ingroup Histogram Algorithms
+/// \brief Overload version of fill_histogram for dense_histogram taking an execution policy
+///
+/// Each thread fills a dense histogram of its own, so this needs as many times the memory
+/// of the histogram as there are threads.
+///
+template <std::size_t... Dimensions, typename ExecutionPolicy, typename SrcView, typename... T>
+auto fill_histogram(
+    ExecutionPolicy const& policy,
+    SrcView const& srcview,
+    dense_histogram<T...>& hist,
+    std::size_t bin_width               = 1,
+    bool accumulate                     = false,
+    bool sparsefill                     = true,
+    bool applymask                      = false,
+    std::vector<std::vector<bool>> mask = {},
+    typename dense_histogram<T...>::key_type lower =
+        (detail::tuple_limit<typename dense_histogram<T...>::key_type>::min)(),
+    typename dense_histogram<T...>::key_type upper =
+        (detail::tuple_limit<typename dense_histogram<T...>::key_type>::max)(),
+    bool setlimits = false)
+    -> typename std::enable_if<is_execution_policy<ExecutionPolicy>::value>::type
+{
+    if (policy.concurrency() <= 1)
+    {
+        fill_histogram<Dimensions...>(
+            srcview, hist, bin_width, accumulate, sparsefill, applymask, std::move(mask),
+            lower, upper, setlimits);
+        return;
+    }
+
+    if (!accumulate)
+        hist.clear();
+
+    auto const partials = detail::fill_partial_histograms(
+        policy, srcview, dense_histogram<T...>(),
+        [&](dense_histogram<T...>& partial, auto const& band, std::ptrdiff_t first_row) {
+            partial.template fill<Dimensions...>(
+                band, bin_width, applymask,
+                detail::band_mask(mask, applymask, first_row, band.height()),
+                lower, upper, setlimits);
+        });
+
+    double* bins = hist.data();
+    for (std::size_t i = 0; i < hist.size(); ++i)
+    {
+        double total = 0.0;
+        for (auto const& partial : partials)
+            total += partial.data()[i];
+        if (total > 0.0)
+            detail::add_histogram_count(bins[i], static_cast<std::size_t>(total));
+    }
+}
+
 ///
 /// \fn void cumulative_histogram(Container&)
 /// \ingroup Histogram Algorithms
@@ -714,6 +1436,32 @@ auto cumulative_histogram(histogram<T...> const& hist) -> histogram<T...>
     return cumulative_hist;
 }
 
+/// \brief Overload of cumulative_histogram for dense_histogram
+///
+/// Computes running sums along each axis in turn, which takes #bins * #dimensions steps.
+///
+template <typename... T>
+auto cumulative_histogram(dense_histogram<T...> const& hist) -> dense_histogram<T...>
+{
+    dense_histogram<T...> cumulative_hist = hist;
+    double* bins = cumulative_hist.data();
+    std::size_t const size = cumulative_hist.size();
+    std::size_t const extents[] = {detail::dense_histogram_extent<T>::value...};
+
+    std::size_t stride = 1;
+    for (std::size_t axis = sizeof...(T); axis-- > 0;)
+    {
+        std::size_t const extent = extents[axis];
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            if ((i / stride) % extent != 0)
+                bins[i] += bins[i - stride];
+        }
+        stride *= extent;
+    }
+    return cumulative_hist;
+}
+
 }}  //namespace boost::gil
 
 #endif
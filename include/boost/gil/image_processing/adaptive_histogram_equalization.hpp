@@ -10,13 +10,22 @@
 #define BOOST_GIL_IMAGE_PROCESSING_ADAPTIVE_HISTOGRAM_EQUALIZATION_HPP
 
 #include <boost/gil/algorithm.hpp>
+#include <boost/gil/execution.hpp>
 #include <boost/gil/histogram.hpp>
 #include <boost/gil/image.hpp>
 #include <boost/gil/image_processing/histogram_equalization.hpp>
 #include <boost/gil/image_view_factory.hpp>
 
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <map>
+#include <type_traits>
 #include <vector>
 
 namespace boost { namespace gil {
@@ -116,33 +125,393 @@ void clip_and_redistribute(SrcHist const& src_hist, DstHist& dst_hist, double cl
     }
 }
 
+/// \ingroup AHE-helpers
+/// \brief Lookup table of a tile holding the equalized value of every channel value
+///
+/// Used with dense tile histograms, which have a bin for every value of 8-bit channels.
+///
+template <typename T>
+class clahe_dense_lut
+{
+public:
+    clahe_dense_lut() = default;
+
+    // Maps each value as histogram_equalization does, from the cumulative counts in the
+    // order of the values
+    clahe_dense_lut(dense_histogram<T> const& hist, std::size_t /*bin_width*/)
+    {
+        double const min_key = static_cast<double>((std::numeric_limits<T>::min)());
+        double const max_key = static_cast<double>((std::numeric_limits<T>::max)());
+        double const sum     = hist.sum();
+        double cumulative    = 0;
+        for (std::size_t i = 0; i < table_.size(); ++i)
+        {
+            cumulative += hist.data()[i];
+            table_[i] = static_cast<T>((cumulative * (max_key - min_key)) / sum + min_key);
+        }
+    }
+
+    auto operator()(T value) const -> T
+    {
+        return table_[offset(value)];
+    }
+
+private:
+    static auto offset(T value) -> std::size_t
+    {
+        return static_cast<std::size_t>(
+            static_cast<long>(value) - static_cast<long>((std::numeric_limits<T>::min)()));
+    }
+
+    std::array<T, dense_histogram_extent<T>::value> table_{};
+};
+
+/// \ingroup AHE-helpers
+/// \brief Lookup table of a tile holding the equalized value of the bins present in its
+///        histogram only
+///
+/// Used with sparse tile histograms, so that the tables of all tiles of a 16-bit image take
+/// at most as many entries as the image has values. A bin absent from the histogram adds
+/// nothing to the cumulative counts, so it maps as the nearest smaller bin present, or to
+/// the lowest value if there is none.
+///
+template <typename T>
+class clahe_sparse_lut
+{
+public:
+    clahe_sparse_lut() = default;
+
+    clahe_sparse_lut(histogram<T> const& hist, std::size_t bin_width)
+        : bin_width_(bin_width)
+    {
+        std::map<T, T> const color_map = histogram_equalization(hist);
+        keys_.reserve(color_map.size());
+        values_.reserve(color_map.size());
+        for (auto const& v : color_map)
+        {
+            keys_.push_back(v.first);
+            values_.push_back(v.second);
+        }
+    }
+
+    auto operator()(T value) const -> T
+    {
+        // the bin of the value, computed as histogram::fill does
+        T const key = static_cast<T>(value / bin_width_);
+        auto const it = std::upper_bound(keys_.begin(), keys_.end(), key);
+        if (it == keys_.begin())
+            return (std::numeric_limits<T>::min)();
+        return values_[static_cast<std::size_t>(it - keys_.begin()) - 1];
+    }
+
+private:
+    std::size_t bin_width_ = 1;
+    std::vector<T> keys_;
+    std::vector<T> values_;
+};
+
+/// \ingroup AHE-helpers
+/// \brief Lookup tables of the tiles of non_overlapping_interpolated_clahe
+///
+/// Fills the histogram of every tile and channel, clips it with clip_and_redistribute and
+/// keeps the table equalizing it. Tiles are laid out in rows, each tile
+/// holding the tables of its channels one after the other.
+///
+template <typename Histogram>
+class clahe_tile_luts
+{
+public:
+    using value_type = typename std::tuple_element<0, typename Histogram::key_type>::type;
+    using lut_type   = typename std::conditional
+    <
+        std::is_same<Histogram, dense_histogram<value_type>>::value,
+        clahe_dense_lut<value_type>,
+        clahe_sparse_lut<value_type>
+    >::type;
+
+    template <typename ExecutionPolicy, typename SrcView>
+    clahe_tile_luts(
+        ExecutionPolicy const& policy,
+        SrcView const& src_view,
+        std::ptrdiff_t tile_width_x,
+        std::ptrdiff_t tile_width_y,
+        double clip_limit,
+        std::size_t bin_width)
+        : channels_(num_channels<SrcView>::value)
+        , tiles_x_((src_view.width() + tile_width_x - 1) / tile_width_x)
+        , tiles_y_((src_view.height() + tile_width_y - 1) / tile_width_y)
+        , luts_(static_cast<std::size_t>(tiles_x_ * tiles_y_) * channels_)
+    {
+        // Tiles are independent, so each band of tiles fills histograms of its own
+        detail::for_each_row_band(policy, tiles_x_ * tiles_y_,
+            [&](std::ptrdiff_t first, std::ptrdiff_t last)
+        {
+            Histogram hist;
+            for (std::ptrdiff_t tile = first; tile < last; ++tile)
+            {
+                std::ptrdiff_t const x0 = tile % tiles_x_ * tile_width_x;
+                std::ptrdiff_t const y0 = tile / tiles_x_ * tile_width_y;
+                std::ptrdiff_t const x1 = (std::min)(x0 + tile_width_x, src_view.width());
+                std::ptrdiff_t const y1 = (std::min)(y0 + tile_width_y, src_view.height());
+                for (std::size_t c = 0; c < channels_; ++c)
+                {
+                    fill_histogram(
+                        subimage_view(nth_channel_view(src_view, static_cast<int>(c)),
+                            x0, y0, x1 - x0, y1 - y0),
+                        hist, bin_width);
+                    detail::clip_and_redistribute(hist, hist, clip_limit);
+                    luts_[static_cast<std::size_t>(tile) * channels_ + c] =
+                        lut_type(hist, bin_width);
+                }
+            }
+        });
+    }
+
+    auto tiles_x() const -> std::ptrdiff_t { return tiles_x_; }
+    auto tiles_y() const -> std::ptrdiff_t { return tiles_y_; }
+
+    /// \brief Returns the equalized value of a channel value in the tile at index \p tile
+    ///        of the tile rows
+    auto operator()(std::ptrdiff_t tile, std::size_t channel, value_type value) const
+        -> value_type
+    {
+        return luts_[static_cast<std::size_t>(tile) * channels_ + channel](value);
+    }
+
+private:
+    std::size_t channels_;
+    std::ptrdiff_t tiles_x_;
+    std::ptrdiff_t tiles_y_;
+    std::vector<lut_type> luts_;
+};
+
+/// \ingroup AHE-helpers
+/// \brief Position of a pixel between the centres of the tiles around it along one axis
+///
+/// Pixels before the first centre or after the last one take both neighbours from the
+/// nearest tile, so that they get its table alone.
+///
+struct clahe_tile_span
+{
+    clahe_tile_span() = default;
+
+    clahe_tile_span(std::ptrdiff_t position, std::ptrdiff_t tile_width, std::ptrdiff_t tiles)
+    {
+        std::ptrdiff_t const offset = position - tile_width / 2;
+        std::ptrdiff_t const left   = offset < 0 ? -1 : offset / tile_width;
+        first  = (std::max)(left, std::ptrdiff_t(0));
+        second = (std::min)(left + 1, tiles - 1);
+        weight = offset - left * tile_width;
+    }
+
+    std::ptrdiff_t first = 0;
+    std::ptrdiff_t second = 0;
+    // weight of the second tile, out of the tile width
+    std::ptrdiff_t weight = 0;
+};
+
+/// \ingroup AHE-helpers
+/// \brief Implementation of non_overlapping_interpolated_clahe collecting the tile
+///        histograms in the given histogram type.
+///
+/// Builds the tables of all tiles, then blends the tables of the four tiles around each
+/// pixel with integer weights, so that the result is the exact bilinear blend rounded down.
+/// Pixels for which the mask row is zero are copied from the source.
+///
+template
+<
+    typename Histogram,
+    typename ExecutionPolicy,
+    typename SrcView,
+    typename DstView,
+    typename MaskRows
+>
+void non_overlapping_interpolated_clahe_impl(
+    ExecutionPolicy const& policy,
+    SrcView const& src_view,
+    DstView const& dst_view,
+    MaskRows const& mask_rows,
+    std::ptrdiff_t tile_width_x,
+    std::ptrdiff_t tile_width_y,
+    double clip_limit,
+    std::size_t bin_width)
+{
+    using source_channel_t = typename channel_type<SrcView>::type;
+    using dst_channel_t    = typename channel_type<DstView>::type;
+    using value_t          = typename clahe_tile_luts<Histogram>::value_type;
+
+    BOOST_ASSERT(src_view.dimensions() == dst_view.dimensions());
+    BOOST_ASSERT(tile_width_x > 0 && tile_width_y > 0 && bin_width > 0);
+    std::ptrdiff_t const width  = src_view.width();
+    std::ptrdiff_t const height = src_view.height();
+    if (width == 0 || height == 0)
+        return;
+
+    clahe_tile_luts<Histogram> const luts(
+        policy, src_view, tile_width_x, tile_width_y, clip_limit, bin_width);
+    std::size_t const channels = num_channels<SrcView>::value;
+
+    // Tiles left and right of each column, and their weights
+    std::vector<clahe_tile_span> columns(static_cast<std::size_t>(width));
+    for (std::ptrdiff_t x = 0; x < width; ++x)
+        columns[static_cast<std::size_t>(x)] = clahe_tile_span(x, tile_width_x, luts.tiles_x());
+    std::int64_t const area = static_cast<std::int64_t>(tile_width_x * tile_width_y);
+    double const inverse_area = 1.0 / static_cast<double>(area);
+
+    detail::for_each_row_band(policy, height, [&](std::ptrdiff_t y0, std::ptrdiff_t y1)
+    {
+        std::vector<std::uint8_t> mask(static_cast<std::size_t>(width), 1);
+        for (std::ptrdiff_t y = y0; y < y1; ++y)
+        {
+            mask_rows(y, mask.data());
+            clahe_tile_span const row(y, tile_width_y, luts.tiles_y());
+            std::int64_t const wy_second = row.weight;
+            std::int64_t const wy_first  = tile_width_y - row.weight;
+            std::ptrdiff_t const top     = row.first * luts.tiles_x();
+            std::ptrdiff_t const bottom  = row.second * luts.tiles_x();
+            typename SrcView::x_iterator src_it = src_view.row_begin(y);
+            typename DstView::x_iterator dst_it = dst_view.row_begin(y);
+            for (std::size_t c = 0; c < channels; ++c)
+            {
+                for (std::ptrdiff_t x = 0; x < width; ++x)
+                {
+                    source_channel_t const value = dynamic_at_c(src_it[x], c);
+                    if (!mask[static_cast<std::size_t>(x)])
+                    {
+                        dynamic_at_c(dst_it[x], c) = channel_convert<dst_channel_t>(value);
+                        continue;
+                    }
+
+                    clahe_tile_span const& column = columns[static_cast<std::size_t>(x)];
+                    value_t const key = static_cast<value_t>(value);
+                    std::int64_t const sum =
+                        (tile_width_x - column.weight) *
+                            (wy_first * luts(top + column.first, c, key) +
+                             wy_second * luts(bottom + column.first, c, key)) +
+                        column.weight *
+                            (wy_first * luts(top + column.second, c, key) +
+                             wy_second * luts(bottom + column.second, c, key));
+
+                    // Integer division through the reciprocal, corrected by at most one
+                    std::int64_t quotient =
+                        static_cast<std::int64_t>(static_cast<double>(sum) * inverse_area);
+                    std::int64_t const remainder = sum - quotient * area;
+                    if (sum >= 0)
+                        quotient += remainder >= area ? 1 : (remainder < 0 ? -1 : 0);
+                    else
+                        quotient += remainder <= -area ? -1 : (remainder > 0 ? 1 : 0);
+                    dynamic_at_c(dst_it[x], c) = channel_convert<dst_channel_t>(
+                        source_channel_t(static_cast<value_t>(quotient)));
+                }
+            }
+        }
+    });
+}
+
+/// \ingroup AHE-helpers
+/// \brief Selects the tile histograms and runs non_overlapping_interpolated_clahe_impl
+///
+/// The tiles of 8-bit channels keep a dense_histogram where it applies. The tiles of 16-bit
+/// channels keep sparse histograms, whose tables hold the bins present only, since dense
+/// tables of 16-bit channels take 65536 entries per tile.
+///
+template <typename ExecutionPolicy, typename SrcView, typename DstView, typename MaskRows>
+void non_overlapping_interpolated_clahe_dispatch(
+    ExecutionPolicy const& policy,
+    SrcView const& src_view,
+    DstView const& dst_view,
+    MaskRows const& mask_rows,
+    std::ptrdiff_t tile_width_x,
+    std::ptrdiff_t tile_width_y,
+    double clip_limit,
+    std::size_t bin_width)
+{
+    using value_t = typename base_channel_type<typename channel_type<SrcView>::type>::type;
+    static_assert(is_dense_histogram_bin<value_t>::value,
+        "CLAHE requires integral channels of at most 16 bits");
+
+    using dense_t = typename std::conditional
+    <
+        dense_histogram_extent<value_t>::value <= 256,
+        dense_histogram<value_t>,
+        histogram<value_t>
+    >::type;
+    if (bin_width == 1)
+    {
+        non_overlapping_interpolated_clahe_impl<dense_t>(policy, src_view, dst_view, mask_rows,
+            tile_width_x, tile_width_y, clip_limit, bin_width);
+    }
+    else
+    {
+        non_overlapping_interpolated_clahe_impl<histogram<value_t>>(policy, src_view, dst_view,
+            mask_rows, tile_width_x, tile_width_y, clip_limit, bin_width);
+    }
+}
+
+/// \ingroup AHE-helpers
+/// \brief Provides rows of all ones, when no mask is given
+///
+struct clahe_no_mask
+{
+    void operator()(std::ptrdiff_t, std::uint8_t*) const {}
+};
+
+/// \ingroup AHE-helpers
+/// \brief Provides the rows of a single channel mask view as ones where the mask is nonzero
+///
+template <typename MaskView>
+class clahe_mask_rows
+{
+public:
+    explicit clahe_mask_rows(MaskView const& mask) : mask_(mask) {}
+
+    void operator()(std::ptrdiff_t y, std::uint8_t* row) const
+    {
+        typename MaskView::x_iterator it = mask_.row_begin(y);
+        for (std::ptrdiff_t x = 0; x < mask_.width(); ++x)
+            row[x] = static_cast<int>(at_c<0>(it[x])) != 0;
+    }
+
+private:
+    MaskView mask_;
+};
+
 } // namespace detail
 
 /// \fn void non_overlapping_interpolated_clahe
 /// \ingroup AHE
+/// @param policy        Input   Execution policy
 /// @param src_view      Input   Source image view
 /// @param dst_view      Output  Output image view
 /// @param tile_width_x  Input   Tile width along x-axis to apply HE
-/// @param tile_width_y  Input   Tile width along x-axis to apply HE
+/// @param tile_width_y  Input   Tile width along y-axis to apply HE
 /// @param clip_limit    Input   Clipping limit to be applied
 /// @param bin_width     Input   Bin widths for histogram
-/// @param mask          Input   Specify if mask is to be used
-/// @param src_mask      Input   Mask on input image to ignore specified pixels
 /// \brief Performs local histogram equalization on tiles of size (tile_width_x, tile_width_y)
 ///        Then uses the clip limit to redistribute excess pixels above the limit uniformly to
 ///        other bins. The clip limit is specified as a fraction i.e. a bin's value is clipped
 ///        if bin_value >= clip_limit * (Total number of pixels in the tile)
 ///
-template <typename SrcView, typename DstView>
+///        The histograms of the tiles and the lookup tables built from them are computed
+///        once, then each pixel blends the tables of the four tiles around it. Tiles and
+///        bands of rows are processed according to the execution policy. Channels must be
+///        integral of at most 16 bits.
+///
+template
+<
+    typename ExecutionPolicy,
+    typename SrcView,
+    typename DstView,
+    typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+>
 void non_overlapping_interpolated_clahe(
+    ExecutionPolicy const& policy,
     SrcView const& src_view,
     DstView const& dst_view,
-    std::ptrdiff_t tile_width_x             = 20,
-    std::ptrdiff_t tile_width_y             = 20,
-    double clip_limit                       = 0.03,
-    std::size_t bin_width                   = 1.0,
-    bool mask                               = false,
-    std::vector<std::vector<bool>> src_mask = {})
+    std::ptrdiff_t tile_width_x = 20,
+    std::ptrdiff_t tile_width_y = 20,
+    double clip_limit           = 0.03,
+    std::size_t bin_width       = 1)
 {
     gil_function_requires<ImageViewConcept<SrcView>>();
     gil_function_requires<MutableImageViewConcept<DstView>>();
@@ -153,148 +522,95 @@ void non_overlapping_interpolated_clahe(
             typename color_space_type<DstView>::type>::value,
         "Source and destination views must have same color space");
 
-    using source_channel_t = typename channel_type<SrcView>::type;
-    using dst_channel_t    = typename channel_type<DstView>::type;
-    using coord_t          = typename SrcView::x_coord_t;
-
-    std::size_t const channels = num_channels<SrcView>::value;
-    coord_t const width        = src_view.width();
-    coord_t const height       = src_view.height();
-
-    // Find control points
-
-    std::vector<coord_t> sample_x;
-    coord_t sample_x1 = tile_width_x / 2;
-    coord_t sample_y1 = tile_width_y / 2;
-
-    auto extend_left   = tile_width_x;
-    auto extend_top    = tile_width_y;
-    auto extend_right  = (tile_width_x - width % tile_width_x) % tile_width_x + tile_width_x;
-    auto extend_bottom = (tile_width_y - height % tile_width_y) % tile_width_y + tile_width_y;
-
-    auto new_width  = width + extend_left + extend_right;
-    auto new_height = height + extend_top + extend_bottom;
-
-    image<typename SrcView::value_type> padded_img(new_width, new_height);
-
-    auto top_left_x     = tile_width_x;
-    auto top_left_y     = tile_width_y;
-    auto bottom_right_x = tile_width_x + width;
-    auto bottom_right_y = tile_width_y + height;
-
-    copy_pixels(src_view, subimage_view(view(padded_img), top_left_x, top_left_y, width, height));
-
-    for (std::size_t k = 0; k < channels; k++)
-    {
-        std::vector<histogram<source_channel_t>> prev_row(new_width / tile_width_x),
-            next_row((new_width / tile_width_x));
-        std::vector<std::map<source_channel_t, source_channel_t>> prev_map(
-            new_width / tile_width_x),
-            next_map((new_width / tile_width_x));
+    detail::non_overlapping_interpolated_clahe_dispatch(policy, src_view, dst_view,
+        detail::clahe_no_mask(), tile_width_x, tile_width_y, clip_limit, bin_width);
+}
 
-        coord_t prev = 0, next = 1;
-        auto channel_view = nth_channel_view(view(padded_img), k);
+/// \overload non_overlapping_interpolated_clahe
+/// \ingroup AHE
+/// @param mask_view     Input   Single channel mask over the source, typically a packed
+///                              1-bit view; pixels where it is zero are copied unchanged
+/// \brief Equalizes the pixels selected by a mask, the histograms still covering all pixels
+///
+template
+<
+    typename ExecutionPolicy,
+    typename SrcView,
+    typename DstView,
+    typename MaskView,
+    typename std::enable_if
+    <
+        is_execution_policy<ExecutionPolicy>::value && !std::is_arithmetic<MaskView>::value,
+        int
+    >::type = 0
+>
+void non_overlapping_interpolated_clahe(
+    ExecutionPolicy const& policy,
+    SrcView const& src_view,
+    DstView const& dst_view,
+    MaskView const& mask_view,
+    std::ptrdiff_t tile_width_x = 20,
+    std::ptrdiff_t tile_width_y = 20,
+    double clip_limit           = 0.03,
+    std::size_t bin_width       = 1)
+{
+    gil_function_requires<ImageViewConcept<SrcView>>();
+    gil_function_requires<MutableImageViewConcept<DstView>>();
+    gil_function_requires<ImageViewConcept<MaskView>>();
 
-        for (std::ptrdiff_t i = top_left_y; i < bottom_right_y; ++i)
-        {
-            if ((i - sample_y1) / tile_width_y >= next || i == top_left_y)
-            {
-                if (i != top_left_y)
-                {
-                    prev = next;
-                    next++;
-                }
-                prev_row = next_row;
-                prev_map = next_map;
-                for (std::ptrdiff_t j = sample_x1; j < new_width; j += tile_width_x)
-                {
-                    auto img_view = subimage_view(
-                        channel_view, j - sample_x1, next * tile_width_y,
-                        std::max<int>(
-                            std::min<int>(tile_width_x + j - sample_x1, bottom_right_x) -
-                                (j - sample_x1),
-                            0),
-                        std::max<int>(
-                            std::min<int>((next + 1) * tile_width_y, bottom_right_y) -
-                                next * tile_width_y,
-                            0));
+    static_assert(
+        color_spaces_are_compatible<
+            typename color_space_type<SrcView>::type,
+            typename color_space_type<DstView>::type>::value,
+        "Source and destination views must have same color space");
+    static_assert(num_channels<MaskView>::value == 1, "Mask view must have a single channel");
+    BOOST_ASSERT(mask_view.dimensions() == src_view.dimensions());
 
-                    fill_histogram(
-                        img_view, next_row[(j - sample_x1) / tile_width_x], bin_width, false,
-                        false);
+    detail::non_overlapping_interpolated_clahe_dispatch(policy, src_view, dst_view,
+        detail::clahe_mask_rows<MaskView>(mask_view), tile_width_x, tile_width_y, clip_limit,
+        bin_width);
+}
 
-                    detail::clip_and_redistribute(
-                        next_row[(j - sample_x1) / tile_width_x],
-                        next_row[(j - sample_x1) / tile_width_x], clip_limit);
+/// \overload non_overlapping_interpolated_clahe
+/// \ingroup AHE
+///
+template <typename SrcView, typename DstView>
+void non_overlapping_interpolated_clahe(
+    SrcView const& src_view,
+    DstView const& dst_view,
+    std::ptrdiff_t tile_width_x = 20,
+    std::ptrdiff_t tile_width_y = 20,
+    double clip_limit           = 0.03,
+    std::size_t bin_width       = 1)
+{
+    non_overlapping_interpolated_clahe(execution::seq, src_view, dst_view, tile_width_x,
+        tile_width_y, clip_limit, bin_width);
+}
 
-                    next_map[(j - sample_x1) / tile_width_x] =
-                        histogram_equalization(next_row[(j - sample_x1) / tile_width_x]);
-                }
-            }
-            bool prev_row_mask = 1, next_row_mask = 1;
-            if (prev == 0)
-                prev_row_mask = false;
-            else if (next + 1 == new_height / tile_width_y)
-                next_row_mask = false;
-            for (std::ptrdiff_t j = top_left_x; j < bottom_right_x; ++j)
-            {
-                bool prev_col_mask = true, next_col_mask = true;
-                if ((j - sample_x1) / tile_width_x == 0)
-                    prev_col_mask = false;
-                else if ((j - sample_x1) / tile_width_x + 1 == new_width / tile_width_x - 1)
-                    next_col_mask = false;
-
-                // Bilinear interpolation
-                point_t top_left(
-                    (j - sample_x1) / tile_width_x * tile_width_x + sample_x1,
-                                    prev * tile_width_y + sample_y1);
-                point_t top_right(top_left.x + tile_width_x, top_left.y);
-                point_t bottom_left(top_left.x, top_left.y + tile_width_y);
-                point_t bottom_right(top_left.x + tile_width_x, top_left.y + tile_width_y);
-
-                long double x_diff = top_right.x - top_left.x;
-                long double y_diff = bottom_left.y - top_left.y;
-
-                long double x1 = (j - top_left.x) / x_diff;
-                long double x2 = (top_right.x - j) / x_diff;
-                long double y1 = (i - top_left.y) / y_diff;
-                long double y2 = (bottom_left.y - i) / y_diff;
-
-                if (prev_row_mask == 0)
-                    y1 = 1;
-                else if (next_row_mask == 0)
-                    y2 = 1;
-                if (prev_col_mask == 0)
-                    x1 = 1;
-                else if (next_col_mask == 0)
-                    x2 = 1;
-
-                long double numerator =
-                    ((prev_row_mask & prev_col_mask) * x2 *
-                         prev_map[(top_left.x - sample_x1) / tile_width_x][channel_view(j, i)] +
-                     (prev_row_mask & next_col_mask) * x1 *
-                         prev_map[(top_right.x - sample_x1) / tile_width_x][channel_view(j, i)]) *
-                        y2 +
-                    ((next_row_mask & prev_col_mask) * x2 *
-                         next_map[(bottom_left.x - sample_x1) / tile_width_x][channel_view(j, i)] +
-                     (next_row_mask & next_col_mask) * x1 *
-                         next_map[(bottom_right.x - sample_x1) / tile_width_x][channel_view(j, i)]) *
-                        y1;
-
-                if (mask && !src_mask[i - top_left_y][j - top_left_x])
-                {
-                    dst_view(j - top_left_x, i - top_left_y) =
-                        channel_convert<dst_channel_t>(
-                            static_cast<source_channel_t>(channel_view(i, j)));
-                }
-                else
-                {
-                    dst_view(j - top_left_x, i - top_left_y) =
-                        channel_convert<dst_channel_t>(static_cast<source_channel_t>(numerator));
-                }
-            }
-        }
-    }
+/// \overload non_overlapping_interpolated_clahe
+/// \ingroup AHE
+///
+template
+<
+    typename SrcView,
+    typename DstView,
+    typename MaskView,
+    typename std::enable_if
+    <
+        !is_execution_policy<SrcView>::value && !std::is_arithmetic<MaskView>::value, int
+    >::type = 0
+>
+void non_overlapping_interpolated_clahe(
+    SrcView const& src_view,
+    DstView const& dst_view,
+    MaskView const& mask_view,
+    std::ptrdiff_t tile_width_x = 20,
+    std::ptrdiff_t tile_width_y = 20,
+    double clip_limit           = 0.03,
+    std::size_t bin_width       = 1)
+{
+    non_overlapping_interpolated_clahe(execution::seq, src_view, dst_view, mask_view,
+        tile_width_x, tile_width_y, clip_limit, bin_width);
 }
 
 }}  //namespace boost::gil
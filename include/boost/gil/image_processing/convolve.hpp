@@ -13,15 +13,22 @@
 #include <boost/gil/image_processing/kernel.hpp>
 
 #include <boost/gil/algorithm.hpp>
+#include <boost/gil/execution.hpp>
 #include <boost/gil/image_view_factory.hpp>
 #include <boost/gil/metafunctions.hpp>
 #include <boost/gil/pixel_numeric_operations.hpp>
+#include <boost/gil/detail/correlate_row.hpp>
+#include <boost/gil/detail/fft.hpp>
+#include <boost/gil/detail/is_channel_integral.hpp>
 
 #include <boost/assert.hpp>
 
 #include <algorithm>
+#include <cmath>
+#include <complex>
 #include <cstddef>
 #include <functional>
+#include <iterator>
 #include <type_traits>
 #include <vector>
 
@@ -192,6 +199,779 @@ struct correlator_k
     }
 };
 
+/// \brief Correlates the rows of a strip buffer with the kernel, the taps of a pixel being
+/// \p tap_stride pixels apart, using vector instructions.
+template <typename PixelAccum, typename KernelIterator, typename DstIterator>
+void correlate_strip_row(
+    PixelAccum const* src,
+    std::ptrdiff_t tap_stride,
+    KernelIterator kernel_begin,
+    std::size_t kernel_size,
+    DstIterator dst_begin,
+    std::ptrdiff_t count,
+    std::true_type) // vectorized
+{
+    correlate_taps<PixelAccum>(src, tap_stride, kernel_begin, kernel_size, dst_begin, count);
+}
+
+/// \brief Correlates the rows of a strip buffer with the kernel, the taps of a pixel being
+/// \p tap_stride pixels apart, accumulating like correlate_pixels_n.
+template <typename PixelAccum, typename KernelIterator, typename DstIterator>
+void correlate_strip_row(
+    PixelAccum const* src,
+    std::ptrdiff_t tap_stride,
+    KernelIterator kernel_begin,
+    std::size_t kernel_size,
+    DstIterator dst_begin,
+    std::ptrdiff_t count,
+    std::false_type) // generic
+{
+    using dst_value_t = typename std::iterator_traits<DstIterator>::value_type;
+    using kernel_value_t = typename std::iterator_traits<KernelIterator>::value_type;
+
+    PixelAccum accum_zero;
+    pixel_zeros_t<PixelAccum>()(accum_zero);
+    for (std::ptrdiff_t x = 0; x < count; ++x, ++dst_begin)
+    {
+        PixelAccum accum = accum_zero;
+        PixelAccum const* tap = src + x;
+        KernelIterator kernel_it = kernel_begin;
+        for (std::size_t k = 0; k < kernel_size; ++k, tap += tap_stride, ++kernel_it)
+        {
+            accum = pixel_plus_t<PixelAccum, PixelAccum, PixelAccum>()(
+                accum,
+                pixel_multiplies_scalar_t<PixelAccum, kernel_value_t, PixelAccum>()(
+                    *tap, *kernel_it));
+        }
+        dst_value_t value;
+        pixel_assigns_t<PixelAccum, dst_value_t>()(accum, value);
+        *dst_begin = value;
+    }
+}
+
+/// \brief Computes the cross-correlation of 1D kernel with columns of an image.
+///
+/// Gives the same result as correlate_rows_impl on the transposed views, but reads and writes
+/// the image in row order. The image is processed in strips of columns, the rows of a strip
+/// are copied to a buffer in blocks, with boundary manipulations applied, and every output row
+/// of the strip is the weighted sum of consecutive rows of the buffer. The buffer keeps the
+/// last rows of a block for the next one, so \p src_view and \p dst_view may be the same.
+/// \tparam PixelAccum - Specifies the data type which will be used for creating the buffer
+/// holding source image pixels.
+/// \param src_view - Gil view of source image used in correlation.
+/// \param kernel - 1D kernel which will be correlated with source image.
+/// \param dst_view - Gil view which will store the result of column correlation.
+/// \param option - Specifies the manner in which boundary pixels of "dst_view" should be computed.
+template <typename PixelAccum, typename SrcView, typename Kernel, typename DstView>
+void correlate_cols_impl(
+    SrcView const& src_view,
+    Kernel const& kernel,
+    DstView const& dst_view,
+    boundary_option option)
+{
+    BOOST_ASSERT(src_view.dimensions() == dst_view.dimensions());
+    BOOST_ASSERT(kernel.size() != 0);
+
+    if (kernel.size() == 1)
+    {
+        // Reduces to a multiplication
+        view_multiplies_scalar<PixelAccum>(src_view, *kernel.begin(), dst_view);
+        return;
+    }
+
+    using src_pixel_ref_t = typename pixel_proxy<typename SrcView::value_type>::type;
+    using dst_pixel_ref_t = typename pixel_proxy<typename DstView::value_type>::type;
+    using kernel_iterator_t = decltype(kernel.begin());
+    using is_vectorized_t = is_correlate_row_vectorized
+        <
+            PixelAccum, PixelAccum const*, kernel_iterator_t
+        >;
+
+    std::ptrdiff_t const width = src_view.width();
+    std::ptrdiff_t const height = src_view.height();
+    if (width == 0 || height == 0)
+        return;
+
+    std::ptrdiff_t const size = static_cast<std::ptrdiff_t>(kernel.size());
+    std::ptrdiff_t const left = static_cast<std::ptrdiff_t>(kernel.left_size());
+    std::ptrdiff_t const right = static_cast<std::ptrdiff_t>(kernel.right_size());
+
+    PixelAccum acc_zero;
+    pixel_zeros_t<PixelAccum>()(acc_zero);
+    typename DstView::value_type dst_zero;
+    pixel_assigns_t<PixelAccum, dst_pixel_ref_t>()(acc_zero, dst_zero);
+
+    bool const is_output_option =
+        option == boundary_option::output_ignore || option == boundary_option::output_zero;
+    if (is_output_option && height < size)
+    {
+        if (option == boundary_option::output_zero)
+            fill_pixels(dst_view, dst_zero);
+        return;
+    }
+
+    // Rows of the destination which are computed
+    std::ptrdiff_t const first_row = is_output_option ? left : 0;
+    std::ptrdiff_t const last_row = is_output_option ? height - right : height;
+
+    // About 4 KiB per buffer row, so that the rows read for an output row stay in cache
+    constexpr std::ptrdiff_t strip_bytes = 4096;
+    constexpr std::ptrdiff_t block_rows = 128;
+    std::ptrdiff_t const pixel_bytes = static_cast<std::ptrdiff_t>(sizeof(PixelAccum));
+    std::ptrdiff_t const strip_width =
+        (std::min)(width, (std::max)(std::ptrdiff_t(8), strip_bytes / pixel_bytes));
+    std::vector<PixelAccum> buffer((block_rows + size - 1) * strip_width);
+
+    for (std::ptrdiff_t x0 = 0; x0 < width; x0 += strip_width)
+    {
+        std::ptrdiff_t const columns = (std::min)(strip_width, width - x0);
+
+        // Copies source row y of the strip, y may be outside the view for extend options
+        auto load_row = [&](std::ptrdiff_t y, PixelAccum* it_buffer)
+        {
+            if ((y >= 0 && y < height) || option == boundary_option::extend_padded)
+            {
+                auto const it_src =
+                    (src_view.xy_at(x0, 0) + typename SrcView::point_t(0, y)).x();
+                assign_pixels(it_src, it_src + columns, it_buffer);
+            }
+            else if (option == boundary_option::extend_zero)
+            {
+                std::fill_n(it_buffer, columns, acc_zero);
+            }
+            else // extend_constant
+            {
+                auto const it_src = src_view.row_begin(y < 0 ? 0 : height - 1) + x0;
+                for (std::ptrdiff_t x = 0; x < columns; ++x)
+                    pixel_assigns_t<src_pixel_ref_t, PixelAccum>()(it_src[x], it_buffer[x]);
+            }
+        };
+
+        std::ptrdiff_t loaded_rows = 0;
+        for (std::ptrdiff_t y0 = first_row; y0 < last_row; y0 += block_rows)
+        {
+            std::ptrdiff_t const rows = (std::min)(block_rows, last_row - y0);
+            std::ptrdiff_t const needed_rows = rows + size - 1;
+            if (loaded_rows > 0)
+            {
+                // Rows shared with the previous block
+                std::copy(
+                    buffer.begin() + (loaded_rows - size + 1) * columns,
+                    buffer.begin() + loaded_rows * columns,
+                    buffer.begin());
+                loaded_rows = size - 1;
+            }
+            for (; loaded_rows < needed_rows; ++loaded_rows)
+                load_row(y0 - left + loaded_rows, &buffer[loaded_rows * columns]);
+
+            for (std::ptrdiff_t r = 0; r < rows; ++r)
+            {
+                correlate_strip_row<PixelAccum>(
+                    &buffer[r * columns], columns, kernel.begin(), kernel.size(),
+                    dst_view.row_begin(y0 + r) + x0, columns, is_vectorized_t());
+            }
+        }
+
+        if (option == boundary_option::output_zero)
+        {
+            for (std::ptrdiff_t y = 0; y < first_row; ++y)
+                std::fill_n(dst_view.row_begin(y) + x0, columns, dst_zero);
+            for (std::ptrdiff_t y = last_row; y < height; ++y)
+                std::fill_n(dst_view.row_begin(y) + x0, columns, dst_zero);
+        }
+    }
+}
+
+/// \brief Provides functionality for performing 2D correlation between the kernel and rows of
+/// buffers storing source image pixels, for the vectorized float accumulators.
+template <typename PixelAccum, typename Kernel, bool IsVectorized>
+class correlator_2d
+{
+public:
+    correlator_2d(Kernel const& kernel) : kernel_(kernel), rows_(kernel.size()) {}
+
+    /// \brief Correlates \p count pixels, output pixel x uses the kernel size pixels starting
+    /// at x of each row of \p rows
+    template <typename DstIterator>
+    void operator()(PixelAccum const* const* rows, DstIterator dst_begin, std::ptrdiff_t count)
+    {
+        for (std::size_t r = 0; r < rows_.size(); ++r)
+            rows_[r] = reinterpret_cast<float const*>(rows[r]);
+        correlate_taps_2d<PixelAccum>(
+            rows_.data(), kernel_.size(), kernel_.begin(), kernel_.size(), dst_begin, count);
+    }
+
+private:
+    Kernel const& kernel_;
+    std::vector<float const*> rows_;
+};
+
+/// \brief Provides functionality for performing 2D correlation between the kernel and rows of
+/// buffers storing source image pixels. Taps are accumulated in row-major kernel order.
+template <typename PixelAccum, typename Kernel>
+class correlator_2d<PixelAccum, Kernel, false>
+{
+public:
+    correlator_2d(Kernel const& kernel) : kernel_(kernel) {}
+
+    template <typename DstIterator>
+    void operator()(PixelAccum const* const* rows, DstIterator dst_begin, std::ptrdiff_t count)
+    {
+        using dst_value_t = typename std::iterator_traits<DstIterator>::value_type;
+        using kernel_value_t = typename Kernel::value_type;
+
+        std::size_t const size = kernel_.size();
+        PixelAccum accum_zero;
+        pixel_zeros_t<PixelAccum>()(accum_zero);
+        for (std::ptrdiff_t x = 0; x < count; ++x, ++dst_begin)
+        {
+            PixelAccum accum = accum_zero;
+            auto kernel_it = kernel_.begin();
+            for (std::size_t r = 0; r < size; ++r)
+            {
+                PixelAccum const* tap = rows[r] + x;
+                for (std::size_t c = 0; c < size; ++c, ++tap, ++kernel_it)
+                {
+                    accum = pixel_plus_t<PixelAccum, PixelAccum, PixelAccum>()(
+                        accum,
+                        pixel_multiplies_scalar_t<PixelAccum, kernel_value_t, PixelAccum>()(
+                            *tap, *kernel_it));
+                }
+            }
+            dst_value_t value;
+            pixel_assigns_t<PixelAccum, dst_value_t>()(accum, value);
+            *dst_begin = value;
+        }
+    }
+
+private:
+    Kernel const& kernel_;
+};
+
+/// \brief Copies rows of a view to buffers of PixelAccum, extended by the given number of pixels
+/// on the left and right for the extend options of boundary_option.
+///
+/// Rows outside the view may be requested with the extend options, and are filled as the option
+/// requires. With the output_ignore and output_zero options, rows are copied without extension.
+template <typename PixelAccum, typename SrcView>
+class correlate_2d_row_loader
+{
+public:
+    correlate_2d_row_loader(
+        SrcView const& src_view, std::ptrdiff_t left, std::ptrdiff_t right, boundary_option option)
+        : src_view_(src_view), left_(left), right_(right), option_(option)
+    {
+        pixel_zeros_t<PixelAccum>()(zero_);
+    }
+
+    /// \brief Returns the number of pixels of the buffer rows
+    auto width() const -> std::ptrdiff_t
+    {
+        bool const is_output_option = option_ == boundary_option::output_ignore ||
+            option_ == boundary_option::output_zero;
+        return is_output_option ? src_view_.width() : src_view_.width() + left_ + right_;
+    }
+
+    void operator()(std::ptrdiff_t y, PixelAccum* it_buffer) const
+    {
+        using src_pixel_ref_t = typename pixel_proxy<typename SrcView::value_type>::type;
+
+        std::ptrdiff_t const width = src_view_.width();
+        std::ptrdiff_t const height = src_view_.height();
+        if (y < 0 || y >= height)
+        {
+            if (option_ == boundary_option::extend_zero)
+            {
+                std::fill_n(it_buffer, this->width(), zero_);
+                return;
+            }
+            if (option_ == boundary_option::extend_constant)
+                y = y < 0 ? 0 : height - 1;
+        }
+        auto const it_src = (src_view_.xy_at(0, 0) + typename SrcView::point_t(0, y)).x();
+        if (option_ == boundary_option::output_ignore || option_ == boundary_option::output_zero)
+        {
+            assign_pixels(it_src, it_src + width, it_buffer);
+        }
+        else if (option_ == boundary_option::extend_padded)
+        {
+            assign_pixels(it_src - left_, it_src + width + right_, it_buffer);
+        }
+        else if (option_ == boundary_option::extend_zero)
+        {
+            std::fill_n(it_buffer, left_, zero_);
+            assign_pixels(it_src, it_src + width, it_buffer + left_);
+            std::fill_n(it_buffer + left_ + width, right_, zero_);
+        }
+        else // extend_constant
+        {
+            PixelAccum filler;
+            pixel_assigns_t<src_pixel_ref_t, PixelAccum>()(it_src[0], filler);
+            std::fill_n(it_buffer, left_, filler);
+            assign_pixels(it_src, it_src + width, it_buffer + left_);
+            pixel_assigns_t<src_pixel_ref_t, PixelAccum>()(it_src[width - 1], filler);
+            std::fill_n(it_buffer + left_ + width, right_, filler);
+        }
+    }
+
+private:
+    SrcView src_view_;
+    std::ptrdiff_t left_;
+    std::ptrdiff_t right_;
+    boundary_option option_;
+    PixelAccum zero_;
+};
+
+/// \brief Fills rows [first_row, last_row) of the destination pixels of 2D correlation whose
+/// kernel window does not lie within the image with \p zero, for boundary_option::output_zero.
+template <typename Kernel, typename DstView>
+void zero_correlate_2d_border(
+    Kernel const& kernel,
+    DstView const& dst_view,
+    typename DstView::value_type const& zero,
+    std::ptrdiff_t first_row,
+    std::ptrdiff_t last_row)
+{
+    std::ptrdiff_t const width = dst_view.width();
+    std::ptrdiff_t const upper = static_cast<std::ptrdiff_t>(kernel.upper_size());
+    std::ptrdiff_t const lower = static_cast<std::ptrdiff_t>(kernel.lower_size());
+    std::ptrdiff_t const left = static_cast<std::ptrdiff_t>(kernel.left_size());
+    std::ptrdiff_t const right = static_cast<std::ptrdiff_t>(kernel.right_size());
+    for (std::ptrdiff_t y = first_row; y < last_row; ++y)
+    {
+        typename DstView::x_iterator it_dst = dst_view.row_begin(y);
+        if (y < upper || y >= dst_view.height() - lower)
+        {
+            std::fill_n(it_dst, width, zero);
+        }
+        else
+        {
+            std::fill_n(it_dst, left, zero);
+            std::fill_n(it_dst + width - right, right, zero);
+        }
+    }
+}
+
+/// \brief Computes rows [first_row, last_row) of the cross-correlation of 2D kernel with an image.
+///
+/// Source rows are copied to a ring buffer of kernel size rows, with boundary manipulations
+/// applied, so every output pixel is computed from full kernel windows without bounds checks.
+/// With the output_ignore and output_zero options, only the pixels whose window lies within the
+/// image are computed. Each source row is read once, before the output rows below it are
+/// written, so \p src_view and \p dst_view may be the same when all rows are computed at once.
+/// \tparam PixelAccum - Specifies the data type which will be used for creating the buffer
+/// holding source image pixels, and for accumulating the products.
+/// \param src_view - Gil view of source image used in correlation.
+/// \param kernel - 2D kernel which will be correlated with source image.
+/// \param dst_view - Gil view which will store the result of correlation.
+/// \param option - Specifies the manner in which boundary pixels of "dst_view" should be computed.
+template <typename PixelAccum, typename SrcView, typename Kernel, typename DstView>
+void correlate_2d_impl(
+    SrcView const& src_view,
+    Kernel const& kernel,
+    DstView const& dst_view,
+    boundary_option option,
+    std::ptrdiff_t first_row,
+    std::ptrdiff_t last_row)
+{
+    BOOST_ASSERT(src_view.dimensions() == dst_view.dimensions());
+    BOOST_ASSERT(kernel.size() != 0);
+    BOOST_ASSERT(0 <= first_row && first_row <= last_row && last_row <= dst_view.height());
+
+    using dst_pixel_ref_t = typename pixel_proxy<typename DstView::value_type>::type;
+    using correlator_t = correlator_2d
+        <
+            PixelAccum,
+            Kernel,
+            is_correlate_row_vectorized
+            <
+                PixelAccum, PixelAccum const*, decltype(kernel.begin())
+            >::value
+        >;
+
+    std::ptrdiff_t const width = src_view.width();
+    std::ptrdiff_t const height = src_view.height();
+    if (width == 0 || first_row == last_row)
+        return;
+
+    std::ptrdiff_t const size = static_cast<std::ptrdiff_t>(kernel.size());
+    std::ptrdiff_t const upper = static_cast<std::ptrdiff_t>(kernel.upper_size());
+    std::ptrdiff_t const lower = static_cast<std::ptrdiff_t>(kernel.lower_size());
+    std::ptrdiff_t const left = static_cast<std::ptrdiff_t>(kernel.left_size());
+    std::ptrdiff_t const right = static_cast<std::ptrdiff_t>(kernel.right_size());
+
+    PixelAccum acc_zero;
+    pixel_zeros_t<PixelAccum>()(acc_zero);
+    typename DstView::value_type dst_zero;
+    pixel_assigns_t<PixelAccum, dst_pixel_ref_t>()(acc_zero, dst_zero);
+
+    bool const is_output_option =
+        option == boundary_option::output_ignore || option == boundary_option::output_zero;
+    if (is_output_option && (width < size || height < size))
+    {
+        if (option == boundary_option::output_zero)
+            fill_pixels(row_band_view(dst_view, first_row, last_row), dst_zero);
+        return;
+    }
+
+    // Rows and columns of the destination which are computed
+    std::ptrdiff_t const y_begin = (std::max)(first_row, is_output_option ? upper : 0);
+    std::ptrdiff_t const y_end = (std::min)(last_row, is_output_option ? height - lower : height);
+    std::ptrdiff_t const x_begin = is_output_option ? left : 0;
+    std::ptrdiff_t const x_count = is_output_option ? width - size + 1 : width;
+    std::ptrdiff_t const buffer_width = is_output_option ? width : width + size - 1;
+
+    correlate_2d_row_loader<PixelAccum, SrcView> load_row(src_view, left, right, option);
+
+    // Source row y is kept in slot y modulo kernel size
+    std::vector<PixelAccum> ring(size * buffer_width);
+    auto slot = [&](std::ptrdiff_t y) -> PixelAccum*
+    {
+        return &ring[((y % size + size) % size) * buffer_width];
+    };
+
+    correlator_t correlator(kernel);
+    std::vector<PixelAccum const*> rows(kernel.size());
+    for (std::ptrdiff_t y = y_begin - upper; y < y_begin + lower; ++y)
+        load_row(y, slot(y));
+    for (std::ptrdiff_t y = y_begin; y < y_end; ++y)
+    {
+        load_row(y + lower, slot(y + lower));
+        for (std::ptrdiff_t r = 0; r < size; ++r)
+            rows[r] = slot(y - upper + r);
+
+        correlator(rows.data(), dst_view.row_begin(y) + x_begin, x_count);
+    }
+
+    if (option == boundary_option::output_zero)
+        zero_correlate_2d_border(kernel, dst_view, dst_zero, first_row, last_row);
+}
+
+/// \brief Converts a value computed in double precision to a channel of a pixel accumulator,
+/// rounding it to the nearest integer for integral channels.
+template <typename Channel>
+auto to_correlate_2d_channel(double value) -> Channel
+{
+    using base_channel_t = typename base_channel_type<Channel>::type;
+    return Channel(static_cast<base_channel_t>(
+        is_channel_integral<Channel>::value ? std::round(value) : value));
+}
+
+/// \brief FFT sizes of the tiles of FFT-based 2D correlation
+struct correlate_2d_fft_tiling
+{
+    std::ptrdiff_t fft_width;
+    std::ptrdiff_t fft_height;
+    /// Estimated number of floating point operations correlating one pair of channels
+    double cost;
+};
+
+/// \brief Chooses the FFT sizes of the tiles computing \p columns by \p rows pixels of 2D
+/// correlation with a kernel of \p kernel_size, minimizing the estimated number of operations.
+///
+/// A tile of an FFT size yields that size minus kernel_size plus one pixels along each axis.
+/// Larger tiles waste fewer transformed values on the overlap with neighbouring tiles, but their
+/// transforms cost more per value and no longer fit in the caches.
+inline auto choose_correlate_2d_fft_tiling(
+    std::ptrdiff_t columns, std::ptrdiff_t rows, std::size_t kernel_size)
+    -> correlate_2d_fft_tiling
+{
+    std::size_t const max_size = (std::max)(fft_good_size(2 * kernel_size), std::size_t(512));
+    auto sizes = [&](std::ptrdiff_t count)
+    {
+        std::size_t const last = (std::min)(
+            fft_good_size(static_cast<std::size_t>(count) + kernel_size - 1), max_size);
+        std::vector<std::size_t> result;
+        for (std::size_t n = fft_good_size(kernel_size); n <= last; n = fft_good_size(n + 1))
+            result.push_back(n);
+        return result;
+    };
+
+    correlate_2d_fft_tiling best{0, 0, 0.0};
+    for (std::size_t fft_width : sizes(columns))
+    {
+        for (std::size_t fft_height : sizes(rows))
+        {
+            std::size_t const tile_width = fft_width - kernel_size + 1;
+            std::size_t const tile_height = fft_height - kernel_size + 1;
+            double const tiles =
+                static_cast<double>((static_cast<std::size_t>(columns) + tile_width - 1) /
+                    tile_width) *
+                static_cast<double>((static_cast<std::size_t>(rows) + tile_height - 1) /
+                    tile_height);
+            double const points = static_cast<double>(fft_width * fft_height);
+            // Forward and inverse transforms, and the copies and multiplication of the spectra
+            double const cost = tiles * points * (10.0 * std::log2(points) + 16.0);
+            if (best.fft_width == 0 || cost < best.cost)
+            {
+                best.fft_width = static_cast<std::ptrdiff_t>(fft_width);
+                best.fft_height = static_cast<std::ptrdiff_t>(fft_height);
+                best.cost = cost;
+            }
+        }
+    }
+    return best;
+}
+
+/// \brief Determines whether correlate_2d_fft_impl computes the same integer accumulators as
+/// correlate_2d_impl with \p kernel.
+///
+/// The direct computation truncates each product to the accumulator channel, so both agree only
+/// when the kernel values are integers. The sums of products then hold exactly in double
+/// precision for channels of up to 32 bits, and rounding the FFT results recovers them.
+template <typename Channel, typename Kernel>
+auto is_correlate_2d_fft_exact(Kernel const& kernel, std::true_type /* integral */) -> bool
+{
+    if (sizeof(Channel) > 4)
+        return false;
+
+    return std::all_of(kernel.begin(), kernel.end(), [](typename Kernel::value_type value)
+    {
+        double whole;
+        return !(std::abs(std::modf(static_cast<double>(value), &whole)) > 0.0);
+    });
+}
+
+/// \brief Floating point accumulators only differ by floating point rounding
+template <typename Channel, typename Kernel>
+auto is_correlate_2d_fft_exact(Kernel const&, std::false_type /* integral */) -> bool
+{
+    return true;
+}
+
+/// \brief Determines whether 2D correlation of an image of \p dimensions is faster computed
+/// with correlate_2d_fft_impl than with correlate_2d_impl.
+///
+/// The direct computation costs a multiplication and an addition per kernel value and channel,
+/// fewer with vector instructions, while the FFT-based computation grows with the logarithm of
+/// the kernel size and handles two channels at once. Integer accumulators are only computed
+/// with FFT when the results are the same, see is_correlate_2d_fft_exact.
+template <typename PixelAccum, typename Kernel>
+auto prefers_correlate_2d_fft(
+    point_t const& dimensions, Kernel const& kernel, boundary_option option) -> bool
+{
+    using channel_t = typename channel_type<PixelAccum>::type;
+    std::size_t const size = kernel.size();
+    // Small kernels are always faster computed directly
+    if (size < 8)
+        return false;
+
+    bool const is_output_option =
+        option == boundary_option::output_ignore || option == boundary_option::output_zero;
+    std::ptrdiff_t const margin = is_output_option ? static_cast<std::ptrdiff_t>(size) - 1 : 0;
+    std::ptrdiff_t const columns = dimensions.x - margin;
+    std::ptrdiff_t const rows = dimensions.y - margin;
+    if (columns <= 0 || rows <= 0)
+        return false;
+
+    constexpr std::size_t channels = num_channels<PixelAccum>::value;
+    bool const is_vectorized = is_correlate_row_vectorized
+        <
+            PixelAccum, PixelAccum const*, decltype(kernel.begin())
+        >::value;
+    double const direct_cost = static_cast<double>(columns) * static_cast<double>(rows) *
+        static_cast<double>(size * size * channels) * (is_vectorized ? 2.0 / 8 : 2.0);
+    double const fft_cost = choose_correlate_2d_fft_tiling(columns, rows, size).cost *
+        static_cast<double>((channels + 1) / 2);
+    return fft_cost < direct_cost &&
+        is_correlate_2d_fft_exact<channel_t>(kernel, is_channel_integral<channel_t>());
+}
+
+/// \brief Computes rows [first_row, last_row) of the cross-correlation of 2D kernel with an image
+/// using fast Fourier transforms, with the same results as correlate_2d_impl up to rounding.
+///
+/// The destination is split in tiles, and each tile is computed from the overlapping block of
+/// source pixels it depends on by multiplying their spectrum by the conjugate spectrum of the
+/// kernel, padded to the same FFT size. Two channels are correlated at once as the real and
+/// imaginary parts of complex values. Integer accumulators are rounded to the nearest value,
+/// which is the exact result for integer kernel values.
+/// Source rows are copied to a buffer one band of tiles at a time, keeping the rows shared with
+/// the next band, so \p src_view and \p dst_view may be the same when all rows are computed at
+/// once.
+template <typename PixelAccum, typename SrcView, typename Kernel, typename DstView>
+void correlate_2d_fft_impl(
+    SrcView const& src_view,
+    Kernel const& kernel,
+    DstView const& dst_view,
+    boundary_option option,
+    std::ptrdiff_t first_row,
+    std::ptrdiff_t last_row)
+{
+    BOOST_ASSERT(src_view.dimensions() == dst_view.dimensions());
+    BOOST_ASSERT(kernel.size() != 0);
+    BOOST_ASSERT(0 <= first_row && first_row <= last_row && last_row <= dst_view.height());
+
+    using dst_pixel_ref_t = typename pixel_proxy<typename DstView::value_type>::type;
+    using channel_t = typename channel_type<PixelAccum>::type;
+    using complex_t = fft_plan::complex_t;
+    constexpr std::ptrdiff_t channels = num_channels<PixelAccum>::value;
+
+    std::ptrdiff_t const width = src_view.width();
+    std::ptrdiff_t const height = src_view.height();
+    if (width == 0 || first_row == last_row)
+        return;
+
+    std::ptrdiff_t const size = static_cast<std::ptrdiff_t>(kernel.size());
+    std::ptrdiff_t const upper = static_cast<std::ptrdiff_t>(kernel.upper_size());
+    std::ptrdiff_t const lower = static_cast<std::ptrdiff_t>(kernel.lower_size());
+    std::ptrdiff_t const left = static_cast<std::ptrdiff_t>(kernel.left_size());
+    std::ptrdiff_t const right = static_cast<std::ptrdiff_t>(kernel.right_size());
+
+    PixelAccum acc_zero;
+    pixel_zeros_t<PixelAccum>()(acc_zero);
+    typename DstView::value_type dst_zero;
+    pixel_assigns_t<PixelAccum, dst_pixel_ref_t>()(acc_zero, dst_zero);
+
+    bool const is_output_option =
+        option == boundary_option::output_ignore || option == boundary_option::output_zero;
+    if (is_output_option && (width < size || height < size))
+    {
+        if (option == boundary_option::output_zero)
+            fill_pixels(row_band_view(dst_view, first_row, last_row), dst_zero);
+        return;
+    }
+
+    // Rows and columns of the destination which are computed
+    std::ptrdiff_t const y_begin = (std::max)(first_row, is_output_option ? upper : 0);
+    std::ptrdiff_t const y_end = (std::min)(last_row, is_output_option ? height - lower : height);
+    std::ptrdiff_t const x_begin = is_output_option ? left : 0;
+    std::ptrdiff_t const x_count = is_output_option ? width - size + 1 : width;
+
+    correlate_2d_row_loader<PixelAccum, SrcView> load_row(src_view, left, right, option);
+    std::ptrdiff_t const buffer_width = load_row.width();
+
+    if (y_begin < y_end)
+    {
+        correlate_2d_fft_tiling const tiling =
+            choose_correlate_2d_fft_tiling(x_count, y_end - y_begin, kernel.size());
+        std::ptrdiff_t const fft_width = tiling.fft_width;
+        std::ptrdiff_t const fft_height = tiling.fft_height;
+        std::ptrdiff_t const tile_width = fft_width - size + 1;
+        std::ptrdiff_t const tile_height = fft_height - size + 1;
+        fft_plan const row_plan(static_cast<std::size_t>(fft_width));
+        fft_plan const column_plan(static_cast<std::size_t>(fft_height));
+        std::vector<complex_t> work(
+            (fft_plan::column_block + 1) * static_cast<std::size_t>(fft_height + fft_width));
+
+        // Row and column transforms of the leading rows, the others being zeros
+        auto forward_2d = [&](complex_t* grid, std::ptrdiff_t rows)
+        {
+            for (std::ptrdiff_t y = 0; y < rows; ++y)
+                row_plan.forward(grid + y * fft_width, work.data());
+            column_plan.forward_columns(
+                grid, static_cast<std::size_t>(fft_width), work.data());
+        };
+
+        // Conjugate spectrum of the kernel, scaled to normalize the inverse transforms
+        std::vector<complex_t> spectrum(static_cast<std::size_t>(fft_width * fft_height));
+        double const scale = 1.0 / static_cast<double>(fft_width * fft_height);
+        auto it_kernel = kernel.begin();
+        for (std::ptrdiff_t y = 0; y < size; ++y)
+        {
+            for (std::ptrdiff_t x = 0; x < size; ++x, ++it_kernel)
+                spectrum[y * fft_width + x] = scale * static_cast<double>(*it_kernel);
+        }
+        forward_2d(spectrum.data(), size);
+        for (complex_t& value : spectrum)
+            value = std::conj(value);
+
+        std::vector<PixelAccum> band((tile_height + size - 1) * buffer_width);
+        std::vector<complex_t> grid(spectrum.size());
+        std::vector<PixelAccum> tile(tile_width * tile_height);
+        for (std::ptrdiff_t y0 = y_begin; y0 < y_end; y0 += tile_height)
+        {
+            std::ptrdiff_t const rows = (std::min)(tile_height, y_end - y0);
+            std::ptrdiff_t const band_rows = rows + size - 1;
+
+            // The first rows were the last rows of the previous band
+            std::ptrdiff_t loaded_rows = 0;
+            if (y0 != y_begin)
+            {
+                std::copy(
+                    band.begin() + tile_height * buffer_width,
+                    band.begin() + (tile_height + size - 1) * buffer_width,
+                    band.begin());
+                loaded_rows = size - 1;
+            }
+            for (std::ptrdiff_t r = loaded_rows; r < band_rows; ++r)
+                load_row(y0 - upper + r, &band[r * buffer_width]);
+
+            for (std::ptrdiff_t x0 = 0; x0 < x_count; x0 += tile_width)
+            {
+                std::ptrdiff_t const columns = (std::min)(tile_width, x_count - x0);
+                std::ptrdiff_t const band_columns = columns + size - 1;
+                for (std::ptrdiff_t c = 0; c < channels; c += 2)
+                {
+                    std::fill(grid.begin(), grid.end(), complex_t());
+                    for (std::ptrdiff_t y = 0; y < band_rows; ++y)
+                    {
+                        PixelAccum const* it_band = &band[y * buffer_width + x0];
+                        complex_t* it_grid = &grid[y * fft_width];
+                        for (std::ptrdiff_t x = 0; x < band_columns; ++x)
+                        {
+                            it_grid[x] = complex_t(
+                                static_cast<double>(dynamic_at_c(it_band[x], c)),
+                                c + 1 < channels
+                                    ? static_cast<double>(dynamic_at_c(it_band[x], c + 1))
+                                    : 0.0);
+                        }
+                    }
+
+                    forward_2d(grid.data(), band_rows);
+                    for (std::size_t i = 0; i < grid.size(); ++i)
+                        grid[i] = fft_multiply(grid[i], spectrum[i]);
+                    column_plan.inverse_columns(
+                        grid.data(), static_cast<std::size_t>(fft_width), work.data());
+
+                    for (std::ptrdiff_t y = 0; y < rows; ++y)
+                    {
+                        complex_t* it_grid = &grid[y * fft_width];
+                        row_plan.inverse(it_grid, work.data());
+                        PixelAccum* it_tile = &tile[y * tile_width];
+                        for (std::ptrdiff_t x = 0; x < columns; ++x)
+                        {
+                            dynamic_at_c(it_tile[x], c) =
+                                to_correlate_2d_channel<channel_t>(it_grid[x].real());
+                            if (c + 1 < channels)
+                            {
+                                dynamic_at_c(it_tile[x], c + 1) =
+                                    to_correlate_2d_channel<channel_t>(it_grid[x].imag());
+                            }
+                        }
+                    }
+                }
+
+                for (std::ptrdiff_t y = 0; y < rows; ++y)
+                {
+                    typename DstView::x_iterator it_dst =
+                        dst_view.row_begin(y0 + y) + x_begin + x0;
+                    PixelAccum const* it_tile = &tile[y * tile_width];
+                    for (std::ptrdiff_t x = 0; x < columns; ++x)
+                    {
+                        typename DstView::value_type value;
+                        pixel_assigns_t<PixelAccum, dst_pixel_ref_t>()(it_tile[x], value);
+                        it_dst[x] = value;
+                    }
+                }
+            }
+        }
+    }
+
+    if (option == boundary_option::output_zero)
+        zero_correlate_2d_border(kernel, dst_view, dst_zero, first_row, last_row);
+}
+
+/// \brief Rotates a 2D kernel by 180 degrees, turning a convolution into a cross-correlation
+template <typename Kernel>
+auto rotate_kernel_2d(Kernel const& kernel) -> Kernel
+{
+    Kernel result(kernel);
+    result.center_x() = kernel.right_size();
+    result.center_y() = kernel.lower_size();
+    std::reverse(result.begin(), result.end());
+    return result;
+}
+
 } // namespace detail
 
 /// \ingroup ImageAlgorithms
@@ -230,8 +1010,7 @@ void correlate_cols(
     DstView const& dst_view,
     boundary_option option = boundary_option::extend_zero)
 {
-    correlate_rows<PixelAccum>(
-        transposed_view(src_view), kernel, transposed_view(dst_view), option);
+    detail::correlate_cols_impl<PixelAccum>(src_view, kernel, dst_view, option);
 }
 
 /// \ingroup ImageAlgorithms
@@ -268,8 +1047,7 @@ void convolve_cols(
     DstView const& dst_view,
     boundary_option option = boundary_option::extend_zero)
 {
-    convolve_rows<PixelAccum>(
-        transposed_view(src_view), kernel, transposed_view(dst_view), option);
+    correlate_cols<PixelAccum>(src_view, reverse_kernel(kernel), dst_view, option);
 }
 
 /// \ingroup ImageAlgorithms
@@ -307,8 +1085,7 @@ void correlate_cols_fixed(
     DstView const& dst_view,
     boundary_option option = boundary_option::extend_zero)
 {
-    correlate_rows_fixed<PixelAccum>(
-        transposed_view(src_view), kernel, transposed_view(dst_view), option);
+    detail::correlate_cols_impl<PixelAccum>(src_view, kernel, dst_view, option);
 }
 
 /// \ingroup ImageAlgorithms
@@ -345,8 +1122,128 @@ void convolve_cols_fixed(
     DstView const& dst_view,
     boundary_option option = boundary_option::extend_zero)
 {
-    convolve_rows_fixed<PixelAccum>(
-        transposed_view(src_view), kernel, transposed_view(dst_view), option);
+    correlate_cols_fixed<PixelAccum>(src_view, reverse_kernel(kernel), dst_view, option);
+}
+
+/// \ingroup ImageAlgorithms
+/// \brief Correlates 2D kernel with image.
+///
+/// Large kernels are correlated using fast Fourier transforms when the estimated number of
+/// operations is lower than that of the direct computation, usually from about 10x10 kernel
+/// values with integer accumulators and 30x30 with \c float accumulators. Floating point
+/// accumulators may then differ from the direct computation by floating point rounding. Integer
+/// accumulators are only computed with FFT for kernels of integer values, where the results are
+/// the same, since the direct computation truncates each product of other kernels.
+/// \tparam PixelAccum Specifies the data type which will be used for creating the buffers holding
+/// source image pixels after applying appropriate boundary manipulations, and for accumulating
+/// the products. Accumulators of interleaved \c float pixels use vector instructions.
+/// \tparam SrcView Models ImageViewConcept
+/// \tparam Kernel Specifies the type of 2D kernel which will be correlated with source image.
+/// \tparam DstView Models MutableImageViewConcept
+template <typename PixelAccum, typename SrcView, typename Kernel, typename DstView>
+void correlate_2d(
+    SrcView const& src_view,
+    Kernel const& kernel,
+    DstView const& dst_view,
+    boundary_option option = boundary_option::extend_zero)
+{
+    gil_function_requires<ImageViewConcept<SrcView>>();
+    gil_function_requires<MutableImageViewConcept<DstView>>();
+    static_assert(color_spaces_are_compatible
+    <
+        typename color_space_type<SrcView>::type,
+        typename color_space_type<DstView>::type
+    >::value, "Source and destination views must have pixels with the same color space");
+
+    if (detail::prefers_correlate_2d_fft<PixelAccum>(src_view.dimensions(), kernel, option))
+    {
+        detail::correlate_2d_fft_impl<PixelAccum>(
+            src_view, kernel, dst_view, option, 0, dst_view.height());
+    }
+    else
+    {
+        detail::correlate_2d_impl<PixelAccum>(
+            src_view, kernel, dst_view, option, 0, dst_view.height());
+    }
+}
+
+/// \ingroup ImageAlgorithms
+/// \brief Correlates 2D kernel with image, processing bands of rows as separate tasks.
+/// \p src_view and \p dst_view must not overlap.
+template
+<
+    typename PixelAccum,
+    typename ExecutionPolicy,
+    typename SrcView,
+    typename Kernel,
+    typename DstView,
+    typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+>
+void correlate_2d(
+    ExecutionPolicy const& policy,
+    SrcView const& src_view,
+    Kernel const& kernel,
+    DstView const& dst_view,
+    boundary_option option = boundary_option::extend_zero)
+{
+    gil_function_requires<ImageViewConcept<SrcView>>();
+    gil_function_requires<MutableImageViewConcept<DstView>>();
+    static_assert(color_spaces_are_compatible
+    <
+        typename color_space_type<SrcView>::type,
+        typename color_space_type<DstView>::type
+    >::value, "Source and destination views must have pixels with the same color space");
+
+    bool const use_fft =
+        detail::prefers_correlate_2d_fft<PixelAccum>(src_view.dimensions(), kernel, option);
+    detail::for_each_row_band(policy, dst_view.height(), [&](std::ptrdiff_t y0, std::ptrdiff_t y1)
+    {
+        if (use_fft)
+            detail::correlate_2d_fft_impl<PixelAccum>(src_view, kernel, dst_view, option, y0, y1);
+        else
+            detail::correlate_2d_impl<PixelAccum>(src_view, kernel, dst_view, option, y0, y1);
+    });
+}
+
+/// \ingroup ImageAlgorithms
+/// \brief Convolves 2D kernel with image.
+/// \tparam PixelAccum Specifies the data type which will be used for creating the buffers holding
+/// source image pixels after applying appropriate boundary manipulations, and for accumulating
+/// the products.
+/// \tparam SrcView Models ImageViewConcept
+/// \tparam Kernel Specifies the type of 2D kernel which will be convolved with source image.
+/// \tparam DstView Models MutableImageViewConcept
+template <typename PixelAccum, typename SrcView, typename Kernel, typename DstView>
+void convolve_2d(
+    SrcView const& src_view,
+    Kernel const& kernel,
+    DstView const& dst_view,
+    boundary_option option = boundary_option::extend_zero)
+{
+    correlate_2d<PixelAccum>(src_view, detail::rotate_kernel_2d(kernel), dst_view, option);
+}
+
+/// \ingroup ImageAlgorithms
+/// \brief Convolves 2D kernel with image, processing bands of rows as separate tasks.
+/// \p src_view and \p dst_view must not overlap.
+template
+<
+    typename PixelAccum,
+    typename ExecutionPolicy,
+    typename SrcView,
+    typename Kernel,
+    typename DstView,
+    typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+>
+void convolve_2d(
+    ExecutionPolicy const& policy,
+    SrcView const& src_view,
+    Kernel const& kernel,
+    DstView const& dst_view,
+    boundary_option option = boundary_option::extend_zero)
+{
+    correlate_2d<PixelAccum>(
+        policy, src_view, detail::rotate_kernel_2d(kernel), dst_view, option);
 }
 
 namespace detail
@@ -372,56 +1269,18 @@ void convolve_1d(
     convolve_cols<PixelAccum>(dst_view, kernel, dst_view, option);
 }
 
-template <typename SrcView, typename DstView, typename Kernel>
-void convolve_2d_impl(SrcView const& src_view, DstView const& dst_view, Kernel const& kernel)
-{
-    int flip_ker_row, flip_ker_col, row_boundary, col_boundary;
-    float aux_total;
-    for (std::ptrdiff_t view_row = 0; view_row < src_view.height(); ++view_row)
-    {
-        for (std::ptrdiff_t view_col = 0; view_col < src_view.width(); ++view_col)
-        {
-            aux_total = 0.0f;
-            for (std::size_t kernel_row = 0; kernel_row < kernel.size(); ++kernel_row)
-            {
-                flip_ker_row = kernel.size() - 1 - kernel_row;      // row index of flipped kernel
-
-                for (std::size_t kernel_col = 0; kernel_col < kernel.size(); ++kernel_col)
-                {
-                    flip_ker_col = kernel.size() - 1 - kernel_col; // column index of flipped kernel
-
-                    // index of input signal, used for checking boundary
-                    row_boundary = view_row + (kernel.center_y() - flip_ker_row);
-                    col_boundary = view_col + (kernel.center_x() - flip_ker_col);
-
-                    // ignore input samples which are out of bound
-                    if (row_boundary >= 0 && row_boundary < src_view.height() &&
-                        col_boundary >= 0 && col_boundary < src_view.width())
-                    {
-                        aux_total +=
-                            src_view(col_boundary, row_boundary)[0] *
-                            kernel.at(flip_ker_col, flip_ker_row);
-                    }
-                }
-            }
-            dst_view(view_col, view_row) = aux_total;
-        }
-    }
-}
-
 /// \ingroup ImageAlgorithms
-/// \brief convolve_2d can only use convolve_option_extend_zero as convolve_boundary_option
-///  this is the default option and cannot be changed for now
-///  (In future there are plans to improve the algorithm and allow user to use other options as well)
+/// \brief Convolves 2D kernel with image, accumulating each channel in \c float.
+///
+/// Equivalent to convolve_2d with a \c float pixel accumulator and
+/// boundary_option::extend_zero, kept for compatibility. The kernel is always applied directly,
+/// never with FFT, so integer destinations are truncated from the same sums for any size.
 /// \tparam SrcView Models ImageViewConcept
 /// \tparam Kernel Specifies the type of 2D kernel which will be used while convolution.
 /// \tparam DstView Models MutableImageViewConcept
 template <typename SrcView, typename DstView, typename Kernel>
 void convolve_2d(SrcView const& src_view, Kernel const& kernel, DstView const& dst_view)
 {
-    BOOST_ASSERT(src_view.dimensions() == dst_view.dimensions());
-    BOOST_ASSERT(kernel.size() != 0);
-
     gil_function_requires<ImageViewConcept<SrcView>>();
     gil_function_requires<MutableImageViewConcept<DstView>>();
     static_assert(color_spaces_are_compatible
@@ -430,14 +1289,9 @@ void convolve_2d(SrcView const& src_view, Kernel const& kernel, DstView const& d
         typename color_space_type<DstView>::type
     >::value, "Source and destination views must have pixels with the same color space");
 
-    for (std::size_t i = 0; i < src_view.num_channels(); i++)
-    {
-        detail::convolve_2d_impl(
-            nth_channel_view(src_view, i),
-            nth_channel_view(dst_view, i),
-            kernel
-        );
-    }
+    using accum_t = pixel<float, typename SrcView::value_type::layout_t>;
+    detail::correlate_2d_impl<accum_t>(src_view, detail::rotate_kernel_2d(kernel), dst_view,
+        boundary_option::extend_zero, 0, dst_view.height());
 }
 
 }}} // namespace boost::gil::detail
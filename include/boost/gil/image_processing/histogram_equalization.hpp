@@ -8,11 +8,16 @@
 #ifndef BOOST_GIL_IMAGE_PROCESSING_HISTOGRAM_EQUALIZATION_HPP
 #define BOOST_GIL_IMAGE_PROCESSING_HISTOGRAM_EQUALIZATION_HPP
 
+#include <boost/gil/algorithm.hpp>
+#include <boost/gil/execution.hpp>
 #include <boost/gil/histogram.hpp>
 #include <boost/gil/image.hpp>
 
+#include <array>
 #include <cmath>
 #include <map>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace boost { namespace gil {
@@ -33,6 +38,158 @@ namespace boost { namespace gil {
 ///        6. Hence the pixel transform , px => histogram_of_ith_channel[px].
 ///
 
+namespace detail {
+
+/// \ingroup HE
+/// \brief Computes the equalization color map of the source histogram and transforms
+///        the destination histogram, for any histogram type over integral keys.
+///
+template <typename SrcKeyType, typename DstKeyType, typename SrcHist, typename DstHist>
+auto histogram_equalization_impl(SrcHist const& src_hist, DstHist& dst_hist)
+    -> std::map<SrcKeyType, DstKeyType>
+{
+    static_assert(
+        std::is_integral<SrcKeyType>::value &&
+        std::is_integral<DstKeyType>::value,
+        "Source and destination histogram types are not appropriate");
+
+    using value_t = typename SrcHist::value_type;
+    dst_hist.clear();
+    double sum          = src_hist.sum();
+    SrcKeyType min_key  = (std::numeric_limits<DstKeyType>::min)();
+    SrcKeyType max_key  = (std::numeric_limits<DstKeyType>::max)();
+    auto cumltv_srchist = cumulative_histogram(src_hist);
+    std::map<SrcKeyType, DstKeyType> color_map;
+    std::for_each(cumltv_srchist.begin(), cumltv_srchist.end(), [&](value_t const& v) {
+        DstKeyType trnsfrmd_key =
+            static_cast<DstKeyType>((v.second * (max_key - min_key)) / sum + min_key);
+        color_map[std::get<0>(v.first)] = trnsfrmd_key;
+    });
+    std::for_each(src_hist.begin(), src_hist.end(), [&](value_t const& v) {
+        dst_hist[color_map[std::get<0>(v.first)]] += v.second;
+    });
+    return color_map;
+}
+
+/// \ingroup HE
+/// \brief Equalizes each channel of the source view, collecting the channel histograms
+///        in the given histogram type.
+///
+template <typename Histogram, typename ExecutionPolicy, typename SrcView, typename DstView>
+void histogram_equalization_channels(
+    ExecutionPolicy const& policy,
+    SrcView const& src_view,
+    DstView const& dst_view,
+    std::size_t bin_width,
+    bool mask,
+    std::vector<std::vector<bool>> const& src_mask,
+    std::false_type /* lookup tables */)
+{
+    using dst_channel_t    = typename channel_type<DstView>::type;
+    using coord_t          = typename SrcView::x_coord_t;
+
+    std::size_t const channels = num_channels<SrcView>::value;
+    coord_t const width        = src_view.width();
+    coord_t const height       = src_view.height();
+    std::size_t pixel_max      = (std::numeric_limits<dst_channel_t>::max)();
+    std::size_t pixel_min      = (std::numeric_limits<dst_channel_t>::min)();
+
+    for (std::size_t i = 0; i < channels; i++)
+    {
+        Histogram h;
+        fill_histogram(
+            policy, nth_channel_view(src_view, i), h, bin_width, false, false, mask, src_mask);
+        h.normalize();
+        auto h2 = cumulative_histogram(h);
+        for (std::ptrdiff_t src_y = 0; src_y < height; ++src_y)
+        {
+            auto src_it = nth_channel_view(src_view, i).row_begin(src_y);
+            auto dst_it = nth_channel_view(dst_view, i).row_begin(src_y);
+            for (std::ptrdiff_t src_x = 0; src_x < width; ++src_x)
+            {
+                if (mask && !src_mask[src_y][src_x])
+                    dst_it[src_x][0] = channel_convert<dst_channel_t>(src_it[src_x][0]);
+                else
+                    dst_it[src_x][0] = static_cast<dst_channel_t>(
+                        h2[src_it[src_x][0]] * (pixel_max - pixel_min) + pixel_min);
+            }
+        }
+    }
+}
+
+/// \ingroup HE
+/// \brief Equalizes each channel of a source view of integral channels of at most 16 bits,
+///        turning the mapping of each channel into a lookup table applied to whole rows.
+///
+template <typename Histogram, typename ExecutionPolicy, typename SrcView, typename DstView>
+void histogram_equalization_channels(
+    ExecutionPolicy const& policy,
+    SrcView const& src_view,
+    DstView const& dst_view,
+    std::size_t bin_width,
+    bool mask,
+    std::vector<std::vector<bool>> const& src_mask,
+    std::true_type /* lookup tables */)
+{
+    using src_channel_t = typename channel_type<SrcView>::type;
+    using dst_channel_t = typename channel_type<DstView>::type;
+    using dst_value_t   = typename base_channel_type<dst_channel_t>::type;
+    std::size_t const channels = num_channels<SrcView>::value;
+    std::size_t pixel_max      = (std::numeric_limits<dst_channel_t>::max)();
+    std::size_t pixel_min      = (std::numeric_limits<dst_channel_t>::min)();
+    double const range         = static_cast<double>(pixel_max - pixel_min);
+    double const offset        = static_cast<double>(pixel_min);
+
+    // Values absent from a sparse cumulative histogram map as its zero entries do
+    std::size_t const extent = lut_extent<src_channel_t>::value;
+    std::vector<dst_value_t> tables(
+        channels * extent, static_cast<dst_value_t>(static_cast<dst_channel_t>(offset)));
+    std::array<dst_value_t const*, num_channels<SrcView>::value> table_rows;
+    for (std::size_t i = 0; i < channels; i++)
+    {
+        Histogram h;
+        fill_histogram(
+            policy, nth_channel_view(src_view, static_cast<int>(i)), h, bin_width, false, false,
+            mask, src_mask);
+        h.normalize();
+        dst_value_t* table = tables.data() + i * extent;
+        for (auto const& v : cumulative_histogram(h))
+        {
+            table[lut_index(std::get<0>(v.first))] = static_cast<dst_value_t>(
+                static_cast<dst_channel_t>(v.second * range + offset));
+        }
+        table_rows[i] = table;
+    }
+
+    if (!mask)
+    {
+        apply_channel_luts(policy, src_view, dst_view, table_rows);
+        return;
+    }
+
+    for_each_row_band(policy, src_view.height(), [&](std::ptrdiff_t y0, std::ptrdiff_t y1)
+    {
+        for (std::ptrdiff_t y = y0; y < y1; ++y)
+        {
+            auto src_it = src_view.row_begin(y);
+            auto dst_it = dst_view.row_begin(y);
+            for (std::ptrdiff_t x = 0; x < src_view.width(); ++x)
+            {
+                bool const inside = src_mask[y][x];
+                for (std::size_t c = 0; c < channels; ++c)
+                {
+                    src_channel_t const value = dynamic_at_c(src_it[x], c);
+                    dynamic_at_c(dst_it[x], c) = inside
+                        ? dst_channel_t(table_rows[c][lut_index(value)])
+                        : channel_convert<dst_channel_t>(value);
+                }
+            }
+        }
+    });
+}
+
+} // namespace detail
+
 /// \fn histogram_equalization
 /// \ingroup HE
 /// \tparam SrcKeyType Key Type of input histogram
@@ -62,41 +219,57 @@ template <typename SrcKeyType, typename DstKeyType>
 auto histogram_equalization(histogram<SrcKeyType> const& src_hist, histogram<DstKeyType>& dst_hist)
     -> std::map<SrcKeyType, DstKeyType>
 {
-    static_assert(
-        std::is_integral<SrcKeyType>::value &&
-        std::is_integral<DstKeyType>::value,
-        "Source and destination histogram types are not appropriate");
+    return detail::histogram_equalization_impl<SrcKeyType, DstKeyType>(src_hist, dst_hist);
+}
 
-    using value_t = typename histogram<SrcKeyType>::value_type;
-    dst_hist.clear();
-    double sum          = src_hist.sum();
-    SrcKeyType min_key  = (std::numeric_limits<DstKeyType>::min)();
-    SrcKeyType max_key  = (std::numeric_limits<DstKeyType>::max)();
-    auto cumltv_srchist = cumulative_histogram(src_hist);
-    std::map<SrcKeyType, DstKeyType> color_map;
-    std::for_each(cumltv_srchist.begin(), cumltv_srchist.end(), [&](value_t const& v) {
-        DstKeyType trnsfrmd_key =
-            static_cast<DstKeyType>((v.second * (max_key - min_key)) / sum + min_key);
-        color_map[std::get<0>(v.first)] = trnsfrmd_key;
-    });
-    std::for_each(src_hist.begin(), src_hist.end(), [&](value_t const& v) {
-        dst_hist[color_map[std::get<0>(v.first)]] += v.second;
-    });
-    return color_map;
+/// \overload histogram_equalization
+/// \ingroup HE
+/// \brief Overload for histogram equalization algorithm on a dense histogram
+///
+template <typename SrcKeyType>
+auto histogram_equalization(dense_histogram<SrcKeyType> const& src_hist)
+    -> std::map<SrcKeyType, SrcKeyType>
+{
+    dense_histogram<SrcKeyType> dst_hist;
+    return histogram_equalization(src_hist, dst_hist);
 }
 
 /// \overload histogram_equalization
 /// \ingroup HE
+/// \brief Overload for histogram equalization algorithm on dense histograms
+///
+template <typename SrcKeyType, typename DstKeyType>
+auto histogram_equalization(
+    dense_histogram<SrcKeyType> const& src_hist, dense_histogram<DstKeyType>& dst_hist)
+    -> std::map<SrcKeyType, DstKeyType>
+{
+    return detail::histogram_equalization_impl<SrcKeyType, DstKeyType>(src_hist, dst_hist);
+}
+
+/// \overload histogram_equalization
+/// \ingroup HE
+/// @param policy    INPUT Execution policy filling the histograms and mapping bands of rows
 /// @param src_view  INPUT source image view
 /// @param dst_view  OUTPUT Output image view
 /// @param bin_width INPUT Histogram bin width
 /// @param mask      INPUT Specify is mask is to be used
 /// @param src_mask  INPUT Mask vector over input image
 /// \brief Overload for histogram equalization algorithm, takes in both source & destination
-///        image views and histogram equalizes the input image.
+///        image views and histogram equalizes the input image according to an execution
+///        policy.
 ///
-template <typename SrcView, typename DstView>
+///        Integral source channels of at most 16 bits are mapped through one lookup table
+///        per channel, see apply_lut.
+///
+template
+<
+    typename ExecutionPolicy,
+    typename SrcView,
+    typename DstView,
+    typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+>
 void histogram_equalization(
+    ExecutionPolicy const& policy,
     SrcView const& src_view,
     DstView const& dst_view,
     std::size_t bin_width = 1,
@@ -112,37 +285,41 @@ void histogram_equalization(
             typename color_space_type<DstView>::type>::value,
         "Source and destination views must have same color space");
 
-    // Defining channel type
     using source_channel_t = typename channel_type<SrcView>::type;
-    using dst_channel_t    = typename channel_type<DstView>::type;
-    using coord_t          = typename SrcView::x_coord_t;
-
-    std::size_t const channels = num_channels<SrcView>::value;
-    coord_t const width        = src_view.width();
-    coord_t const height       = src_view.height();
-    std::size_t pixel_max      = (std::numeric_limits<dst_channel_t>::max)();
-    std::size_t pixel_min      = (std::numeric_limits<dst_channel_t>::min)();
+    using use_lut_t = detail::is_lut_index_channel<source_channel_t>;
 
-    for (std::size_t i = 0; i < channels; i++)
+    if (bin_width == 1)
     {
-        histogram<source_channel_t> h;
-        fill_histogram(nth_channel_view(src_view, i), h, bin_width, false, false, mask, src_mask);
-        h.normalize();
-        auto h2 = cumulative_histogram(h);
-        for (std::ptrdiff_t src_y = 0; src_y < height; ++src_y)
-        {
-            auto src_it = nth_channel_view(src_view, i).row_begin(src_y);
-            auto dst_it = nth_channel_view(dst_view, i).row_begin(src_y);
-            for (std::ptrdiff_t src_x = 0; src_x < width; ++src_x)
-            {
-                if (mask && !src_mask[src_y][src_x])
-                    dst_it[src_x][0] = channel_convert<dst_channel_t>(src_it[src_x][0]);
-                else
-                    dst_it[src_x][0] = static_cast<dst_channel_t>(
-                        h2[src_it[src_x][0]] * (pixel_max - pixel_min) + pixel_min);
-            }
-        }
+        detail::histogram_equalization_channels<detail::fast_histogram<source_channel_t>>(
+            policy, src_view, dst_view, bin_width, mask, src_mask, use_lut_t());
     }
+    else
+    {
+        detail::histogram_equalization_channels<histogram<source_channel_t>>(
+            policy, src_view, dst_view, bin_width, mask, src_mask, use_lut_t());
+    }
+}
+
+/// \overload histogram_equalization
+/// \ingroup HE
+/// @param src_view  INPUT source image view
+/// @param dst_view  OUTPUT Output image view
+/// @param bin_width INPUT Histogram bin width
+/// @param mask      INPUT Specify is mask is to be used
+/// @param src_mask  INPUT Mask vector over input image
+/// \brief Overload for histogram equalization algorithm, takes in both source & destination
+///        image views and histogram equalizes the input image.
+///
+template <typename SrcView, typename DstView>
+void histogram_equalization(
+    SrcView const& src_view,
+    DstView const& dst_view,
+    std::size_t bin_width = 1,
+    bool mask = false,
+    std::vector<std::vector<bool>> src_mask = {})
+{
+    histogram_equalization(
+        execution::seq, src_view, dst_view, bin_width, mask, std::move(src_mask));
 }
 
 }}  //namespace boost::gil
@@ -10,12 +10,16 @@
 #define BOOST_GIL_IMAGE_PROCESSING_HISTOGRAM_MATCHING_HPP
 
 #include <boost/gil/algorithm.hpp>
+#include <boost/gil/execution.hpp>
 #include <boost/gil/histogram.hpp>
 #include <boost/gil/image.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <map>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace boost { namespace gil {
@@ -34,39 +38,16 @@ namespace boost { namespace gil {
 ///                                                      => px' = Inv-CDF (CDF(px))
 ///
 
-/// \fn histogram_matching
-/// \ingroup HM
-/// \tparam SrcKeyType Key Type of input histogram
-/// @param src_hist INPUT Input source histogram
-/// @param ref_hist INPUT Input reference histogram
-/// \brief Overload for histogram matching algorithm, takes in a single source histogram &
-///        reference histogram and returns the color map used for histogram matching.
-///
-template <typename SrcKeyType, typename RefKeyType>
-auto histogram_matching(histogram<SrcKeyType> const& src_hist, histogram<RefKeyType> const& ref_hist)
-    -> std::map<SrcKeyType, SrcKeyType>
-{
-    histogram<SrcKeyType> dst_hist;
-    return histogram_matching(src_hist, ref_hist, dst_hist);
-}
+namespace detail {
 
-/// \overload histogram_matching
 /// \ingroup HM
-/// \tparam SrcKeyType Key Type of input histogram
-/// \tparam RefKeyType Key Type of reference histogram
-/// \tparam DstKeyType Key Type of output histogram
-/// @param src_hist INPUT source histogram
-/// @param ref_hist INPUT reference histogram
-/// @param dst_hist OUTPUT Output histogram
-/// \brief Overload for histogram matching algorithm, takes in source histogram, reference
-///        histogram & destination histogram and returns the color map used for histogram
-///        matching as well as transforming the destination histogram.
+/// \brief Computes the matching color map of the source histogram and transforms the
+///        destination histogram, for any histogram type over integral keys.
 ///
-template <typename SrcKeyType, typename RefKeyType, typename DstKeyType>
-auto histogram_matching(
-    histogram<SrcKeyType> const& src_hist,
-    histogram<RefKeyType> const& ref_hist,
-    histogram<DstKeyType>& dst_hist)
+template <
+    typename SrcKeyType, typename RefKeyType, typename DstKeyType,
+    typename SrcHist, typename RefHist, typename DstHist>
+auto histogram_matching_impl(SrcHist const& src_hist, RefHist const& ref_hist, DstHist& dst_hist)
     -> std::map<SrcKeyType, DstKeyType>
 {
     static_assert(
@@ -75,7 +56,7 @@ auto histogram_matching(
         std::is_integral<DstKeyType>::value,
         "Source, Reference or Destination histogram type is not appropriate.");
 
-    using value_t = typename histogram<SrcKeyType>::value_type;
+    using value_t = typename SrcHist::value_type;
     dst_hist.clear();
     double src_sum      = src_hist.sum();
     double ref_sum      = ref_hist.sum();
@@ -83,34 +64,35 @@ auto histogram_matching(
     auto cumltv_refhist = cumulative_histogram(ref_hist);
     std::map<SrcKeyType, RefKeyType> inverse_mapping;
 
-    std::vector<typename histogram<RefKeyType>::key_type> src_keys, ref_keys;
+    std::vector<typename RefHist::key_type> src_keys, ref_keys;
     src_keys             = src_hist.sorted_keys();
     ref_keys             = ref_hist.sorted_keys();
-    std::ptrdiff_t start = ref_keys.size() - 1;
-    RefKeyType ref_max;
+    std::ptrdiff_t const ref_size = static_cast<std::ptrdiff_t>(ref_keys.size());
+    std::ptrdiff_t start = ref_size - 1;
+    RefKeyType ref_max = RefKeyType(0);
     if (start >= 0)
         ref_max = std::get<0>(ref_keys[start]);
 
-    for (std::ptrdiff_t j = src_keys.size() - 1; j >= 0; --j)
+    // Without reference values every source value maps to zero
+    for (std::ptrdiff_t j = static_cast<std::ptrdiff_t>(src_keys.size()) - 1;
+         j >= 0 && ref_size > 0; --j)
     {
         double src_val = (cumltv_srchist[src_keys[j]] * ref_sum) / src_sum;
         while (cumltv_refhist[ref_keys[start]] > src_val && start > 0)
         {
             start--;
         }
+        RefKeyType const next =
+            start + 1 < ref_size ? std::get<0>(ref_keys[start + 1]) : ref_max;
         if (std::abs(cumltv_refhist[ref_keys[start]] - src_val) >
-            std::abs(cumltv_refhist(std::min<RefKeyType>(ref_max, std::get<0>(ref_keys[start + 1]))) -
-                src_val))
+            std::abs(cumltv_refhist(next) - src_val))
         {
-            inverse_mapping[std::get<0>(src_keys[j])] =
-                std::min<RefKeyType>(ref_max, std::get<0>(ref_keys[start + 1]));
+            inverse_mapping[std::get<0>(src_keys[j])] = next;
         }
         else
         {
             inverse_mapping[std::get<0>(src_keys[j])] = std::get<0>(ref_keys[start]);
         }
-        if (j == 0)
-            break;
     }
     std::for_each(src_hist.begin(), src_hist.end(), [&](value_t const& v) {
         dst_hist[inverse_mapping[std::get<0>(v.first)]] += v.second;
@@ -118,8 +100,239 @@ auto histogram_matching(
     return inverse_mapping;
 }
 
+
+/// \ingroup HM
+/// \brief Computes the matching color map of each channel of the source view, collecting
+///        the channel histograms in the given histogram types.
+///
+template
+<
+    typename SrcHist, typename RefHist,
+    typename ExecutionPolicy, typename SrcView, typename ReferenceView, typename Visit
+>
+void histogram_matching_maps(
+    ExecutionPolicy const& policy,
+    SrcView const& src_view,
+    ReferenceView const& ref_view,
+    std::size_t bin_width,
+    bool mask,
+    std::vector<std::vector<bool>> const& src_mask,
+    std::vector<std::vector<bool>> const& ref_mask,
+    Visit visit)
+{
+    using source_channel_t = typename channel_type<SrcView>::type;
+    using ref_channel_t    = typename channel_type<ReferenceView>::type;
+
+    std::size_t const channels     = num_channels<SrcView>::value;
+    source_channel_t src_pixel_min = (std::numeric_limits<source_channel_t>::min)();
+    source_channel_t src_pixel_max = (std::numeric_limits<source_channel_t>::max)();
+    ref_channel_t ref_pixel_min    = (std::numeric_limits<ref_channel_t>::min)();
+    ref_channel_t ref_pixel_max    = (std::numeric_limits<ref_channel_t>::max)();
+
+    for (std::size_t i = 0; i < channels; i++)
+    {
+        SrcHist src_histogram;
+        RefHist ref_histogram;
+        fill_histogram(
+            policy, nth_channel_view(src_view, i), src_histogram, bin_width, false, false, mask,
+            src_mask, std::tuple<source_channel_t>(src_pixel_min),
+            std::tuple<source_channel_t>(src_pixel_max), true);
+        fill_histogram(
+            policy, nth_channel_view(ref_view, i), ref_histogram, bin_width, false, false, mask,
+            ref_mask, std::tuple<ref_channel_t>(ref_pixel_min),
+            std::tuple<ref_channel_t>(ref_pixel_max), true);
+        SrcHist dst_histogram;
+        visit(i, histogram_matching_impl<source_channel_t, ref_channel_t, source_channel_t>(
+            src_histogram, ref_histogram, dst_histogram));
+    }
+}
+
+/// \ingroup HM
+/// \brief Matches each channel of the source view to the reference view, collecting the
+///        channel histograms in the given histogram types.
+///
+template
+<
+    typename SrcHist, typename RefHist,
+    typename ExecutionPolicy, typename SrcView, typename ReferenceView, typename DstView
+>
+void histogram_matching_channels(
+    ExecutionPolicy const& policy,
+    SrcView const& src_view,
+    ReferenceView const& ref_view,
+    DstView const& dst_view,
+    std::size_t bin_width,
+    bool mask,
+    std::vector<std::vector<bool>> const& src_mask,
+    std::vector<std::vector<bool>> const& ref_mask,
+    std::false_type /* lookup tables */)
+{
+    using dst_channel_t    = typename channel_type<DstView>::type;
+    using coord_t          = typename SrcView::x_coord_t;
+
+    coord_t const width            = src_view.width();
+    coord_t const height           = src_view.height();
+
+    histogram_matching_maps<SrcHist, RefHist>(
+        policy, src_view, ref_view, bin_width, mask, src_mask, ref_mask,
+        [&](std::size_t i, auto inverse_mapping) {
+            for (std::ptrdiff_t src_y = 0; src_y < height; ++src_y)
+            {
+                auto src_it = nth_channel_view(src_view, i).row_begin(src_y);
+                auto dst_it = nth_channel_view(dst_view, i).row_begin(src_y);
+                for (std::ptrdiff_t src_x = 0; src_x < width; ++src_x)
+                {
+                    if (mask && !src_mask[src_y][src_x])
+                        dst_it[src_x][0] = src_it[src_x][0];
+                    else
+                        dst_it[src_x][0] =
+                            static_cast<dst_channel_t>(inverse_mapping[src_it[src_x][0]]);
+                }
+            }
+        });
+}
+
+/// \ingroup HM
+/// \brief Matches each channel of a source view of integral channels of at most 16 bits,
+///        turning the color map of each channel into a lookup table applied to whole rows.
+///
+template
+<
+    typename SrcHist, typename RefHist,
+    typename ExecutionPolicy, typename SrcView, typename ReferenceView, typename DstView
+>
+void histogram_matching_channels(
+    ExecutionPolicy const& policy,
+    SrcView const& src_view,
+    ReferenceView const& ref_view,
+    DstView const& dst_view,
+    std::size_t bin_width,
+    bool mask,
+    std::vector<std::vector<bool>> const& src_mask,
+    std::vector<std::vector<bool>> const& ref_mask,
+    std::true_type /* lookup tables */)
+{
+    using source_channel_t = typename channel_type<SrcView>::type;
+    using dst_channel_t    = typename channel_type<DstView>::type;
+    using dst_value_t      = typename base_channel_type<dst_channel_t>::type;
+    std::size_t const channels = num_channels<SrcView>::value;
+
+    // Values absent from a color map map to zero, as its operator[] gives
+    std::size_t const extent = lut_extent<source_channel_t>::value;
+    std::vector<dst_value_t> tables(channels * extent,
+        static_cast<dst_value_t>(static_cast<dst_channel_t>(source_channel_t(0))));
+    std::array<dst_value_t const*, num_channels<SrcView>::value> table_rows;
+    histogram_matching_maps<SrcHist, RefHist>(
+        policy, src_view, ref_view, bin_width, mask, src_mask, ref_mask,
+        [&](std::size_t i, std::map<source_channel_t, source_channel_t> const& inverse_mapping) {
+            dst_value_t* table = tables.data() + i * extent;
+            for (auto const& v : inverse_mapping)
+            {
+                table[lut_index(v.first)] =
+                    static_cast<dst_value_t>(static_cast<dst_channel_t>(v.second));
+            }
+            table_rows[i] = table;
+        });
+
+    if (!mask)
+    {
+        apply_channel_luts(policy, src_view, dst_view, table_rows);
+        return;
+    }
+
+    for_each_row_band(policy, src_view.height(), [&](std::ptrdiff_t y0, std::ptrdiff_t y1)
+    {
+        for (std::ptrdiff_t y = y0; y < y1; ++y)
+        {
+            auto src_it = src_view.row_begin(y);
+            auto dst_it = dst_view.row_begin(y);
+            for (std::ptrdiff_t x = 0; x < src_view.width(); ++x)
+            {
+                bool const inside = src_mask[y][x];
+                for (std::size_t c = 0; c < channels; ++c)
+                {
+                    source_channel_t const value = dynamic_at_c(src_it[x], c);
+                    dynamic_at_c(dst_it[x], c) = inside
+                        ? dst_channel_t(table_rows[c][lut_index(value)])
+                        : dst_channel_t(value);
+                }
+            }
+        }
+    });
+}
+
+} // namespace detail
+
+/// \fn histogram_matching
+/// \ingroup HM
+/// \tparam SrcKeyType Key Type of input histogram
+/// @param src_hist INPUT Input source histogram
+/// @param ref_hist INPUT Input reference histogram
+/// \brief Overload for histogram matching algorithm, takes in a single source histogram &
+///        reference histogram and returns the color map used for histogram matching.
+///
+template <typename SrcKeyType, typename RefKeyType>
+auto histogram_matching(histogram<SrcKeyType> const& src_hist, histogram<RefKeyType> const& ref_hist)
+    -> std::map<SrcKeyType, SrcKeyType>
+{
+    histogram<SrcKeyType> dst_hist;
+    return histogram_matching(src_hist, ref_hist, dst_hist);
+}
+
+/// \overload histogram_matching
+/// \ingroup HM
+/// \tparam SrcKeyType Key Type of input histogram
+/// \tparam RefKeyType Key Type of reference histogram
+/// \tparam DstKeyType Key Type of output histogram
+/// @param src_hist INPUT source histogram
+/// @param ref_hist INPUT reference histogram
+/// @param dst_hist OUTPUT Output histogram
+/// \brief Overload for histogram matching algorithm, takes in source histogram, reference
+///        histogram & destination histogram and returns the color map used for histogram
+///        matching as well as transforming the destination histogram.
+///
+template <typename SrcKeyType, typename RefKeyType, typename DstKeyType>
+auto histogram_matching(
+    histogram<SrcKeyType> const& src_hist,
+    histogram<RefKeyType> const& ref_hist,
+    histogram<DstKeyType>& dst_hist)
+    -> std::map<SrcKeyType, DstKeyType>
+{
+    return detail::histogram_matching_impl<SrcKeyType, RefKeyType, DstKeyType>(
+        src_hist, ref_hist, dst_hist);
+}
+
+/// \overload histogram_matching
+/// \ingroup HM
+/// \brief Overload for histogram matching algorithm on dense histograms
+///
+template <typename SrcKeyType, typename RefKeyType>
+auto histogram_matching(
+    dense_histogram<SrcKeyType> const& src_hist, dense_histogram<RefKeyType> const& ref_hist)
+    -> std::map<SrcKeyType, SrcKeyType>
+{
+    dense_histogram<SrcKeyType> dst_hist;
+    return histogram_matching(src_hist, ref_hist, dst_hist);
+}
+
+/// \overload histogram_matching
+/// \ingroup HM
+/// \brief Overload for histogram matching algorithm on dense histograms
+///
+template <typename SrcKeyType, typename RefKeyType, typename DstKeyType>
+auto histogram_matching(
+    dense_histogram<SrcKeyType> const& src_hist,
+    dense_histogram<RefKeyType> const& ref_hist,
+    dense_histogram<DstKeyType>& dst_hist)
+    -> std::map<SrcKeyType, DstKeyType>
+{
+    return detail::histogram_matching_impl<SrcKeyType, RefKeyType, DstKeyType>(
+        src_hist, ref_hist, dst_hist);
+}
+
 /// \overload histogram_matching
 /// \ingroup HM
+/// @param policy    INPUT Execution policy filling the histograms and mapping bands of rows
 /// @param src_view  INPUT source image view
 /// @param ref_view  INPUT Reference image view
 /// @param dst_view  OUTPUT Output image view
@@ -129,10 +342,21 @@ auto histogram_matching(
 /// @param ref_mask  INPUT Mask vector over reference image
 /// \brief Overload for histogram matching algorithm, takes in both source, reference &
 ///        destination image views and histogram matches the input image using the
-///        reference image.
+///        reference image according to an execution policy.
 ///
-template <typename SrcView, typename ReferenceView, typename DstView>
+///        Integral source channels of at most 16 bits are mapped through one lookup table
+///        per channel, see apply_lut.
+///
+template
+<
+    typename ExecutionPolicy,
+    typename SrcView,
+    typename ReferenceView,
+    typename DstView,
+    typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+>
 void histogram_matching(
+    ExecutionPolicy const& policy,
     SrcView const& src_view,
     ReferenceView const& ref_view,
     DstView const& dst_view,
@@ -157,47 +381,52 @@ void histogram_matching(
             typename color_space_type<DstView>::type>::value,
         "Source and destination view must have same color space");
 
-    // Defining channel type
     using source_channel_t = typename channel_type<SrcView>::type;
     using ref_channel_t    = typename channel_type<ReferenceView>::type;
-    using dst_channel_t    = typename channel_type<DstView>::type;
-    using coord_t          = typename SrcView::x_coord_t;
+    using use_lut_t        = detail::is_lut_index_channel<source_channel_t>;
 
-    std::size_t const channels     = num_channels<SrcView>::value;
-    coord_t const width            = src_view.width();
-    coord_t const height           = src_view.height();
-    source_channel_t src_pixel_min = (std::numeric_limits<source_channel_t>::min)();
-    source_channel_t src_pixel_max = (std::numeric_limits<source_channel_t>::max)();
-    ref_channel_t ref_pixel_min    = (std::numeric_limits<ref_channel_t>::min)();
-    ref_channel_t ref_pixel_max    = (std::numeric_limits<ref_channel_t>::max)();
-
-    for (std::size_t i = 0; i < channels; i++)
+    if (bin_width == 1)
     {
-        histogram<source_channel_t> src_histogram;
-        histogram<ref_channel_t> ref_histogram;
-        fill_histogram(
-            nth_channel_view(src_view, i), src_histogram, bin_width, false, false, mask, src_mask,
-            std::tuple<source_channel_t>(src_pixel_min),
-            std::tuple<source_channel_t>(src_pixel_max), true);
-        fill_histogram(
-            nth_channel_view(ref_view, i), ref_histogram, bin_width, false, false, mask, ref_mask,
-            std::tuple<ref_channel_t>(ref_pixel_min), std::tuple<ref_channel_t>(ref_pixel_max),
-            true);
-        auto inverse_mapping = histogram_matching(src_histogram, ref_histogram);
-        for (std::ptrdiff_t src_y = 0; src_y < height; ++src_y)
-        {
-            auto src_it = nth_channel_view(src_view, i).row_begin(src_y);
-            auto dst_it = nth_channel_view(dst_view, i).row_begin(src_y);
-            for (std::ptrdiff_t src_x = 0; src_x < width; ++src_x)
-            {
-                if (mask && !src_mask[src_y][src_x])
-                    dst_it[src_x][0] = src_it[src_x][0];
-                else
-                    dst_it[src_x][0] =
-                        static_cast<dst_channel_t>(inverse_mapping[src_it[src_x][0]]);
-            }
-        }
+        detail::histogram_matching_channels
+        <
+            detail::fast_histogram<source_channel_t>, detail::fast_histogram<ref_channel_t>
+        >(policy, src_view, ref_view, dst_view, bin_width, mask, src_mask, ref_mask, use_lut_t());
     }
+    else
+    {
+        detail::histogram_matching_channels
+        <
+            histogram<source_channel_t>, histogram<ref_channel_t>
+        >(policy, src_view, ref_view, dst_view, bin_width, mask, src_mask, ref_mask, use_lut_t());
+    }
+}
+
+/// \overload histogram_matching
+/// \ingroup HM
+/// @param src_view  INPUT source image view
+/// @param ref_view  INPUT Reference image view
+/// @param dst_view  OUTPUT Output image view
+/// @param bin_width INPUT Histogram bin width
+/// @param mask      INPUT Specify is mask is to be used
+/// @param src_mask  INPUT Mask vector over input image
+/// @param ref_mask  INPUT Mask vector over reference image
+/// \brief Overload for histogram matching algorithm, takes in both source, reference &
+///        destination image views and histogram matches the input image using the
+///        reference image.
+///
+template <typename SrcView, typename ReferenceView, typename DstView>
+void histogram_matching(
+    SrcView const& src_view,
+    ReferenceView const& ref_view,
+    DstView const& dst_view,
+    std::size_t bin_width = 1,
+    bool mask = false,
+    std::vector<std::vector<bool>> src_mask = {},
+    std::vector<std::vector<bool>> ref_mask = {})
+{
+    histogram_matching(
+        execution::seq, src_view, ref_view, dst_view, bin_width, mask, std::move(src_mask),
+        std::move(ref_mask));
 }
 
 }}  //namespace boost::gil
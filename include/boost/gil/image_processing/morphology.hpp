@@ -12,6 +12,15 @@
 #include <boost/gil/image_processing/kernel.hpp>
 #include <boost/gil/gray.hpp>
 #include <boost/gil/image_processing/threshold.hpp>
+#include <boost/gil/point.hpp>
+#include <boost/gil/detail/binary_morphology.hpp>
+#include <boost/gil/detail/byte_rows.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
 
 namespace boost { namespace gil { namespace detail {
 
@@ -24,10 +33,260 @@ enum class morphological_operation
 /// \addtogroup ImageProcessing
 /// @{
 
+/// \brief Selects the larger of two values, for dilation
+struct morph_max
+{
+    template <typename T>
+    auto operator()(T a, T b) const -> T { return (std::max)(a, b); }
+};
+
+/// \brief Selects the smaller of two values, for erosion
+struct morph_min
+{
+    template <typename T>
+    auto operator()(T a, T b) const -> T { return (std::min)(a, b); }
+};
+
+/// \brief Pixels covered by a structuring element, as offsets from the pixel under
+/// consideration
+struct morph_element
+{
+    /// Offsets of the covered pixels, the first one being the pixel itself
+    std::vector<point<std::ptrdiff_t>> offsets;
+    /// Smallest coordinates of the offsets
+    point<std::ptrdiff_t> low;
+    /// Largest coordinates of the offsets
+    point<std::ptrdiff_t> high;
+    /// Whether the offsets are all those between low and high
+    bool rectangle = false;
+};
+
+/// \brief Finds the pixels covered by a kernel.
+///
+/// Element (x, y) of the kernel, at column x and row y, covers the pixel at offset
+/// (center_x - x, center_y - y), so the kernel is flipped. The pixel under consideration is
+/// always covered.
+template <typename Kernel>
+auto morph_structuring_element(Kernel const& kernel) -> morph_element
+{
+    std::ptrdiff_t const center_x = static_cast<std::ptrdiff_t>(kernel.center_x());
+    std::ptrdiff_t const center_y = static_cast<std::ptrdiff_t>(kernel.center_y());
+    morph_element element;
+    element.offsets.emplace_back(0, 0);
+    for (std::size_t y = 0; y < kernel.size(); ++y)
+    {
+        for (std::size_t x = 0; x < kernel.size(); ++x)
+        {
+            point<std::ptrdiff_t> const offset(
+                center_x - static_cast<std::ptrdiff_t>(x),
+                center_y - static_cast<std::ptrdiff_t>(y));
+            // non-zero elements, possibly negative, without comparing floats for equality
+            bool const covers = kernel.at(x, y) < 0 || kernel.at(x, y) > 0;
+            if (covers && offset != point<std::ptrdiff_t>(0, 0))
+                element.offsets.push_back(offset);
+        }
+    }
+
+    element.low = point<std::ptrdiff_t>(0, 0);
+    element.high = point<std::ptrdiff_t>(0, 0);
+    for (auto const& offset : element.offsets)
+    {
+        element.low = point<std::ptrdiff_t>(
+            (std::min)(element.low.x, offset.x), (std::min)(element.low.y, offset.y));
+        element.high = point<std::ptrdiff_t>(
+            (std::max)(element.high.x, offset.x), (std::max)(element.high.y, offset.y));
+    }
+    // The offsets are distinct, so they cover their bounds if there are as many
+    element.rectangle = static_cast<std::ptrdiff_t>(element.offsets.size()) ==
+        (element.high.x - element.low.x + 1) * (element.high.y - element.low.y + 1);
+    return element;
+}
+
+/// \brief Computes the maximum or minimum of every window of \p length consecutive positions,
+/// with about 3 comparisons per position whatever the length, as in M. van Herk, "A fast
+/// algorithm for local minimum and maximum filters on rectangular and octagonal kernels", 1992,
+/// and J. Gil, M. Werman, "Computing 2-D min, median, and max filters", 1993.
+///
+/// Each position holds \p lanes values, processed independently, so that the windows of many
+/// columns are computed at once. The positions are split into blocks of \p length, of which
+/// \p prefix holds the running selection from the start of the block and \p suffix the one to its
+/// end; a window then spans at most two blocks and is the selection of a suffix and a prefix.
+/// \param in - Values of \p count + \p length - 1 positions.
+/// \param out - Values of the windows starting at the first \p count positions.
+/// \param prefix - Buffer as large as \p in.
+/// \param suffix - Buffer as large as \p in.
+template <typename T, typename Select>
+void van_herk_gil_werman(
+    T const* in,
+    T* out,
+    std::ptrdiff_t count,
+    std::ptrdiff_t length,
+    std::ptrdiff_t lanes,
+    T* prefix,
+    T* suffix,
+    Select select)
+{
+    std::ptrdiff_t const positions = count + length - 1;
+    for (std::ptrdiff_t first = 0; first < positions; first += length)
+    {
+        std::ptrdiff_t const last = (std::min)(first + length, positions) - 1;
+        std::copy(in + first * lanes, in + (first + 1) * lanes, prefix + first * lanes);
+        for (std::ptrdiff_t i = first + 1; i <= last; ++i)
+        {
+            for (std::ptrdiff_t k = 0; k < lanes; ++k)
+                prefix[i * lanes + k] = select(prefix[(i - 1) * lanes + k], in[i * lanes + k]);
+        }
+        std::copy(in + last * lanes, in + (last + 1) * lanes, suffix + last * lanes);
+        for (std::ptrdiff_t i = last - 1; i >= first; --i)
+        {
+            for (std::ptrdiff_t k = 0; k < lanes; ++k)
+                suffix[i * lanes + k] = select(suffix[(i + 1) * lanes + k], in[i * lanes + k]);
+        }
+    }
+    T const* ends = prefix + (length - 1) * lanes;
+    for (std::ptrdiff_t i = 0; i < count * lanes; ++i)
+        out[i] = select(suffix[i], ends[i]);
+}
+
+/// \brief Applies a morphological operation with a rectangular structuring element, as a pass
+/// along the rows followed by a pass along the columns.
+///
+/// The window of pixel (x, y) covers columns x - \p left to x + \p right and rows y - \p top to
+/// y + \p bottom, all non-negative. Windows are clipped to the view, which amounts to extending
+/// the view by repeating its sides since the clipped window still holds the pixel itself.
+template <typename SrcView, typename DstView, typename Select>
+void morph_rectangle(
+    SrcView const& src_view,
+    DstView const& dst_view,
+    std::ptrdiff_t left,
+    std::ptrdiff_t right,
+    std::ptrdiff_t top,
+    std::ptrdiff_t bottom,
+    Select select)
+{
+    using value_t = typename base_channel_type<typename channel_type<SrcView>::type>::type;
+    using dst_channel_t = typename channel_type<DstView>::type;
+    using dst_value_t = typename base_channel_type<dst_channel_t>::type;
+
+    std::ptrdiff_t const width = src_view.width();
+    std::ptrdiff_t const height = src_view.height();
+    if (width == 0 || height == 0)
+        return;
+
+    // Windows along the rows
+    std::ptrdiff_t const columns = left + right + 1;
+    std::vector<value_t> rows(static_cast<std::size_t>(width * height));
+    std::vector<value_t> in(static_cast<std::size_t>(width + columns - 1));
+    std::vector<value_t> prefix(in.size());
+    std::vector<value_t> suffix(in.size());
+    for (std::ptrdiff_t y = 0; y < height; ++y)
+    {
+        auto const src_it = src_view.row_begin(y);
+        for (std::ptrdiff_t x = 0; x < width; ++x)
+            in[static_cast<std::size_t>(left + x)] = static_cast<value_t>(src_it[x][0]);
+        value_t const first = in[static_cast<std::size_t>(left)];
+        value_t const last = in[static_cast<std::size_t>(left + width - 1)];
+        std::fill_n(in.begin(), left, first);
+        std::fill_n(in.begin() + left + width, right, last);
+        van_herk_gil_werman(
+            in.data(), rows.data() + y * width, width, columns, 1, prefix.data(), suffix.data(),
+            select);
+    }
+
+    // Windows along the columns, in strips of adjacent columns processed together
+    std::ptrdiff_t const strip_width = (std::min)(width, std::ptrdiff_t(256));
+    std::ptrdiff_t const lines = top + bottom + 1;
+    std::size_t const strip_size = static_cast<std::size_t>((height + lines - 1) * strip_width);
+    in.resize(strip_size);
+    prefix.resize(strip_size);
+    suffix.resize(strip_size);
+    std::vector<value_t> out(static_cast<std::size_t>(height * strip_width));
+    for (std::ptrdiff_t x0 = 0; x0 < width; x0 += strip_width)
+    {
+        std::ptrdiff_t const lanes = (std::min)(strip_width, width - x0);
+        for (std::ptrdiff_t i = 0; i < height + lines - 1; ++i)
+        {
+            std::ptrdiff_t const y = (std::min)((std::max)(i - top, std::ptrdiff_t(0)), height - 1);
+            value_t const* row = rows.data() + y * width + x0;
+            std::copy(row, row + lanes, in.begin() + i * lanes);
+        }
+        van_herk_gil_werman(
+            in.data(), out.data(), height, lines, lanes, prefix.data(), suffix.data(), select);
+        for (std::ptrdiff_t y = 0; y < height; ++y)
+        {
+            auto const dst_it = dst_view.row_begin(y) + x0;
+            for (std::ptrdiff_t x = 0; x < lanes; ++x)
+            {
+                dst_it[x] = typename DstView::value_type(
+                    dst_channel_t(static_cast<dst_value_t>(out[static_cast<std::size_t>(
+                        y * lanes + x)])));
+            }
+        }
+    }
+}
+
+/// \brief Applies a morphological operation with any structuring element, selecting among the
+/// covered pixels, and checking for the sides of the view only near them.
+template <typename SrcView, typename DstView, typename Select>
+void morph_offsets(
+    SrcView const& src_view, DstView const& dst_view, morph_element const& element, Select select)
+{
+    using value_t = typename base_channel_type<typename channel_type<SrcView>::type>::type;
+    using dst_channel_t = typename channel_type<DstView>::type;
+    using dst_value_t = typename base_channel_type<dst_channel_t>::type;
+    using cached_location_t = typename SrcView::xy_locator::cached_location_t;
+
+    auto const& offsets = element.offsets;
+    point<std::ptrdiff_t> const low = element.low;
+    point<std::ptrdiff_t> const high = element.high;
+
+    auto const src_loc = src_view.xy_at(0, 0);
+    std::vector<cached_location_t> cached;
+    for (auto const& offset : offsets)
+        cached.push_back(src_loc.cache_location(offset.x, offset.y));
+
+    for (std::ptrdiff_t y = 0; y < src_view.height(); ++y)
+    {
+        bool const inner_row = y + low.y >= 0 && y + high.y < src_view.height();
+        auto loc = src_view.xy_at(0, y);
+        auto dst_it = dst_view.row_begin(y);
+        for (std::ptrdiff_t x = 0; x < src_view.width(); ++x, ++loc.x(), ++dst_it)
+        {
+            value_t result = static_cast<value_t>((*loc)[0]);
+            if (inner_row && x + low.x >= 0 && x + high.x < src_view.width())
+            {
+                for (auto const& location : cached)
+                    result = select(result, static_cast<value_t>(loc[location][0]));
+            }
+            else
+            {
+                for (auto const& offset : offsets)
+                {
+                    // Pixels outside the view are ignored
+                    std::ptrdiff_t const column = x + offset.x;
+                    std::ptrdiff_t const row = y + offset.y;
+                    if (row >= 0 && row < src_view.height() &&
+                        column >= 0 && column < src_view.width())
+                    {
+                        result = select(result, static_cast<value_t>(src_view(column, row)[0]));
+                    }
+                }
+            }
+            *dst_it = typename DstView::value_type(
+                dst_channel_t(static_cast<dst_value_t>(result)));
+        }
+    }
+}
+
 /// \brief Implements morphological operations at pixel level.This function
 /// compares neighbouring pixel values according to the kernel and choose
 /// minimum/mamximum neighbouring pixel value and assigns it to the pixel under
 /// consideration.
+///
+/// The kernel is flipped, see morph_structuring_element. Pixels outside the view are ignored.
+/// Kernels whose non-zero elements form a rectangle or a line holding the center, such as
+/// the usual square structuring elements, are applied with separable passes whose cost does not
+/// depend on the size of the kernel.
 /// \param src_view - Source/Input image view.
 /// \param dst_view - View which stores the final result of operations performed by this function.
 /// \param kernel - Kernel matrix/structuring element containing 0's and 1's
@@ -40,51 +299,57 @@ template <typename SrcView, typename DstView, typename Kernel>
 void morph_impl(SrcView const& src_view, DstView const& dst_view, Kernel const& kernel,
                 morphological_operation identifier)
 {
-    std::ptrdiff_t flip_ker_row, flip_ker_col, row_boundary, col_boundary;
-    typename channel_type<typename SrcView::value_type>::type target_element;
-    for (std::ptrdiff_t view_row = 0; view_row < src_view.height(); ++view_row)
-    {
-        for (std::ptrdiff_t view_col = 0; view_col < src_view.width(); ++view_col)
-        {
-            target_element = src_view(view_col, view_row);
-            for (std::size_t kernel_row = 0; kernel_row < kernel.size(); ++kernel_row)
-            {
-                flip_ker_row = kernel.size() - 1 - kernel_row; // row index of flipped kernel
+    auto const element = morph_structuring_element(kernel);
+    point<std::ptrdiff_t> const& low = element.low;
+    point<std::ptrdiff_t> const& high = element.high;
+    if (element.rectangle && identifier == morphological_operation::dilation)
+        morph_rectangle(src_view, dst_view, -low.x, high.x, -low.y, high.y, morph_max{});
+    else if (element.rectangle)
+        morph_rectangle(src_view, dst_view, -low.x, high.x, -low.y, high.y, morph_min{});
+    else if (identifier == morphological_operation::dilation)
+        morph_offsets(src_view, dst_view, element, morph_max{});
+    else
+        morph_offsets(src_view, dst_view, element, morph_min{});
+}
 
-                for (std::size_t kernel_col = 0; kernel_col < kernel.size(); ++kernel_col)
-                {
-                    flip_ker_col = kernel.size() - 1 - kernel_col; // column index of flipped kernel
+/// \brief Applies a morphological operation to a mask of one bit per pixel, 64 pixels at a
+/// time. Erosion is computed as the dilation of the inverted mask, so that pixels outside the
+/// mask are ignored by both operations.
+template <typename SrcView, typename DstView, typename Kernel>
+void morph_binary(SrcView const& src_view, DstView const& dst_view, Kernel const& kernel,
+                  morphological_operation identifier)
+{
+    std::ptrdiff_t const width = src_view.width();
+    std::ptrdiff_t const height = src_view.height();
+    if (width == 0 || height == 0)
+        return;
 
-                    // We ensure that we consider only those pixels which are overlapped
-                    // on a non-zero kernel_element as
-                    if (kernel.at(flip_ker_row, flip_ker_col) == 0)
-                    {
-                        continue;
-                    }
-                    // index of input signal, used for checking boundary
-                    row_boundary = view_row + (kernel.center_y() - flip_ker_row);
-                    col_boundary = view_col + (kernel.center_x() - flip_ker_col);
+    bool const invert = identifier == morphological_operation::erosion;
+    std::ptrdiff_t const words = bit_row_words(width);
+    std::vector<std::uint64_t> rows(static_cast<std::size_t>(words * height));
+    for (std::ptrdiff_t y = 0; y < height; ++y)
+    {
+        auto const range = src_view.row_begin(y).bit_range();
+        load_bit_row(range.current_byte(), range.bit_offset(), width, rows.data() + y * words,
+            invert);
+    }
 
-                    // ignore input samples which are out of bound
-                    if (row_boundary >= 0 && row_boundary < src_view.height() &&
-                        col_boundary >= 0 && col_boundary < src_view.width())
-                    {
+    auto const element = morph_structuring_element(kernel);
+    if (element.rectangle)
+    {
+        binary_dilate_rectangle(rows, width, height, -element.low.x, element.high.x,
+            -element.low.y, element.high.y);
+    }
+    else
+    {
+        binary_dilate_offsets(rows, width, height, element.offsets);
+    }
 
-                        if (identifier == morphological_operation::dilation)
-                        {
-                            target_element =
-                                (std::max)(src_view(col_boundary, row_boundary)[0], target_element);
-                        }
-                        else if (identifier == morphological_operation::erosion)
-                        {
-                            target_element =
-                                (std::min)(src_view(col_boundary, row_boundary)[0], target_element);
-                        }
-                    }
-                }
-            }
-            dst_view(view_col, view_row) = target_element;
-        }
+    for (std::ptrdiff_t y = 0; y < height; ++y)
+    {
+        auto const range = dst_view.row_begin(y).bit_range();
+        store_bit_row(rows.data() + y * words, range.current_byte(), range.bit_offset(), width,
+            invert);
     }
 }
 
@@ -110,6 +375,15 @@ void morph(SrcView const& src_view, DstView const& dst_view, Kernel const& ker_m
     gil_function_requires<ColorSpacesCompatibleConcept<typename color_space_type<SrcView>::type,
                                                        typename color_space_type<DstView>::type>>();
 
+    using is_binary_t = std::integral_constant<bool,
+        is_binary_mask_view<SrcView>::value && is_binary_mask_view<DstView>::value>;
+    morph(src_view, dst_view, ker_mat, identifier, is_binary_t());
+}
+
+template <typename SrcView, typename DstView, typename Kernel>
+void morph(SrcView const& src_view, DstView const& dst_view, Kernel const& ker_mat,
+           morphological_operation identifier, std::false_type)
+{
     gil::image<typename DstView::value_type> intermediate_img(src_view.dimensions());
 
     for (std::size_t i = 0; i < src_view.num_channels(); i++)
@@ -120,6 +394,50 @@ void morph(SrcView const& src_view, DstView const& dst_view, Kernel const& ker_m
     copy_pixels(view(intermediate_img), dst_view);
 }
 
+/// \brief Applies the operation to masks of one bit per pixel without unpacking them
+template <typename SrcView, typename DstView, typename Kernel>
+void morph(SrcView const& src_view, DstView const& dst_view, Kernel const& ker_mat,
+           morphological_operation identifier, std::true_type)
+{
+    morph_binary(src_view, dst_view, ker_mat, identifier);
+}
+
+/// \brief Applies a morphological operation the given number of times, to a copy of the source
+/// view in the destination view.
+template <typename SrcView, typename DstView, typename Kernel>
+void morph_iterations(SrcView const& src_view, DstView const& dst_view, Kernel const& ker_mat,
+                      morphological_operation identifier, int iterations, std::false_type)
+{
+    copy_pixels(src_view, dst_view);
+    for (int i = 0; i < iterations; ++i)
+        morph(dst_view, dst_view, ker_mat, identifier);
+}
+
+/// \brief Applies the operation to masks of one bit per pixel, reading the first iteration from
+/// the source rather than copying it bit by bit
+template <typename SrcView, typename DstView, typename Kernel>
+void morph_iterations(SrcView const& src_view, DstView const& dst_view, Kernel const& ker_mat,
+                      morphological_operation identifier, int iterations, std::true_type)
+{
+    if (iterations <= 0)
+    {
+        copy_pixels(src_view, dst_view);
+        return;
+    }
+    morph(src_view, dst_view, ker_mat, identifier);
+    for (int i = 1; i < iterations; ++i)
+        morph(dst_view, dst_view, ker_mat, identifier);
+}
+
+template <typename SrcView, typename DstView, typename Kernel>
+void morph_iterations(SrcView const& src_view, DstView const& dst_view, Kernel const& ker_mat,
+                      morphological_operation identifier, int iterations)
+{
+    using is_binary_t = std::integral_constant<bool,
+        is_binary_mask_view<SrcView>::value && is_binary_mask_view<DstView>::value>;
+    morph_iterations(src_view, dst_view, ker_mat, identifier, iterations, is_binary_t());
+}
+
 /// \brief Calculates the difference between pixel values of first image_view
 /// and second image_view.
 /// \param src_view1 - First parameter for subtraction of views.
@@ -170,6 +488,10 @@ void difference(SrcView const& src_view1, SrcView const& src_view2, DiffView con
 /// applying dilation.
 /// \param iterations - Specifies the number of times dilation is to be applied on the input image
 /// view.
+///
+/// Masks of one bit per pixel, such as views of bit_aligned_image1_type<1, gray_layout_t>::type,
+/// are dilated without unpacking them, 64 pixels at a time. The same holds for erode, opening
+/// and closing.
 /// \tparam SrcView type of source image, models gil::ImageViewConcept.
 /// \tparam IntOpView type of output image, models gil::MutableImageViewConcept.
 /// \tparam Kernel type of structuring element.
@@ -177,9 +499,8 @@ template <typename SrcView, typename IntOpView, typename Kernel>
 void dilate(SrcView const& src_view, IntOpView const& int_op_view, Kernel const& ker_mat,
             int iterations)
 {
-    copy_pixels(src_view, int_op_view);
-    for (int i = 0; i < iterations; ++i)
-        morph(int_op_view, int_op_view, ker_mat, detail::morphological_operation::dilation);
+    detail::morph_iterations(src_view, int_op_view, ker_mat,
+        detail::morphological_operation::dilation, iterations);
 }
 
 /// \brief Applies morphological erosion on the input image view using given
@@ -198,9 +519,8 @@ template <typename SrcView, typename IntOpView, typename Kernel>
 void erode(SrcView const& src_view, IntOpView const& int_op_view, Kernel const& ker_mat,
            int iterations)
 {
-    copy_pixels(src_view, int_op_view);
-    for (int i = 0; i < iterations; ++i)
-        morph(int_op_view, int_op_view, ker_mat, detail::morphological_operation::erosion);
+    detail::morph_iterations(src_view, int_op_view, ker_mat,
+        detail::morphological_operation::erosion, iterations);
 }
 
 /// \brief Performs erosion and then dilation on the input image view . This
@@ -293,6 +613,58 @@ void black_hat(SrcView const& src_view, DstView const& dst_view, Kernel const& k
     closing(src_view, view(int_closing), ker_mat);
     difference(view(int_closing), src_view, dst_view);
 }
+/// \brief Packs a single-channel view into a mask of one bit per pixel, setting the pixels
+/// which are not zero.
+/// \param src_view - Source view, of a single channel.
+/// \param dst_view - Mask, such as a view of bit_aligned_image1_type<1, gray_layout_t>::type.
+/// \tparam SrcView type of source image, models gil::ImageViewConcept.
+/// \tparam DstView type of mask, models gil::MutableImageViewConcept.
+template <typename SrcView, typename DstView>
+void pack_binary_mask(SrcView const& src_view, DstView const& dst_view)
+{
+    static_assert(detail::is_binary_mask_view<DstView>::value,
+        "Destination must have pixels of a single bit");
+    static_assert(num_channels<SrcView>::value == 1, "Source must have a single channel");
+    BOOST_ASSERT(src_view.dimensions() == dst_view.dimensions());
+
+    // Rows of 8-bit pixels are packed with vector comparisons
+    using is_byte_row_t = typename detail::is_byte_row_view<SrcView>::type;
+
+    std::ptrdiff_t const width = src_view.width();
+    std::vector<std::uint64_t> words(static_cast<std::size_t>(detail::bit_row_words(width)));
+    for (std::ptrdiff_t y = 0; y < src_view.height() && width > 0; ++y)
+    {
+        detail::pack_mask_row(src_view.row_begin(y), width, words.data(), is_byte_row_t());
+        auto const range = dst_view.row_begin(y).bit_range();
+        detail::store_bit_row(words.data(), range.current_byte(), range.bit_offset(), width, false);
+    }
+}
+
+/// \brief Unpacks a mask of one bit per pixel into a single-channel view, writing the largest
+/// channel value for the set pixels and the smallest one for the others.
+/// \param src_view - Mask, such as a view of bit_aligned_image1_type<1, gray_layout_t>::type.
+/// \param dst_view - Destination view, of a single channel.
+/// \tparam SrcView type of mask, models gil::ImageViewConcept.
+/// \tparam DstView type of destination image, models gil::MutableImageViewConcept.
+template <typename SrcView, typename DstView>
+void unpack_binary_mask(SrcView const& src_view, DstView const& dst_view)
+{
+    static_assert(detail::is_binary_mask_view<SrcView>::value,
+        "Source must have pixels of a single bit");
+    static_assert(num_channels<DstView>::value == 1, "Destination must have a single channel");
+    BOOST_ASSERT(src_view.dimensions() == dst_view.dimensions());
+
+    using is_byte_row_t = typename detail::is_byte_row_view<DstView>::type;
+
+    std::ptrdiff_t const width = src_view.width();
+    std::vector<std::uint64_t> words(static_cast<std::size_t>(detail::bit_row_words(width)));
+    for (std::ptrdiff_t y = 0; y < src_view.height() && width > 0; ++y)
+    {
+        auto const range = src_view.row_begin(y).bit_range();
+        detail::load_bit_row(range.current_byte(), range.bit_offset(), width, words.data(), false);
+        detail::unpack_mask_row(words.data(), width, dst_view.row_begin(y), is_byte_row_t());
+    }
+}
 /// @}
 }}     // namespace boost::gil
 #endif // BOOST_GIL_IMAGE_PROCESSING_MORPHOLOGY_HPP
@@ -0,0 +1,774 @@
+//
+// Copyright 2026 Boost.GIL Contributors
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#ifndef BOOST_GIL_IMAGE_PROCESSING_PYRAMID_HPP
+#define BOOST_GIL_IMAGE_PROCESSING_PYRAMID_HPP
+
+#include <boost/gil/image_processing/convolve.hpp>
+#include <boost/gil/image_processing/kernel.hpp>
+
+#include <boost/gil/algorithm.hpp>
+#include <boost/gil/execution.hpp>
+#include <boost/gil/image.hpp>
+#include <boost/gil/pixel.hpp>
+#include <boost/gil/point.hpp>
+#include <boost/gil/detail/downsample_row.hpp>
+#include <boost/gil/detail/resample_row.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace boost { namespace gil {
+
+/// \ingroup ImageProcessing
+/// \brief Mipmap of an image: level 0 is a copy of the image and each further level halves
+/// the previous one by averaging its blocks of 2x2 pixels.
+///
+/// Level i + 1 has half the width and half the height of level i, rounded down, dropping the
+/// last column or row of odd dimensions, which belongs to no block of 2x2 pixels. This differs
+/// from gaussian_pyramid, whose levels are rounded up. Levels stop when a dimension reaches 1.
+///
+/// The first levels are built in a single pass over the image: once two rows of a level are
+/// written, the row of the next level they average is computed while they are still in cache.
+/// Bands of rows are built according to the execution policy.
+template <typename Image>
+class image_pyramid
+{
+public:
+    using image_t = Image;
+    using view_t = typename Image::view_t;
+    using const_view_t = typename Image::const_view_t;
+
+    image_pyramid() = default;
+
+    /// \brief Builds up to \p levels levels of \p view
+    template <typename View>
+    image_pyramid(View const& view, std::size_t levels)
+        : image_pyramid(execution::seq, view, levels)
+    {}
+
+    /// \brief Builds up to \p levels levels of \p view according to an execution policy
+    template
+    <
+        typename ExecutionPolicy,
+        typename View,
+        typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+    >
+    image_pyramid(ExecutionPolicy const& policy, View const& view, std::size_t levels)
+    {
+        static_assert(detail::is_resample_pixel<typename view_t::value_type>::value,
+            "Averaging requires channels stored as arithmetic values");
+        BOOST_ASSERT(levels > 0);
+
+        // Reserved, since growing the vector would copy the levels
+        std::size_t count = 1;
+        for (point_t size = view.dimensions(); count < levels && size.x >= 2 && size.y >= 2;
+            size = point_t(size.x / 2, size.y / 2))
+        {
+            ++count;
+        }
+        levels_.reserve(count);
+        for (point_t size = view.dimensions(); levels_.size() < count;
+            size = point_t(size.x / 2, size.y / 2))
+        {
+            levels_.emplace_back(size);
+        }
+        if (view.width() == 0 || view.height() == 0)
+            return;
+
+        // Blocks of rows of level 0 whose rows of the cascaded levels depend on no other block.
+        // Deeper levels are small enough to be halved one after the other.
+        std::size_t const cascaded = (std::min)(levels_.size(), std::size_t(6));
+        std::ptrdiff_t const block = std::ptrdiff_t(1) << (cascaded - 1);
+        std::ptrdiff_t const height = view.height();
+        view_t const first = gil::view(levels_.front());
+        detail::for_each_row_band(policy, (height + block - 1) / block,
+            [&](std::ptrdiff_t b0, std::ptrdiff_t b1)
+        {
+            row_buffers buffers(levels_.front().width());
+            for (std::ptrdiff_t y = b0 * block; y < (std::min)(b1 * block, height); ++y)
+            {
+                std::copy(view.row_begin(y), view.row_end(y), first.row_begin(y));
+
+                // Odd rows complete the row of the next level averaging them
+                std::size_t level = 0;
+                for (std::ptrdiff_t row = y; level + 1 < cascaded && (row & 1) != 0; row /= 2)
+                    halve_row(level++, row / 2, buffers);
+            }
+        });
+
+        for (std::size_t level = cascaded; level < levels_.size(); ++level)
+        {
+            detail::for_each_row_band(policy, levels_[level].height(),
+                [&](std::ptrdiff_t y0, std::ptrdiff_t y1)
+            {
+                row_buffers buffers(levels_[level - 1].width());
+                for (std::ptrdiff_t y = y0; y < y1; ++y)
+                    halve_row(level - 1, y, buffers);
+            });
+        }
+    }
+
+    /// \brief Returns the number of levels, including level 0
+    auto size() const -> std::size_t { return levels_.size(); }
+
+    auto level(std::size_t i) -> view_t
+    {
+        BOOST_ASSERT(i < levels_.size());
+        return gil::view(levels_[i]);
+    }
+
+    auto level(std::size_t i) const -> const_view_t
+    {
+        BOOST_ASSERT(i < levels_.size());
+        return gil::const_view(levels_[i]);
+    }
+
+private:
+    using value_t = typename base_channel_type<typename channel_type<view_t>::type>::type;
+    using flat_t = detail::is_resample_flat_view<view_t, value_t>;
+    static constexpr std::size_t channels = num_channels<view_t>::value;
+
+    /// \brief Rows of channels copied from levels that are not stored as flat arrays
+    struct row_buffers
+    {
+        explicit row_buffers(std::ptrdiff_t width)
+            : row0(flat_t::value ? 0 : static_cast<std::size_t>(width) * channels)
+            , row1(row0.size())
+            , dst(row0.size())
+        {}
+
+        std::vector<value_t> row0;
+        std::vector<value_t> row1;
+        std::vector<value_t> dst;
+    };
+
+    /// \brief Computes row \p y of level \p level + 1 from two rows of level \p level
+    void halve_row(std::size_t level, std::ptrdiff_t y, row_buffers& buffers)
+    {
+        view_t const src = gil::view(levels_[level]);
+        view_t const dst = gil::view(levels_[level + 1]);
+        value_t const* row0 = detail::resample_load_row(src, 2 * y, buffers.row0, flat_t());
+        value_t const* row1 = detail::resample_load_row(src, 2 * y + 1, buffers.row1, flat_t());
+        value_t* target = detail::resample_row_target(dst, y, buffers.dst, flat_t());
+        detail::downsample_2x2_row<channels>(row0, row1, target, dst.width());
+        detail::resample_store_row(dst, y, buffers.dst, flat_t());
+    }
+
+    std::vector<Image> levels_;
+};
+
+namespace detail {
+
+/// \brief Weights of the reduction and the expansion of the levels of a pyramid by a kernel
+///
+/// Reduction correlates a level with the kernel at its even coordinates only. Expansion
+/// correlates the level upsampled by inserting zeros between its pixels, so output coordinate
+/// 2q + p only takes the taps of phase p, which are normalized to keep constant levels.
+template <typename Accum>
+struct pyramid_kernel
+{
+    pyramid_kernel() = default;
+
+    template <typename Kernel>
+    explicit pyramid_kernel(Kernel const& kernel)
+        : center(static_cast<std::ptrdiff_t>(kernel.center()))
+    {
+        std::ptrdiff_t const size = static_cast<std::ptrdiff_t>(kernel.size());
+        for (std::ptrdiff_t i = 0; i < size; ++i)
+            weights.push_back(static_cast<Accum>(kernel[static_cast<std::size_t>(i)]));
+
+        for (std::ptrdiff_t p = 0; p < 2; ++p)
+        {
+            Accum total = 0;
+            for (std::ptrdiff_t i = 0; i < size; ++i)
+            {
+                if ((p + i + center) % 2 != 0)
+                    continue;
+                std::ptrdiff_t const offset = (p + i - center) / 2;
+                phase_offsets[p].push_back(offset);
+                phase_weights[p].push_back(weights[static_cast<std::size_t>(i)]);
+                total += weights[static_cast<std::size_t>(i)];
+                first_offset = (std::min)(first_offset, offset);
+                last_offset = (std::max)(last_offset, offset);
+            }
+            BOOST_ASSERT_MSG(!phase_weights[p].empty(), "Pyramid kernels need at least 2 taps");
+            if (total < Accum(0) || Accum(0) < total)
+            {
+                for (auto& weight : phase_weights[p])
+                    weight /= total;
+            }
+        }
+    }
+
+    std::vector<Accum> weights;
+    std::ptrdiff_t center = 0;
+    std::vector<Accum> phase_weights[2];
+    std::vector<std::ptrdiff_t> phase_offsets[2];
+    std::ptrdiff_t first_offset = 0;
+    std::ptrdiff_t last_offset = 0;
+};
+
+/// \brief Binomial kernel 1 4 6 4 1 / 16 of the Burt and Adelson pyramids
+inline auto binomial_pyramid_kernel() -> kernel_1d_fixed<float, 5>
+{
+    float const taps[] = {0.0625f, 0.25f, 0.375f, 0.25f, 0.0625f};
+    return kernel_1d_fixed<float, 5>(taps, 2);
+}
+
+/// \brief Row buffers of a band of rows of pyramid levels, reused from level to level
+template <typename PixelAccum>
+struct pyramid_scratch
+{
+    using accum_t = typename channel_type<PixelAccum>::type;
+
+    std::vector<PixelAccum> line;   // a source row extended by the kernel
+    std::vector<PixelAccum> base;   // a row the expansion is added to
+    std::vector<PixelAccum> acc;    // the row being computed
+    std::vector<accum_t> ring;      // source rows filtered horizontally
+    std::vector<std::ptrdiff_t> ring_rows;
+};
+
+template <typename PixelAccum>
+inline auto pyramid_channels(PixelAccum* pixels) -> typename channel_type<PixelAccum>::type*
+{
+    return reinterpret_cast<typename channel_type<PixelAccum>::type*>(pixels);
+}
+
+/// \brief Boundary option of the levels built from a source view with \p option, which have no
+/// pixels around them
+inline auto pyramid_level_option(boundary_option option) -> boundary_option
+{
+    return option == boundary_option::extend_padded ? boundary_option::extend_constant : option;
+}
+
+/// \brief Rounds and saturates a row of accumulated pixels to row \p y of a view
+template <typename PixelAccum, typename View>
+void pyramid_store_row(View const& view, std::ptrdiff_t y, PixelAccum const* row)
+{
+    using value_t = typename View::value_type;
+    using base_t = typename base_channel_type<typename channel_type<View>::type>::type;
+    using accum_t = typename channel_type<PixelAccum>::type;
+    auto it = view.row_begin(y);
+    for (std::ptrdiff_t x = 0; x < view.width(); ++x)
+    {
+        PixelAccum rounded;
+        for (std::size_t c = 0; c < num_channels<PixelAccum>::value; ++c)
+        {
+            dynamic_at_c(rounded, c) =
+                static_cast<accum_t>(resample_round<base_t>(dynamic_at_c(row[x], c)));
+        }
+        value_t value;
+        pixel_assigns_t<PixelAccum, value_t>()(rounded, value);
+        it[x] = value;
+    }
+}
+
+/// \brief Rounds an expansion to the nearest integer when the levels have integral channels
+template <typename T, typename Accum>
+inline auto pyramid_round_expansion(Accum value) -> Accum
+{
+    return std::is_integral<T>::value ? std::floor(value + Accum(0.5)) : value;
+}
+
+/// \brief Copies \p src to \p dst, converting the channels as pyramid levels are
+template <typename PixelAccum, typename ExecutionPolicy, typename SrcView, typename DstView>
+void pyramid_copy(
+    ExecutionPolicy const& policy,
+    SrcView const& src,
+    DstView const& dst,
+    std::vector<pyramid_scratch<PixelAccum>>& scratch)
+{
+    correlate_2d_row_loader<PixelAccum, SrcView> const load_row(
+        src, 0, 0, boundary_option::output_ignore);
+    for_each_indexed_row_band(policy, dst.height(),
+        [&](std::size_t band, std::ptrdiff_t y0, std::ptrdiff_t y1)
+    {
+        std::vector<PixelAccum>& line = scratch[band].line;
+        line.resize(static_cast<std::size_t>(load_row.width()));
+        for (std::ptrdiff_t y = y0; y < y1; ++y)
+        {
+            load_row(y, line.data());
+            pyramid_store_row(dst, y, line.data());
+        }
+    });
+}
+
+/// \brief Blurs \p src with a kernel at the pixels it keeps in \p dst, its next level
+template <typename PixelAccum, typename ExecutionPolicy, typename SrcView, typename DstView>
+void pyramid_reduce(
+    ExecutionPolicy const& policy,
+    SrcView const& src,
+    DstView const& dst,
+    pyramid_kernel<typename channel_type<PixelAccum>::type> const& kernel,
+    boundary_option option,
+    std::vector<pyramid_scratch<PixelAccum>>& scratch)
+{
+    using accum_t = typename channel_type<PixelAccum>::type;
+    std::size_t const n = num_channels<PixelAccum>::value;
+    std::ptrdiff_t const size = static_cast<std::ptrdiff_t>(kernel.weights.size());
+    std::ptrdiff_t const center = kernel.center;
+    correlate_2d_row_loader<PixelAccum, SrcView> const load_row(
+        src, center, size - 1 - center, option);
+    std::size_t const width = static_cast<std::size_t>(dst.width());
+    std::size_t const row_size = width * n;
+
+    for_each_indexed_row_band(policy, dst.height(),
+        [&](std::size_t band, std::ptrdiff_t y0, std::ptrdiff_t y1)
+    {
+        // Source row r is filtered to slot (r + center) % size of the ring. The rows of an
+        // output row are consecutive, hence in distinct slots.
+        pyramid_scratch<PixelAccum>& s = scratch[band];
+        s.line.resize(static_cast<std::size_t>(load_row.width()));
+        s.acc.resize(width);
+        s.ring.resize(static_cast<std::size_t>(size) * row_size);
+        s.ring_rows.assign(static_cast<std::size_t>(size),
+            (std::numeric_limits<std::ptrdiff_t>::min)());
+        accum_t const* line = pyramid_channels(s.line.data());
+        accum_t* acc = pyramid_channels(s.acc.data());
+        accum_t const* weights = kernel.weights.data();
+        for (std::ptrdiff_t y = y0; y < y1; ++y)
+        {
+            std::fill(acc, acc + row_size, accum_t(0));
+            for (std::ptrdiff_t i = 0; i < size; ++i)
+            {
+                std::ptrdiff_t const r = 2 * y - center + i;
+                std::size_t const slot = static_cast<std::size_t>((2 * y + i) % size);
+                accum_t* row = s.ring.data() + slot * row_size;
+                if (s.ring_rows[slot] != r)
+                {
+                    load_row(r, s.line.data());
+                    for (std::size_t x = 0; x < width; ++x)
+                    {
+                        accum_t const* from = line + 2 * x * n;
+                        for (std::size_t c = 0; c < n; ++c)
+                        {
+                            accum_t sum = 0;
+                            for (std::ptrdiff_t k = 0; k < size; ++k)
+                                sum += weights[k] * from[static_cast<std::size_t>(k) * n + c];
+                            row[x * n + c] = sum;
+                        }
+                    }
+                    s.ring_rows[slot] = r;
+                }
+                accum_t const weight = weights[i];
+                for (std::size_t j = 0; j < row_size; ++j)
+                    acc[j] += weight * row[j];
+            }
+            pyramid_store_row(dst, y, s.acc.data());
+        }
+    });
+}
+
+/// \brief Sets \p dst to \p base plus \p sign times the expansion of \p src, the next level of
+/// \p dst, which may be \p base
+template
+<
+    typename PixelAccum,
+    typename ExecutionPolicy,
+    typename SrcView,
+    typename BaseView,
+    typename DstView
+>
+void pyramid_expand(
+    ExecutionPolicy const& policy,
+    SrcView const& src,
+    BaseView const& base,
+    DstView const& dst,
+    typename channel_type<PixelAccum>::type sign,
+    pyramid_kernel<typename channel_type<PixelAccum>::type> const& kernel,
+    boundary_option option,
+    std::vector<pyramid_scratch<PixelAccum>>& scratch)
+{
+    using accum_t = typename channel_type<PixelAccum>::type;
+    using level_t = typename base_channel_type<typename channel_type<SrcView>::type>::type;
+    std::size_t const n = num_channels<PixelAccum>::value;
+    std::ptrdiff_t const left = -kernel.first_offset;
+    std::ptrdiff_t const ring_size = kernel.last_offset - kernel.first_offset + 1;
+    correlate_2d_row_loader<PixelAccum, SrcView> const load_row(
+        src, left, kernel.last_offset, option);
+    correlate_2d_row_loader<PixelAccum, BaseView> const load_base(
+        base, 0, 0, boundary_option::output_ignore);
+    std::size_t const width = static_cast<std::size_t>(dst.width());
+    std::size_t const row_size = width * n;
+
+    for_each_indexed_row_band(policy, dst.height(),
+        [&](std::size_t band, std::ptrdiff_t y0, std::ptrdiff_t y1)
+    {
+        // Source row m is expanded to slot (m + left) % ring_size of the ring. The rows of an
+        // output row lie between its first and last offsets, hence in distinct slots.
+        pyramid_scratch<PixelAccum>& s = scratch[band];
+        s.line.resize(static_cast<std::size_t>(load_row.width()));
+        s.base.resize(width);
+        s.acc.resize(width);
+        s.ring.resize(static_cast<std::size_t>(ring_size) * row_size);
+        s.ring_rows.assign(static_cast<std::size_t>(ring_size),
+            (std::numeric_limits<std::ptrdiff_t>::min)());
+        accum_t const* line = pyramid_channels(s.line.data());
+        accum_t const* base_row = pyramid_channels(s.base.data());
+        accum_t* acc = pyramid_channels(s.acc.data());
+        for (std::ptrdiff_t y = y0; y < y1; ++y)
+        {
+            std::size_t const p = static_cast<std::size_t>(y % 2);
+            std::vector<std::ptrdiff_t> const& offsets = kernel.phase_offsets[p];
+            std::vector<accum_t> const& weights = kernel.phase_weights[p];
+            std::fill(acc, acc + row_size, accum_t(0));
+            for (std::size_t j = 0; j < offsets.size(); ++j)
+            {
+                std::ptrdiff_t const m = y / 2 + offsets[j];
+                std::size_t const slot = static_cast<std::size_t>((m + left) % ring_size);
+                accum_t* row = s.ring.data() + slot * static_cast<std::size_t>(row_size);
+                if (s.ring_rows[slot] != m)
+                {
+                    load_row(m, s.line.data());
+                    for (std::size_t x = 0; x < width; ++x)
+                    {
+                        std::vector<std::ptrdiff_t> const& x_offsets = kernel.phase_offsets[x % 2];
+                        std::vector<accum_t> const& x_weights = kernel.phase_weights[x % 2];
+                        std::ptrdiff_t const q = static_cast<std::ptrdiff_t>(x / 2) + left;
+                        for (std::size_t c = 0; c < n; ++c)
+                        {
+                            accum_t sum = 0;
+                            for (std::size_t k = 0; k < x_offsets.size(); ++k)
+                            {
+                                std::size_t const from =
+                                    static_cast<std::size_t>(q + x_offsets[k]) * n + c;
+                                sum += x_weights[k] * line[from];
+                            }
+                            row[x * n + c] = sum;
+                        }
+                    }
+                    s.ring_rows[slot] = m;
+                }
+                accum_t const weight = weights[j];
+                for (std::size_t i = 0; i < row_size; ++i)
+                    acc[i] += weight * row[i];
+            }
+            // Integral expansions are rounded before they are added, so that subtracting and
+            // adding back the same expansion restores a level exactly
+            load_base(y, s.base.data());
+            for (std::size_t i = 0; i < row_size; ++i)
+                acc[i] = base_row[i] + sign * pyramid_round_expansion<level_t>(acc[i]);
+            pyramid_store_row(dst, y, s.acc.data());
+        }
+    });
+}
+
+/// \brief Builds up to \p levels levels of the Gaussian pyramid of \p view into \p images
+template <typename PixelAccum, typename Image, typename ExecutionPolicy, typename View>
+void build_gaussian_pyramid(
+    ExecutionPolicy const& policy,
+    View const& view,
+    std::size_t levels,
+    pyramid_kernel<typename channel_type<PixelAccum>::type> const& kernel,
+    boundary_option option,
+    std::vector<Image>& images,
+    std::vector<pyramid_scratch<PixelAccum>>& scratch)
+{
+    BOOST_ASSERT(levels > 0);
+    BOOST_ASSERT_MSG(option == boundary_option::extend_zero ||
+        option == boundary_option::extend_constant ||
+        option == boundary_option::extend_padded,
+        "Pyramids require one of the extend options");
+
+    // Reserved, since growing the vector would copy the levels
+    std::size_t count = 1;
+    for (point_t size = view.dimensions(); count < levels && size.x >= 2 && size.y >= 2;
+        size = point_t((size.x + 1) / 2, (size.y + 1) / 2))
+    {
+        ++count;
+    }
+    images.reserve(count);
+    for (point_t size = view.dimensions(); images.size() < count;
+        size = point_t((size.x + 1) / 2, (size.y + 1) / 2))
+    {
+        images.emplace_back(size);
+    }
+    if (view.width() == 0 || view.height() == 0)
+        return;
+
+    // Bands of the first level are the most numerous
+    scratch.resize(row_band_count(policy, view.height()));
+    pyramid_copy(policy, view, gil::view(images[0]), scratch);
+    if (count > 1)
+        pyramid_reduce(policy, view, gil::view(images[1]), kernel, option, scratch);
+    for (std::size_t i = 2; i < count; ++i)
+    {
+        pyramid_reduce(policy, gil::const_view(images[i - 1]), gil::view(images[i]), kernel,
+            pyramid_level_option(option), scratch);
+    }
+}
+
+} // namespace detail
+
+/// \ingroup ImageProcessing
+/// \brief Gaussian pyramid of an image: level 0 is a copy of the image and each further level
+/// blurs the previous one with a kernel and keeps every other pixel of every other row.
+///
+/// Level i + 1 has half the width and half the height of level i, rounded up, since it keeps
+/// the even pixels of level i, including the last column or row of odd dimensions, which
+/// laplacian_pyramid needs to reconstruct them. This differs from image_pyramid, whose levels
+/// are rounded down. Levels stop when a dimension reaches 1. Each level is computed at its own pixels only, rather than blurring
+/// the previous level at full resolution and subsampling it, and the row buffers of the
+/// separable blur are reused from level to level.
+///
+/// The kernel is a kernel_1d or kernel_1d_fixed, the binomial 1 4 6 4 1 / 16 by default.
+/// Pixels past the borders are read according to one of the extend options of
+/// boundary_option; extend_padded reads the pixels around the image for level 1 and repeats
+/// the borders of the further levels, as extend_constant does.
+template <typename Image>
+class gaussian_pyramid
+{
+public:
+    using image_t = Image;
+    using view_t = typename Image::view_t;
+    using const_view_t = typename Image::const_view_t;
+
+    gaussian_pyramid() = default;
+
+    /// \brief Builds up to \p levels levels of \p view with the binomial kernel
+    template <typename View>
+    gaussian_pyramid(View const& view, std::size_t levels)
+        : gaussian_pyramid(execution::seq, view, levels)
+    {}
+
+    /// \brief Builds up to \p levels levels of \p view with a kernel
+    template <typename View, typename Kernel>
+    gaussian_pyramid(
+        View const& view,
+        std::size_t levels,
+        Kernel const& kernel,
+        boundary_option option = boundary_option::extend_constant)
+        : gaussian_pyramid(execution::seq, view, levels, kernel, option)
+    {}
+
+    /// \brief Builds up to \p levels levels of \p view with the binomial kernel according to an
+    /// execution policy
+    template
+    <
+        typename ExecutionPolicy,
+        typename View,
+        typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+    >
+    gaussian_pyramid(ExecutionPolicy const& policy, View const& view, std::size_t levels)
+        : gaussian_pyramid(policy, view, levels, detail::binomial_pyramid_kernel())
+    {}
+
+    /// \brief Builds up to \p levels levels of \p view with a kernel according to an execution
+    /// policy
+    template
+    <
+        typename ExecutionPolicy,
+        typename View,
+        typename Kernel,
+        typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+    >
+    gaussian_pyramid(
+        ExecutionPolicy const& policy,
+        View const& view,
+        std::size_t levels,
+        Kernel const& kernel,
+        boundary_option option = boundary_option::extend_constant)
+    {
+        std::vector<detail::pyramid_scratch<pixel_accum_t>> scratch;
+        detail::build_gaussian_pyramid(policy, view, levels,
+            detail::pyramid_kernel<accum_t>(kernel), option, levels_, scratch);
+    }
+
+    /// \brief Returns the number of levels, including level 0
+    auto size() const -> std::size_t { return levels_.size(); }
+
+    auto level(std::size_t i) -> view_t
+    {
+        BOOST_ASSERT(i < levels_.size());
+        return gil::view(levels_[i]);
+    }
+
+    auto level(std::size_t i) const -> const_view_t
+    {
+        BOOST_ASSERT(i < levels_.size());
+        return gil::const_view(levels_[i]);
+    }
+
+private:
+    using accum_t = detail::resample_accum_t
+        <
+            typename base_channel_type<typename channel_type<view_t>::type>::type
+        >;
+    using pixel_accum_t = pixel<accum_t, typename Image::value_type::layout_t>;
+
+    std::vector<Image> levels_;
+};
+
+/// \ingroup ImageProcessing
+/// \brief Laplacian pyramid of an image: level i holds the details of level i of its Gaussian
+/// pyramid missing from level i + 1, and the last level is the last Gaussian level.
+///
+/// Level i is the Gaussian level i minus the expansion of the Gaussian level i + 1, which
+/// upsamples it by inserting zeros between its pixels and blurs it with the kernel. collapse()
+/// adds the expansions back from the last level down, reconstructing the image. The levels but
+/// the last hold differences, so \p Image must have signed or floating point channels.
+///
+/// The kernel and the boundary options are those of gaussian_pyramid.
+template <typename Image>
+class laplacian_pyramid
+{
+    using channel_base_t = typename base_channel_type
+        <
+            typename channel_type<typename Image::view_t>::type
+        >::type;
+    static_assert(
+        std::is_signed<channel_base_t>::value || std::is_floating_point<channel_base_t>::value,
+        "Laplacian levels hold differences, which require signed or floating point channels");
+
+public:
+    using image_t = Image;
+    using view_t = typename Image::view_t;
+    using const_view_t = typename Image::const_view_t;
+
+    laplacian_pyramid() = default;
+
+    /// \brief Builds up to \p levels levels of \p view with the binomial kernel
+    template <typename View>
+    laplacian_pyramid(View const& view, std::size_t levels)
+        : laplacian_pyramid(execution::seq, view, levels)
+    {}
+
+    /// \brief Builds up to \p levels levels of \p view with a kernel
+    template <typename View, typename Kernel>
+    laplacian_pyramid(
+        View const& view,
+        std::size_t levels,
+        Kernel const& kernel,
+        boundary_option option = boundary_option::extend_constant)
+        : laplacian_pyramid(execution::seq, view, levels, kernel, option)
+    {}
+
+    /// \brief Builds up to \p levels levels of \p view with the binomial kernel according to an
+    /// execution policy
+    template
+    <
+        typename ExecutionPolicy,
+        typename View,
+        typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+    >
+    laplacian_pyramid(ExecutionPolicy const& policy, View const& view, std::size_t levels)
+        : laplacian_pyramid(policy, view, levels, detail::binomial_pyramid_kernel())
+    {}
+
+    /// \brief Builds up to \p levels levels of \p view with a kernel according to an execution
+    /// policy
+    template
+    <
+        typename ExecutionPolicy,
+        typename View,
+        typename Kernel,
+        typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+    >
+    laplacian_pyramid(
+        ExecutionPolicy const& policy,
+        View const& view,
+        std::size_t levels,
+        Kernel const& kernel,
+        boundary_option option = boundary_option::extend_constant)
+        : kernel_(kernel)
+        , option_(detail::pyramid_level_option(option))
+    {
+        std::vector<detail::pyramid_scratch<pixel_accum_t>> scratch;
+        detail::build_gaussian_pyramid(policy, view, levels, kernel_, option, levels_, scratch);
+
+        // Level i + 1 is still Gaussian when level i is replaced by its details
+        for (std::size_t i = 0; i + 1 < levels_.size() && view.width() > 0 && view.height() > 0;
+            ++i)
+        {
+            detail::pyramid_expand(policy, gil::const_view(levels_[i + 1]),
+                gil::const_view(levels_[i]), gil::view(levels_[i]), accum_t(-1), kernel_,
+                option_, scratch);
+        }
+    }
+
+    /// \brief Returns the number of levels, including level 0
+    auto size() const -> std::size_t { return levels_.size(); }
+
+    auto level(std::size_t i) -> view_t
+    {
+        BOOST_ASSERT(i < levels_.size());
+        return gil::view(levels_[i]);
+    }
+
+    auto level(std::size_t i) const -> const_view_t
+    {
+        BOOST_ASSERT(i < levels_.size());
+        return gil::const_view(levels_[i]);
+    }
+
+    /// \brief Reconstructs the image to \p dst, which has the dimensions of level 0, by adding
+    /// the expansion of each level to the level below, according to an execution policy
+    template
+    <
+        typename ExecutionPolicy,
+        typename View,
+        typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+    >
+    void collapse(ExecutionPolicy const& policy, View const& dst) const
+    {
+        BOOST_ASSERT(!levels_.empty());
+        BOOST_ASSERT(dst.dimensions() == levels_.front().dimensions());
+        if (dst.width() == 0 || dst.height() == 0)
+            return;
+
+        std::vector<detail::pyramid_scratch<pixel_accum_t>> scratch(
+            detail::row_band_count(policy, dst.height()));
+        if (levels_.size() == 1)
+        {
+            detail::pyramid_copy(policy, gil::const_view(levels_.front()), dst, scratch);
+            return;
+        }
+
+        Image upper;
+        const_view_t src = gil::const_view(levels_.back());
+        for (std::size_t i = levels_.size() - 2; i > 0; --i)
+        {
+            Image lower(levels_[i].dimensions());
+            detail::pyramid_expand(policy, src, gil::const_view(levels_[i]), gil::view(lower),
+                accum_t(1), kernel_, option_, scratch);
+            upper = std::move(lower);
+            src = gil::const_view(upper);
+        }
+        detail::pyramid_expand(policy, src, gil::const_view(levels_.front()), dst, accum_t(1),
+            kernel_, option_, scratch);
+    }
+
+    /// \brief Reconstructs the image to \p dst, which has the dimensions of level 0
+    template <typename View>
+    void collapse(View const& dst) const
+    {
+        collapse(execution::seq, dst);
+    }
+
+private:
+    using accum_t = detail::resample_accum_t
+        <
+            typename base_channel_type<typename channel_type<view_t>::type>::type
+        >;
+    using pixel_accum_t = pixel<accum_t, typename Image::value_type::layout_t>;
+
+    detail::pyramid_kernel<accum_t> kernel_;
+    boundary_option option_ = boundary_option::extend_constant;
+    std::vector<Image> levels_;
+};
+
+}} // namespace boost::gil
+
+#endif
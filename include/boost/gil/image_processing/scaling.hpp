@@ -8,10 +8,21 @@
 #ifndef BOOST_GIL_IMAGE_PROCESSING_SCALING_HPP
 #define BOOST_GIL_IMAGE_PROCESSING_SCALING_HPP
 
+#include <boost/gil/concepts.hpp>
+#include <boost/gil/execution.hpp>
+#include <boost/gil/image.hpp>
 #include <boost/gil/image_view.hpp>
 #include <boost/gil/rgb.hpp>
 #include <boost/gil/pixel.hpp>
 #include <boost/gil/image_processing/numeric.hpp>
+#include <boost/gil/detail/downsample_row.hpp>
+#include <boost/gil/detail/resample_row.hpp>
+
+#include <boost/assert.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
 
 namespace boost { namespace gil {
 
@@ -82,6 +93,29 @@ void lanczos_at(
     output_view(target_x, target_y) = result_pixel;
 }
 
+namespace detail {
+
+/// \brief Lanczos kernel with \p a lobes on each side, for detail::resample_separable
+struct lanczos_kernel
+{
+    std::ptrdiff_t a;
+
+    auto support() const -> double { return static_cast<double>(a); }
+    auto operator()(double x) const -> double { return lanczos(x, a); }
+};
+
+/// \brief Size of an axis after the area pass of scale_lanczos
+///
+/// An axis shrinking by more than twice \p gap is first averaged down to \p gap times its
+/// destination size, otherwise it keeps its source size.
+inline auto lanczos_reduced_size(std::ptrdiff_t src_size, std::ptrdiff_t dst_size,
+    std::ptrdiff_t gap = 2) -> std::ptrdiff_t
+{
+    return dst_size > 0 && src_size > 2 * gap * dst_size ? gap * dst_size : src_size;
+}
+
+} // namespace detail
+
 /// \brief Complete Lanczos algorithm
 /// \ingroup DownScalingAlgorithms
 ///
@@ -91,23 +125,142 @@ void lanczos_at(
 /// Based on wikipedia article:
 /// https://en.wikipedia.org/wiki/Lanczos_resampling
 /// with standardinzed cardinal sin (sinc)
-template <typename ImageView>
-void scale_lanczos(ImageView input_view, ImageView output_view, std::ptrdiff_t a)
+///
+/// The kernel is separable, so the image is resampled horizontally then vertically, with the
+/// weights of each output column and row computed once. When downscaling, the kernel is
+/// widened by the scale factor so that every source pixel contributes. 8-bit channels are
+/// accumulated in fixed point, other channels in floating point. Bands of rows are resampled
+/// according to the execution policy.
+///
+/// An axis shrinking by more than 4 times is first area averaged down to twice its destination
+/// size, so that large downscales do not pay for a kernel spanning many source pixels. The
+/// averaging keeps every source pixel, and the Lanczos pass still filters the last factor of 2.
+template
+<
+    typename ExecutionPolicy,
+    typename SrcView,
+    typename DstView,
+    typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+>
+void scale_lanczos(
+    ExecutionPolicy const& policy,
+    SrcView const& input_view,
+    DstView const& output_view,
+    std::ptrdiff_t a)
 {
-    double scale_x = (static_cast<double>(output_view.width()))
-                     / static_cast<double>(input_view.width());
-    double scale_y = (static_cast<double>(output_view.height()))
-                     / static_cast<double>(input_view.height());
+    gil_function_requires<ImageViewConcept<SrcView>>();
+    gil_function_requires<MutableImageViewConcept<DstView>>();
+    BOOST_ASSERT(a > 0);
 
-    using x_coord_t = typename ImageView::x_coord_t;
-    using y_coord_t = typename ImageView::y_coord_t;
-    for (y_coord_t y = 0; y < output_view.height(); ++y)
+    point_t const reduced(
+        detail::lanczos_reduced_size(input_view.width(), output_view.width()),
+        detail::lanczos_reduced_size(input_view.height(), output_view.height()));
+    if (reduced == input_view.dimensions())
     {
-        for (x_coord_t x = 0; x < output_view.width(); ++x)
+        detail::resample_separable(policy, input_view, output_view, detail::lanczos_kernel{a});
+        return;
+    }
+
+    image<typename SrcView::value_type> reduced_image(reduced);
+    detail::resample_separable(policy, input_view, view(reduced_image),
+        detail::make_area_axis(input_view.width(), reduced.x),
+        detail::make_area_axis(input_view.height(), reduced.y));
+    detail::resample_separable(
+        policy, const_view(reduced_image), output_view, detail::lanczos_kernel{a});
+}
+
+/// \brief Complete Lanczos algorithm
+/// \ingroup DownScalingAlgorithms
+template <typename SrcView, typename DstView>
+void scale_lanczos(SrcView const& input_view, DstView const& output_view, std::ptrdiff_t a)
+{
+    scale_lanczos(execution::seq, input_view, output_view, a);
+}
+
+namespace detail {
+
+/// \brief Halves \p src to the dimensions of \p dst by averaging blocks of 2x2 pixels, in
+/// bands of rows according to an execution policy
+template <typename ExecutionPolicy, typename SrcView, typename DstView>
+void downsample_2x2(ExecutionPolicy const& policy, SrcView const& src, DstView const& dst)
+{
+    using value_t = typename base_channel_type<typename channel_type<SrcView>::type>::type;
+    static_assert(std::is_same<typename SrcView::value_type, typename DstView::value_type>::value,
+        "Source and destination views must have the same pixel type");
+    static_assert(is_resample_pixel<typename SrcView::value_type>::value,
+        "Averaging requires channels stored as arithmetic values");
+    BOOST_ASSERT(src.width() >= 2 * dst.width() && src.height() >= 2 * dst.height());
+
+    std::size_t const n = num_channels<SrcView>::value;
+    using src_flat_t = is_resample_flat_view<SrcView, value_t>;
+    using dst_flat_t = is_resample_flat_view<DstView, value_t>;
+    for_each_row_band(policy, dst.height(), [&](std::ptrdiff_t y0, std::ptrdiff_t y1)
+    {
+        std::size_t const src_size =
+            src_flat_t::value ? 0 : static_cast<std::size_t>(src.width()) * n;
+        std::vector<value_t> row0_buffer(src_size);
+        std::vector<value_t> row1_buffer(src_size);
+        std::vector<value_t> dst_buffer(
+            dst_flat_t::value ? 0 : static_cast<std::size_t>(dst.width()) * n);
+        for (std::ptrdiff_t y = y0; y < y1; ++y)
         {
-            lanczos_at(input_view, output_view, x / scale_x, y / scale_y, x, y, a);
+            value_t const* row0 = resample_load_row(src, 2 * y, row0_buffer, src_flat_t());
+            value_t const* row1 = resample_load_row(src, 2 * y + 1, row1_buffer, src_flat_t());
+            value_t* target = resample_row_target(dst, y, dst_buffer, dst_flat_t());
+            downsample_2x2_row<num_channels<SrcView>::value>(row0, row1, target, dst.width());
+            resample_store_row(dst, y, dst_buffer, dst_flat_t());
         }
+    });
+}
+
+} // namespace detail
+
+/// \brief Area averaging (box) scaling
+/// \ingroup DownScalingAlgorithms
+///
+/// Each output pixel is the mean of the source pixels under its area, weighted by the part of
+/// them it covers, so downscaling by any ratio neither skips source pixels nor rings. When
+/// upscaling, output pixels straddling two source pixels blend them.
+///
+/// Halving both dimensions averages blocks of 2x2 pixels directly. Other ratios resample the
+/// image horizontally then vertically as scale_lanczos does, with the weights of each output
+/// column and row computed once. Bands of rows are scaled according to the execution policy.
+template
+<
+    typename ExecutionPolicy,
+    typename SrcView,
+    typename DstView,
+    typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+>
+void scale_area(
+    ExecutionPolicy const& policy, SrcView const& input_view, DstView const& output_view)
+{
+    gil_function_requires<ImageViewConcept<SrcView>>();
+    gil_function_requires<MutableImageViewConcept<DstView>>();
+
+    if (input_view.width() == 0 || input_view.height() == 0 ||
+        output_view.width() == 0 || output_view.height() == 0)
+    {
+        return;
     }
+
+    if (input_view.width() == 2 * output_view.width() &&
+        input_view.height() == 2 * output_view.height())
+    {
+        detail::downsample_2x2(policy, input_view, output_view);
+        return;
+    }
+    detail::resample_separable(policy, input_view, output_view,
+        detail::make_area_axis(input_view.width(), output_view.width()),
+        detail::make_area_axis(input_view.height(), output_view.height()));
+}
+
+/// \brief Area averaging (box) scaling
+/// \ingroup DownScalingAlgorithms
+template <typename SrcView, typename DstView>
+void scale_area(SrcView const& input_view, DstView const& output_view)
+{
+    scale_area(execution::seq, input_view, output_view);
 }
 
 }} // namespace boost::gil
@@ -0,0 +1,277 @@
+//
+// Copyright 2026 Boost.GIL Contributors
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#ifndef BOOST_GIL_IMAGE_PROCESSING_SUMMED_AREA_TABLE_HPP
+#define BOOST_GIL_IMAGE_PROCESSING_SUMMED_AREA_TABLE_HPP
+
+#include <boost/gil/image_processing/convolve.hpp>
+
+#include <boost/gil/algorithm.hpp>
+#include <boost/gil/execution.hpp>
+#include <boost/gil/pixel.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace boost { namespace gil {
+
+/// \ingroup ImageProcessing
+/// \brief Summed-area table (integral image) of a view, giving the sum, mean and variance of
+/// the channels of any rectangle of pixels in constant time.
+///
+/// Entry (x, y) of the table holds the sums of the channels of all pixels above and to the
+/// left of pixel (x, y), so the sum over a rectangle is the combination of the entries at its
+/// four corners. \p T is the type of the sums, typically \c std::int64_t for integral channels,
+/// which keeps the sums exact, and \c double otherwise.
+///
+/// The table may cover the view extended on every side by a border filled according to a
+/// boundary_option, in which case rectangles may reach into the border.
+template <typename T>
+class summed_area_table
+{
+public:
+    using value_type = T;
+
+    summed_area_table() = default;
+
+    /// \brief Builds the table of \p view
+    /// \param squares - Whether to also sum the squares of the channels, needed by variance().
+    template <typename View>
+    explicit summed_area_table(View const& view, bool squares = false)
+        : summed_area_table(execution::seq, view, 0, boundary_option::extend_zero, squares)
+    {}
+
+    /// \brief Builds the table of \p view extended by \p border pixels on every side
+    /// \param option - One of the extend options of boundary_option. extend_padded reads the
+    /// border from the pixels around \p view.
+    template <typename View>
+    summed_area_table(
+        View const& view, std::ptrdiff_t border, boundary_option option, bool squares = false)
+        : summed_area_table(execution::seq, view, border, option, squares)
+    {}
+
+    /// \brief Builds the table of \p view according to an execution policy
+    template
+    <
+        typename ExecutionPolicy,
+        typename View,
+        typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+    >
+    summed_area_table(ExecutionPolicy const& policy, View const& view, bool squares = false)
+        : summed_area_table(policy, view, 0, boundary_option::extend_zero, squares)
+    {}
+
+    /// \brief Builds the table of \p view extended by \p border pixels on every side according
+    /// to an execution policy
+    template
+    <
+        typename ExecutionPolicy,
+        typename View,
+        typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+    >
+    summed_area_table(
+        ExecutionPolicy const& policy,
+        View const& view,
+        std::ptrdiff_t border,
+        boundary_option option,
+        bool squares = false)
+        : width_(view.width())
+        , height_(view.height())
+        , border_(border)
+        , channels_(gil::num_channels<View>::value)
+        , stride_((view.width() + 2 * border + 1) * static_cast<std::ptrdiff_t>(channels_))
+    {
+        BOOST_ASSERT(border >= 0);
+        BOOST_ASSERT_MSG(option == boundary_option::extend_zero ||
+            option == boundary_option::extend_constant ||
+            option == boundary_option::extend_padded,
+            "Table borders require one of the extend options");
+
+        std::size_t const size =
+            static_cast<std::size_t>(stride_ * (height_ + 2 * border_ + 1));
+        sums_.assign(size, T(0));
+        if (squares)
+            squares_.assign(size, T(0));
+        if (view.width() == 0 || view.height() == 0)
+            return;
+
+        using accum_t = pixel<T, typename View::value_type::layout_t>;
+        detail::correlate_2d_row_loader<accum_t, View> const load_row(view, border, border, option);
+        std::ptrdiff_t const rows = height_ + 2 * border_;
+        std::ptrdiff_t const columns = width_ + 2 * border_;
+        std::ptrdiff_t const channels = static_cast<std::ptrdiff_t>(channels_);
+
+        // Sums along each row, which are independent
+        detail::for_each_row_band(policy, rows, [&](std::ptrdiff_t y0, std::ptrdiff_t y1)
+        {
+            std::vector<accum_t> buffer(static_cast<std::size_t>(columns));
+            for (std::ptrdiff_t y = y0; y < y1; ++y)
+            {
+                load_row(y - border_, buffer.data());
+                accumulate_row(sums_.data(), buffer.data(), y, columns, channels, false);
+                if (squares)
+                    accumulate_row(squares_.data(), buffer.data(), y, columns, channels, true);
+            }
+        });
+
+        // Sums down each column, in strips of adjacent columns which are independent
+        std::ptrdiff_t const strip_width = 256;
+        std::ptrdiff_t const strips = (stride_ + strip_width - 1) / strip_width;
+        detail::for_each_row_band(policy, strips, [&](std::ptrdiff_t s0, std::ptrdiff_t s1)
+        {
+            std::ptrdiff_t const first = s0 * strip_width;
+            std::ptrdiff_t const last = (std::min)(s1 * strip_width, stride_);
+            accumulate_columns(sums_.data(), first, last, rows);
+            if (squares)
+                accumulate_columns(squares_.data(), first, last, rows);
+        });
+    }
+
+    /// \brief Returns the width of the view the table was built from, without border
+    auto width() const -> std::ptrdiff_t { return width_; }
+
+    /// \brief Returns the height of the view the table was built from, without border
+    auto height() const -> std::ptrdiff_t { return height_; }
+
+    /// \brief Returns the number of pixels by which the table extends the view on every side
+    auto border() const -> std::ptrdiff_t { return border_; }
+
+    auto num_channels() const -> std::size_t { return channels_; }
+
+    /// \brief Returns whether the table holds the sums of squares needed by variance()
+    auto has_squares() const -> bool { return !squares_.empty(); }
+
+    /// \brief Returns the sum of a channel over the pixels of the rectangle at (\p x, \p y) of
+    /// size \p width x \p height
+    /// \param channel - Index of the channel in the layout of the view.
+    auto sum(
+        std::ptrdiff_t x,
+        std::ptrdiff_t y,
+        std::ptrdiff_t width,
+        std::ptrdiff_t height,
+        std::size_t channel = 0) const -> T
+    {
+        return rectangle(sums_, x, y, width, height, channel);
+    }
+
+    /// \brief Returns the sum of the squares of a channel over the pixels of a rectangle
+    auto square_sum(
+        std::ptrdiff_t x,
+        std::ptrdiff_t y,
+        std::ptrdiff_t width,
+        std::ptrdiff_t height,
+        std::size_t channel = 0) const -> T
+    {
+        BOOST_ASSERT_MSG(has_squares(), "The table was built without the sums of squares");
+        return rectangle(squares_, x, y, width, height, channel);
+    }
+
+    /// \brief Returns the mean of a channel over the pixels of a non-empty rectangle
+    auto mean(
+        std::ptrdiff_t x,
+        std::ptrdiff_t y,
+        std::ptrdiff_t width,
+        std::ptrdiff_t height,
+        std::size_t channel = 0) const -> double
+    {
+        BOOST_ASSERT(width > 0 && height > 0);
+        return static_cast<double>(sum(x, y, width, height, channel)) /
+            static_cast<double>(width * height);
+    }
+
+    /// \brief Returns the population variance of a channel over the pixels of a non-empty
+    /// rectangle, which requires the table to be built with the sums of squares
+    auto variance(
+        std::ptrdiff_t x,
+        std::ptrdiff_t y,
+        std::ptrdiff_t width,
+        std::ptrdiff_t height,
+        std::size_t channel = 0) const -> double
+    {
+        double const area = static_cast<double>(width * height);
+        double const m = mean(x, y, width, height, channel);
+        double const square_mean =
+            static_cast<double>(square_sum(x, y, width, height, channel)) / area;
+        return (std::max)(square_mean - m * m, 0.0);
+    }
+
+private:
+    // Entry of the table at the top left corner of pixel (x, y) of the view
+    auto at(std::vector<T> const& table, std::ptrdiff_t x, std::ptrdiff_t y, std::size_t channel)
+        const -> T
+    {
+        std::ptrdiff_t const index = (y + border_) * stride_ +
+            (x + border_) * static_cast<std::ptrdiff_t>(channels_) +
+            static_cast<std::ptrdiff_t>(channel);
+        return table[static_cast<std::size_t>(index)];
+    }
+
+    auto rectangle(
+        std::vector<T> const& table,
+        std::ptrdiff_t x,
+        std::ptrdiff_t y,
+        std::ptrdiff_t width,
+        std::ptrdiff_t height,
+        std::size_t channel) const -> T
+    {
+        BOOST_ASSERT(width >= 0 && height >= 0 && channel < channels_);
+        BOOST_ASSERT(x >= -border_ && x + width <= width_ + border_);
+        BOOST_ASSERT(y >= -border_ && y + height <= height_ + border_);
+        return at(table, x + width, y + height, channel) - at(table, x, y + height, channel) -
+            at(table, x + width, y, channel) + at(table, x, y, channel);
+    }
+
+    // Writes the running sums of buffer row y into table row y + 1, past its zero first entry
+    template <typename PixelAccum>
+    void accumulate_row(
+        T* table,
+        PixelAccum const* buffer,
+        std::ptrdiff_t y,
+        std::ptrdiff_t columns,
+        std::ptrdiff_t channels,
+        bool square) const
+    {
+        T* it = table + (y + 1) * stride_;
+        for (std::ptrdiff_t x = 0; x < columns; ++x, it += channels)
+        {
+            for (std::ptrdiff_t c = 0; c < channels; ++c)
+            {
+                T const value = buffer[x][c];
+                it[channels + c] = it[c] + (square ? value * value : value);
+            }
+        }
+    }
+
+    // Adds each of table rows 1 to rows - 1 to the next one, for entries [first, last)
+    void accumulate_columns(
+        T* table, std::ptrdiff_t first, std::ptrdiff_t last, std::ptrdiff_t rows) const
+    {
+        for (std::ptrdiff_t y = 1; y < rows; ++y)
+        {
+            T const* above = table + y * stride_;
+            T* it = table + (y + 1) * stride_;
+            for (std::ptrdiff_t i = first; i < last; ++i)
+                it[i] += above[i];
+        }
+    }
+
+    std::ptrdiff_t width_ = 0;
+    std::ptrdiff_t height_ = 0;
+    std::ptrdiff_t border_ = 0;
+    std::size_t channels_ = 0;
+    std::ptrdiff_t stride_ = 0;
+    std::vector<T> sums_;
+    std::vector<T> squares_;
+};
+
+}} // namespace boost::gil
+
+#endif
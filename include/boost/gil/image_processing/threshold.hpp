@@ -13,16 +13,23 @@
 #include <array>
 #include <type_traits>
 #include <cstddef>
+#include <cstdint>
 #include <algorithm>
 #include <vector>
 #include <cmath>
 
 #include <boost/assert.hpp>
 
+#include <boost/gil/execution.hpp>
+#include <boost/gil/histogram.hpp>
 #include <boost/gil/image.hpp>
 #include <boost/gil/image_processing/kernel.hpp>
 #include <boost/gil/image_processing/convolve.hpp>
+#include <boost/gil/image_processing/filter.hpp>
 #include <boost/gil/image_processing/numeric.hpp>
+#include <boost/gil/image_processing/summed_area_table.hpp>
+#include <boost/gil/detail/byte_rows.hpp>
+#include <boost/gil/detail/simd.hpp>
 
 namespace boost { namespace gil {
 
@@ -59,6 +66,183 @@ void threshold_impl(SrcView const& src_view, DstView const& dst_view, Operator c
     }
 }
 
+/// \brief Describes the fixed thresholds as dst = src > threshold ? above : below, where above
+/// and below are either a constant or the source value
+template <typename Channel>
+struct threshold_op_desc
+{
+    Channel threshold;
+    Channel above;
+    Channel below;
+    bool above_is_pixel;
+    bool below_is_pixel;
+};
+
+/// \brief Applies a fixed threshold to \p count bytes, 16 at a time where possible
+inline void threshold_bytes(
+    std::uint8_t const* src,
+    std::uint8_t* dst,
+    std::ptrdiff_t count,
+    threshold_op_desc<std::uint8_t> const& desc)
+{
+    std::ptrdiff_t i = 0;
+    // Values from the source are selected by masks, so that constants and pixels are blended
+    // alike
+    std::uint8_t const above_mask = desc.above_is_pixel ? 0xFF : 0;
+    std::uint8_t const above_value = desc.above_is_pixel ? 0 : desc.above;
+    std::uint8_t const below_mask = desc.below_is_pixel ? 0xFF : 0;
+    std::uint8_t const below_value = desc.below_is_pixel ? 0 : desc.below;
+#if defined(BOOST_GIL_SIMD_SSE2)
+    // Unsigned comparison as signed comparison of the values with their top bit flipped
+    __m128i const sign = _mm_set1_epi8(static_cast<char>(0x80));
+    __m128i const threshold = _mm_set1_epi8(static_cast<char>(desc.threshold ^ 0x80));
+    __m128i const above_masks = _mm_set1_epi8(static_cast<char>(above_mask));
+    __m128i const above_values = _mm_set1_epi8(static_cast<char>(above_value));
+    __m128i const below_masks = _mm_set1_epi8(static_cast<char>(below_mask));
+    __m128i const below_values = _mm_set1_epi8(static_cast<char>(below_value));
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src + i));
+        __m128i const greater = _mm_cmpgt_epi8(_mm_xor_si128(v, sign), threshold);
+        __m128i const above = _mm_or_si128(_mm_and_si128(v, above_masks), above_values);
+        __m128i const below = _mm_or_si128(_mm_and_si128(v, below_masks), below_values);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+            _mm_or_si128(_mm_and_si128(greater, above), _mm_andnot_si128(greater, below)));
+    }
+#elif defined(BOOST_GIL_SIMD_NEON)
+    uint8x16_t const threshold = vdupq_n_u8(desc.threshold);
+    uint8x16_t const above_masks = vdupq_n_u8(above_mask);
+    uint8x16_t const above_values = vdupq_n_u8(above_value);
+    uint8x16_t const below_masks = vdupq_n_u8(below_mask);
+    uint8x16_t const below_values = vdupq_n_u8(below_value);
+    for (; i + 16 <= count; i += 16)
+    {
+        uint8x16_t const v = vld1q_u8(src + i);
+        uint8x16_t const above = vorrq_u8(vandq_u8(v, above_masks), above_values);
+        uint8x16_t const below = vorrq_u8(vandq_u8(v, below_masks), below_values);
+        vst1q_u8(dst + i, vbslq_u8(vcgtq_u8(v, threshold), above, below));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        std::uint8_t const v = src[i];
+        dst[i] = v > desc.threshold
+            ? static_cast<std::uint8_t>((v & above_mask) | above_value)
+            : static_cast<std::uint8_t>((v & below_mask) | below_value);
+    }
+}
+
+/// \brief Applies a threshold per byte, dst = src > thresholds ? above : below, 16 bytes at a
+/// time where possible
+/// \param thresholds - Thresholds of the bytes, within [-1, 255].
+inline void threshold_bytes(
+    std::uint8_t const* src,
+    std::int16_t const* thresholds,
+    std::uint8_t* dst,
+    std::ptrdiff_t count,
+    std::uint8_t above,
+    std::uint8_t below)
+{
+    std::ptrdiff_t i = 0;
+#if defined(BOOST_GIL_SIMD_SSE2)
+    __m128i const zero = _mm_setzero_si128();
+    __m128i const above_values = _mm_set1_epi8(static_cast<char>(above));
+    __m128i const below_values = _mm_set1_epi8(static_cast<char>(below));
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src + i));
+        __m128i const low = _mm_loadu_si128(reinterpret_cast<__m128i const*>(thresholds + i));
+        __m128i const high =
+            _mm_loadu_si128(reinterpret_cast<__m128i const*>(thresholds + i + 8));
+        __m128i const greater = _mm_packs_epi16(
+            _mm_cmpgt_epi16(_mm_unpacklo_epi8(v, zero), low),
+            _mm_cmpgt_epi16(_mm_unpackhi_epi8(v, zero), high));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_or_si128(
+            _mm_and_si128(greater, above_values), _mm_andnot_si128(greater, below_values)));
+    }
+#elif defined(BOOST_GIL_SIMD_NEON)
+    uint8x16_t const above_values = vdupq_n_u8(above);
+    uint8x16_t const below_values = vdupq_n_u8(below);
+    for (; i + 16 <= count; i += 16)
+    {
+        uint8x16_t const v = vld1q_u8(src + i);
+        int16x8_t const low = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(v)));
+        int16x8_t const high = vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(v)));
+        uint8x16_t const greater = vcombine_u8(
+            vmovn_u16(vcgtq_s16(low, vld1q_s16(thresholds + i))),
+            vmovn_u16(vcgtq_s16(high, vld1q_s16(thresholds + i + 8))));
+        vst1q_u8(dst + i, vbslq_u8(greater, above_values, below_values));
+    }
+#endif
+    for (; i < count; ++i)
+        dst[i] = src[i] > thresholds[i] ? above : below;
+}
+
+template
+<
+    typename SourceChannelT,
+    typename ResultChannelT,
+    typename SrcView,
+    typename DstView,
+    typename Operator,
+    typename Desc
+>
+void threshold_impl(
+    SrcView const& src_view,
+    DstView const& dst_view,
+    Operator const& threshold_op,
+    Desc const&,
+    std::false_type)
+{
+    threshold_impl<SourceChannelT, ResultChannelT>(src_view, dst_view, threshold_op);
+}
+
+template
+<
+    typename SourceChannelT,
+    typename ResultChannelT,
+    typename SrcView,
+    typename DstView,
+    typename Operator,
+    typename Desc
+>
+void threshold_impl(
+    SrcView const& src_view,
+    DstView const& dst_view,
+    Operator const&,
+    Desc const& desc,
+    std::true_type)
+{
+    std::ptrdiff_t const count =
+        src_view.width() * static_cast<std::ptrdiff_t>(num_channels<SrcView>::value);
+    for (std::ptrdiff_t y = 0; y < src_view.height(); y++)
+    {
+        threshold_bytes(
+            reinterpret_cast<std::uint8_t const*>(&src_view.row_begin(y)[0]),
+            reinterpret_cast<std::uint8_t*>(&dst_view.row_begin(y)[0]), count, desc);
+    }
+}
+
+/// \brief Applies the threshold operator to each channel, or the equivalent description to the
+/// rows of interleaved 8-bit views, as arrays of bytes
+template
+<
+    typename SourceChannelT,
+    typename ResultChannelT,
+    typename SrcView,
+    typename DstView,
+    typename Operator
+>
+void threshold_impl(
+    SrcView const& src_view,
+    DstView const& dst_view,
+    Operator const& threshold_op,
+    threshold_op_desc<ResultChannelT> const& desc)
+{
+    threshold_impl<SourceChannelT, ResultChannelT>(src_view, dst_view, threshold_op, desc,
+        is_byte_row_views<SrcView, DstView>());
+}
+
 } //namespace boost::gil::detail
 
 /// \addtogroup ImageProcessing
@@ -122,15 +306,19 @@ void threshold_binary(
     {
         detail::threshold_impl<source_channel_t, result_channel_t>(src_view, dst_view,
             [threshold_value, max_value](source_channel_t px) -> result_channel_t {
-                return px > threshold_value ? max_value : 0;
-            });
+                return px > threshold_value ? max_value : result_channel_t(0);
+            },
+            detail::threshold_op_desc<result_channel_t>{
+                threshold_value, max_value, result_channel_t(0), false, false});
     }
     else
     {
         detail::threshold_impl<source_channel_t, result_channel_t>(src_view, dst_view,
             [threshold_value, max_value](source_channel_t px) -> result_channel_t {
-                return px > threshold_value ? 0 : max_value;
-            });
+                return px > threshold_value ? result_channel_t(0) : max_value;
+            },
+            detail::threshold_op_desc<result_channel_t>{
+                threshold_value, result_channel_t(0), max_value, false, false});
     }
 }
 
@@ -155,7 +343,7 @@ void threshold_binary(
     //deciding output channel type and creating functor
     using result_channel_t = typename channel_type<DstView>::type;
 
-    result_channel_t max_value = (std::numeric_limits<result_channel_t>::max)();
+    result_channel_t max_value = channel_traits<result_channel_t>::max_value();
     threshold_binary(src_view, dst_view, threshold_value, max_value, direction);
 }
 
@@ -192,14 +380,18 @@ void threshold_truncate(
             detail::threshold_impl<source_channel_t, result_channel_t>(src_view, dst_view,
                 [threshold_value](source_channel_t px) -> result_channel_t {
                     return px > threshold_value ? threshold_value : px;
-                });
+                },
+                detail::threshold_op_desc<result_channel_t>{
+                    threshold_value, threshold_value, threshold_value, false, true});
         }
         else
         {
             detail::threshold_impl<source_channel_t, result_channel_t>(src_view, dst_view,
                 [threshold_value](source_channel_t px) -> result_channel_t {
                     return px > threshold_value ? px : threshold_value;
-                });
+                },
+                detail::threshold_op_desc<result_channel_t>{
+                    threshold_value, threshold_value, threshold_value, true, false});
         }
     }
     else
@@ -209,70 +401,143 @@ void threshold_truncate(
             detail::threshold_impl<source_channel_t, result_channel_t>(src_view, dst_view,
                 [threshold_value](source_channel_t px) -> result_channel_t {
                     return px > threshold_value ? px : 0;
-                });
+                },
+                detail::threshold_op_desc<result_channel_t>{
+                    threshold_value, result_channel_t(0), result_channel_t(0), true, false});
         }
         else
         {
             detail::threshold_impl<source_channel_t, result_channel_t>(src_view, dst_view,
                 [threshold_value](source_channel_t px) -> result_channel_t {
                     return px > threshold_value ? 0 : px;
-                });
+                },
+                detail::threshold_op_desc<result_channel_t>{
+                    threshold_value, result_channel_t(0), result_channel_t(0), false, true});
         }
     }
 }
 
 namespace detail{
 
-template <typename SrcView, typename DstView>
-void otsu_impl(SrcView const& src_view, DstView const& dst_view, threshold_direction direction)
+/// \brief Returns the bin in [0, 255] of a channel value scaled from [low, low + 255 / scale],
+/// as a gray pixel, so that a view of the bins can fill a dense_histogram
+template <typename SrcView>
+class otsu_bin_deref_fn : public deref_base
+<
+    otsu_bin_deref_fn<SrcView>,
+    gray8_pixel_t, gray8_pixel_t, gray8_pixel_t const&,
+    typename SrcView::const_t::reference, gray8_pixel_t, false
+>
+{
+public:
+    otsu_bin_deref_fn() = default;
+    otsu_bin_deref_fn(double low, double scale) : low_(low), scale_(scale) {}
+
+    auto operator()(typename SrcView::const_t::reference px) const -> gray8_pixel_t
+    {
+        using channel_t = typename channel_type<SrcView>::type;
+        return gray8_pixel_t(static_cast<std::uint8_t>(
+            (static_cast<double>(channel_t(px)) - low_) * scale_));
+    }
+
+private:
+    double low_ = 0;
+    double scale_ = 1;
+};
+
+/// \brief Fills the histogram of otsu_impl with the bins of the values scaled to [0, 255]
+template <typename ExecutionPolicy, typename SrcView>
+void fill_otsu_histogram(
+    ExecutionPolicy const& policy,
+    SrcView const& src_view,
+    dense_histogram<std::uint8_t>& histogram,
+    double low,
+    double scale,
+    std::true_type /* scaled */)
+{
+    using bins_t = typename SrcView::template add_deref<otsu_bin_deref_fn<SrcView>>;
+    fill_histogram(policy, bins_t::make(src_view, otsu_bin_deref_fn<SrcView>(low, scale)),
+        histogram);
+}
+
+/// \brief Fills the histogram of otsu_impl with the values of an unsigned 8-bit channel
+template <typename ExecutionPolicy, typename SrcView>
+void fill_otsu_histogram(
+    ExecutionPolicy const& policy,
+    SrcView const& src_view,
+    dense_histogram<std::uint8_t>& histogram,
+    double,
+    double,
+    std::false_type /* scaled */)
+{
+    fill_histogram(policy, src_view, histogram);
+}
+
+template <typename ExecutionPolicy, typename SrcView, typename DstView>
+void otsu_impl(
+    ExecutionPolicy const& policy,
+    SrcView const& src_view,
+    DstView const& dst_view,
+    threshold_direction direction)
 {
     //deciding output channel type and creating functor
     using source_channel_t = typename channel_type<SrcView>::type;
 
-    std::array<std::size_t, 256> histogram{};
+    dense_histogram<std::uint8_t> histogram;
     //initial value of min is set to maximum possible value to compare histogram data
     //initial value of max is set to minimum possible value to compare histogram data
-    auto min = (std::numeric_limits<source_channel_t>::max)(),
-        max = (std::numeric_limits<source_channel_t>::min)();
+    using base_t = typename base_channel_type<source_channel_t>::type;
+    auto min = source_channel_t((std::numeric_limits<base_t>::max)()),
+        max = source_channel_t(std::numeric_limits<base_t>::lowest());
+    using scaled_t = std::integral_constant
+    <
+        bool, (sizeof(source_channel_t) > 1) || std::is_signed<source_channel_t>::value
+    >;
+    bool const is_scaled = scaled_t::value;
+    double low = 0.0, scale = 1.0;
 
-    if (sizeof(source_channel_t) > 1 || std::is_signed<source_channel_t>::value)
+    if (is_scaled)
     {
-        //iterate over the image to find the min and max pixel values
-        for (std::ptrdiff_t y = 0; y < src_view.height(); y++)
+        //find the min and max pixel values of each band of rows, then of the image
+        using range_t = std::pair<source_channel_t, source_channel_t>;
+        std::vector<range_t> ranges(
+            row_band_count(policy, src_view.height()), range_t(min, max));
+        std::size_t const bands = for_each_indexed_row_band(policy, src_view.height(),
+            [&](std::size_t band, std::ptrdiff_t y0, std::ptrdiff_t y1)
         {
-            typename SrcView::x_iterator src_it = src_view.row_begin(y);
-            for (std::ptrdiff_t x = 0; x < src_view.width(); x++)
+            range_t range = ranges[band];
+            for (std::ptrdiff_t y = y0; y < y1; y++)
             {
-                if (src_it[x] < min) min = src_it[x];
-                if (src_it[x] > min) min = src_it[x];
+                typename SrcView::x_iterator src_it = src_view.row_begin(y);
+                for (std::ptrdiff_t x = 0; x < src_view.width(); x++)
+                {
+                    source_channel_t const value = src_it[x];
+                    if (value < range.first) range.first = value;
+                    if (value > range.second) range.second = value;
+                }
             }
+            ranges[band] = range;
+        });
+        for (std::size_t band = 0; band < bands; ++band)
+        {
+            if (ranges[band].first < min) min = ranges[band].first;
+            if (ranges[band].second > max) max = ranges[band].second;
         }
 
-        //making histogram
-        for (std::ptrdiff_t y = 0; y < src_view.height(); y++)
+        // A constant image is entirely background
+        if (max <= min)
         {
-            typename SrcView::x_iterator src_it = src_view.row_begin(y);
-
-            for (std::ptrdiff_t x = 0; x < src_view.width(); x++)
-            {
-                histogram[((src_it[x] - min) * 255) / (max - min)]++;
-            }
+            threshold_binary(src_view, dst_view, max, direction);
+            return;
         }
-    }
-    else
-    {
-        //making histogram
-        for (std::ptrdiff_t y = 0; y < src_view.height(); y++)
-        {
-            typename SrcView::x_iterator src_it = src_view.row_begin(y);
 
-            for (std::ptrdiff_t x = 0; x < src_view.width(); x++)
-            {
-                histogram[src_it[x]]++;
-            }
-        }
+        low = static_cast<double>(min);
+        scale = 255.0 / (static_cast<double>(max) - low);
     }
 
+    //making histogram, of the values scaled to [0, 255] if needed
+    fill_otsu_histogram(policy, src_view, histogram, low, scale, scaled_t{});
+
     //histData = histogram data
     //sum = total (background + foreground)
     //sumB = sum background
@@ -284,31 +549,34 @@ void otsu_impl(SrcView const& src_view, DstView const& dst_view, threshold_direc
     //varBeetween = between class variance
     //http://www.labbookpages.co.uk/software/imgProc/otsuThreshold.html
     //https://www.ipol.im/pub/art/2016/158/
-    std::ptrdiff_t total_pixel = src_view.height() * src_view.width();
-    std::ptrdiff_t sum_total = 0, sum_back = 0;
+    std::size_t total_pixel = static_cast<std::size_t>(src_view.height() * src_view.width());
+    std::size_t sum_total = 0, sum_back = 0;
     std::size_t weight_back = 0, weight_fore = 0, threshold = 0;
     double var_max = 0, mean_back, mean_fore, var_intra_class;
 
+    std::array<std::size_t, 256> counts{};
     for (std::size_t t = 0; t < 256; t++)
     {
-        sum_total += t * histogram[t];
+        counts[t] = static_cast<std::size_t>(histogram.data()[t]);
+        sum_total += t * counts[t];
     }
 
-    for (int t = 0; t < 256; t++)
+    for (std::size_t t = 0; t < 256; t++)
     {
-        weight_back += histogram[t];               // Weight Background
+        weight_back += counts[t];               // Weight Background
         if (weight_back == 0) continue;
 
         weight_fore = total_pixel - weight_back;          // Weight Foreground
         if (weight_fore == 0) break;
 
-        sum_back += t * histogram[t];
+        sum_back += t * counts[t];
 
-        mean_back = sum_back / weight_back;            // Mean Background
-        mean_fore = (sum_total - sum_back) / weight_fore;    // Mean Foreground
+        mean_back = static_cast<double>(sum_back / weight_back);            // Mean Background
+        mean_fore = static_cast<double>((sum_total - sum_back) / weight_fore); // Mean Foreground
 
         // Calculate Between Class Variance
-        var_intra_class = weight_back * weight_fore * (mean_back - mean_fore) * (mean_back - mean_fore);
+        var_intra_class = static_cast<double>(weight_back) * static_cast<double>(weight_fore) *
+            (mean_back - mean_fore) * (mean_back - mean_fore);
 
         // Check if new maximum found
         if (var_intra_class > var_max) {
@@ -316,19 +584,43 @@ void otsu_impl(SrcView const& src_view, DstView const& dst_view, threshold_direc
             threshold = t;
         }
     }
-    if (sizeof(source_channel_t) > 1 && std::is_unsigned<source_channel_t>::value)
+    if (is_scaled)
     {
-        threshold_binary(src_view, dst_view, (threshold * (max - min) / 255) + min, direction);
+        // Bin t holds the values v with (v - min) * 255 / (max - min) in [t, t + 1), so the
+        // background ends below min + (t + 1) * (max - min) / 255. Integral channels take the
+        // last value below it, floating-point ones the bound itself, their range being as
+        // small as one.
+        double const range = static_cast<double>(max) - static_cast<double>(min);
+        double const bound = static_cast<double>(threshold + 1) * range;
+        double const value = static_cast<double>(min) +
+            (detail::is_channel_integral<source_channel_t>::value
+                ? std::floor((bound - 1.0) / 255.0)
+                : bound / 255.0);
+        using dst_channel_t = typename channel_type<DstView>::type;
+        threshold_binary(src_view, dst_view,
+            dst_channel_t(static_cast<typename base_channel_type<dst_channel_t>::type>(value)),
+            direction);
     }
     else {
-        threshold_binary(src_view, dst_view, threshold, direction);
+        threshold_binary(src_view, dst_view,
+            static_cast<typename channel_type<DstView>::type>(threshold), direction);
     }
 }
 } //namespace detail
 
-template <typename SrcView, typename DstView>
+/// \ingroup ImageProcessing
+/// \brief Applies the optimal threshold of each channel of the source view, computing the
+/// histograms according to an execution policy
+template
+<
+    typename ExecutionPolicy,
+    typename SrcView,
+    typename DstView,
+    typename std::enable_if<is_execution_policy<ExecutionPolicy>::value, int>::type = 0
+>
 void threshold_optimal
 (
+    ExecutionPolicy const& policy,
     SrcView const& src_view,
     DstView const& dst_view,
     threshold_optimal_value mode = threshold_optimal_value::otsu,
@@ -337,30 +629,220 @@ void threshold_optimal
 {
     if (mode == threshold_optimal_value::otsu)
     {
-        for (std::size_t i = 0; i < src_view.num_channels(); i++)
+        for (int i = 0; i < static_cast<int>(num_channels<SrcView>::value); i++)
         {
             detail::otsu_impl
-                (nth_channel_view(src_view, i), nth_channel_view(dst_view, i), direction);
+                (policy, nth_channel_view(src_view, i), nth_channel_view(dst_view, i), direction);
         }
     }
 }
 
+template <typename SrcView, typename DstView>
+void threshold_optimal
+(
+    SrcView const& src_view,
+    DstView const& dst_view,
+    threshold_optimal_value mode = threshold_optimal_value::otsu,
+    threshold_direction direction = threshold_direction::regular
+)
+{
+    threshold_optimal(execution::seq, src_view, dst_view, mode, direction);
+}
+
 namespace detail {
 
+/// \brief Largest kernel size whose sums of 8-bit channels fit in 32 bits, 255 * 4103^2 < 2^32
+constexpr std::size_t adaptive_mean_max_kernel_32 = 4103;
+
+/// \brief Provides the rows of mean thresholds of an adaptive threshold from a summed-area
+/// table, at a cost independent of the kernel size
+///
+/// The means are those of box_filter, over the kernel centred on each pixel, with zeros
+/// outside the view.
+///
+/// Sums of 8-bit unsigned channels over kernels of up to adaptive_mean_max_kernel_32 pixels
+/// square fit in 32 bits, and the wraparound of the table cancels out over a rectangle. Larger
+/// kernels must be given 64-bit sums through \p Sum.
+template
+<
+    typename SrcView,
+    typename Sum = typename std::conditional
+    <
+        std::is_same<typename channel_type<SrcView>::type, std::uint8_t>::value,
+        std::uint32_t,
+        typename std::conditional
+        <
+            is_channel_integral<typename channel_type<SrcView>::type>::value,
+            std::int64_t,
+            double
+        >::type
+    >::type
+>
+class adaptive_mean_rows
+{
+    using channel_t = typename channel_type<SrcView>::type;
+    using base_t = typename base_channel_type<channel_t>::type;
+    using sum_t = Sum;
+
+public:
+    using value_type = typename SrcView::value_type;
+
+    adaptive_mean_rows(SrcView const& view, std::size_t kernel_size)
+        : radius_(static_cast<std::ptrdiff_t>(kernel_size / 2))
+        , size_(static_cast<std::ptrdiff_t>(kernel_size))
+        , table_(view, radius_, boundary_option::extend_zero)
+    {
+        BOOST_ASSERT((!std::is_same<sum_t, std::uint32_t>::value ||
+            kernel_size <= adaptive_mean_max_kernel_32));
+    }
+
+    void operator()(std::ptrdiff_t y, value_type* row) const
+    {
+        std::ptrdiff_t const top = y - radius_;
+        for (std::ptrdiff_t x = 0; x < table_.width(); ++x)
+        {
+            for (std::size_t c = 0; c < num_channels<SrcView>::value; ++c)
+            {
+                sum_t const sum = table_.sum(x - radius_, top, size_, size_, c);
+                dynamic_at_c(row[x], c) = mean(sum, detail::is_channel_integral<channel_t>());
+            }
+        }
+    }
+
+private:
+    auto mean(sum_t sum, std::true_type) const -> channel_t
+    {
+        return channel_t(static_cast<base_t>(sum / static_cast<sum_t>(size_ * size_)));
+    }
+
+    auto mean(sum_t sum, std::false_type) const -> channel_t
+    {
+        double const area = static_cast<double>(size_ * size_);
+        return channel_t(static_cast<base_t>(static_cast<double>(sum) / area));
+    }
+
+    std::ptrdiff_t radius_;
+    std::ptrdiff_t size_;
+    summed_area_table<sum_t> table_;
+};
+
+/// \brief Provides the rows of thresholds of an adaptive threshold from a view of them
+template <typename View>
+class adaptive_view_rows
+{
+public:
+    using value_type = typename View::value_type;
+
+    explicit adaptive_view_rows(View const& view) : view_(view) {}
+
+    void operator()(std::ptrdiff_t y, value_type* row) const
+    {
+        std::copy(view_.row_begin(y), view_.row_end(y), row);
+    }
+
+private:
+    View view_;
+};
+
+/// \brief Applies the adaptive threshold to each channel, src > threshold - constant
+template
+<
+    typename SourceChannelT,
+    typename ResultChannelT,
+    typename SrcView,
+    typename DstView,
+    typename ThresholdRows,
+    typename Operator
+>
+void adaptive_impl
+(
+    SrcView const& src_view,
+    ThresholdRows const& threshold_rows,
+    DstView const& dst_view,
+    Operator const& threshold_op,
+    ResultChannelT,
+    ResultChannelT,
+    ResultChannelT,
+    std::false_type
+)
+{
+    std::vector<typename ThresholdRows::value_type> thresholds(
+        static_cast<std::size_t>(src_view.width()));
+    for (std::ptrdiff_t y = 0; y < src_view.height(); y++)
+    {
+        threshold_rows(y, thresholds.data());
+        typename SrcView::x_iterator src_it = src_view.row_begin(y);
+        typename DstView::x_iterator dst_it = dst_view.row_begin(y);
+
+        for (std::ptrdiff_t x = 0; x < src_view.width(); x++)
+        {
+            static_transform(src_it[x], thresholds[static_cast<std::size_t>(x)], dst_it[x],
+                threshold_op);
+        }
+    }
+}
+
+// Rows of interleaved 8-bit pixels are compared as arrays of bytes to 16-bit thresholds
 template
 <
     typename SourceChannelT,
     typename ResultChannelT,
     typename SrcView,
     typename DstView,
+    typename ThresholdRows,
     typename Operator
 >
 void adaptive_impl
 (
     SrcView const& src_view,
-    SrcView const& convolved_view,
+    ThresholdRows const& threshold_rows,
     DstView const& dst_view,
-    Operator const& threshold_op
+    Operator const&,
+    ResultChannelT constant,
+    ResultChannelT above,
+    ResultChannelT below,
+    std::true_type
+)
+{
+    std::size_t const count =
+        static_cast<std::size_t>(src_view.width()) * num_channels<SrcView>::value;
+    std::vector<typename ThresholdRows::value_type> thresholds(
+        static_cast<std::size_t>(src_view.width()));
+    std::vector<std::int16_t> offset_thresholds(count);
+    for (std::ptrdiff_t y = 0; y < src_view.height(); y++)
+    {
+        threshold_rows(y, thresholds.data());
+        auto const* values = reinterpret_cast<std::uint8_t const*>(thresholds.data());
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            // Any threshold below zero lets all values through
+            offset_thresholds[i] = static_cast<std::int16_t>(
+                (std::max)(static_cast<int>(values[i]) - static_cast<int>(constant), -1));
+        }
+        threshold_bytes(
+            reinterpret_cast<std::uint8_t const*>(&src_view.row_begin(y)[0]),
+            offset_thresholds.data(),
+            reinterpret_cast<std::uint8_t*>(&dst_view.row_begin(y)[0]),
+            static_cast<std::ptrdiff_t>(count), above, below);
+    }
+}
+
+template
+<
+    typename SourceChannelT,
+    typename ResultChannelT,
+    typename SrcView,
+    typename DstView,
+    typename ThresholdRows
+>
+void adaptive_impl
+(
+    SrcView const& src_view,
+    ThresholdRows const& threshold_rows,
+    DstView const& dst_view,
+    ResultChannelT max_value,
+    threshold_direction direction,
+    ResultChannelT constant
 )
 {
     //template argument validation
@@ -373,17 +855,20 @@ void adaptive_impl
         typename color_space_type<DstView>::type
     >::value, "Source and destination views must have pixels with the same color space");
 
-    //iterate over the image checking each pixel value for the threshold
-    for (std::ptrdiff_t y = 0; y < src_view.height(); y++)
+    using is_byte_t = detail::is_byte_row_views<SrcView, DstView>;
+    if (direction == threshold_direction::regular)
     {
-        typename SrcView::x_iterator src_it = src_view.row_begin(y);
-        typename SrcView::x_iterator convolved_it = convolved_view.row_begin(y);
-        typename DstView::x_iterator dst_it = dst_view.row_begin(y);
-
-        for (std::ptrdiff_t x = 0; x < src_view.width(); x++)
-        {
-            static_transform(src_it[x], convolved_it[x], dst_it[x], threshold_op);
-        }
+        adaptive_impl<SourceChannelT, ResultChannelT>(src_view, threshold_rows, dst_view,
+            [max_value, constant](SourceChannelT px, SourceChannelT threshold) -> ResultChannelT
+        { return px > (threshold - constant) ? max_value : 0; },
+            constant, max_value, ResultChannelT(0), is_byte_t());
+    }
+    else
+    {
+        adaptive_impl<SourceChannelT, ResultChannelT>(src_view, threshold_rows, dst_view,
+            [max_value, constant](SourceChannelT px, SourceChannelT threshold) -> ResultChannelT
+        { return px > (threshold - constant) ? 0 : max_value; },
+            constant, ResultChannelT(0), max_value, is_byte_t());
     }
 }
 } //namespace boost::gil::detail
@@ -403,39 +888,30 @@ void threshold_adaptive
     BOOST_ASSERT_MSG((kernel_size % 2 != 0), "Kernel size must be an odd number");
 
     typedef typename channel_type<SrcView>::type source_channel_t;
-    typedef typename channel_type<DstView>::type result_channel_t;
-
-    image<typename SrcView::value_type> temp_img(src_view.width(), src_view.height());
-    typename image<typename SrcView::value_type>::view_t temp_view = view(temp_img);
-    SrcView temp_conv(temp_view);
 
-    if (method == threshold_adaptive_method::mean)
+    if (method == threshold_adaptive_method::mean &&
+        std::is_same<source_channel_t, std::uint8_t>::value &&
+        kernel_size > detail::adaptive_mean_max_kernel_32)
     {
-        std::vector<float> mean_kernel_values(kernel_size, 1.0f/kernel_size);
-        kernel_1d<float> kernel(mean_kernel_values.begin(), kernel_size, kernel_size/2);
-
-        detail::convolve_1d
-        <
-            pixel<float, typename SrcView::value_type::layout_t>
-        >(src_view, kernel, temp_view);
+        detail::adaptive_impl<source_channel_t>(src_view,
+            detail::adaptive_mean_rows<SrcView, std::int64_t>(src_view, kernel_size),
+            dst_view, max_value, direction, constant);
     }
-    else if (method == threshold_adaptive_method::gaussian)
+    else if (method == threshold_adaptive_method::mean)
     {
-        detail::kernel_2d<float> kernel = generate_gaussian_kernel(kernel_size, 1.0);
-        convolve_2d(src_view, kernel, temp_view);
+        detail::adaptive_impl<source_channel_t>(src_view,
+            detail::adaptive_mean_rows<SrcView>(src_view, kernel_size),
+            dst_view, max_value, direction, constant);
     }
-
-    if (direction == threshold_direction::regular)
-    {
-        detail::adaptive_impl<source_channel_t, result_channel_t>(src_view, temp_conv, dst_view,
-            [max_value, constant](source_channel_t px, source_channel_t threshold) -> result_channel_t
-        { return px > (threshold - constant) ? max_value : 0; });
-    }
-    else
+    else if (method == threshold_adaptive_method::gaussian)
     {
-        detail::adaptive_impl<source_channel_t, result_channel_t>(src_view, temp_conv, dst_view,
-            [max_value, constant](source_channel_t px, source_channel_t threshold) -> result_channel_t
-        { return px > (threshold - constant) ? 0 : max_value; });
+        using temp_image_t = image<typename SrcView::value_type>;
+        temp_image_t temp_img(src_view.width(), src_view.height());
+        detail::kernel_2d<float> kernel = generate_gaussian_kernel(kernel_size, 1.0);
+        convolve_2d(src_view, kernel, view(temp_img));
+        detail::adaptive_impl<source_channel_t>(src_view,
+            detail::adaptive_view_rows<typename temp_image_t::const_view_t>(const_view(temp_img)),
+            dst_view, max_value, direction, constant);
     }
 }
 
@@ -0,0 +1,177 @@
+//
+// Copyright 2026 Boost.GIL Contributors
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#include <boost/gil.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "core/image/test_fixture.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace gil = boost::gil;
+namespace fixture = boost::gil::test::fixture;
+
+// Rows of 71 pixels are looked up in blocks of 16 bytes and a scalar tail
+constexpr std::ptrdiff_t width = 71;
+constexpr std::ptrdiff_t height = 9;
+
+template <typename View>
+void fill_random(View const& v)
+{
+    using channel_t = typename gil::channel_type<View>::type;
+    fixture::fill_random_channels(v);
+    // extreme values
+    v(0, 0) = typename View::value_type((std::numeric_limits<channel_t>::max)());
+    v(1, 0) = typename View::value_type((std::numeric_limits<channel_t>::min)());
+}
+
+template <typename SrcView, typename DstView, typename Lut>
+void check_looked_up(SrcView const& src, DstView const& dst, Lut const& lut)
+{
+    using src_channel_t = typename gil::channel_type<SrcView>::type;
+    using dst_channel_t = typename gil::channel_type<DstView>::type;
+    bool all_equal = true;
+    for (std::ptrdiff_t y = 0; y < src.height(); ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < src.width(); ++x)
+        {
+            for (std::size_t c = 0; c < gil::num_channels<SrcView>::value; ++c)
+            {
+                long const index = static_cast<long>(src_channel_t(src(x, y)[c])) -
+                    static_cast<long>((std::numeric_limits<src_channel_t>::min)());
+                dst_channel_t const expected =
+                    static_cast<dst_channel_t>(lut[static_cast<std::size_t>(index)]);
+                all_equal = all_equal && !(dst(x, y)[c] < expected) && !(expected < dst(x, y)[c]);
+            }
+        }
+    }
+    BOOST_TEST(all_equal);
+}
+
+template <typename Channel>
+auto make_lut(std::size_t size) -> std::vector<Channel>
+{
+    using base_t = typename gil::base_channel_type<Channel>::type;
+    std::vector<Channel> lut(size);
+    for (std::size_t i = 0; i < size; ++i)
+        lut[i] = Channel(static_cast<base_t>(i * 7 + 3));
+    return lut;
+}
+
+template <typename SrcImage, typename DstImage>
+void test_lookup()
+{
+    using src_channel_t = typename gil::channel_type<SrcImage>::type;
+    using dst_channel_t = typename gil::channel_type<DstImage>::type;
+    std::size_t const size = static_cast<std::size_t>(
+        (std::numeric_limits<src_channel_t>::max)() -
+        static_cast<long>((std::numeric_limits<src_channel_t>::min)()) + 1);
+    auto const lut = make_lut<dst_channel_t>(size);
+
+    SrcImage src(width, height);
+    fill_random(gil::view(src));
+    DstImage dst(width, height);
+    gil::apply_lut(gil::const_view(src), gil::view(dst), lut);
+    check_looked_up(gil::const_view(src), gil::const_view(dst), lut);
+
+    // not 1D-traversable, rows looked up one at a time
+    DstImage dst2(width, height);
+    auto const src_sub = gil::subimage_view(gil::const_view(src), 1, 1, width - 2, height - 2);
+    auto const dst_sub = gil::subimage_view(gil::view(dst2), 1, 1, width - 2, height - 2);
+    gil::apply_lut(gil::execution::parallel_policy(3), src_sub, dst_sub, lut);
+    check_looked_up(src_sub, dst_sub, lut);
+}
+
+void test_in_place_and_table_types()
+{
+    gil::rgb8_image_t img(width, height);
+    fill_random(gil::view(img));
+    gil::rgb8_image_t const original(img);
+
+    // Tables of any arithmetic type are converted to the destination channel
+    std::array<int, 256> inverted;
+    for (std::size_t i = 0; i < inverted.size(); ++i)
+        inverted[i] = 255 - static_cast<int>(i);
+    gil::apply_lut(gil::execution::par, gil::const_view(img), gil::view(img), inverted);
+    check_looked_up(gil::const_view(original), gil::const_view(img), inverted);
+}
+
+void test_full_16bit_table()
+{
+    // A 16-bit source indexes a table of all 65536 channel values
+    auto const lut = std::unique_ptr<std::array<std::uint16_t, 65536>>(
+        new std::array<std::uint16_t, 65536>());
+    for (std::size_t i = 0; i < lut->size(); ++i)
+        (*lut)[i] = static_cast<std::uint16_t>(65535 - i);
+
+    gil::rgb16_image_t src(width, height);
+    fill_random(gil::view(src));
+    gil::view(src)(0, 0) = gil::rgb16_pixel_t(0, 65535, 32768);
+    gil::rgb16_image_t dst(width, height);
+    gil::apply_lut(gil::const_view(src), gil::view(dst), *lut);
+    check_looked_up(gil::const_view(src), gil::const_view(dst), *lut);
+    BOOST_TEST(gil::const_view(dst)(0, 0) == gil::rgb16_pixel_t(65535, 0, 32767));
+}
+
+void test_channel_tables()
+{
+    gil::rgb8_image_t src(width, height);
+    fill_random(gil::view(src));
+    gil::rgb8_planar_image_t planar(width, height);
+    gil::copy_pixels(gil::const_view(src), gil::view(planar));
+
+    std::vector<std::uint8_t> tables(3 * 256);
+    for (std::size_t i = 0; i < tables.size(); ++i)
+        tables[i] = static_cast<std::uint8_t>(i * 13 / 3);
+    std::array<std::uint8_t const*, 3> const rows{
+        {tables.data(), tables.data() + 256, tables.data() + 512}};
+
+    gil::rgb8_image_t dst(width, height);
+    gil::detail::apply_channel_luts(
+        gil::execution::parallel_policy(2), gil::const_view(src), gil::view(dst), rows);
+    gil::rgb8_planar_image_t planar_dst(width, height);
+    gil::detail::apply_channel_luts(
+        gil::execution::seq, gil::const_view(planar), gil::view(planar_dst), rows);
+
+    bool all_equal = true;
+    for (std::ptrdiff_t y = 0; y < height; ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < width; ++x)
+        {
+            for (std::size_t c = 0; c < 3; ++c)
+            {
+                std::uint8_t const expected = rows[c][gil::const_view(src)(x, y)[c]];
+                all_equal = all_equal && gil::const_view(dst)(x, y)[c] == expected;
+                all_equal = all_equal && gil::const_view(planar_dst)(x, y)[c] == expected;
+            }
+        }
+    }
+    BOOST_TEST(all_equal);
+}
+
+int main()
+{
+    test_lookup<gil::gray8_image_t, gil::gray8_image_t>();
+    test_lookup<gil::rgb8_image_t, gil::rgb8_image_t>();
+    test_lookup<gil::rgb8_planar_image_t, gil::rgb8_image_t>();
+    test_lookup<gil::gray8s_image_t, gil::gray8s_image_t>();
+    test_lookup<gil::gray8_image_t, gil::gray16_image_t>();
+    test_lookup<gil::gray16_image_t, gil::gray16_image_t>();
+    test_lookup<gil::rgb16s_image_t, gil::rgb8_image_t>();
+    test_lookup<gil::gray8_image_t, gil::gray32f_image_t>();
+    test_in_place_and_table_types();
+    test_full_16bit_table();
+    test_channel_tables();
+
+    return ::boost::report_errors();
+}
@@ -0,0 +1,114 @@
+//
+// Copyright 2026 Boost.GIL Contributors
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#include <boost/gil/algorithm.hpp>
+#include <boost/gil/color_convert.hpp>
+#include <boost/gil/gray.hpp>
+#include <boost/gil/image.hpp>
+#include <boost/gil/image_view_factory.hpp>
+#include <boost/gil/rgb.hpp>
+#include <boost/gil/rgba.hpp>
+#include <boost/gil/typedefs.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "core/image/test_fixture.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace gil = boost::gil;
+namespace fixture = boost::gil::test::fixture;
+
+// Rows of 71 pixels are converted in blocks of 32 and 16 pixels and a scalar tail
+constexpr std::ptrdiff_t width = 71;
+constexpr std::ptrdiff_t height = 5;
+
+template <typename Image>
+auto make_image() -> Image
+{
+    Image image(width, height);
+    auto v = gil::view(image);
+    fixture::fill_random(v, 0, 255);
+    // extreme values
+    v(0, 0) = typename Image::value_type(gil::channel_traits<std::uint8_t>::max_value());
+    v(1, 0) = typename Image::value_type(gil::channel_traits<std::uint8_t>::min_value());
+    return image;
+}
+
+template <typename SrcView, typename DstView>
+void check_converted(SrcView const& src, DstView const& dst)
+{
+    bool all_equal = true;
+    for (std::ptrdiff_t y = 0; y < src.height(); ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < src.width(); ++x)
+        {
+            typename DstView::value_type expected;
+            gil::color_convert(src(x, y), expected);
+            all_equal = all_equal && expected == dst(x, y);
+        }
+    }
+    BOOST_TEST(all_equal);
+}
+
+template <typename SrcImage, typename DstImage>
+void test_conversion()
+{
+    auto const src = make_image<SrcImage>();
+
+    DstImage dst(width, height);
+    gil::copy_and_convert_pixels(gil::const_view(src), gil::view(dst));
+    check_converted(gil::const_view(src), gil::const_view(dst));
+
+    // not 1D-traversable, rows converted one at a time
+    DstImage dst2(width, height);
+    auto const src_sub = gil::subimage_view(gil::const_view(src), 1, 1, width - 2, height - 2);
+    auto const dst_sub = gil::subimage_view(gil::view(dst2), 1, 1, width - 2, height - 2);
+    gil::copy_and_convert_pixels(src_sub, dst_sub);
+    check_converted(src_sub, dst_sub);
+
+    // not convertible with vector instructions
+    DstImage dst3(width, height);
+    auto const src_step = gil::flipped_left_right_view(gil::const_view(src));
+    gil::copy_and_convert_pixels(src_step, gil::view(dst3));
+    check_converted(src_step, gil::const_view(dst3));
+}
+
+template <typename SrcImage>
+void test_conversions_from()
+{
+    test_conversion<SrcImage, gil::gray8_image_t>();
+    test_conversion<SrcImage, gil::rgb8_image_t>();
+    test_conversion<SrcImage, gil::bgr8_image_t>();
+    test_conversion<SrcImage, gil::rgba8_image_t>();
+    test_conversion<SrcImage, gil::bgra8_image_t>();
+    test_conversion<SrcImage, gil::argb8_image_t>();
+    test_conversion<SrcImage, gil::abgr8_image_t>();
+}
+
+void test_empty_view()
+{
+    gil::rgb8_image_t src;
+    gil::bgr8_image_t dst;
+    gil::copy_and_convert_pixels(gil::const_view(src), gil::view(dst));
+    BOOST_TEST_EQ(gil::view(dst).size(), 0);
+}
+
+int main()
+{
+    test_conversions_from<gil::gray8_image_t>();
+    test_conversions_from<gil::rgb8_image_t>();
+    test_conversions_from<gil::bgr8_image_t>();
+    test_conversions_from<gil::rgba8_image_t>();
+    test_conversions_from<gil::bgra8_image_t>();
+    test_conversions_from<gil::argb8_image_t>();
+    test_conversions_from<gil::abgr8_image_t>();
+    test_empty_view();
+
+    return ::boost::report_errors();
+}
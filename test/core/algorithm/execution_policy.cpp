@@ -0,0 +1,229 @@
+//
+// Copyright 2026 Boost.GIL Contributors
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#include <boost/gil/algorithm.hpp>
+#include <boost/gil/color_convert.hpp>
+#include <boost/gil/execution.hpp>
+#include <boost/gil/gray.hpp>
+#include <boost/gil/image.hpp>
+#include <boost/gil/image_view_factory.hpp>
+#include <boost/gil/rgb.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+namespace gil = boost::gil;
+
+// Executor counting the tasks it was asked to run
+struct counting_executor
+{
+    std::size_t concurrency() const { return 3; }
+
+    template <typename F>
+    void bulk_execute(std::size_t count, F&& f) const
+    {
+        tasks += count;
+        for (std::size_t i = 0; i < count; ++i)
+            f(i);
+    }
+
+    mutable std::size_t tasks = 0;
+};
+
+namespace boost { namespace gil {
+template <>
+struct is_execution_policy<counting_executor> : std::true_type {};
+}} // namespace boost::gil
+
+// Odd dimensions, so that row bands are of uneven size
+constexpr std::ptrdiff_t width = 37;
+constexpr std::ptrdiff_t height = 53;
+
+gil::rgb8_image_t make_rgb_image()
+{
+    gil::rgb8_image_t image(width, height);
+    auto v = gil::view(image);
+    for (std::ptrdiff_t y = 0; y < height; ++y)
+        for (std::ptrdiff_t x = 0; x < width; ++x)
+            v(x, y) = gil::rgb8_pixel_t(
+                static_cast<std::uint8_t>(x * 7), static_cast<std::uint8_t>(y * 3), static_cast<std::uint8_t>(x + y));
+    return image;
+}
+
+void test_copy_pixels()
+{
+    auto const src = make_rgb_image();
+    gil::rgb8_image_t dst(width, height);
+    gil::copy_pixels(gil::execution::parallel_policy(4), gil::const_view(src), gil::view(dst));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(src), gil::const_view(dst)));
+
+    // not 1D-traversable
+    gil::rgb8_image_t dst2(width, height, gil::rgb8_pixel_t(0, 0, 0));
+    auto const src_sub = gil::subimage_view(gil::const_view(src), 1, 2, 30, 40);
+    auto const dst_sub = gil::subimage_view(gil::view(dst2), 1, 2, 30, 40);
+    gil::copy_pixels(gil::execution::par, src_sub, dst_sub);
+    BOOST_TEST(gil::equal_pixels(src_sub, dst_sub));
+    BOOST_TEST(dst2._view(0, 0) == gil::rgb8_pixel_t(0, 0, 0));
+    BOOST_TEST(dst2._view(31, 42) == gil::rgb8_pixel_t(0, 0, 0));
+}
+
+void test_copy_and_convert_pixels()
+{
+    auto const src = make_rgb_image();
+    gil::gray8_image_t expected(width, height);
+    gil::copy_and_convert_pixels(gil::const_view(src), gil::view(expected));
+
+    gil::gray8_image_t dst(width, height);
+    gil::copy_and_convert_pixels(
+        gil::execution::parallel_policy(4), gil::const_view(src), gil::view(dst));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(dst)));
+
+    gil::gray8_image_t dst2(width, height);
+    gil::copy_and_convert_pixels(
+        gil::execution::parallel_policy(4),
+        gil::const_view(src), gil::view(dst2), gil::default_color_converter());
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(dst2)));
+}
+
+void test_fill_pixels()
+{
+    gil::rgb8_image_t image(width, height);
+    gil::rgb8_pixel_t const value(1, 2, 3);
+    gil::fill_pixels(gil::execution::par, gil::view(image), value);
+
+    gil::rgb8_image_t expected(width, height, value);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(image), gil::const_view(expected)));
+}
+
+void test_for_each_pixel()
+{
+    gil::gray8_image_t image(width, height, gil::gray8_pixel_t(2));
+    std::atomic<int> sum{0};
+    gil::for_each_pixel(gil::execution::parallel_policy(4), gil::view(image), [&sum](gil::gray8_ref_t p)
+    {
+        sum += p;
+        p = gil::gray8_pixel_t(5);
+    });
+    BOOST_TEST_EQ(sum, 2 * width * height);
+    BOOST_TEST(gil::equal_pixels(
+        gil::const_view(image), gil::const_view(gil::gray8_image_t(width, height, gil::gray8_pixel_t(5)))));
+}
+
+void test_generate_pixels()
+{
+    gil::gray8_image_t image(width, height);
+    gil::generate_pixels(gil::execution::seq, gil::view(image), [] { return gil::gray8_pixel_t(9); });
+    BOOST_TEST(gil::equal_pixels(
+        gil::const_view(image), gil::const_view(gil::gray8_image_t(width, height, gil::gray8_pixel_t(9)))));
+}
+
+void test_transform_pixels()
+{
+    auto const src = make_rgb_image();
+    auto const invert = [](gil::rgb8c_ref_t p)
+    {
+        return gil::rgb8_pixel_t(
+            static_cast<std::uint8_t>(255 - p[0]),
+            static_cast<std::uint8_t>(255 - p[1]),
+            static_cast<std::uint8_t>(255 - p[2]));
+    };
+    gil::rgb8_image_t expected(width, height);
+    gil::transform_pixels(gil::const_view(src), gil::view(expected), invert);
+
+    gil::rgb8_image_t dst(width, height);
+    gil::transform_pixels(gil::execution::parallel_policy(4), gil::const_view(src), gil::view(dst), invert);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(dst)));
+
+    auto const max = [](gil::rgb8c_ref_t a, gil::rgb8c_ref_t b)
+    {
+        return gil::rgb8_pixel_t((std::max)(a[0], b[0]), (std::max)(a[1], b[1]), (std::max)(a[2], b[2]));
+    };
+    gil::transform_pixels(gil::const_view(src), gil::const_view(dst), gil::view(expected), max);
+    gil::transform_pixels(
+        gil::execution::parallel_policy(4), gil::const_view(src), gil::const_view(dst), gil::view(dst), max);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(dst)));
+}
+
+void test_transform_pixel_positions()
+{
+    gil::gray8_image_t src(width, height);
+    auto v = gil::view(src);
+    for (std::ptrdiff_t y = 0; y < height; ++y)
+        for (std::ptrdiff_t x = 0; x < width; ++x)
+            v(x, y) = static_cast<std::uint8_t>(x + 2 * y);
+
+    // Vertical difference reaches across band boundaries
+    auto const interior = gil::subimage_view(gil::const_view(src), 0, 1, width, height - 2);
+    auto const diff = [](gil::gray8c_loc_t loc)
+    {
+        return gil::gray8_pixel_t(static_cast<std::uint8_t>(loc(0, 1) - loc(0, -1)));
+    };
+    gil::gray8_image_t dst(width, height - 2);
+    gil::transform_pixel_positions(gil::execution::parallel_policy(4), interior, gil::view(dst), diff);
+    BOOST_TEST(gil::equal_pixels(
+        gil::const_view(dst), gil::const_view(gil::gray8_image_t(width, height - 2, gil::gray8_pixel_t(4)))));
+
+    auto const sum = [](gil::gray8c_loc_t a, gil::gray8c_loc_t b)
+    {
+        return gil::gray8_pixel_t(static_cast<std::uint8_t>(a(0, 1) + b(0, -1)));
+    };
+    gil::gray8_image_t expected(width, height - 2);
+    gil::transform_pixel_positions(interior, interior, gil::view(expected), sum);
+    gil::transform_pixel_positions(gil::execution::parallel_policy(4), interior, interior, gil::view(dst), sum);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(dst)));
+}
+
+void test_custom_executor()
+{
+    counting_executor executor;
+    gil::gray8_image_t image(width, height);
+    gil::fill_pixels(executor, gil::view(image), gil::gray8_pixel_t(7));
+    BOOST_TEST_EQ(executor.tasks, 12u);
+    BOOST_TEST(gil::equal_pixels(
+        gil::const_view(image), gil::const_view(gil::gray8_image_t(width, height, gil::gray8_pixel_t(7)))));
+}
+
+void test_exception_propagation()
+{
+    gil::gray8_image_t image(width, height, gil::gray8_pixel_t(0));
+    gil::view(image)(3, 40) = gil::gray8_pixel_t(1);
+    BOOST_TEST_THROWS(
+        gil::for_each_pixel(gil::execution::parallel_policy(4), gil::const_view(image), [](gil::gray8c_ref_t p)
+        {
+            if (p == gil::gray8_pixel_t(1))
+                throw std::runtime_error("pixel");
+        }),
+        std::runtime_error);
+}
+
+void test_empty_view()
+{
+    gil::gray8_image_t image;
+    int calls = 0;
+    gil::for_each_pixel(gil::execution::par, gil::view(image), [&calls](gil::gray8_ref_t) { ++calls; });
+    BOOST_TEST_EQ(calls, 0);
+}
+
+int main()
+{
+    test_copy_pixels();
+    test_copy_and_convert_pixels();
+    test_fill_pixels();
+    test_for_each_pixel();
+    test_generate_pixels();
+    test_transform_pixels();
+    test_transform_pixel_positions();
+    test_custom_executor();
+    test_exception_propagation();
+    test_empty_view();
+
+    return ::boost::report_errors();
+}
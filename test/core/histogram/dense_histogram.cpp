@@ -0,0 +1,197 @@
+//
+// Copyright 2026 Boost.GIL Contributors
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+
+#include <boost/gil/histogram.hpp>
+#include <boost/gil/image.hpp>
+#include <boost/gil/image_processing/histogram_equalization.hpp>
+#include <boost/gil/image_processing/histogram_matching.hpp>
+#include <boost/gil/image_view.hpp>
+#include <boost/gil/typedefs.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "core/image/test_fixture.hpp"
+
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+namespace gil = boost::gil;
+namespace fixture = boost::gil::test::fixture;
+
+std::uint8_t big_matrix[] =
+{
+    1, 2, 3, 4, 5, 6, 7, 8,
+    1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 3, 4, 5, 6, 7, 8,
+    3, 4, 3, 4, 3, 4, 3, 4,
+    1, 2, 3, 4, 5, 6, 7, 8,
+    5, 6, 5, 6, 5, 6, 5, 6,
+    1, 2, 3, 4, 5, 6, 7, 8,
+    7, 8, 7, 8, 7, 8, 7, 8
+};
+
+std::uint8_t big_rgb_matrix[] =
+{
+    1, 2, 3, 2, 3, 4, 3, 4, 5, 4, 5, 6, 5, 6, 7, 6, 7, 8, 7, 8, 9, 8, 9, 10,
+    1, 2, 3, 2, 3, 4, 1, 2, 3, 2, 3, 4, 1, 2, 3, 2, 3, 4, 1, 2, 3, 2, 3, 4,
+    1, 2, 3, 2, 3, 4, 3, 4, 5, 4, 5, 6, 5, 6, 7, 6, 7, 8, 7, 8, 9, 8, 9, 10,
+    3, 4, 5, 4, 5, 6, 3, 4, 5, 4, 5, 6, 3, 4, 5, 4, 5, 6, 3, 4, 5, 4, 5, 6,
+    1, 2, 3, 2, 3, 4, 3, 4, 5, 4, 5, 6, 5, 6, 7, 6, 7, 8, 7, 8, 9, 8, 9, 10,
+    5, 6, 7, 6, 7, 8, 5, 6, 7, 6, 7, 8, 5, 6, 7, 6, 7, 8, 5, 6, 7, 6, 7, 8,
+    1, 2, 3, 2, 3, 4, 3, 4, 5, 4, 5, 6, 5, 6, 7, 6, 7, 8, 7, 8, 9, 8, 9, 10,
+    7, 8, 9, 8, 9, 10, 7, 8, 9, 8, 9, 10, 7, 8, 9, 8, 9, 10, 7, 8, 9, 8, 9, 10,
+};
+
+std::vector<std::vector<bool>> mask =
+{
+    {1, 0, 0, 1, 1, 0, 0, 1},
+    {0, 0, 1, 1, 0, 0, 1, 1},
+    {0, 1, 0, 1, 0, 1, 0, 1},
+    {1, 1, 0, 0, 1, 1, 0, 0},
+    {1, 0, 0, 1, 1, 0, 0, 1},
+    {0, 0, 1, 1, 0, 0, 1, 1},
+    {0, 1, 0, 1, 0, 1, 0, 1},
+    {1, 1, 0, 0, 1, 1, 0, 0},
+};
+
+gil::gray8c_view_t big_gray_view = gil::interleaved_view(8, 8, reinterpret_cast<gil::gray8c_pixel_t*>(big_matrix), 8);
+
+gil::rgb8c_view_t big_rgb_view = gil::interleaved_view(8, 8, reinterpret_cast<gil::rgb8c_pixel_t*>(big_rgb_matrix), 24);
+
+void check_bins()
+{
+    gil::dense_histogram<std::uint8_t> h1;
+    BOOST_TEST_EQ(h1.size(), 256u);
+    BOOST_TEST_EQ(h1.sum(), 0.0);
+    BOOST_TEST(h1.min_key() == std::make_tuple(std::uint8_t(0)));
+    BOOST_TEST(h1.max_key() == std::make_tuple(std::uint8_t(255)));
+
+    gil::dense_histogram<std::int8_t, std::uint8_t> h2;
+    BOOST_TEST_EQ(h2.size(), 65536u);
+    // joint histograms of two 16 bit axes would not fit
+    static_assert(gil::detail::dense_histogram_bin_count<std::uint16_t>::value == 65536, "");
+    static_assert(gil::detail::dense_histogram_bin_count<std::uint16_t, std::uint16_t>::value >
+                      gil::detail::dense_histogram_max_bin_count, "");
+    BOOST_TEST(h2.min_key() == std::make_tuple(std::int8_t(-128), std::uint8_t(0)));
+    BOOST_TEST(h2.max_key() == std::make_tuple(std::int8_t(127), std::uint8_t(255)));
+
+    h2(-1, 3) = 5;
+    h2[std::make_tuple(std::int8_t(-128), std::uint8_t(255))] = 2;
+    BOOST_TEST_EQ(h2.at(std::make_tuple(std::int8_t(-1), std::uint8_t(3))), 5.0);
+    BOOST_TEST_EQ(h2.data()[255], 2.0);
+    BOOST_TEST_EQ(h2.sum(), 7.0);
+
+    // Iteration visits all keys in ascending order
+    auto const keys = h2.sorted_keys();
+    std::size_t count = 0;
+    bool in_order = true;
+    for (auto const& v : h2)
+    {
+        in_order = in_order && v.first == keys[count];
+        ++count;
+    }
+    BOOST_TEST_EQ(count, h2.size());
+    BOOST_TEST(in_order);
+
+    h2.clear();
+    BOOST_TEST_EQ(h2.sum(), 0.0);
+}
+
+void check_fill_matches_histogram()
+{
+    gil::histogram<std::uint8_t> sparse;
+    gil::dense_histogram<std::uint8_t> dense;
+    gil::fill_histogram(big_gray_view, sparse);
+    gil::fill_histogram(big_gray_view, dense);
+    BOOST_TEST(dense.equals(sparse));
+    BOOST_TEST_EQ(dense.sum(), sparse.sum());
+
+    // Accumulate
+    gil::fill_histogram(big_gray_view, dense, 1, true);
+    BOOST_TEST_EQ(dense(1), 2 * sparse(1));
+
+    // Bin width, mask and limits
+    gil::fill_histogram(
+        big_gray_view, sparse, 2, false, true, true, mask,
+        std::make_tuple(std::uint8_t(1)), std::make_tuple(std::uint8_t(3)), true);
+    gil::fill_histogram(
+        big_gray_view, dense, 2, false, true, true, mask,
+        std::make_tuple(std::uint8_t(1)), std::make_tuple(std::uint8_t(3)), true);
+    BOOST_TEST(dense.equals(sparse));
+    BOOST_TEST_EQ(dense.sum(), sparse.sum());
+
+    // Views with at least four pixels per bin are counted in interleaved tables
+    gil::gray8_image_t large(67, 31);
+    fixture::fill_random(gil::view(large), 0, 31);
+    gil::fill_histogram(gil::const_view(large), sparse);
+    gil::fill_histogram(gil::const_view(large), dense);
+    BOOST_TEST(dense.equals(sparse));
+    BOOST_TEST_EQ(dense.sum(), 67.0 * 31.0);
+}
+
+void check_joint_fill()
+{
+    gil::histogram<std::uint8_t, std::uint8_t> sparse;
+    gil::dense_histogram<std::uint8_t, std::uint8_t> dense;
+    gil::fill_histogram<0, 2>(big_rgb_view, sparse);
+    gil::fill_histogram<0, 2>(big_rgb_view, dense);
+    BOOST_TEST(dense.equals(sparse));
+    BOOST_TEST_EQ(dense.sum(), 64.0);
+    BOOST_TEST_EQ(dense(1, 3), sparse(1, 3));
+
+    auto const sub_dense = dense.sub_histogram<1>();
+    auto const sub_sparse = sparse.sub_histogram<1>();
+    BOOST_TEST(sub_dense.equals(sub_sparse));
+    BOOST_TEST_EQ(sub_dense.sum(), 64.0);
+}
+
+void check_cumulative()
+{
+    gil::histogram<std::uint8_t> sparse;
+    gil::dense_histogram<std::uint8_t> dense;
+    gil::fill_histogram(big_gray_view, sparse, 1, false, false);
+    gil::fill_histogram(big_gray_view, dense);
+    BOOST_TEST(gil::cumulative_histogram(dense).equals(gil::cumulative_histogram(sparse)));
+    BOOST_TEST_EQ(gil::cumulative_histogram(dense)(255), 64.0);
+
+    gil::histogram<std::uint8_t, std::uint8_t> sparse2;
+    gil::dense_histogram<std::uint8_t, std::uint8_t> dense2;
+    gil::fill_histogram<0, 1>(big_rgb_view, sparse2);
+    gil::fill_histogram<0, 1>(big_rgb_view, dense2);
+    auto cumulative_dense2 = gil::cumulative_histogram(dense2);
+    BOOST_TEST(cumulative_dense2.equals(gil::cumulative_histogram(sparse2)));
+    BOOST_TEST_EQ(cumulative_dense2(255, 255), 64.0);
+}
+
+void check_histogram_algorithms()
+{
+    gil::histogram<std::uint8_t> sparse;
+    gil::dense_histogram<std::uint8_t> dense;
+    gil::fill_histogram(big_gray_view, sparse, 1, false, false);
+    gil::fill_histogram(big_gray_view, dense);
+    BOOST_TEST(gil::histogram_equalization(dense) == gil::histogram_equalization(sparse));
+
+    gil::histogram<std::uint8_t> sparse_ref;
+    gil::dense_histogram<std::uint8_t> dense_ref;
+    gil::fill_histogram(gil::nth_channel_view(big_rgb_view, 2), sparse_ref, 1, false, false);
+    gil::fill_histogram(gil::nth_channel_view(big_rgb_view, 2), dense_ref);
+    BOOST_TEST(
+        gil::histogram_matching(dense, dense_ref) == gil::histogram_matching(sparse, sparse_ref));
+}
+
+int main()
+{
+    check_bins();
+    check_fill_matches_histogram();
+    check_joint_fill();
+    check_cumulative();
+    check_histogram_algorithms();
+
+    return boost::report_errors();
+}
@@ -6,12 +6,15 @@
 // http://www.boost.org/LICENSE_1_0.txt
 //
 
+#include <boost/gil/execution.hpp>
 #include <boost/gil/histogram.hpp>
 #include <boost/gil/image.hpp>
 #include <boost/gil/image_view.hpp>
 #include <boost/gil/typedefs.hpp>
 
 #include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
 #include <iostream>
 
 namespace gil = boost::gil;
@@ -266,6 +269,38 @@ void check_fill_bin_width()
     BOOST_TEST(check1);
 }
 
+void check_fill_parallel()
+{
+    // Partial histograms of three row bands are merged
+    gil::execution::parallel_policy const policy(3);
+
+    gil::histogram<int> h1, h2;
+    gil::fill_histogram(big_gray_view, h1);
+    gil::fill_histogram(policy, big_gray_view, h2);
+    BOOST_TEST(h1 == h2);
+
+    std::vector<std::vector<bool>> big_mask(8, std::vector<bool>(8, true));
+    big_mask[1][2] = big_mask[4][4] = big_mask[7][0] = false;
+    gil::histogram<int, int> h3, h4;
+    gil::fill_histogram<0, 2>(big_rgb_view, h3, 2, false, false, true, big_mask,
+        std::make_tuple(1, 1), std::make_tuple(3, 4), true);
+    gil::fill_histogram<0, 2>(policy, big_rgb_view, h4, 2, false, false, true, big_mask,
+        std::make_tuple(1, 1), std::make_tuple(3, 4), true);
+    BOOST_TEST(h3 == h4);
+
+    // Accumulating over fractional bins rounds as the serial fill does
+    h1.normalize();
+    h2.normalize();
+    gil::fill_histogram(big_gray_view, h1, 1, true);
+    gil::fill_histogram(policy, big_gray_view, h2, 1, true);
+    BOOST_TEST(h1 == h2);
+
+    gil::dense_histogram<std::uint8_t> d1, d2;
+    gil::fill_histogram(big_gray_view, d1);
+    gil::fill_histogram(policy, big_gray_view, d2);
+    BOOST_TEST(std::equal(d1.data(), d1.data() + d1.size(), d2.data()));
+}
+
 int main() {
 
     check_histogram_fill_test1();
@@ -277,6 +312,7 @@ int main() {
     check_histogram_fill_test7();
     check_histogram_fill_algorithm();
     check_fill_bin_width();
+    check_fill_parallel();
 
     return boost::report_errors();
 }
\ No newline at end of file
@@ -10,6 +10,11 @@
 
 #include <boost/gil.hpp>
 
+#include "core/test_fixture.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <initializer_list>
 #include <limits>
@@ -96,6 +101,63 @@ auto generate_image(std::ptrdiff_t size_x, std::ptrdiff_t size_y, Generator&& ge
     return out;
 }
 
+// Assigns the values of generate() to the channels of the pixels of a view, row by row
+template <typename View, typename Generator>
+void generate_channels(View const& view, Generator&& generate)
+{
+    using channel_t = typename gil::channel_type<View>::type;
+    using base_t = typename gil::base_channel_type<channel_t>::type;
+    for (std::ptrdiff_t y = 0; y < view.height(); ++y)
+    {
+        std::for_each(view.row_begin(y), view.row_end(y),
+            [&generate](typename View::reference p)
+        {
+            for (std::size_t c = 0; c < gil::num_channels<View>::value; ++c)
+                p[c] = channel_t(static_cast<base_t>(generate()));
+        });
+    }
+}
+
+// Fills the channels of a view with random integers of [minimum, maximum]
+template <typename View>
+void fill_random(View const& view, int minimum, int maximum, std::uint32_t seed = 5489u)
+{
+    generate_channels(view, random_value<int>(seed, minimum, maximum));
+}
+
+// Fills the channels of a view with random values spread over the range of the channel,
+// which is [0, 1] for floating point channels
+template <typename View>
+void fill_random_channels(View const& view, std::uint32_t seed = 5489u)
+{
+    using channel_t = typename gil::channel_type<View>::type;
+    random_value<int> random(seed, 0, 65535);
+    generate_channels(view, [&random]() {
+        float const value = static_cast<float>(random()) / 65535.0f;
+        return gil::channel_convert<channel_t>(gil::float32_t(value));
+    });
+}
+
+// Largest absolute difference between the channels of two views of the same dimensions
+template <typename View1, typename View2>
+auto max_difference(View1 const& v1, View2 const& v2) -> double
+{
+    double result = 0.0;
+    for (std::ptrdiff_t y = 0; y < v1.height(); ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < v1.width(); ++x)
+        {
+            for (std::size_t c = 0; c < gil::num_channels<View1>::value; ++c)
+            {
+                double const a = static_cast<double>(v1(x, y)[c]);
+                double const b = static_cast<double>(v2(x, y)[c]);
+                result = (std::max)(result, std::fabs(a - b));
+            }
+        }
+    }
+    return result;
+}
+
 template <typename Image>
 auto create_image(std::ptrdiff_t size_x, std::ptrdiff_t size_y, int channel_value) -> Image
 {
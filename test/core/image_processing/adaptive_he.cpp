@@ -6,6 +6,7 @@
 // http://www.boost.org/LICENSE_1_0.txt)
 //
 
+#include <boost/gil.hpp>
 #include <boost/gil/histogram.hpp>
 #include <boost/gil/image_view.hpp>
 #include <boost/gil/image_processing/histogram_equalization.hpp>
@@ -13,10 +14,14 @@
 
 #include <boost/core/lightweight_test.hpp>
 
+#include "core/image/test_fixture.hpp"
+
 #include <cmath>
+#include <cstdint>
 #include <vector>
 
 namespace gil = boost::gil;
+namespace fixture = boost::gil::test::fixture;
 
 double epsilon = 1.0;
 
@@ -104,11 +109,114 @@ void check_non_overlapping_interpolated_clahe()
     }
 }
 
+// Channels of [40 c, 40 c + 63], whose histograms differ
+template <typename View>
+void fill_random_channels(View const& v)
+{
+    for (int c = 0; c < static_cast<int>(gil::num_channels<View>::value); ++c)
+    {
+        fixture::fill_random(
+            gil::nth_channel_view(v, c), 40 * c, 40 * c + 63, std::uint32_t(17 + c));
+    }
+}
+
+// Channels are equalized independently, in parallel bands of tiles and rows
+void check_clahe_channels_and_policies()
+{
+    gil::rgb8_image_t src(75, 43);
+    fill_random_channels(gil::view(src));
+
+    gil::rgb8_image_t serial(src.dimensions());
+    gil::rgb8_image_t parallel(src.dimensions());
+    gil::non_overlapping_interpolated_clahe(gil::const_view(src), gil::view(serial), 16, 10, 0.1);
+    gil::non_overlapping_interpolated_clahe(gil::execution::parallel_policy(3),
+        gil::const_view(src), gil::view(parallel), 16, 10, 0.1);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(serial), gil::const_view(parallel)));
+
+    gil::rgb8_planar_image_t planar_src(src.dimensions());
+    gil::rgb8_planar_image_t planar(src.dimensions());
+    gil::copy_pixels(gil::const_view(src), gil::view(planar_src));
+    gil::non_overlapping_interpolated_clahe(
+        gil::const_view(planar_src), gil::view(planar), 16, 10, 0.1);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(serial), gil::const_view(planar)));
+
+    for (int c = 0; c < 3; ++c)
+    {
+        gil::gray8_image_t channel(src.dimensions());
+        gil::non_overlapping_interpolated_clahe(
+            gil::nth_channel_view(gil::const_view(src), c), gil::view(channel), 16, 10, 0.1);
+        BOOST_TEST(gil::equal_pixels(
+            gil::nth_channel_view(gil::const_view(serial), c), gil::const_view(channel)));
+    }
+}
+
+// Pixels outside the mask are copied, while the histograms still count them
+void check_clahe_mask()
+{
+    using gray1_image_t = gil::bit_aligned_image1_type<1, gil::gray_layout_t>::type;
+
+    gil::gray8_image_t src(40, 30);
+    fill_random_channels(gil::view(src));
+    gil::gray8_image_t full(src.dimensions());
+    gil::non_overlapping_interpolated_clahe(gil::const_view(src), gil::view(full), 12, 12);
+
+    gray1_image_t mask(src.dimensions());
+    gil::gray8_image_t byte_mask(src.dimensions());
+    for (std::ptrdiff_t y = 0; y < src.height(); ++y)
+        for (std::ptrdiff_t x = 0; x < src.width(); ++x)
+        {
+            bool const selected = (x + 2 * y) % 5 != 0;
+            gil::view(mask)(x, y) = gray1_image_t::value_type(selected ? 1 : 0);
+            gil::view(byte_mask)(x, y) = gil::gray8_pixel_t(selected ? 255 : 0);
+        }
+
+    gil::gray8_image_t masked(src.dimensions());
+    gil::gray8_image_t byte_masked(src.dimensions());
+    gil::non_overlapping_interpolated_clahe(
+        gil::const_view(src), gil::view(masked), gil::const_view(mask), 12, 12);
+    gil::non_overlapping_interpolated_clahe(
+        gil::const_view(src), gil::view(byte_masked), gil::const_view(byte_mask), 12, 12);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(masked), gil::const_view(byte_masked)));
+
+    bool ok = true;
+    for (std::ptrdiff_t y = 0; y < src.height(); ++y)
+        for (std::ptrdiff_t x = 0; x < src.width(); ++x)
+        {
+            auto const& expected = (x + 2 * y) % 5 != 0 ? full : src;
+            ok = ok && gil::const_view(masked)(x, y) == gil::const_view(expected)(x, y);
+        }
+    BOOST_TEST(ok);
+}
+
+// 16-bit channels keep sparse tile tables, which map absent values as the nearest smaller one
+void check_clahe_16bit()
+{
+    gil::gray16_image_t src(4, 4), expected(4, 4), clahe(4, 4);
+    gil::transform_pixels(gray_view, gil::view(src), [](gil::gray8c_pixel_t const& p) {
+        return gil::gray16_pixel_t(static_cast<std::uint16_t>(p[0] * 257));
+    });
+    gil::histogram_equalization(gil::const_view(src), gil::view(expected));
+    gil::non_overlapping_interpolated_clahe(gil::const_view(src), gil::view(clahe), 8, 8, 1.0);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(clahe)));
+
+    gil::rgb16_image_t noise(61, 37);
+    gil::rgb16_image_t serial(noise.dimensions());
+    gil::rgb16_image_t parallel(noise.dimensions());
+    fill_random_channels(gil::view(noise));
+    gil::non_overlapping_interpolated_clahe(gil::const_view(noise), gil::view(serial), 16, 10, 0.1);
+    gil::non_overlapping_interpolated_clahe(gil::execution::parallel_policy(3),
+        gil::const_view(noise), gil::view(parallel), 16, 10, 0.1);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(serial), gil::const_view(parallel)));
+}
+
 int main()
 {
     check_actual_clip_limit();
     check_clip_and_redistribute();
     check_non_overlapping_interpolated_clahe();
+    check_clahe_channels_and_policies();
+    check_clahe_mask();
+    check_clahe_16bit();
 
     return boost::report_errors();
 }
@@ -5,14 +5,19 @@
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 //
-#include <boost/gil/algorithm.hpp>
-#include <boost/gil/gray.hpp>
-#include <boost/gil/image_view.hpp>
+#include <boost/gil.hpp>
 #include <boost/gil/image_processing/filter.hpp>
 
 #include <boost/core/lightweight_test.hpp>
 
+#include "core/image/test_fixture.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
 namespace gil = boost::gil;
+namespace fixture = boost::gil::test::fixture;
 
 std::uint8_t img[] =
 {
@@ -57,9 +62,107 @@ void test_box_filter_with_default_parameters()
     BOOST_TEST(gil::equal_pixels(out_view, dst_view));
 }
 
+// Unnormalized box filter of any size and anchor equals the correlation with a kernel of ones
+void test_box_filter_matches_kernel_of_ones()
+{
+    gil::rgb8_image_t padded(60, 50);
+    fixture::fill_random(gil::view(padded), 0, 255);
+    auto const src = gil::subimage_view(gil::const_view(padded), 12, 12, 36, 26);
+
+    for (std::size_t size : {2, 5, 11})
+    {
+        for (long int anchor : {0L, static_cast<long int>(size - 1) / 2})
+        {
+            std::size_t const center = size - 1 - static_cast<std::size_t>(anchor);
+            std::vector<int> const ones(size * size, 1);
+            gil::detail::kernel_2d<int> const kernel(ones.begin(), ones.size(), center, center);
+            for (auto option : {gil::boundary_option::extend_zero,
+                                gil::boundary_option::extend_constant,
+                                gil::boundary_option::extend_padded,
+                                gil::boundary_option::output_zero})
+            {
+                gil::rgb32s_image_t expected(src.dimensions());
+                gil::rgb32s_image_t actual(src.dimensions());
+                gil::correlate_2d<gil::rgb32s_pixel_t>(src, kernel, gil::view(expected), option);
+                gil::box_filter(src, gil::view(actual), size, anchor, false, option);
+                BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(actual)));
+            }
+        }
+    }
+}
+
+void test_box_filter_large_kernel()
+{
+    gil::rgb8_image_t src(70, 45);
+    fixture::fill_random(gil::view(src), 0, 255);
+    gil::rgb8_planar_image_t planar_src(src.dimensions());
+    gil::copy_pixels(gil::const_view(src), gil::view(planar_src));
+
+    // The mean of a window of 101 x 101 pixels with a constant extension
+    gil::rgb8_image_t expected(src.dimensions());
+    gil::box_filter(
+        gil::const_view(src), gil::view(expected), 101, -1, true,
+        gil::boundary_option::extend_constant);
+    long sum = 0;
+    for (std::ptrdiff_t y = -50; y <= 50; ++y)
+        for (std::ptrdiff_t x = -50; x <= 50; ++x)
+        {
+            std::ptrdiff_t const cx = x < 0 ? 0 : (x < 70 ? x : 69);
+            std::ptrdiff_t const cy = y < 0 ? 0 : (y < 45 ? y : 44);
+            sum += gil::const_view(src)(cx, cy)[1];
+        }
+    BOOST_TEST_EQ(static_cast<long>(gil::const_view(expected)(0, 0)[1]), sum / (101 * 101));
+
+    gil::rgb8_planar_image_t actual(src.dimensions());
+    gil::box_filter(
+        gil::execution::parallel_policy(3), gil::const_view(planar_src), gil::view(actual), 101,
+        -1, true, gil::boundary_option::extend_constant);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(actual)));
+}
+
+// Integral means are the window sum divided by the area, truncated once. Truncating after
+// each separable pass instead gives 0 for the centre, whose row means are 2/3, 2/3 and 5/3.
+void test_box_filter_integer_rounding()
+{
+    std::uint8_t const values[] =
+    {
+        1, 1, 0,
+        1, 1, 0,
+        2, 2, 1
+    };
+    gil::gray8c_view_t const src =
+        gil::interleaved_view(3, 3, reinterpret_cast<gil::gray8_pixel_t const*>(values), 3);
+    gil::gray8_image_t dst(3, 3);
+    gil::box_filter(src, gil::view(dst), 3);
+    BOOST_TEST_EQ(static_cast<int>(gil::const_view(dst)(1, 1)[0]), 1);
+
+    gil::gray8_image_t noise(31, 17);
+    fixture::fill_random(gil::view(noise), 0, 255);
+    gil::gray8_image_t mean(noise.dimensions());
+    gil::box_filter(gil::const_view(noise), gil::view(mean), 5);
+    bool ok = true;
+    for (std::ptrdiff_t y = 0; y < noise.height(); ++y)
+        for (std::ptrdiff_t x = 0; x < noise.width(); ++x)
+        {
+            int sum = 0;
+            for (std::ptrdiff_t dy = -2; dy <= 2; ++dy)
+                for (std::ptrdiff_t dx = -2; dx <= 2; ++dx)
+                {
+                    bool const inside = x + dx >= 0 && x + dx < noise.width() &&
+                        y + dy >= 0 && y + dy < noise.height();
+                    sum += inside ? gil::const_view(noise)(x + dx, y + dy)[0] : 0;
+                }
+            ok = ok && gil::const_view(mean)(x, y)[0] == sum / 25;
+        }
+    BOOST_TEST(ok);
+}
+
 int main()
 {
     test_box_filter_with_default_parameters();
+    test_box_filter_matches_kernel_of_ones();
+    test_box_filter_large_kernel();
+    test_box_filter_integer_rounding();
 
     return ::boost::report_errors();
 }
@@ -11,9 +11,14 @@
 
 #include <boost/core/lightweight_test.hpp>
 
+#include "core/image/test_fixture.hpp"
+
 #include <cstddef>
+#include <cstdint>
+#include <vector>
 
 namespace gil = boost::gil;
+namespace fixture = boost::gil::test::fixture;
 
 std::uint8_t img[] =
 {
@@ -191,11 +196,319 @@ void test_convolve_2d_with_sobel_y_filter()
   BOOST_TEST(gil::equal_pixels(exp_out_view, view(img_gray_out)));
 }
 
+// Brute-force correlation with explicit boundary handling, accumulating taps in row-major order
+template <typename Accum, typename SrcView, typename Kernel, typename DstView>
+void reference_correlate_2d(
+    SrcView const& src, Kernel const& kernel, DstView const& dst, gil::boundary_option option)
+{
+    using dst_channel_t = typename gil::channel_type<DstView>::type;
+    std::ptrdiff_t const size = static_cast<std::ptrdiff_t>(kernel.size());
+    std::ptrdiff_t const cx = static_cast<std::ptrdiff_t>(kernel.center_x());
+    std::ptrdiff_t const cy = static_cast<std::ptrdiff_t>(kernel.center_y());
+    bool const is_output_option = option == gil::boundary_option::output_ignore
+        || option == gil::boundary_option::output_zero;
+    for (std::ptrdiff_t y = 0; y < dst.height(); ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < dst.width(); ++x)
+        {
+            bool const inside = x - cx >= 0 && x - cx + size <= src.width()
+                && y - cy >= 0 && y - cy + size <= src.height();
+            if (is_output_option && !inside)
+            {
+                if (option == gil::boundary_option::output_zero)
+                    for (std::size_t c = 0; c < gil::num_channels<DstView>::value; ++c)
+                        dst(x, y)[c] = dst_channel_t(0);
+                continue;
+            }
+            for (std::size_t c = 0; c < gil::num_channels<DstView>::value; ++c)
+            {
+                Accum acc = 0;
+                for (std::ptrdiff_t r = 0; r < size; ++r)
+                {
+                    for (std::ptrdiff_t k = 0; k < size; ++k)
+                    {
+                        std::ptrdiff_t sx = x - cx + k;
+                        std::ptrdiff_t sy = y - cy + r;
+                        Accum value = 0;
+                        bool const outside =
+                            sx < 0 || sx >= src.width() || sy < 0 || sy >= src.height();
+                        if (option == gil::boundary_option::extend_padded || !outside)
+                        {
+                            value = static_cast<Accum>(src.xy_at(0, 0)[gil::point_t(sx, sy)][c]);
+                        }
+                        else if (option == gil::boundary_option::extend_constant)
+                        {
+                            sx = (std::min)((std::max)(sx, std::ptrdiff_t(0)), src.width() - 1);
+                            sy = (std::min)((std::max)(sy, std::ptrdiff_t(0)), src.height() - 1);
+                            value = static_cast<Accum>(src(sx, sy)[c]);
+                        }
+                        acc = acc + value * static_cast<Accum>(kernel.at(k, r));
+                    }
+                }
+                dst(x, y)[c] = static_cast<dst_channel_t>(acc);
+            }
+        }
+    }
+}
+
+template <typename PixelAccum, typename Accum, typename Image, typename T>
+void test_correlate_2d_matches_reference(std::size_t size, std::size_t cy, std::size_t cx)
+{
+    std::vector<T> values(size * size);
+    for (std::size_t i = 0; i < values.size(); ++i)
+        values[i] = static_cast<T>((i * 7) % 5) - static_cast<T>(1);
+    gil::detail::kernel_2d<T> const kernel(values.begin(), values.size(), cy, cx);
+
+    for (std::ptrdiff_t width : {3, 37})
+    {
+        std::ptrdiff_t const height = 11;
+        std::ptrdiff_t const margin = static_cast<std::ptrdiff_t>(size);
+        Image padded(width + 2 * margin, height + 2 * margin);
+        fixture::fill_random(gil::view(padded), 0, 63);
+        auto const src = gil::subimage_view(gil::view(padded), margin, margin, width, height);
+
+        for (auto option : {gil::boundary_option::output_ignore,
+                            gil::boundary_option::output_zero,
+                            gil::boundary_option::extend_padded,
+                            gil::boundary_option::extend_zero,
+                            gil::boundary_option::extend_constant})
+        {
+            Image expected(width, height);
+            Image actual(width, height);
+            Image actual_parallel(width, height);
+            gil::fill_pixels(gil::view(expected), typename Image::value_type{});
+            gil::fill_pixels(gil::view(actual), typename Image::value_type{});
+            gil::fill_pixels(gil::view(actual_parallel), typename Image::value_type{});
+
+            reference_correlate_2d<Accum>(src, kernel, gil::view(expected), option);
+            gil::correlate_2d<PixelAccum>(src, kernel, gil::view(actual), option);
+            BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(actual)));
+
+            gil::correlate_2d<PixelAccum>(
+                gil::execution::parallel_policy(3), src, kernel, gil::view(actual_parallel),
+                option);
+            BOOST_TEST(
+                gil::equal_pixels(gil::const_view(expected), gil::const_view(actual_parallel)));
+        }
+    }
+}
+
+void test_correlate_2d()
+{
+    test_correlate_2d_matches_reference<gil::gray32f_pixel_t, float, gil::gray32f_image_t, float>(
+        3, 1, 1);
+    test_correlate_2d_matches_reference<gil::rgb32f_pixel_t, float, gil::rgb8_image_t, float>(
+        5, 1, 3);
+    test_correlate_2d_matches_reference<gil::rgba32f_pixel_t, float, gil::rgba8_image_t, float>(
+        7, 3, 3);
+    test_correlate_2d_matches_reference<gil::rgb32f_pixel_t, float, gil::rgb8_planar_image_t, float>(
+        3, 2, 0);
+    test_correlate_2d_matches_reference<gil::gray32s_pixel_t, int, gil::gray16s_image_t, int>(
+        5, 2, 2);
+}
+
+// Results of the FFT-based computation are exact for integral kernel values and pixels, up to
+// rounding errors of double precision for floating point destinations
+template <typename PixelAccum, typename Accum, typename Image, typename T>
+void test_correlate_2d_fft_matches_reference(std::size_t size, std::size_t cy, std::size_t cx)
+{
+    std::vector<T> values(size * size);
+    for (std::size_t i = 0; i < values.size(); ++i)
+        values[i] = static_cast<T>((i * 7) % 5) - static_cast<T>(1);
+    gil::detail::kernel_2d<T> const kernel(values.begin(), values.size(), cy, cx);
+
+    // The larger images are computed in several tiles and bands of tiles
+    for (gil::point_t const dimensions : {gil::point_t(3, 5), gil::point_t(37, 11),
+                                          gil::point_t(130, 150)})
+    {
+        std::ptrdiff_t const width = dimensions.x;
+        std::ptrdiff_t const height = dimensions.y;
+        std::ptrdiff_t const margin = static_cast<std::ptrdiff_t>(size);
+        Image padded(width + 2 * margin, height + 2 * margin);
+        fixture::fill_random(gil::view(padded), 0, 63);
+        auto const src = gil::subimage_view(gil::view(padded), margin, margin, width, height);
+
+        for (auto option : {gil::boundary_option::output_ignore,
+                            gil::boundary_option::output_zero,
+                            gil::boundary_option::extend_padded,
+                            gil::boundary_option::extend_zero,
+                            gil::boundary_option::extend_constant})
+        {
+            Image expected(width, height);
+            Image actual(width, height);
+            Image actual_bands(width, height);
+            gil::fill_pixels(gil::view(expected), typename Image::value_type{});
+            gil::fill_pixels(gil::view(actual), typename Image::value_type{});
+            gil::fill_pixels(gil::view(actual_bands), typename Image::value_type{});
+
+            reference_correlate_2d<Accum>(src, kernel, gil::view(expected), option);
+            gil::detail::correlate_2d_fft_impl<PixelAccum>(
+                src, kernel, gil::view(actual), option, 0, height);
+            BOOST_TEST_LT(
+                fixture::max_difference(gil::const_view(expected), gil::const_view(actual)), 1e-6);
+
+            gil::detail::correlate_2d_fft_impl<PixelAccum>(
+                src, kernel, gil::view(actual_bands), option, 0, height / 2);
+            gil::detail::correlate_2d_fft_impl<PixelAccum>(
+                src, kernel, gil::view(actual_bands), option, height / 2, height);
+            BOOST_TEST_LT(fixture::max_difference(
+                gil::const_view(expected), gil::const_view(actual_bands)), 1e-6);
+
+            Image in_place(padded.dimensions());
+            gil::copy_pixels(gil::const_view(padded), gil::view(in_place));
+            auto const in_place_view =
+                gil::subimage_view(gil::view(in_place), margin, margin, width, height);
+            gil::detail::correlate_2d_fft_impl<PixelAccum>(
+                in_place_view, kernel, in_place_view, option, 0, height);
+            if (option != gil::boundary_option::output_ignore)
+                BOOST_TEST_LT(
+                    fixture::max_difference(gil::const_view(expected), in_place_view), 1e-6);
+        }
+    }
+}
+
+void test_correlate_2d_fft()
+{
+    test_correlate_2d_fft_matches_reference
+        <
+            gil::gray32f_pixel_t, float, gil::gray32f_image_t, float
+        >(3, 1, 1);
+    test_correlate_2d_fft_matches_reference
+        <
+            gil::rgb32f_pixel_t, float, gil::rgb8_image_t, float
+        >(5, 1, 3);
+    test_correlate_2d_fft_matches_reference
+        <
+            gil::rgba32f_pixel_t, float, gil::rgba8_planar_image_t, float
+        >(7, 3, 3);
+    test_correlate_2d_fft_matches_reference
+        <
+            gil::gray32s_pixel_t, int, gil::gray16s_image_t, int
+        >(4, 0, 3);
+}
+
+void test_correlate_2d_large_kernel()
+{
+    std::size_t const size = 17;
+    std::vector<int> values(size * size);
+    for (std::size_t i = 0; i < values.size(); ++i)
+        values[i] = static_cast<int>((i * 7) % 5) - 1;
+    gil::detail::kernel_2d<int> const kernel(values.begin(), values.size(), 8, 5);
+
+    gil::gray16s_image_t src(91, 73);
+    fixture::fill_random(gil::view(src), 0, 63);
+    BOOST_TEST((gil::detail::prefers_correlate_2d_fft<gil::gray32s_pixel_t>(
+        src.dimensions(), kernel, gil::boundary_option::extend_constant)));
+
+    gil::gray16s_image_t expected(src.dimensions());
+    gil::gray16s_image_t actual(src.dimensions());
+    gil::gray16s_image_t actual_parallel(src.dimensions());
+    reference_correlate_2d<int>(
+        gil::const_view(src), kernel, gil::view(expected), gil::boundary_option::extend_constant);
+    gil::correlate_2d<gil::gray32s_pixel_t>(
+        gil::const_view(src), kernel, gil::view(actual), gil::boundary_option::extend_constant);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(actual)));
+    gil::correlate_2d<gil::gray32s_pixel_t>(
+        gil::execution::parallel_policy(3), gil::const_view(src), kernel,
+        gil::view(actual_parallel), gil::boundary_option::extend_constant);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(actual_parallel)));
+}
+
+template <typename T>
+auto make_threshold_kernel(std::size_t size, T divisor) -> gil::detail::kernel_2d<T>
+{
+    std::vector<T> values(size * size);
+    for (std::size_t i = 0; i < values.size(); ++i)
+        values[i] = (static_cast<T>((i * 7) % 5) - static_cast<T>(1)) / divisor;
+    return gil::detail::kernel_2d<T>(values.begin(), values.size(), size / 2, size / 2);
+}
+
+// Both sides of the switch to FFT give the same integer results as the direct computation
+void test_correlate_2d_fft_threshold()
+{
+    gil::gray8_image_t src(64, 48);
+    fixture::fill_random(gil::view(src), 0, 63);
+    auto const option = gil::boundary_option::extend_zero;
+
+    std::size_t size = 1;
+    while (size < 32 && !gil::detail::prefers_correlate_2d_fft<gil::gray32s_pixel_t>(
+        src.dimensions(), make_threshold_kernel(size, 1), option))
+    {
+        ++size;
+    }
+    BOOST_TEST_LT(size, 32u);
+
+    for (std::size_t s : {size - 1, size})
+    {
+        auto const kernel = make_threshold_kernel(s, 1);
+        gil::gray32s_image_t direct(src.dimensions());
+        gil::gray32s_image_t fft(src.dimensions());
+        gil::gray32s_image_t actual(src.dimensions());
+        gil::detail::correlate_2d_impl<gil::gray32s_pixel_t>(
+            gil::const_view(src), kernel, gil::view(direct), option, 0, src.height());
+        gil::detail::correlate_2d_fft_impl<gil::gray32s_pixel_t>(
+            gil::const_view(src), kernel, gil::view(fft), option, 0, src.height());
+        gil::correlate_2d<gil::gray32s_pixel_t>(
+            gil::const_view(src), kernel, gil::view(actual), option);
+        BOOST_TEST(gil::equal_pixels(gil::const_view(direct), gil::const_view(fft)));
+        BOOST_TEST(gil::equal_pixels(gil::const_view(direct), gil::const_view(actual)));
+    }
+
+    // The direct computation truncates each product of other kernels, which FFT cannot follow
+    auto const fractional = make_threshold_kernel(size, 3.0f);
+    BOOST_TEST_NOT((gil::detail::prefers_correlate_2d_fft<gil::gray32s_pixel_t>(
+        src.dimensions(), fractional, option)));
+    gil::gray32s_image_t direct(src.dimensions());
+    gil::gray32s_image_t actual(src.dimensions());
+    gil::detail::correlate_2d_impl<gil::gray32s_pixel_t>(
+        gil::const_view(src), fractional, gil::view(direct), option, 0, src.height());
+    gil::correlate_2d<gil::gray32s_pixel_t>(
+        gil::const_view(src), fractional, gil::view(actual), option);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(direct), gil::const_view(actual)));
+
+    // The legacy convolution never switches to FFT, even for kernels that would
+    gil::gray8_image_t large(160, 120);
+    fixture::fill_random(gil::view(large), 0, 63);
+    auto const mean = make_threshold_kernel(41, 500.0f);
+    BOOST_TEST((gil::detail::prefers_correlate_2d_fft<gil::gray32f_pixel_t>(
+        large.dimensions(), mean, option)));
+    gil::gray8_image_t expected(large.dimensions());
+    gil::gray8_image_t legacy(large.dimensions());
+    gil::detail::correlate_2d_impl<gil::gray32f_pixel_t>(gil::const_view(large),
+        gil::detail::rotate_kernel_2d(mean), gil::view(expected), option, 0, large.height());
+    gil::detail::convolve_2d(gil::const_view(large), mean, gil::view(legacy));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(legacy)));
+}
+
+void test_convolve_2d_rotates_kernel()
+{
+    std::vector<float> const values = {1, 2, 0, 0, 0, 0, 0, 0, 3};
+    gil::detail::kernel_2d<float> const kernel(values.begin(), values.size(), 0, 2);
+    std::vector<float> const rotated_values = {3, 0, 0, 0, 0, 0, 0, 2, 1};
+    gil::detail::kernel_2d<float> const rotated(rotated_values.begin(), values.size(), 2, 0);
+
+    gil::gray32f_image_t src(9, 7);
+    fixture::fill_random(gil::view(src), 0, 63);
+    gil::gray32f_image_t convolved(9, 7);
+    gil::gray32f_image_t correlated(9, 7);
+    gil::convolve_2d<gil::gray32f_pixel_t>(
+        gil::const_view(src), kernel, gil::view(convolved), gil::boundary_option::extend_constant);
+    gil::correlate_2d<gil::gray32f_pixel_t>(
+        gil::const_view(src), rotated, gil::view(correlated),
+        gil::boundary_option::extend_constant);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(convolved), gil::const_view(correlated)));
+}
+
 int main()
 {
     test_convolve_2d_with_normalized_mean_filter();
     test_convolve_2d_with_image_using_float32_t();
     test_convolve_2d_with_sobel_x_filter();
     test_convolve_2d_with_sobel_y_filter();
+    test_correlate_2d();
+    test_correlate_2d_fft();
+    test_correlate_2d_large_kernel();
+    test_correlate_2d_fft_threshold();
+    test_convolve_2d_rotates_kernel();
     return ::boost::report_errors();
 }
@@ -11,8 +11,11 @@
 
 #include <boost/core/lightweight_test.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 
 #include "test_fixture.hpp"
 #include "core/image/test_fixture.hpp"
@@ -65,10 +68,100 @@ struct test_image_1x1_kernel_3x3_identity
     }
 };
 
+// Columns are correlated in strips of columns and blocks of rows, the result must be the same
+// as correlating the rows of the transposed views
+struct test_strips_match_transposed_rows
+{
+    template <typename PixelAccum, typename Image, typename Kernel>
+    static void check(Kernel const& kernel, std::ptrdiff_t width, std::ptrdiff_t height)
+    {
+        // the margin makes extend_padded valid
+        std::ptrdiff_t const margin = static_cast<std::ptrdiff_t>(kernel.size());
+        Image padded(width + 2 * margin, height + 2 * margin);
+        fixture::fill_random(gil::view(padded), 0, 63);
+        auto const src = gil::subimage_view(gil::view(padded), margin, margin, width, height);
+
+        for (auto option : {gil::boundary_option::output_ignore,
+                            gil::boundary_option::output_zero,
+                            gil::boundary_option::extend_padded,
+                            gil::boundary_option::extend_zero,
+                            gil::boundary_option::extend_constant})
+        {
+            Image expected(width, height);
+            Image actual(width, height);
+            gil::fill_pixels(gil::view(expected), typename Image::value_type{});
+            gil::fill_pixels(gil::view(actual), typename Image::value_type{});
+            gil::correlate_rows<PixelAccum>(
+                gil::transposed_view(src), kernel, gil::transposed_view(gil::view(expected)),
+                option);
+            gil::correlate_cols<PixelAccum>(src, kernel, gil::view(actual), option);
+            BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(actual)));
+
+            // in place, as in the second pass of convolve_1d
+            if (option != gil::boundary_option::extend_padded)
+            {
+                Image in_place(width, height);
+                gil::copy_pixels(src, gil::view(in_place));
+                gil::correlate_cols<PixelAccum>(
+                    gil::const_view(in_place), kernel, gil::view(in_place), option);
+                if (option == gil::boundary_option::output_ignore
+                    && height >= static_cast<std::ptrdiff_t>(kernel.size()))
+                {
+                    // rows outside the computed ones keep the source
+                    auto const computed = gil::subimage_view(
+                        gil::view(in_place), 0, static_cast<std::ptrdiff_t>(kernel.left_size()),
+                        width, height - static_cast<std::ptrdiff_t>(kernel.size()) + 1);
+                    auto const computed_expected = gil::subimage_view(
+                        gil::view(expected), 0, static_cast<std::ptrdiff_t>(kernel.left_size()),
+                        width, height - static_cast<std::ptrdiff_t>(kernel.size()) + 1);
+                    BOOST_TEST(gil::equal_pixels(computed_expected, computed));
+                }
+                else if (option != gil::boundary_option::output_ignore)
+                {
+                    BOOST_TEST(gil::equal_pixels(
+                        gil::const_view(expected), gil::const_view(in_place)));
+                }
+            }
+        }
+    }
+
+    template <typename PixelAccum, typename Image, typename T>
+    static void run_with()
+    {
+        std::vector<T> const values = {1, 2, 3, 5, 3, 2, 1, 4, 1};
+        for (std::size_t size : {3u, 9u})
+        {
+            gil::kernel_1d<T> const kernel(values.begin(), size, size / 2 - (size == 9 ? 1 : 0));
+            check<PixelAccum, Image>(kernel, 1100, 150);
+            check<PixelAccum, Image>(kernel, 5, 7);
+        }
+        gil::kernel_1d_fixed<T, 3> const kernel_fixed(values.begin(), 1);
+        Image src(70, 80);
+        fixture::fill_random(gil::view(src), 0, 63);
+        Image expected(70, 80);
+        Image actual(70, 80);
+        gil::convolve_rows_fixed<PixelAccum>(
+            gil::transposed_view(gil::const_view(src)), kernel_fixed,
+            gil::transposed_view(gil::view(expected)));
+        gil::convolve_cols_fixed<PixelAccum>(gil::const_view(src), kernel_fixed, gil::view(actual));
+        BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(actual)));
+    }
+
+    static void run()
+    {
+        run_with<gil::gray32f_pixel_t, gil::gray32f_image_t, float>();
+        run_with<gil::rgb32f_pixel_t, gil::rgb8_image_t, float>();
+        run_with<gil::rgba32f_pixel_t, gil::rgba16_image_t, float>();
+        run_with<gil::gray32s_pixel_t, gil::gray16_image_t, int>();
+        run_with<gil::rgb32s_pixel_t, gil::rgb8_image_t, int>();
+    }
+};
+
 int main()
 {
     test_image_1x1_kernel_1x1_identity::run();
     test_image_1x1_kernel_3x3_identity::run();
+    test_strips_match_transposed_rows::run();
 
     return ::boost::report_errors();
 }
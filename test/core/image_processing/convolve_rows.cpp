@@ -11,8 +11,11 @@
 
 #include <boost/core/lightweight_test.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 
 #include "test_fixture.hpp"
 #include "core/image/test_fixture.hpp"
@@ -65,10 +68,84 @@ struct test_image_1x1_kernel_3x3_identity
     }
 };
 
+// Rows of float pixels are correlated with vector instructions in blocks of several pixels,
+// the widths below leave different remainders for the scalar tail.
+struct test_float_accumulator_rows
+{
+    // Tap by tap float accumulation with zero extension, as done by correlate_pixels_n
+    template <typename SrcView, typename DstView>
+    static void check(
+        SrcView const& src, gil::kernel_1d<float> const& kernel, DstView const& dst)
+    {
+        using dst_channel_t = typename gil::channel_type<DstView>::type;
+        std::ptrdiff_t const left = static_cast<std::ptrdiff_t>(kernel.left_size());
+        bool all_equal = true;
+        for (std::ptrdiff_t y = 0; y < src.height(); ++y)
+        {
+            for (std::ptrdiff_t x = 0; x < src.width(); ++x)
+            {
+                for (std::size_t c = 0; c < gil::num_channels<SrcView>::value; ++c)
+                {
+                    float acc = 0.0f;
+                    for (std::size_t k = 0; k < kernel.size(); ++k)
+                    {
+                        std::ptrdiff_t const sx = x + static_cast<std::ptrdiff_t>(k) - left;
+                        float const v = sx < 0 || sx >= src.width()
+                            ? 0.0f
+                            : static_cast<float>(src(sx, y)[c]);
+                        acc += v * kernel[k];
+                    }
+                    dst_channel_t const expected = static_cast<dst_channel_t>(acc);
+                    all_equal = all_equal &&
+                        !(expected < dst(x, y)[c]) && !(dst(x, y)[c] < expected);
+                }
+            }
+        }
+        BOOST_TEST(all_equal);
+    }
+
+    template <typename PixelAccum, typename SrcImage, typename DstImage>
+    static void run_with()
+    {
+        std::vector<float> const values =
+            {0.01f, 0.02f, 0.05f, 0.1f, 0.15f, 0.2f, 0.3f, 0.35f, 0.3f, 0.2f, 0.15f, 0.1f,
+             0.05f, 0.02f, 0.01f};
+        for (std::ptrdiff_t width : {1, 3, 13, 45, 70})
+        {
+            SrcImage src(width, 3);
+            fixture::fill_random(gil::view(src), 0, 127);
+            for (std::size_t size : {3u, 7u, 15u})
+            {
+                gil::kernel_1d<float> const kernel(values.begin(), size, size / 2);
+                DstImage dst(width, 3);
+                gil::correlate_rows<PixelAccum>(gil::const_view(src), kernel, gil::view(dst));
+                check(gil::const_view(src), kernel, gil::const_view(dst));
+            }
+            gil::kernel_1d_fixed<float, 5> const kernel_fixed(values.begin() + 2, 2);
+            DstImage dst(width, 3);
+            gil::correlate_rows_fixed<PixelAccum>(
+                gil::const_view(src), kernel_fixed, gil::view(dst));
+            check(gil::const_view(src), gil::kernel_1d<float>(values.begin() + 2, 5, 2),
+                gil::const_view(dst));
+        }
+    }
+
+    static void run()
+    {
+        run_with<gil::gray32f_pixel_t, gil::gray32f_image_t, gil::gray32f_image_t>();
+        run_with<gil::rgb32f_pixel_t, gil::rgb32f_image_t, gil::rgb32f_image_t>();
+        run_with<gil::bgra32f_pixel_t, gil::bgra32f_image_t, gil::bgra32f_image_t>();
+        run_with<gil::rgb32f_pixel_t, gil::rgb32f_planar_image_t, gil::rgb32f_image_t>();
+        run_with<gil::rgb32f_pixel_t, gil::rgb8_image_t, gil::rgb8_image_t>();
+        run_with<gil::gray32f_pixel_t, gil::gray16_image_t, gil::gray32f_image_t>();
+    }
+};
+
 int main()
 {
     test_image_1x1_kernel_1x1_identity::run();
     test_image_1x1_kernel_3x3_identity::run();
+    test_float_accumulator_rows::run();
 
     return ::boost::report_errors();
 }
@@ -0,0 +1,193 @@
+//
+// Copyright 2026 Boost.GIL Contributors
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#include <boost/gil.hpp>
+#include <boost/gil/image_processing/filter.hpp>
+#include <boost/gil/image_processing/numeric.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "core/image/test_fixture.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+namespace gil = boost::gil;
+namespace fixture = boost::gil::test::fixture;
+
+void test_constant_image_is_unchanged()
+{
+    gil::rgb8_image_t src(31, 17);
+    gil::fill_pixels(gil::view(src), gil::rgb8_pixel_t(10, 120, 250));
+    for (double sigma : {0.5, 2.0, 40.0})
+    {
+        gil::rgb8_image_t dst(31, 17);
+        gil::gaussian_blur(
+            gil::const_view(src), gil::view(dst), sigma, gil::boundary_option::extend_constant);
+        BOOST_TEST(gil::equal_pixels(gil::const_view(src), gil::const_view(dst)));
+    }
+}
+
+// The result matches the correlation with a sampled Gaussian kernel within the accuracy of the
+// recursive approximation, for any sigma and boundary option
+void test_matches_gaussian_kernel()
+{
+    gil::gray32f_image_t padded(120, 100);
+    fixture::fill_random(gil::view(padded), 0, 255);
+    auto const src = gil::subimage_view(gil::const_view(padded), 30, 30, 60, 40);
+
+    for (double sigma : {3.0, 9.0})
+    {
+        std::size_t const radius = static_cast<std::size_t>(std::ceil(3.0 * sigma));
+        auto const kernel = gil::generate_gaussian_kernel(2 * radius + 1, sigma);
+        for (auto option : {gil::boundary_option::extend_zero,
+                            gil::boundary_option::extend_constant,
+                            gil::boundary_option::extend_padded})
+        {
+            gil::gray32f_image_t expected(src.dimensions());
+            gil::gray32f_image_t actual(src.dimensions());
+            gil::correlate_2d<gil::gray32f_pixel_t>(src, kernel, gil::view(expected), option);
+            gil::gaussian_blur(src, gil::view(actual), sigma, option);
+            BOOST_TEST_LT(
+                fixture::max_difference(gil::const_view(expected), gil::const_view(actual)), 6.0);
+        }
+    }
+}
+
+void test_interleaved_and_planar_views()
+{
+    gil::rgb8_image_t src(23, 19);
+    fixture::fill_random(gil::view(src), 0, 255);
+    gil::rgb8_planar_image_t planar_src(src.dimensions());
+    gil::copy_pixels(gil::const_view(src), gil::view(planar_src));
+
+    gil::rgb8_image_t expected(src.dimensions());
+    gil::rgb8_planar_image_t actual(src.dimensions());
+    gil::gaussian_blur(gil::const_view(src), gil::view(expected), 4.0);
+    gil::gaussian_blur(gil::const_view(planar_src), gil::view(actual), 4.0);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(actual)));
+
+    // Channels are blurred independently
+    gil::gray8_image_t red(src.dimensions());
+    gil::gaussian_blur(gil::nth_channel_view(gil::const_view(src), 0), gil::view(red), 4.0);
+    BOOST_TEST(gil::equal_pixels(
+        gil::nth_channel_view(gil::const_view(expected), 0), gil::const_view(red)));
+}
+
+void test_extend_zero_keeps_sum()
+{
+    // An impulse far from the sides spreads without losing its weight
+    gil::gray32f_image_t src(601, 601);
+    gil::fill_pixels(gil::view(src), gil::gray32f_pixel_t(0.0f));
+    gil::view(src)(300, 300) = gil::gray32f_pixel_t(1.0f);
+    gil::gray32f_image_t dst(src.dimensions());
+    gil::gaussian_blur(gil::const_view(src), gil::view(dst), 20.0);
+
+    double sum = 0;
+    for (auto const& p : gil::const_view(dst))
+        sum += static_cast<double>(p[0]);
+    BOOST_TEST_LT(std::abs(sum - 1.0), 1e-3);
+    BOOST_TEST(gil::const_view(dst)(300, 300)[0] > gil::const_view(dst)(310, 300)[0]);
+    BOOST_TEST_EQ(gil::const_view(dst)(300, 310)[0], gil::const_view(dst)(310, 300)[0]);
+}
+
+void test_output_options()
+{
+    gil::gray8_image_t src(30, 20);
+    fixture::fill_random(gil::view(src), 0, 255);
+    gil::gray8_image_t computed(src.dimensions());
+    gil::gaussian_blur(
+        gil::const_view(src), gil::view(computed), 1.5, gil::boundary_option::extend_constant);
+
+    // Pixels closer than ceil(3 * sigma) to a side are left out
+    std::ptrdiff_t const radius = 5;
+    auto const inner = [&](gil::gray8c_view_t const& v)
+    {
+        return gil::subimage_view(v, radius, radius, 30 - 2 * radius, 20 - 2 * radius);
+    };
+
+    gil::gray8_image_t zeroed(src.dimensions());
+    gil::fill_pixels(gil::view(zeroed), gil::gray8_pixel_t(1));
+    gil::gaussian_blur(
+        gil::const_view(src), gil::view(zeroed), 1.5, gil::boundary_option::output_zero);
+    BOOST_TEST(gil::equal_pixels(inner(gil::const_view(computed)), inner(gil::const_view(zeroed))));
+    BOOST_TEST(gil::const_view(zeroed)(4, 10) == gil::gray8_pixel_t(0));
+    BOOST_TEST(gil::const_view(zeroed)(10, 15) == gil::gray8_pixel_t(0));
+
+    gil::gray8_image_t ignored(src.dimensions());
+    gil::fill_pixels(gil::view(ignored), gil::gray8_pixel_t(1));
+    gil::gaussian_blur(
+        gil::const_view(src), gil::view(ignored), 1.5, gil::boundary_option::output_ignore);
+    BOOST_TEST(
+        gil::equal_pixels(inner(gil::const_view(computed)), inner(gil::const_view(ignored))));
+    BOOST_TEST(gil::const_view(ignored)(4, 10) == gil::gray8_pixel_t(1));
+    BOOST_TEST(gil::const_view(ignored)(10, 15) == gil::gray8_pixel_t(1));
+}
+
+// Integer channels are clamped before rounding, so the recursion overshooting at a step edge
+// cannot wrap around
+void test_step_edge_stays_in_range()
+{
+    BOOST_TEST_EQ((gil::detail::to_gaussian_blur_channel<std::uint8_t>(255.6, std::true_type())),
+        255);
+    BOOST_TEST_EQ((gil::detail::to_gaussian_blur_channel<std::uint8_t>(-0.6, std::true_type())),
+        0);
+
+    using gray64f_image_t = gil::image<gil::pixel<double, gil::gray_layout_t>, false>;
+    gil::gray8_image_t src(64, 9);
+    for (std::ptrdiff_t y = 0; y < src.height(); ++y)
+        for (std::ptrdiff_t x = 0; x < src.width(); ++x)
+            gil::view(src)(x, y) = gil::gray8_pixel_t(x < 32 ? 0 : 255);
+
+    for (double sigma : {0.5, 0.8, 3.0})
+    {
+        for (auto option : {gil::boundary_option::extend_zero,
+                            gil::boundary_option::extend_constant})
+        {
+            gray64f_image_t exact(src.dimensions());
+            gil::gray8_image_t dst(src.dimensions());
+            gil::gaussian_blur(gil::const_view(src), gil::view(exact), sigma, option);
+            gil::gaussian_blur(gil::const_view(src), gil::view(dst), sigma, option);
+            for (std::ptrdiff_t y = 0; y < src.height(); ++y)
+            {
+                for (std::ptrdiff_t x = 0; x < src.width(); ++x)
+                {
+                    double const value = gil::const_view(exact)(x, y)[0];
+                    double const expected = std::round((std::min)((std::max)(value, 0.0), 255.0));
+                    BOOST_TEST_EQ(static_cast<int>(gil::const_view(dst)(x, y)[0]),
+                        static_cast<int>(expected));
+                }
+            }
+            BOOST_TEST_EQ(static_cast<int>(gil::const_view(dst)(0, 4)[0]), 0);
+        }
+    }
+}
+
+void test_invalid_sigma()
+{
+    gil::gray8_image_t src(3, 3);
+    gil::gray8_image_t dst(3, 3);
+    BOOST_TEST_THROWS(
+        gil::gaussian_blur(gil::const_view(src), gil::view(dst), 0.25), std::invalid_argument);
+}
+
+int main()
+{
+    test_constant_image_is_unchanged();
+    test_matches_gaussian_kernel();
+    test_interleaved_and_planar_views();
+    test_extend_zero_keeps_sum();
+    test_output_options();
+    test_step_edge_stays_in_range();
+    test_invalid_sigma();
+
+    return ::boost::report_errors();
+}
@@ -0,0 +1,233 @@
+//
+// Copyright 2026 Boost.GIL Contributors
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#include <boost/gil.hpp>
+#include <boost/gil/image_processing/pyramid.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "core/image/test_fixture.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace gil = boost::gil;
+namespace fixture = boost::gil::test::fixture;
+
+// Blur of a level at its even pixels, computed in full
+template <typename View>
+auto reduced(View const& src, std::vector<double> const& kernel, std::ptrdiff_t center,
+    gil::boundary_option option, std::ptrdiff_t x, std::ptrdiff_t y, std::size_t c) -> double
+{
+    std::ptrdiff_t const size = static_cast<std::ptrdiff_t>(kernel.size());
+    double sum = 0.0;
+    for (std::ptrdiff_t j = 0; j < size; ++j)
+    {
+        for (std::ptrdiff_t i = 0; i < size; ++i)
+        {
+            std::ptrdiff_t sx = 2 * x + i - center;
+            std::ptrdiff_t sy = 2 * y + j - center;
+            bool const inside = sx >= 0 && sx < src.width() && sy >= 0 && sy < src.height();
+            if (!inside && option == gil::boundary_option::extend_zero)
+                continue;
+            if (option == gil::boundary_option::extend_constant)
+            {
+                sx = (std::min)((std::max)(sx, std::ptrdiff_t(0)), src.width() - 1);
+                sy = (std::min)((std::max)(sy, std::ptrdiff_t(0)), src.height() - 1);
+            }
+            sum += kernel[static_cast<std::size_t>(i)] * kernel[static_cast<std::size_t>(j)] *
+                static_cast<double>(src.xy_at(0, 0)(sx, sy)[c]);
+        }
+    }
+    return sum;
+}
+
+template <typename View, typename Level>
+auto max_reduction_error(View const& src, Level const& dst, std::vector<double> const& kernel,
+    std::ptrdiff_t center, gil::boundary_option option, bool integral) -> double
+{
+    double error = 0.0;
+    for (std::ptrdiff_t y = 0; y < dst.height(); ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < dst.width(); ++x)
+        {
+            for (std::size_t c = 0; c < gil::num_channels<View>::value; ++c)
+            {
+                double expected = reduced(src, kernel, center, option, x, y, c);
+                if (integral)
+                    expected = std::floor(expected + 0.5);
+                error = (std::max)(
+                    error, std::abs(static_cast<double>(dst(x, y)[c]) - expected));
+            }
+        }
+    }
+    return error;
+}
+
+template <typename Pyramid>
+bool equal_levels(Pyramid const& a, Pyramid const& b)
+{
+    bool equal = a.size() == b.size();
+    for (std::size_t i = 0; equal && i < a.size(); ++i)
+        equal = gil::equal_pixels(a.level(i), b.level(i));
+    return equal;
+}
+
+template <typename Image>
+void test_gaussian(double tolerance)
+{
+    using channel_t = typename gil::channel_type<Image>::type;
+    bool const integral = std::is_integral<typename gil::base_channel_type<channel_t>::type>::value;
+    std::vector<double> const binomial{1 / 16.0, 4 / 16.0, 6 / 16.0, 4 / 16.0, 1 / 16.0};
+
+    Image src(67, 45);
+    fixture::fill_random(gil::view(src), 0, 255);
+    gil::gaussian_pyramid<Image> const pyramid(gil::const_view(src), 10);
+    // 67x45, 34x23, 17x12, 9x6, 5x3, 3x2, 2x1
+    BOOST_TEST_EQ(pyramid.size(), 7u);
+    BOOST_TEST(gil::equal_pixels(pyramid.level(0), gil::const_view(src)));
+    BOOST_TEST_EQ(pyramid.level(1).width(), 34);
+    BOOST_TEST_EQ(pyramid.level(1).height(), 23);
+    BOOST_TEST_EQ(pyramid.level(6).height(), 1);
+    for (std::size_t i = 1; i < pyramid.size(); ++i)
+    {
+        BOOST_TEST_LE(max_reduction_error(pyramid.level(i - 1), pyramid.level(i), binomial, 2,
+            gil::boundary_option::extend_constant, integral), tolerance);
+    }
+
+    gil::gaussian_pyramid<Image> const parallel(
+        gil::execution::parallel_policy(3), gil::const_view(src), 10);
+    BOOST_TEST(equal_levels(pyramid, parallel));
+
+    // A 3-tap kernel whose center is not in the middle, reading zeros past the borders
+    float const taps[] = {0.5f, 0.25f, 0.25f};
+    gil::kernel_1d<float> const kernel(taps, 3, 0);
+    gil::gaussian_pyramid<Image> const shifted(
+        gil::const_view(src), 3, kernel, gil::boundary_option::extend_zero);
+    BOOST_TEST_EQ(shifted.size(), 3u);
+    for (std::size_t i = 1; i < shifted.size(); ++i)
+    {
+        BOOST_TEST_LE(max_reduction_error(shifted.level(i - 1), shifted.level(i),
+            {0.5, 0.25, 0.25}, 0, gil::boundary_option::extend_zero, integral), tolerance);
+    }
+}
+
+void test_gaussian_padded()
+{
+    gil::gray8_image_t padded(40, 30);
+    fixture::fill_random(gil::view(padded), 0, 255);
+    auto const src = gil::subimage_view(gil::const_view(padded), 3, 3, 34, 24);
+    std::vector<double> const binomial{1 / 16.0, 4 / 16.0, 6 / 16.0, 4 / 16.0, 1 / 16.0};
+
+    // Level 1 reads the pixels around the view
+    gil::gaussian_pyramid<gil::gray8_image_t> const pyramid(
+        src, 3, gil::detail::binomial_pyramid_kernel(), gil::boundary_option::extend_padded);
+    BOOST_TEST_LE(max_reduction_error(src, pyramid.level(1), binomial, 2,
+        gil::boundary_option::extend_padded, true), 1.0);
+    BOOST_TEST_LE(max_reduction_error(pyramid.level(1), pyramid.level(2), binomial, 2,
+        gil::boundary_option::extend_constant, true), 1.0);
+}
+
+void test_constant()
+{
+    gil::rgb8_image_t src(50, 37, gil::rgb8_pixel_t(10, 128, 250), 0);
+    gil::gaussian_pyramid<gil::rgb8_image_t> const pyramid(gil::const_view(src), 4);
+    bool all_equal = true;
+    for (std::size_t i = 0; i < pyramid.size(); ++i)
+    {
+        gil::rgb8_image_t expected(pyramid.level(i).dimensions(), gil::rgb8_pixel_t(10, 128, 250),
+            0);
+        all_equal = all_equal && gil::equal_pixels(pyramid.level(i), gil::const_view(expected));
+    }
+    BOOST_TEST(all_equal);
+
+    // Details of a constant image vanish
+    gil::laplacian_pyramid<gil::rgb32f_image_t> const laplacian(gil::const_view(src), 4);
+    bool all_zero = true;
+    for (std::size_t i = 0; i + 1 < laplacian.size(); ++i)
+    {
+        auto const level = laplacian.level(i);
+        for (std::ptrdiff_t y = 0; y < level.height(); ++y)
+        {
+            for (std::ptrdiff_t x = 0; x < level.width(); ++x)
+            {
+                for (std::size_t c = 0; c < 3; ++c)
+                    all_zero = all_zero && std::abs(static_cast<float>(level(x, y)[c])) < 1e-3f;
+            }
+        }
+    }
+    BOOST_TEST(all_zero);
+}
+
+template <typename Image>
+void test_laplacian(std::ptrdiff_t width, std::ptrdiff_t height, std::size_t levels)
+{
+    gil::rgb8_image_t src(width, height);
+    fixture::fill_random(gil::view(src), 0, 255);
+    gil::laplacian_pyramid<Image> const laplacian(gil::const_view(src), levels);
+
+    // The last level is the last Gaussian level
+    gil::gaussian_pyramid<Image> const gaussian(gil::const_view(src), levels);
+    BOOST_TEST_EQ(laplacian.size(), gaussian.size());
+    BOOST_TEST(gil::equal_pixels(
+        laplacian.level(laplacian.size() - 1), gaussian.level(gaussian.size() - 1)));
+
+    gil::rgb8_image_t collapsed(width, height);
+    laplacian.collapse(gil::view(collapsed));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(collapsed), gil::const_view(src)));
+
+    gil::rgb8_image_t parallel(width, height);
+    laplacian.collapse(gil::execution::parallel_policy(3), gil::view(parallel));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(parallel), gil::const_view(src)));
+
+    gil::laplacian_pyramid<Image> const parallel_pyramid(
+        gil::execution::parallel_policy(3), gil::const_view(src), levels);
+    BOOST_TEST(equal_levels(laplacian, parallel_pyramid));
+}
+
+// Gaussian levels keep the last column and row of odd dimensions, the levels of image_pyramid
+// drop them
+void test_level_dimensions()
+{
+    gil::gray8_image_t src(13, 7);
+    fixture::fill_random(gil::view(src), 0, 255);
+
+    gil::gaussian_pyramid<gil::gray8_image_t> const gaussian(gil::const_view(src), 10);
+    BOOST_TEST_EQ(gaussian.size(), 4u);
+    BOOST_TEST(gaussian.level(1).dimensions() == gil::point_t(7, 4));
+    BOOST_TEST(gaussian.level(2).dimensions() == gil::point_t(4, 2));
+    BOOST_TEST(gaussian.level(3).dimensions() == gil::point_t(2, 1));
+
+    gil::image_pyramid<gil::gray8_image_t> const mipmap(gil::const_view(src), 10);
+    BOOST_TEST_EQ(mipmap.size(), 3u);
+    BOOST_TEST(mipmap.level(1).dimensions() == gil::point_t(6, 3));
+    BOOST_TEST(mipmap.level(2).dimensions() == gil::point_t(3, 1));
+}
+
+int main()
+{
+    test_gaussian<gil::gray8_image_t>(1.0);
+    test_gaussian<gil::rgb8_image_t>(1.0);
+    test_gaussian<gil::bgr8_image_t>(1.0);
+    test_gaussian<gil::rgb8_planar_image_t>(1.0);
+    test_gaussian<gil::gray16_image_t>(1.0);
+    test_gaussian<gil::rgb32f_image_t>(1e-3);
+    test_gaussian_padded();
+    test_constant();
+    test_level_dimensions();
+
+    test_laplacian<gil::rgb32f_image_t>(67, 45, 10);
+    test_laplacian<gil::rgb32f_planar_image_t>(64, 64, 4);
+    test_laplacian<gil::rgb16s_image_t>(33, 20, 3);
+    test_laplacian<gil::rgb32f_image_t>(1, 9, 3);
+
+    return ::boost::report_errors();
+}
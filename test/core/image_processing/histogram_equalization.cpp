@@ -6,6 +6,7 @@
 // http://www.boost.org/LICENSE_1_0.txt)
 //
 
+#include <boost/gil/algorithm.hpp>
 #include <boost/gil/color_base_algorithm.hpp>
 #include <boost/gil/histogram.hpp>
 #include <boost/gil/image_view.hpp>
@@ -15,6 +16,10 @@
 
 #include <boost/core/lightweight_test.hpp>
 
+#include "core/image/test_fixture.hpp"
+
+#include <cstdint>
+#include <type_traits>
 #include <vector>
 
 const int a = 5;
@@ -111,11 +116,12 @@ std::vector<std::vector<bool> > mask{
 void vector_to_gray_image(boost::gil::gray8_image_t& img,
     std::vector<std::vector<int> >& grid)
 {
-    for(std::ptrdiff_t y=0; y<grid.size(); ++y)
+    for(std::ptrdiff_t y=0; y<static_cast<std::ptrdiff_t>(grid.size()); ++y)
     {
-        for(std::ptrdiff_t x=0; x<grid[0].size(); ++x)
+        for(std::ptrdiff_t x=0; x<static_cast<std::ptrdiff_t>(grid[0].size()); ++x)
         {
-            boost::gil::view(img)(x,y) = boost::gil::gray8_pixel_t(grid[y][x]);
+            boost::gil::view(img)(x,y) =
+                boost::gil::gray8_pixel_t(static_cast<std::uint8_t>(grid[y][x]));
         }
     }
 }
@@ -124,12 +130,11 @@ template<typename SrcView>
 bool equal_pixels(SrcView const& v1, SrcView const& v2, double threshold)
 {
     double sum=0.0;
-    using pixel_t = typename boost::gil::get_pixel_type<SrcView>::type;
     using channel_t = typename boost::gil::channel_type<SrcView>::type;
     channel_t max_p = std::numeric_limits<channel_t>::max();
     channel_t min_p = std::numeric_limits<channel_t>::min();
     long int num_pixels = v1.width() * v1.height();
-    std::size_t num_channels = boost::gil::num_channels<SrcView>::value;
+    std::ptrdiff_t num_channels = boost::gil::num_channels<SrcView>::value;
     for (std::ptrdiff_t y = 0; y < v1.height(); ++y)
     {
         auto it1 = v1.row_begin(y);
@@ -142,7 +147,8 @@ bool equal_pixels(SrcView const& v1, SrcView const& v2, double threshold)
             }
         }
     }
-    return ( abs(sum) / (num_pixels * num_channels * (max_p - min_p)) < threshold );
+    double const scale = static_cast<double>(num_pixels * num_channels * (max_p - min_p));
+    return ( abs(sum) / scale < threshold );
 }
 
 void test_random_image()
@@ -266,6 +272,63 @@ void test_double_peaked_image()
     BOOST_TEST(process_1.equals(process_2));
 }
 
+// Channels of [0, 60 + 40 c), whose histograms differ
+template <typename View>
+void fill_random(View const& v, std::uint32_t seed)
+{
+    for (int c = 0; c < static_cast<int>(boost::gil::num_channels<View>::value); ++c)
+    {
+        boost::gil::test::fixture::fill_random(
+            boost::gil::nth_channel_view(v, c), 0, 59 + 40 * c, seed + std::uint32_t(c));
+    }
+}
+
+// Equalizes with the lookup tables and with the per-pixel mappings, which must agree
+template <typename SrcView, typename DstView>
+void check_lookup_tables(
+    SrcView const& src, DstView const& dst, DstView const& per_pixel, std::size_t bin_width,
+    bool use_mask, std::vector<std::vector<bool>> const& src_mask)
+{
+    namespace gil = boost::gil;
+    using channel_t = typename gil::channel_type<SrcView>::type;
+    gil::detail::histogram_equalization_channels<gil::histogram<channel_t>>(
+        gil::execution::seq, src, per_pixel, bin_width, use_mask, src_mask, std::false_type());
+
+    histogram_equalization(src, dst, bin_width, use_mask, src_mask);
+    BOOST_TEST(gil::equal_pixels(dst, per_pixel));
+    histogram_equalization(
+        gil::execution::parallel_policy(3), src, dst, bin_width, use_mask, src_mask);
+    BOOST_TEST(gil::equal_pixels(dst, per_pixel));
+}
+
+void test_lookup_tables()
+{
+    namespace gil = boost::gil;
+    gil::rgb8_image_t src(61, 37), dst(61, 37), per_pixel(61, 37);
+    fill_random(gil::view(src), 7);
+    std::vector<std::vector<bool>> src_mask(37, std::vector<bool>(61));
+    for (std::size_t y = 0; y < src_mask.size(); ++y)
+        for (std::size_t x = 0; x < src_mask[y].size(); ++x)
+            src_mask[y][x] = (x * 7 + y * 3) % 5 != 0;
+
+    check_lookup_tables(gil::const_view(src), gil::view(dst), gil::view(per_pixel), 1, false, {});
+    check_lookup_tables(gil::const_view(src), gil::view(dst), gil::view(per_pixel), 3, false, {});
+    check_lookup_tables(
+        gil::const_view(src), gil::view(dst), gil::view(per_pixel), 1, true, src_mask);
+
+    // Planar views are mapped pixel by pixel with the same tables
+    gil::rgb8_planar_image_t planar(61, 37), planar_dst(61, 37);
+    gil::copy_pixels(gil::const_view(src), gil::view(planar));
+    histogram_equalization(gil::const_view(planar), gil::view(planar_dst));
+    histogram_equalization(gil::const_view(src), gil::view(dst));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(planar_dst), gil::const_view(dst)));
+
+    gil::gray16_image_t src16(45, 23), dst16(45, 23), expected16(45, 23);
+    fill_random(gil::view(src16), 3);
+    check_lookup_tables(
+        gil::const_view(src16), gil::view(dst16), gil::view(expected16), 1, false, {});
+}
+
 int main()
 {
     //Basic tests for grayscale histogram_equalization
@@ -275,6 +338,7 @@ int main()
     test_binary_image();
     test_uniform_image();
     test_double_peaked_image();
+    test_lookup_tables();
 
     return boost::report_errors();
 }
@@ -6,6 +6,7 @@
 // http://www.boost.org/LICENSE_1_0.txt)
 //
 
+#include <boost/gil/algorithm.hpp>
 #include <boost/gil/image_view.hpp>
 #include <boost/gil/histogram.hpp>
 #include <boost/gil/color_base_algorithm.hpp>
@@ -13,8 +14,12 @@
 #include <boost/gil/extension/toolbox/metafunctions/get_pixel_type.hpp>
 #include <boost/core/lightweight_test.hpp>
 
-#include <vector>
+#include "core/image/test_fixture.hpp"
+
+#include <cstdint>
 #include <iostream>
+#include <type_traits>
+#include <vector>
 
 const int a = 5;
 const double epsilon = 0.000001; // Decided by the value 5/255 i.e. an error of 5 px in 255 px
@@ -63,11 +68,12 @@ std::vector<std::vector<int> > test3_reference{
 void vector_to_gray_image(boost::gil::gray8_image_t& img,
     std::vector<std::vector<int> >& grid)
 {
-    for(std::ptrdiff_t y=0; y<grid.size(); ++y)
+    for(std::ptrdiff_t y=0; y<static_cast<std::ptrdiff_t>(grid.size()); ++y)
     {
-        for(std::ptrdiff_t x=0; x<grid[0].size(); ++x)
+        for(std::ptrdiff_t x=0; x<static_cast<std::ptrdiff_t>(grid[0].size()); ++x)
         {
-            boost::gil::view(img)(x,y) = boost::gil::gray8_pixel_t(grid[y][x]);
+            boost::gil::view(img)(x,y) =
+                boost::gil::gray8_pixel_t(static_cast<std::uint8_t>(grid[y][x]));
         }
     }
 }
@@ -81,8 +87,6 @@ bool equal_histograms(SrcView const& v1, SrcView const& v2, double threshold = e
     using value_t   = typename boost::gil::histogram<channel_t>::value_type;
     channel_t max_p = std::numeric_limits<channel_t>::max();
     channel_t min_p = std::numeric_limits<channel_t>::min();
-    long int num_pixels = v1.width() * v1.height();
-
     boost::gil::fill_histogram(v1, h1, 1, false, false);
     boost::gil::fill_histogram(v2, h2, 1, false, false);
     auto ch1 = boost::gil::cumulative_histogram(h1);
@@ -90,7 +94,7 @@ bool equal_histograms(SrcView const& v1, SrcView const& v2, double threshold = e
     std::for_each(ch1.begin(), ch1.end(), [&](value_t const& v) {
         sum+=abs(v.second-ch1[v.first]);
     });
-    return ( abs(sum) / (ch1.size() * (max_p - min_p)) < threshold );
+    return ( abs(sum) / static_cast<double>(ch1.size() * (max_p - min_p)) < threshold );
 }
 
 void test_random_image()
@@ -126,12 +130,69 @@ void test_equal_image()
     BOOST_TEST(equal_histograms(boost::gil::view(processed), boost::gil::view(processed2)));
 }
 
+// Channels of [0, range + 30 c), whose histograms differ
+template <typename View>
+void fill_random(View const& v, std::uint32_t seed, int range)
+{
+    for (int c = 0; c < static_cast<int>(boost::gil::num_channels<View>::value); ++c)
+    {
+        boost::gil::test::fixture::fill_random(
+            boost::gil::nth_channel_view(v, c), 0, range - 1 + 30 * c, seed + std::uint32_t(c));
+    }
+}
+
+// Matches with the lookup tables and with the per-pixel color maps, which must agree
+template <typename SrcView, typename DstView>
+void check_lookup_tables(
+    SrcView const& src, SrcView const& ref, DstView const& dst, DstView const& expected,
+    bool use_mask, std::vector<std::vector<bool>> const& mask)
+{
+    namespace gil = boost::gil;
+    using channel_t = typename gil::channel_type<SrcView>::type;
+    gil::detail::histogram_matching_channels
+    <
+        gil::histogram<channel_t>, gil::histogram<channel_t>
+    >(gil::execution::seq, src, ref, expected, 1, use_mask, mask, mask, std::false_type());
+
+    histogram_matching(src, ref, dst, 1, use_mask, mask, mask);
+    BOOST_TEST(gil::equal_pixels(dst, expected));
+    histogram_matching(gil::execution::parallel_policy(3), src, ref, dst, 1, use_mask, mask, mask);
+    BOOST_TEST(gil::equal_pixels(dst, expected));
+}
+
+void test_lookup_tables()
+{
+    namespace gil = boost::gil;
+    gil::rgb8_image_t src(53, 41), ref(53, 41), dst(53, 41), expected(53, 41);
+    fill_random(gil::view(src), 5, 90);
+    fill_random(gil::view(ref), 9, 200);
+    std::vector<std::vector<bool>> mask(41, std::vector<bool>(53));
+    for (std::size_t y = 0; y < mask.size(); ++y)
+        for (std::size_t x = 0; x < mask[y].size(); ++x)
+            mask[y][x] = (x * 5 + y) % 7 != 0;
+
+    check_lookup_tables(
+        gil::const_view(src), gil::const_view(ref), gil::view(dst), gil::view(expected),
+        false, {});
+    check_lookup_tables(
+        gil::const_view(src), gil::const_view(ref), gil::view(dst), gil::view(expected),
+        true, mask);
+
+    gil::gray16_image_t src16(37, 29), ref16(37, 29), dst16(37, 29), expected16(37, 29);
+    fill_random(gil::view(src16), 1, 700);
+    fill_random(gil::view(ref16), 2, 3000);
+    check_lookup_tables(
+        gil::const_view(src16), gil::const_view(ref16), gil::view(dst16), gil::view(expected16),
+        false, {});
+}
+
 int main()
 {
     //Basic tests for grayscale histogram_equalization
     test_random_image();
     test_uniform_image();
     test_equal_image();
+    test_lookup_tables();
 
     return boost::report_errors();
 }
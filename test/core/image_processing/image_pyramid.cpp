@@ -0,0 +1,109 @@
+//
+// Copyright 2026 Boost.GIL Contributors
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#include <boost/gil.hpp>
+#include <boost/gil/image_processing/pyramid.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "core/image/test_fixture.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace gil = boost::gil;
+namespace fixture = boost::gil::test::fixture;
+
+// Whether each level averages the blocks of 2x2 pixels of the previous one
+template <typename Pyramid>
+void check_levels(Pyramid const& pyramid)
+{
+    using view_t = typename Pyramid::const_view_t;
+    using base_t = typename gil::base_channel_type<typename gil::channel_type<view_t>::type>::type;
+    bool all_equal = true;
+    for (std::size_t i = 1; i < pyramid.size(); ++i)
+    {
+        view_t const src = pyramid.level(i - 1);
+        view_t const dst = pyramid.level(i);
+        all_equal = all_equal && dst.width() == src.width() / 2;
+        all_equal = all_equal && dst.height() == src.height() / 2;
+        for (std::ptrdiff_t y = 0; y < dst.height(); ++y)
+        {
+            for (std::ptrdiff_t x = 0; x < dst.width(); ++x)
+            {
+                for (std::size_t c = 0; c < gil::num_channels<view_t>::value; ++c)
+                {
+                    double const sum = static_cast<double>(src(2 * x, 2 * y)[c]) +
+                        static_cast<double>(src(2 * x + 1, 2 * y)[c]) +
+                        static_cast<double>(src(2 * x, 2 * y + 1)[c]) +
+                        static_cast<double>(src(2 * x + 1, 2 * y + 1)[c]);
+                    double const expected = std::is_integral<base_t>::value
+                        ? std::floor(sum / 4.0 + 0.5) : sum / 4.0;
+                    all_equal = all_equal &&
+                        std::abs(static_cast<double>(dst(x, y)[c]) - expected) <= 1e-6;
+                }
+            }
+        }
+    }
+    BOOST_TEST(all_equal);
+}
+
+template <typename Image>
+void test_pyramid(std::ptrdiff_t width, std::ptrdiff_t height, std::size_t levels,
+    std::size_t expected_levels)
+{
+    Image src(width, height);
+    fixture::fill_random_channels(gil::view(src));
+
+    gil::image_pyramid<Image> const pyramid(gil::const_view(src), levels);
+    BOOST_TEST_EQ(pyramid.size(), expected_levels);
+    BOOST_TEST(gil::equal_pixels(pyramid.level(0), gil::const_view(src)));
+    check_levels(pyramid);
+
+    gil::image_pyramid<Image> const parallel(
+        gil::execution::parallel_policy(3), gil::const_view(src), levels);
+    BOOST_TEST_EQ(parallel.size(), expected_levels);
+    bool all_equal = true;
+    for (std::size_t i = 0; i < pyramid.size() && i < parallel.size(); ++i)
+        all_equal = all_equal && gil::equal_pixels(pyramid.level(i), parallel.level(i));
+    BOOST_TEST(all_equal);
+}
+
+template <typename Image>
+void test_pyramids()
+{
+    // Odd dimensions drop their last column or row, levels stop at a dimension of 1
+    test_pyramid<Image>(203, 77, 20, 7);
+    test_pyramid<Image>(203, 77, 3, 3);
+    // Levels past the first six are halved after the pass over the image
+    test_pyramid<Image>(300, 520, 9, 9);
+    test_pyramid<Image>(1, 5, 4, 1);
+}
+
+void test_empty()
+{
+    gil::rgb8_image_t src(0, 0);
+    gil::image_pyramid<gil::rgb8_image_t> const pyramid(gil::const_view(src), 4);
+    BOOST_TEST_EQ(pyramid.size(), 1u);
+    BOOST_TEST_EQ(pyramid.level(0).width(), 0);
+}
+
+int main()
+{
+    test_pyramids<gil::gray8_image_t>();
+    test_pyramids<gil::rgb8_image_t>();
+    test_pyramids<gil::rgba8_image_t>();
+    test_pyramids<gil::rgb8_planar_image_t>();
+    test_pyramids<gil::gray16_image_t>();
+    test_pyramids<gil::rgb16_image_t>();
+    test_pyramids<gil::rgb32f_image_t>();
+    test_empty();
+
+    return ::boost::report_errors();
+}
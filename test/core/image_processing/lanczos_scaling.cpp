@@ -5,12 +5,22 @@
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 //
-#include <boost/gil/image.hpp>
+#include <boost/gil.hpp>
 #include <boost/gil/image_processing/scaling.hpp>
 
 #include <boost/core/lightweight_test.hpp>
 
+#include "core/image/test_fixture.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
 namespace gil = boost::gil;
+namespace fixture = boost::gil::test::fixture;
 
 bool are_equal(gil::rgb8_view_t expected, gil::rgb8_view_t actual)
 {
@@ -59,9 +69,141 @@ void test_lanczos_response_on_zero()
     BOOST_TEST_EQ(gil::lanczos(0, 2), 1);
 }
 
+// Lanczos weights of the source pixels of output pixel i, the kernel being widened by the
+// scale factor when shrinking and the weights normalized over the pixels within the source
+auto reference_weights(std::ptrdiff_t i, std::ptrdiff_t src_size, std::ptrdiff_t dst_size, long a)
+    -> std::vector<double>
+{
+    double const scale = static_cast<double>(src_size) / static_cast<double>(dst_size);
+    double const filter_scale = (std::max)(scale, 1.0);
+    double const center = (static_cast<double>(i) + 0.5) * scale;
+    std::vector<double> w(static_cast<std::size_t>(src_size), 0.0);
+    double total = 0;
+    for (std::ptrdiff_t j = 0; j < src_size; ++j)
+    {
+        double const d = (static_cast<double>(j) + 0.5 - center) / filter_scale;
+        if (std::abs(d) < static_cast<double>(a))
+        {
+            w[static_cast<std::size_t>(j)] = gil::lanczos(d, a);
+            total += w[static_cast<std::size_t>(j)];
+        }
+    }
+    for (auto& value : w)
+        value /= total;
+    return w;
+}
+
+// Checks that each channel is within tolerance of the lanczos resampling in double precision
+template <typename SrcView, typename DstView>
+void check_resampled(SrcView const& src, DstView const& dst, long a, double tolerance)
+{
+    double error = 0;
+    for (std::ptrdiff_t y = 0; y < dst.height(); ++y)
+    {
+        auto const wy = reference_weights(y, src.height(), dst.height(), a);
+        for (std::ptrdiff_t x = 0; x < dst.width(); ++x)
+        {
+            auto const wx = reference_weights(x, src.width(), dst.width(), a);
+            for (std::size_t c = 0; c < gil::num_channels<SrcView>::value; ++c)
+            {
+                double expected = 0;
+                for (std::ptrdiff_t j = 0; j < src.height(); ++j)
+                    for (std::ptrdiff_t i = 0; i < src.width(); ++i)
+                        expected += wy[static_cast<std::size_t>(j)] *
+                            wx[static_cast<std::size_t>(i)] * static_cast<double>(src(i, j)[c]);
+                using channel_t = typename gil::channel_type<DstView>::type;
+                if (std::is_integral<channel_t>::value)
+                {
+                    expected = (std::min)((std::max)(expected,
+                        static_cast<double>(gil::channel_traits<channel_t>::min_value())),
+                        static_cast<double>(gil::channel_traits<channel_t>::max_value()));
+                }
+                error = (std::max)(error, std::abs(expected - static_cast<double>(dst(x, y)[c])));
+            }
+        }
+    }
+    BOOST_TEST_LE(error, tolerance);
+}
+
+template <typename Image>
+void test_lanczos_resampling(double tolerance)
+{
+    Image src(37, 23);
+    fixture::fill_random(gil::view(src), 0, 255);
+    for (auto size : {gil::point_t(13, 9), gil::point_t(37, 23), gil::point_t(50, 31),
+                      gil::point_t(20, 40)})
+    {
+        Image dst(size);
+        gil::scale_lanczos(gil::const_view(src), gil::view(dst), 3);
+        check_resampled(gil::const_view(src), gil::const_view(dst), 3, tolerance);
+
+        Image parallel(size);
+        gil::scale_lanczos(
+            gil::execution::parallel_policy(3), gil::const_view(src), gil::view(parallel), 3);
+        BOOST_TEST(gil::equal_pixels(gil::const_view(dst), gil::const_view(parallel)));
+    }
+}
+
+void test_lanczos_layouts()
+{
+    gil::rgb8_image_t src(45, 31);
+    fixture::fill_random(gil::view(src), 0, 255);
+    gil::rgb8_planar_image_t planar(45, 31);
+    gil::copy_pixels(gil::const_view(src), gil::view(planar));
+
+    gil::rgb8_image_t dst(17, 12);
+    gil::rgb8_planar_image_t planar_dst(17, 12);
+    gil::scale_lanczos(gil::const_view(src), gil::view(dst), 2);
+    gil::scale_lanczos(gil::const_view(planar), gil::view(planar_dst), 2);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(dst), gil::const_view(planar_dst)));
+
+    // Constant images stay constant
+    gil::rgb8_image_t flat(45, 31, gil::rgb8_pixel_t(255, 7, 128), 0);
+    gil::scale_lanczos(gil::const_view(flat), gil::view(dst), 3);
+    BOOST_TEST(std::all_of(gil::view(dst).begin(), gil::view(dst).end(),
+        [](gil::rgb8_pixel_t const& p) { return p == gil::rgb8_pixel_t(255, 7, 128); }));
+}
+
+void test_lanczos_large_downscale()
+{
+    // Axes shrinking by more than 4 times are area averaged to twice their destination size
+    gil::rgb8_image_t src(203, 150);
+    fixture::fill_random(gil::view(src), 0, 255);
+    for (auto size : {gil::point_t(20, 15), gil::point_t(20, 75), gil::point_t(101, 10)})
+    {
+        gil::rgb8_image_t reduced(
+            gil::detail::lanczos_reduced_size(203, size.x),
+            gil::detail::lanczos_reduced_size(150, size.y));
+        gil::scale_area(gil::const_view(src), gil::view(reduced));
+        gil::rgb8_image_t expected(size);
+        gil::scale_lanczos(gil::const_view(reduced), gil::view(expected), 3);
+
+        gil::rgb8_image_t dst(size);
+        gil::scale_lanczos(gil::const_view(src), gil::view(dst), 3);
+        BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(dst)));
+
+        gil::rgb8_image_t parallel(size);
+        gil::scale_lanczos(
+            gil::execution::parallel_policy(3), gil::const_view(src), gil::view(parallel), 3);
+        BOOST_TEST(gil::equal_pixels(gil::const_view(dst), gil::const_view(parallel)));
+    }
+
+    gil::gray16_image_t flat(203, 150, gil::gray16_pixel_t(40000), 0);
+    gil::gray16_image_t dst(20, 15);
+    gil::scale_lanczos(gil::const_view(flat), gil::view(dst), 3);
+    BOOST_TEST(std::all_of(gil::view(dst).begin(), gil::view(dst).end(),
+        [](gil::gray16_pixel_t const& p) { return p == gil::gray16_pixel_t(40000); }));
+}
+
 int main()
 {
     test_lanczos_black_image();
     test_lanczos_response_on_zero();
+    test_lanczos_resampling<gil::gray8_image_t>(0.6);
+    test_lanczos_resampling<gil::rgb8_image_t>(0.6);
+    test_lanczos_resampling<gil::gray16_image_t>(0.5);
+    test_lanczos_resampling<gil::rgb32f_image_t>(1e-3);
+    test_lanczos_layouts();
+    test_lanczos_large_downscale();
     return boost::report_errors();
 }
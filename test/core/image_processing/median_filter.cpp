@@ -5,14 +5,20 @@
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 //
-#include <boost/gil/image_view.hpp>
-#include <boost/gil/algorithm.hpp>
-#include <boost/gil/gray.hpp>
+#include <boost/gil.hpp>
 #include <boost/gil/image_processing/filter.hpp>
 
 #include <boost/core/lightweight_test.hpp>
 
+#include "core/image/test_fixture.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
 namespace gil = boost::gil;
+namespace fixture = boost::gil::test::fixture;
 
 std::uint8_t img[] =
 {
@@ -57,9 +63,130 @@ void test_median_filter_with_kernel_size_3()
     BOOST_TEST(gil::equal_pixels(out_view, dst_view));
 }
 
+// Selects the rank in a copy of each window, extended as the option requires
+template <typename SrcView, typename DstView>
+void reference_rank_filter(
+    SrcView const& src, DstView const& dst, std::ptrdiff_t size, std::size_t rank,
+    gil::boundary_option option)
+{
+    using channel_t = typename gil::channel_type<SrcView>::type;
+    std::ptrdiff_t const radius = size / 2;
+    std::vector<channel_t> window;
+    for (std::ptrdiff_t y = 0; y < src.height(); ++y)
+        for (std::ptrdiff_t x = 0; x < src.width(); ++x)
+            for (std::size_t c = 0; c < gil::num_channels<SrcView>::value; ++c)
+            {
+                window.clear();
+                for (std::ptrdiff_t j = y - radius; j <= y + radius; ++j)
+                    for (std::ptrdiff_t i = x - radius; i <= x + radius; ++i)
+                    {
+                        bool const inside = i >= 0 && i < src.width() && j >= 0 && j < src.height();
+                        if (option == gil::boundary_option::extend_zero && !inside)
+                        {
+                            window.push_back(channel_t(0));
+                        }
+                        else if (option == gil::boundary_option::extend_constant)
+                        {
+                            std::ptrdiff_t const ci = (std::min)((std::max)(i, std::ptrdiff_t(0)),
+                                src.width() - 1);
+                            std::ptrdiff_t const cj = (std::min)((std::max)(j, std::ptrdiff_t(0)),
+                                src.height() - 1);
+                            window.push_back(src(ci, cj)[c]);
+                        }
+                        else
+                        {
+                            window.push_back(src.xy_at(x, y)(i - x, j - y)[c]);
+                        }
+                    }
+                std::nth_element(window.begin(), window.begin() + rank, window.end());
+                dst(x, y)[c] = window[rank];
+            }
+}
+
+template <typename Image>
+void check_rank_filter(std::ptrdiff_t size, std::size_t rank)
+{
+    Image padded(57, 41);
+    fixture::fill_random(gil::view(padded), 0, 22);
+    auto const src = gil::subimage_view(gil::const_view(padded), 8, 8, 41, 25);
+
+    for (auto option : {gil::boundary_option::extend_zero,
+                        gil::boundary_option::extend_constant,
+                        gil::boundary_option::extend_padded})
+    {
+        Image expected(src.dimensions());
+        Image actual(src.dimensions());
+        Image actual_parallel(src.dimensions());
+        reference_rank_filter(src, gil::view(expected), size, rank, option);
+        gil::rank_filter(src, gil::view(actual), size, rank, option);
+        gil::rank_filter(
+            gil::execution::parallel_policy(3), src, gil::view(actual_parallel), size, rank,
+            option);
+        BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(actual)));
+        BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(actual_parallel)));
+    }
+}
+
+void test_rank_filter()
+{
+    // Median networks
+    check_rank_filter<gil::gray8_image_t>(3, 4);
+    check_rank_filter<gil::rgb8_image_t>(5, 12);
+    check_rank_filter<gil::gray32f_image_t>(5, 12);
+    // Sliding histograms
+    check_rank_filter<gil::gray8_image_t>(5, 3);
+    check_rank_filter<gil::gray16_image_t>(7, 3);
+    check_rank_filter<gil::gray16s_image_t>(9, 80);
+    // Constant time histograms
+    check_rank_filter<gil::gray8_image_t>(7, 24);
+    check_rank_filter<gil::gray8_image_t>(11, 60);
+    check_rank_filter<gil::gray8_image_t>(15, 0);
+    check_rank_filter<gil::rgb8_image_t>(17, 288);
+    // Selection
+    check_rank_filter<gil::gray32f_image_t>(3, 8);
+    check_rank_filter<gil::gray32s_image_t>(5, 1);
+}
+
+void test_median_filter_output_options()
+{
+    gil::rgb8_image_t src(20, 15);
+    fixture::fill_random(gil::view(src), 0, 22);
+    gil::rgb8_planar_image_t planar_src(src.dimensions());
+    gil::copy_pixels(gil::const_view(src), gil::view(planar_src));
+
+    gil::rgb8_image_t expected(src.dimensions());
+    gil::median_filter(gil::const_view(src), gil::view(expected), 11);
+    gil::rgb8_planar_image_t planar(src.dimensions());
+    gil::median_filter(gil::const_view(planar_src), gil::view(planar), 11);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(planar)));
+
+    auto const inner = [](gil::rgb8c_view_t const& v)
+    {
+        return gil::subimage_view(v, 5, 5, 10, 5);
+    };
+    gil::rgb8_image_t zeroed(src.dimensions());
+    gil::fill_pixels(gil::view(zeroed), gil::rgb8_pixel_t(1, 1, 1));
+    gil::median_filter(
+        gil::const_view(src), gil::view(zeroed), 11, gil::boundary_option::output_zero);
+    gil::rgb8_image_t ignored(src.dimensions());
+    gil::fill_pixels(gil::view(ignored), gil::rgb8_pixel_t(1, 1, 1));
+    gil::median_filter(
+        gil::const_view(src), gil::view(ignored), 11, gil::boundary_option::output_ignore);
+
+    // The window of the inner pixels lies within the image whatever the option
+    BOOST_TEST(gil::equal_pixels(inner(gil::const_view(expected)), inner(gil::const_view(zeroed))));
+    BOOST_TEST(
+        gil::equal_pixels(inner(gil::const_view(expected)), inner(gil::const_view(ignored))));
+    BOOST_TEST(gil::const_view(zeroed)(4, 7) == gil::rgb8_pixel_t(0, 0, 0));
+    BOOST_TEST(gil::const_view(zeroed)(7, 10) == gil::rgb8_pixel_t(0, 0, 0));
+    BOOST_TEST(gil::const_view(ignored)(15, 7) == gil::rgb8_pixel_t(1, 1, 1));
+}
+
 int main()
 {
     test_median_filter_with_kernel_size_3();
+    test_rank_filter();
+    test_median_filter_output_options();
 
     return ::boost::report_errors();
 }
@@ -7,10 +7,20 @@
 //
 
 #include <boost/core/lightweight_test.hpp>
+#include <boost/gil.hpp>
 #include <boost/gil/image_processing/morphology.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
+#include "core/image/test_fixture.hpp"
+
 namespace gil = boost::gil;
+namespace fixture = boost::gil::test::fixture;
+
+using gray1_image_t = gil::bit_aligned_image1_type<1, gil::gray_layout_t>::type;
 
 // This function helps us fill pixels of a view given as 2nd argument with
 // elements of the vector given as 1st argument.
@@ -27,8 +37,200 @@ void pixel_fill(std::vector<std::vector<int>>& original_binary_vector,
     }
 }
 
+template <typename View>
+void invert(View const& v)
+{
+    for (std::ptrdiff_t y = 0; y < v.height(); ++y)
+        for (auto it = v.row_begin(y); it != v.row_end(y); ++it)
+            for (std::size_t c = 0; c < gil::num_channels<View>::value; ++c)
+                (*it)[c] = gil::channel_invert((*it)[c]);
+}
+
+// Kernel of the given size whose elements in columns [x0, x1] and rows [y0, y1] are set
+auto rectangle_kernel(
+    std::size_t size, std::size_t center_x, std::size_t center_y,
+    std::size_t x0, std::size_t x1, std::size_t y0, std::size_t y1) -> gil::detail::kernel_2d<float>
+{
+    std::vector<float> elements(size * size, 0.0f);
+    for (std::size_t y = y0; y <= y1; ++y)
+        for (std::size_t x = x0; x <= x1; ++x)
+            elements[y * size + x] = 1.0f;
+    return gil::detail::kernel_2d<float>(elements.begin(), elements.size(), center_y, center_x);
+}
+
+// Selects among the pixel and those covered by the flipped kernel inside the view
+template <typename SrcView, typename DstView>
+void reference_dilate(
+    SrcView const& src, DstView const& dst, gil::detail::kernel_2d<float> const& kernel)
+{
+    auto const size = static_cast<std::ptrdiff_t>(kernel.size());
+    auto const center_x = static_cast<std::ptrdiff_t>(kernel.center_x());
+    auto const center_y = static_cast<std::ptrdiff_t>(kernel.center_y());
+    for (std::ptrdiff_t y = 0; y < src.height(); ++y)
+        for (std::ptrdiff_t x = 0; x < src.width(); ++x)
+            for (std::size_t c = 0; c < gil::num_channels<SrcView>::value; ++c)
+            {
+                auto result = src(x, y)[c];
+                for (std::ptrdiff_t j = 0; j < size; ++j)
+                    for (std::ptrdiff_t i = 0; i < size; ++i)
+                    {
+                        std::ptrdiff_t const column = x + center_x - i;
+                        std::ptrdiff_t const row = y + center_y - j;
+                        bool const covered = kernel.begin()[j * size + i] > 0.5f;
+                        if (covered && column >= 0 && column < src.width() && row >= 0 &&
+                            row < src.height())
+                        {
+                            result = (std::max)(result, src(column, row)[c]);
+                        }
+                    }
+                dst(x, y)[c] = result;
+            }
+}
+
+template <typename Image>
+void check_dilation_and_erosion(gil::detail::kernel_2d<float> const& kernel)
+{
+    Image src(37, 29);
+    fixture::fill_random(gil::view(src), 0, 255);
+    Image expected(src.dimensions());
+    Image actual(src.dimensions());
+    reference_dilate(gil::const_view(src), gil::view(expected), kernel);
+    gil::dilate(gil::const_view(src), gil::view(actual), kernel, 1);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(actual)));
+
+    // Erosion is the dilation of the inverted image
+    Image inverted(src.dimensions());
+    gil::copy_pixels(gil::const_view(src), gil::view(inverted));
+    invert(gil::view(inverted));
+    gil::erode(gil::const_view(inverted), gil::view(actual), kernel, 1);
+    invert(gil::view(actual));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(actual)));
+}
+
+void test_structuring_elements()
+{
+    // Rectangles and lines holding the center
+    auto const square = rectangle_kernel(9, 4, 4, 0, 8, 0, 8);
+    auto const corner = rectangle_kernel(7, 0, 0, 0, 4, 0, 6);
+    auto const horizontal = rectangle_kernel(11, 5, 5, 0, 10, 5, 5);
+    auto const vertical = rectangle_kernel(5, 1, 2, 1, 1, 0, 4);
+    // Shapes which are not rectangles holding the center
+    auto const apart = rectangle_kernel(5, 0, 0, 2, 4, 2, 3);
+    auto cross = rectangle_kernel(5, 2, 2, 0, 4, 2, 2);
+    for (std::size_t y = 0; y < 5; ++y)
+        cross.begin()[y * 5 + 2] = 1.0f;
+
+    for (auto const& kernel : {square, corner, horizontal, vertical, apart, cross})
+    {
+        check_dilation_and_erosion<gil::gray8_image_t>(kernel);
+        check_dilation_and_erosion<gil::rgb8_image_t>(kernel);
+        check_dilation_and_erosion<gil::rgb16_planar_image_t>(kernel);
+        check_dilation_and_erosion<gil::gray32f_image_t>(kernel);
+    }
+}
+
+void test_line_direction()
+{
+    // Kernel rows are rows of the image
+    gil::gray8_image_t src(9, 9);
+    gil::fill_pixels(gil::view(src), gil::gray8_pixel_t(0));
+    gil::view(src)(4, 4) = gil::gray8_pixel_t(200);
+    gil::gray8_image_t dst(9, 9);
+    gil::dilate(gil::const_view(src), gil::view(dst), rectangle_kernel(3, 1, 1, 0, 2, 1, 1), 1);
+    BOOST_TEST(gil::const_view(dst)(3, 4) == gil::gray8_pixel_t(200));
+    BOOST_TEST(gil::const_view(dst)(5, 4) == gil::gray8_pixel_t(200));
+    BOOST_TEST(gil::const_view(dst)(4, 3) == gil::gray8_pixel_t(0));
+    BOOST_TEST(gil::const_view(dst)(4, 5) == gil::gray8_pixel_t(0));
+}
+
+// Mask of 0 and 255 with about a third of the pixels set
+void fill_random_mask(gil::gray8_view_t const& v)
+{
+    fixture::random_value<int> random(3, 0, 2);
+    std::generate(v.begin(), v.end(), [&random]() {
+        return gil::gray8_pixel_t(random() == 0 ? 255 : 0);
+    });
+}
+
+enum class operation { dilation, erosion, opening, closing };
+
+template <typename SrcView, typename DstView>
+void apply(
+    operation op, SrcView const& src, DstView const& dst,
+    gil::detail::kernel_2d<float> const& kernel)
+{
+    switch (op)
+    {
+    case operation::dilation: gil::dilate(src, dst, kernel, 1); break;
+    case operation::erosion: gil::erode(src, dst, kernel, 2); break;
+    case operation::opening: gil::opening(src, dst, kernel); break;
+    case operation::closing: gil::closing(src, dst, kernel); break;
+    }
+}
+
+void test_binary_masks()
+{
+    auto const square = rectangle_kernel(9, 4, 4, 0, 8, 0, 8);
+    auto const corner = rectangle_kernel(7, 0, 0, 0, 4, 0, 6);
+    auto const wide = rectangle_kernel(71, 35, 35, 0, 70, 35, 35);
+    auto const vertical = rectangle_kernel(5, 1, 2, 1, 1, 0, 4);
+    auto const apart = rectangle_kernel(5, 0, 0, 2, 4, 2, 3);
+    auto cross = rectangle_kernel(5, 2, 2, 0, 4, 2, 2);
+    for (std::size_t y = 0; y < 5; ++y)
+        cross.begin()[y * 5 + 2] = 1.0f;
+
+    // Masks spanning several words, starting at a bit offset within a byte
+    gil::gray8_image_t full(160, 40);
+    fill_random_mask(gil::view(full));
+    auto const src = gil::subimage_view(gil::view(full), 3, 2, 150, 37);
+    gray1_image_t packed(full.dimensions());
+    gil::pack_binary_mask(gil::const_view(full), gil::view(packed));
+    gil::gray8_image_t unpacked(full.dimensions());
+    gil::unpack_binary_mask(gil::const_view(packed), gil::view(unpacked));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(full), gil::const_view(unpacked)));
+
+    for (auto const& kernel : {square, corner, wide, vertical, apart, cross})
+    {
+        for (auto op : {operation::dilation, operation::erosion, operation::opening,
+                        operation::closing})
+        {
+            gil::gray8_image_t expected(full);
+            apply(op, src, gil::subimage_view(gil::view(expected), 3, 2, 150, 37), kernel);
+
+            gray1_image_t mask(packed);
+            auto const mask_src = gil::subimage_view(gil::view(mask), 3, 2, 150, 37);
+            apply(op, mask_src, mask_src, kernel);
+            gil::unpack_binary_mask(gil::const_view(mask), gil::view(unpacked));
+            BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(unpacked)));
+        }
+    }
+}
+
+void test_mask_conversions()
+{
+    // Views of other channel types are converted pixel by pixel
+    gil::gray16_image_t src(70, 3);
+    gil::fill_pixels(gil::view(src), gil::gray16_pixel_t(0));
+    gil::view(src)(5, 0) = gil::gray16_pixel_t(1);
+    gil::view(src)(69, 2) = gil::gray16_pixel_t(40000);
+    gray1_image_t mask(src.dimensions());
+    gil::pack_binary_mask(gil::const_view(src), gil::view(mask));
+
+    gil::gray16_image_t dst(src.dimensions());
+    gil::unpack_binary_mask(gil::const_view(mask), gil::view(dst));
+    BOOST_TEST(gil::const_view(dst)(5, 0) == gil::gray16_pixel_t(65535));
+    BOOST_TEST(gil::const_view(dst)(69, 2) == gil::gray16_pixel_t(65535));
+    BOOST_TEST(gil::const_view(dst)(6, 0) == gil::gray16_pixel_t(0));
+    BOOST_TEST(gil::const_view(dst)(5, 1) == gil::gray16_pixel_t(0));
+}
+
 int main()
 {
+    test_structuring_elements();
+    test_binary_masks();
+    test_mask_conversions();
+    test_line_direction();
+
     std::vector<std::vector<int>> original_binary_vector{
         {0, 0, 0, 0, 0, 0},         {0, 0, 127, 144, 143, 0}, {0, 0, 128, 0, 142, 0},
         {0, 0, 129, 0, 141, 0},     {0, 0, 130, 140, 139, 0}, {0, 0, 131, 0, 0, 0},
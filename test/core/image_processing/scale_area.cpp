@@ -0,0 +1,135 @@
+//
+// Copyright 2026 Boost.GIL Contributors
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#include <boost/gil.hpp>
+#include <boost/gil/image_processing/scaling.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "core/image/test_fixture.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace gil = boost::gil;
+namespace fixture = boost::gil::test::fixture;
+
+// Mean of the source pixels under each output pixel, weighted by their overlap with it
+template <typename SrcView>
+auto area_average(SrcView const& src, std::ptrdiff_t dw, std::ptrdiff_t dh, std::ptrdiff_t x,
+    std::ptrdiff_t y, std::size_t c) -> double
+{
+    double const sx = static_cast<double>(src.width()) / static_cast<double>(dw);
+    double const sy = static_cast<double>(src.height()) / static_cast<double>(dh);
+    double sum = 0.0;
+    double const dx = static_cast<double>(x);
+    double const dy = static_cast<double>(y);
+    for (std::ptrdiff_t j = 0; j < src.height(); ++j)
+    {
+        double const top = static_cast<double>(j);
+        double const oy = (std::min)((dy + 1) * sy, top + 1.0) - (std::max)(dy * sy, top);
+        if (oy <= 0.0)
+            continue;
+        for (std::ptrdiff_t i = 0; i < src.width(); ++i)
+        {
+            double const left = static_cast<double>(i);
+            double const ox = (std::min)((dx + 1) * sx, left + 1.0) - (std::max)(dx * sx, left);
+            if (ox > 0.0)
+                sum += ox * oy * static_cast<double>(src(i, j)[c]);
+        }
+    }
+    return sum / (sx * sy);
+}
+
+template <typename Image>
+void test_scale_area(std::ptrdiff_t sw, std::ptrdiff_t sh, std::ptrdiff_t dw, std::ptrdiff_t dh,
+    double tolerance)
+{
+    using channel_t = typename gil::channel_type<Image>::type;
+    using base_t = typename gil::base_channel_type<channel_t>::type;
+    Image src(sw, sh);
+    fixture::fill_random_channels(gil::view(src));
+
+    Image dst(dw, dh);
+    gil::scale_area(gil::const_view(src), gil::view(dst));
+    auto const s = gil::const_view(src);
+    auto const d = gil::const_view(dst);
+    double difference = 0.0;
+    for (std::ptrdiff_t y = 0; y < dh; ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < dw; ++x)
+        {
+            for (std::size_t c = 0; c < gil::num_channels<Image>::value; ++c)
+            {
+                double expected = area_average(s, dw, dh, x, y, c);
+                if (std::is_integral<base_t>::value)
+                    expected = std::floor(expected + 0.5);
+                difference = (std::max)(
+                    difference, std::abs(static_cast<double>(d(x, y)[c]) - expected));
+            }
+        }
+    }
+    BOOST_TEST_LE(difference, tolerance);
+
+    Image parallel(dw, dh);
+    gil::scale_area(gil::execution::parallel_policy(3), s, gil::view(parallel));
+    BOOST_TEST(gil::equal_pixels(d, gil::const_view(parallel)));
+}
+
+// Halving averages blocks of 2x2 pixels exactly, through the vectorized rows and their tails
+template <typename Image>
+void test_halving(double tolerance)
+{
+    test_scale_area<Image>(134, 30, 67, 15, tolerance);
+    test_scale_area<Image>(10, 4, 5, 2, tolerance);
+    test_scale_area<Image>(2, 2, 1, 1, tolerance);
+}
+
+template <typename Image>
+void test_ratios(double tolerance)
+{
+    test_scale_area<Image>(37, 29, 12, 10, tolerance);
+    test_scale_area<Image>(101, 20, 33, 20, tolerance);
+    test_scale_area<Image>(64, 48, 16, 16, tolerance);
+    test_scale_area<Image>(10, 7, 23, 16, tolerance);
+}
+
+void test_constant()
+{
+    gil::rgb8_image_t src(45, 31, gil::rgb8_pixel_t(7, 128, 255), 0);
+    gil::rgb8_image_t dst(13, 9);
+    gil::scale_area(gil::const_view(src), gil::view(dst));
+    gil::rgb8_image_t expected(13, 9, gil::rgb8_pixel_t(7, 128, 255), 0);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(dst), gil::const_view(expected)));
+}
+
+int main()
+{
+    test_halving<gil::gray8_image_t>(0.0);
+    test_halving<gil::rgb8_image_t>(0.0);
+    test_halving<gil::rgba8_image_t>(0.0);
+    test_halving<gil::rgb8_planar_image_t>(0.0);
+    test_halving<gil::gray16_image_t>(0.0);
+    test_halving<gil::rgb16_image_t>(0.0);
+    test_halving<gil::rgba16_image_t>(0.0);
+    test_halving<gil::gray8s_image_t>(0.0);
+    test_halving<gil::rgb32f_image_t>(1e-6);
+
+    test_ratios<gil::gray8_image_t>(1.0);
+    test_ratios<gil::rgb8_image_t>(1.0);
+    test_ratios<gil::rgba8_planar_image_t>(1.0);
+    test_ratios<gil::gray16_image_t>(1.0);
+    test_ratios<gil::rgb16_image_t>(1.0);
+    test_ratios<gil::rgba16_image_t>(1.0);
+    test_ratios<gil::rgb32f_image_t>(1e-5);
+    test_constant();
+
+    return ::boost::report_errors();
+}
@@ -0,0 +1,168 @@
+//
+// Copyright 2026 Boost.GIL Contributors
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#include <boost/gil.hpp>
+#include <boost/gil/image_processing/summed_area_table.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "core/image/test_fixture.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace gil = boost::gil;
+namespace fixture = boost::gil::test::fixture;
+
+// Channel of the pixel at (x, y) of the view extended according to the option
+template <typename View>
+auto extended_value(
+    View const& v, std::ptrdiff_t x, std::ptrdiff_t y, std::size_t c, gil::boundary_option option)
+    -> double
+{
+    bool const outside = x < 0 || x >= v.width() || y < 0 || y >= v.height();
+    if (outside && option == gil::boundary_option::extend_zero)
+        return 0.0;
+    if (option == gil::boundary_option::extend_constant)
+    {
+        x = (std::min)((std::max)(x, std::ptrdiff_t(0)), v.width() - 1);
+        y = (std::min)((std::max)(y, std::ptrdiff_t(0)), v.height() - 1);
+    }
+    return static_cast<double>(v(x, y)[c]);
+}
+
+template <typename T, typename View>
+void check_rectangles(
+    gil::summed_area_table<T> const& table, View const& v, gil::boundary_option option)
+{
+    std::ptrdiff_t const b = table.border();
+    bool ok = true;
+    for (std::ptrdiff_t y = -b; y <= v.height() + b; y += 3)
+        for (std::ptrdiff_t x = -b; x <= v.width() + b; x += 2)
+            for (std::ptrdiff_t h : {0, 1, 4})
+                for (std::ptrdiff_t w : {0, 1, 5})
+                {
+                    if (x + w > v.width() + b || y + h > v.height() + b)
+                        continue;
+                    for (std::size_t c = 0; c < gil::num_channels<View>::value; ++c)
+                    {
+                        double expected = 0;
+                        for (std::ptrdiff_t j = y; j < y + h; ++j)
+                            for (std::ptrdiff_t i = x; i < x + w; ++i)
+                                expected += extended_value(v, i, j, c, option);
+                        double const actual = static_cast<double>(table.sum(x, y, w, h, c));
+                        ok = ok && std::abs(expected - actual) < 1e-6;
+                    }
+                }
+    BOOST_TEST(ok);
+}
+
+void test_sums()
+{
+    gil::rgb8_image_t img(23, 17);
+    fixture::fill_random(gil::view(img), 0, 255);
+    auto const v = gil::const_view(img);
+
+    gil::summed_area_table<std::int64_t> const table(v);
+    BOOST_TEST_EQ(table.width(), 23);
+    BOOST_TEST_EQ(table.height(), 17);
+    BOOST_TEST_EQ(table.num_channels(), 3u);
+    BOOST_TEST(!table.has_squares());
+    check_rectangles(table, v, gil::boundary_option::extend_zero);
+
+    for (auto option : {gil::boundary_option::extend_zero, gil::boundary_option::extend_constant})
+    {
+        gil::summed_area_table<std::int64_t> const bordered(v, 4, option);
+        check_rectangles(bordered, v, option);
+    }
+
+    // Channels are indexed in the layout of the view
+    gil::bgr8_image_t bgr(img.dimensions());
+    gil::copy_pixels(v, gil::view(bgr));
+    gil::summed_area_table<std::int64_t> const bgr_table(gil::const_view(bgr));
+    BOOST_TEST_EQ(bgr_table.sum(2, 3, 10, 7, 0), table.sum(2, 3, 10, 7, 2));
+}
+
+void test_padded_border()
+{
+    gil::gray32f_image_t img(40, 30);
+    fixture::fill_random(gil::view(img), 0, 255);
+    auto const inner = gil::subimage_view(gil::const_view(img), 5, 5, 30, 20);
+
+    gil::summed_area_table<double> const table(inner, 5, gil::boundary_option::extend_padded);
+    gil::summed_area_table<double> const full(gil::const_view(img));
+    bool ok = true;
+    for (std::ptrdiff_t y = -5; y < 23; y += 4)
+        for (std::ptrdiff_t x = -5; x < 31; x += 3)
+            ok = ok && std::abs(table.sum(x, y, 5, 3) - full.sum(x + 5, y + 5, 5, 3)) < 1e-6;
+    BOOST_TEST(ok);
+}
+
+void test_mean_and_variance()
+{
+    gil::gray16_image_t img(50, 40);
+    fixture::fill_random(gil::view(img), 0, 255);
+    auto const v = gil::const_view(img);
+    gil::summed_area_table<std::int64_t> const table(v, true);
+    BOOST_TEST(table.has_squares());
+
+    double sum = 0;
+    double square_sum = 0;
+    for (std::ptrdiff_t y = 7; y < 22; ++y)
+        for (std::ptrdiff_t x = 3; x < 34; ++x)
+        {
+            double const value = static_cast<double>(v(x, y)[0]);
+            sum += value;
+            square_sum += value * value;
+        }
+    double const mean = sum / (31 * 15);
+    double const variance = square_sum / (31 * 15) - mean * mean;
+    BOOST_TEST_LT(std::abs(table.mean(3, 7, 31, 15) - mean), 1e-9);
+    BOOST_TEST_LT(std::abs(table.variance(3, 7, 31, 15) - variance), 1e-6 * variance);
+    BOOST_TEST_EQ(table.variance(5, 5, 1, 1), 0.0);
+}
+
+void test_parallel_build()
+{
+    gil::rgb16_image_t img(613, 97);
+    fixture::fill_random(gil::view(img), 0, 255);
+    auto const v = gil::const_view(img);
+    auto const option = gil::boundary_option::extend_constant;
+
+    gil::summed_area_table<std::int64_t> const serial(v, 3, option, true);
+    gil::summed_area_table<std::int64_t> const parallel(
+        gil::execution::parallel_policy(4), v, 3, option, true);
+    gil::summed_area_table<double> const parallel_double(
+        gil::execution::parallel_policy(4), v, 3, option, true);
+    bool ok = true;
+    for (std::ptrdiff_t y = -3; y <= 100; y += 7)
+        for (std::ptrdiff_t x = -3; x <= 616; x += 5)
+            for (std::size_t c = 0; c < 3; ++c)
+            {
+                std::int64_t const sum = serial.sum(-3, -3, x + 3, y + 3, c);
+                std::int64_t const square_sum = serial.square_sum(-3, -3, x + 3, y + 3, c);
+                ok = ok && sum == parallel.sum(-3, -3, x + 3, y + 3, c);
+                ok = ok && square_sum == parallel.square_sum(-3, -3, x + 3, y + 3, c);
+                double const square_sum_double =
+                    parallel_double.square_sum(-3, -3, x + 3, y + 3, c);
+                ok = ok && std::abs(static_cast<double>(square_sum) - square_sum_double) <=
+                    1e-12 * static_cast<double>(square_sum);
+            }
+    BOOST_TEST(ok);
+}
+
+int main()
+{
+    test_sums();
+    test_padded_border();
+    test_mean_and_variance();
+    test_parallel_build();
+
+    return ::boost::report_errors();
+}
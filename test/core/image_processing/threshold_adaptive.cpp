@@ -0,0 +1,141 @@
+//
+// Copyright 2026 Boost.GIL Contributors
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#include <boost/gil.hpp>
+#include <boost/gil/image_processing/threshold.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "core/image/test_fixture.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+
+namespace gil = boost::gil;
+namespace fixture = boost::gil::test::fixture;
+
+// Pixels are compared with the mean of the window around them, truncated to the channel type
+void test_mean_large_kernel()
+{
+    gil::gray8_image_t src(64, 48);
+    fixture::fill_random(gil::view(src), 0, 255);
+    auto const v = gil::const_view(src);
+
+    std::ptrdiff_t const radius = 50;
+    gil::gray8_image_t expected(src.dimensions());
+    for (std::ptrdiff_t y = 0; y < v.height(); ++y)
+        for (std::ptrdiff_t x = 0; x < v.width(); ++x)
+        {
+            long sum = 0;
+            for (std::ptrdiff_t j = y - radius; j <= y + radius; ++j)
+                for (std::ptrdiff_t i = x - radius; i <= x + radius; ++i)
+                {
+                    if (i >= 0 && i < v.width() && j >= 0 && j < v.height())
+                        sum += v(i, j)[0];
+                }
+            long const mean = sum / ((2 * radius + 1) * (2 * radius + 1));
+            gil::view(expected)(x, y)[0] = v(x, y)[0] > mean - 3 ? 200 : 0;
+        }
+
+    gil::gray8_image_t actual(src.dimensions());
+    gil::threshold_adaptive(
+        v, gil::view(actual), 200, 2 * radius + 1, gil::threshold_adaptive_method::mean,
+        gil::threshold_direction::regular, 3);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(actual)));
+}
+
+// Each channel is compared with its own mean, whose threshold may fall below zero or above
+// the largest value
+void test_mean_channels()
+{
+    gil::rgb8_image_t src(41, 29);
+    fixture::fill_random(gil::view(src), 0, 255);
+    auto const v = gil::const_view(src);
+
+    std::ptrdiff_t const radius = 3;
+    for (std::uint8_t constant : std::initializer_list<std::uint8_t>{0, 20, 250})
+    {
+        gil::rgb8_image_t expected(src.dimensions());
+        for (std::ptrdiff_t y = 0; y < v.height(); ++y)
+            for (std::ptrdiff_t x = 0; x < v.width(); ++x)
+                for (int c = 0; c < 3; ++c)
+                {
+                    long sum = 0;
+                    for (std::ptrdiff_t j = y - radius; j <= y + radius; ++j)
+                        for (std::ptrdiff_t i = x - radius; i <= x + radius; ++i)
+                        {
+                            if (i >= 0 && i < v.width() && j >= 0 && j < v.height())
+                                sum += v(i, j)[c];
+                        }
+                    long const mean = sum / ((2 * radius + 1) * (2 * radius + 1));
+                    gil::view(expected)(x, y)[c] = v(x, y)[c] > mean - constant ? 0 : 255;
+                }
+
+        gil::rgb8_image_t actual(src.dimensions());
+        gil::threshold_adaptive(
+            v, gil::view(actual), 255, 2 * radius + 1, gil::threshold_adaptive_method::mean,
+            gil::threshold_direction::inverse, constant);
+        BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(actual)));
+    }
+}
+
+// Interleaved 8-bit views are compared as arrays of bytes, and give the same result as planar
+// views for both methods
+void test_interleaved_and_planar_views()
+{
+    gil::rgb8_image_t src(53, 21);
+    fixture::fill_random(gil::view(src), 0, 255);
+    gil::rgb8_planar_image_t planar_src(src.dimensions());
+    gil::copy_pixels(gil::const_view(src), gil::view(planar_src));
+
+    for (auto method : {gil::threshold_adaptive_method::mean,
+                        gil::threshold_adaptive_method::gaussian})
+    {
+        for (auto direction : {gil::threshold_direction::regular,
+                               gil::threshold_direction::inverse})
+        {
+            gil::rgb8_image_t interleaved(src.dimensions());
+            gil::rgb8_planar_image_t planar(src.dimensions());
+            gil::threshold_adaptive(
+                gil::const_view(src), gil::view(interleaved), 180, 5, method, direction, 7);
+            gil::threshold_adaptive(
+                gil::const_view(planar_src), gil::view(planar), 180, 5, method, direction, 7);
+            BOOST_TEST(gil::equal_pixels(gil::const_view(interleaved), gil::const_view(planar)));
+        }
+    }
+}
+
+// Means of wider channels are computed from 64-bit sums
+void test_mean_gray16()
+{
+    gil::gray16_image_t src(30, 20);
+    fixture::fill_random(gil::view(src), 0, 255);
+    gil::gray16_image_t mean(src.dimensions());
+    gil::box_filter(gil::const_view(src), gil::view(mean), 9);
+
+    gil::gray16_image_t expected(src.dimensions());
+    gil::transform_pixels(gil::const_view(src), gil::const_view(mean), gil::view(expected),
+        [](gil::gray16_pixel_t const& px, gil::gray16_pixel_t const& threshold)
+        {
+            return gil::gray16_pixel_t(px[0] > threshold[0] ? 1000 : 0);
+        });
+
+    gil::gray16_image_t actual(src.dimensions());
+    gil::threshold_adaptive(gil::const_view(src), gil::view(actual), 1000, 9);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(expected), gil::const_view(actual)));
+}
+
+int main()
+{
+    test_mean_large_kernel();
+    test_mean_channels();
+    test_interleaved_and_planar_views();
+    test_mean_gray16();
+
+    return ::boost::report_errors();
+}
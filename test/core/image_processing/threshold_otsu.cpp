@@ -9,10 +9,16 @@
 #include <boost/gil/gray.hpp>
 #include <boost/gil/image_view.hpp>
 #include <boost/gil/image_processing/threshold.hpp>
+#include <boost/gil/execution.hpp>
 
 #include <boost/core/lightweight_test.hpp>
 
+#include "core/image/test_fixture.hpp"
+
+#include <cstdint>
+
 namespace gil = boost::gil;
+namespace fixture = boost::gil::test::fixture;
 
 int height = 2;
 int width = 2;
@@ -104,6 +110,62 @@ void test_rgb_inverse()
     BOOST_TEST(gil::equal_pixels(gil::view(otsu_rgb), gil::view(expected_rgb)));
 }
 
+void test_parallel_histogram()
+{
+    gil::rgb8_image_t src(301, 203);
+    for (int c = 0; c < 3; ++c)
+        fixture::fill_random(gil::nth_channel_view(gil::view(src), c), 0, 255 / (c + 1),
+            std::uint32_t(9 + c));
+
+    gil::rgb8_image_t serial(src.dimensions());
+    gil::rgb8_image_t parallel(src.dimensions());
+    gil::threshold_optimal(gil::const_view(src), gil::view(serial));
+    gil::threshold_optimal(
+        gil::execution::parallel_policy(3), gil::const_view(src), gil::view(parallel));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(serial), gil::const_view(parallel)));
+}
+
+// Wider channels are binned between their smallest and largest values, and the threshold is
+// mapped back to their range
+void test_gray16()
+{
+    gil::gray16_image_t src(10, 6);
+    gil::fill_pixels(gil::view(src), gil::gray16_pixel_t(1000));
+    gil::fill_pixels(gil::subimage_view(gil::view(src), 0, 0, 10, 2), gil::gray16_pixel_t(40000));
+    gil::view(src)(3, 4) = gil::gray16_pixel_t(1200);
+
+    gil::gray16_image_t dst(src.dimensions());
+    gil::threshold_optimal(gil::const_view(src), gil::view(dst));
+    gil::gray16_image_t expected(src.dimensions());
+    gil::fill_pixels(gil::view(expected), gil::gray16_pixel_t(0));
+    gil::fill_pixels(
+        gil::subimage_view(gil::view(expected), 0, 0, 10, 2), gil::gray16_pixel_t(65535));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(dst), gil::const_view(expected)));
+
+    // A constant image is entirely background
+    gil::fill_pixels(gil::view(src), gil::gray16_pixel_t(500));
+    gil::threshold_optimal(gil::const_view(src), gil::view(dst));
+    gil::fill_pixels(gil::view(expected), gil::gray16_pixel_t(0));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(dst), gil::const_view(expected)));
+}
+
+// Floating-point channels are mapped back to a range that may be smaller than one
+void test_gray32f()
+{
+    gil::gray32f_image_t src(10, 6);
+    gil::fill_pixels(gil::view(src), gil::gray32f_pixel_t(0.2f));
+    gil::fill_pixels(gil::subimage_view(gil::view(src), 0, 0, 10, 2), gil::gray32f_pixel_t(0.7f));
+    gil::view(src)(3, 4) = gil::gray32f_pixel_t(0.25f);
+
+    gil::gray32f_image_t dst(src.dimensions());
+    gil::threshold_optimal(gil::const_view(src), gil::view(dst));
+    gil::gray32f_image_t expected(src.dimensions());
+    gil::fill_pixels(gil::view(expected), gil::gray32f_pixel_t(0.0f));
+    gil::fill_pixels(
+        gil::subimage_view(gil::view(expected), 0, 0, 10, 2), gil::gray32f_pixel_t(1.0f));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(dst), gil::const_view(expected)));
+}
+
 int main()
 {
     fill_gray();
@@ -113,6 +175,9 @@ int main()
     test_gray_inverse();
     test_rgb_regular();
     test_rgb_inverse();
+    test_parallel_histogram();
+    test_gray16();
+    test_gray32f();
 
     return boost::report_errors();
 }
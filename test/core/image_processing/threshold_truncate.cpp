@@ -5,6 +5,7 @@
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 //
+#include <boost/gil.hpp>
 #include <boost/gil/algorithm.hpp>
 #include <boost/gil/gray.hpp>
 #include <boost/gil/image_view.hpp>
@@ -12,7 +13,12 @@
 
 #include <boost/core/lightweight_test.hpp>
 
+#include "core/image/test_fixture.hpp"
+
+#include <cstdint>
+
 namespace gil = boost::gil;
+namespace fixture = boost::gil::test::fixture;
 
 int height = 4;
 int width = 4;
@@ -213,6 +219,35 @@ void zero_inverse_rgb_to_rgb()
     BOOST_TEST(gil::equal_pixels(gil::view(threshold_rgb), gil::view(expected_rgb)));
 }
 
+// Interleaved 8-bit rows are thresholded as arrays of bytes, which must match the per channel
+// thresholds of planar views, including the bytes past the last full vector of a row
+void wide_rows_match_planar()
+{
+    gil::rgb8_image_t src(37, 5);
+    fixture::fill_random(gil::view(src), 0, 255);
+    gil::rgb8_planar_image_t planar_src(src.dimensions());
+    gil::copy_pixels(gil::const_view(src), gil::view(planar_src));
+
+    gil::rgb8_image_t interleaved(src.dimensions());
+    gil::rgb8_planar_image_t planar(src.dimensions());
+    for (auto direction : {gil::threshold_direction::regular, gil::threshold_direction::inverse})
+    {
+        for (auto mode : {gil::threshold_truncate_mode::threshold,
+                          gil::threshold_truncate_mode::zero})
+        {
+            gil::threshold_truncate(gil::const_view(src), gil::view(interleaved), 100, mode,
+                direction);
+            gil::threshold_truncate(gil::const_view(planar_src), gil::view(planar), 100, mode,
+                direction);
+            BOOST_TEST(gil::equal_pixels(gil::const_view(interleaved), gil::const_view(planar)));
+        }
+
+        gil::threshold_binary(gil::const_view(src), gil::view(interleaved), 200, 30, direction);
+        gil::threshold_binary(
+            gil::const_view(planar_src), gil::view(planar), 200, 30, direction);
+        BOOST_TEST(gil::equal_pixels(gil::const_view(interleaved), gil::const_view(planar)));
+    }
+}
 
 int main()
 {
@@ -229,5 +264,7 @@ int main()
     zero_rgb_to_rgb();
     zero_inverse_rgb_to_rgb();
 
+    wide_rows_match_planar();
+
     return boost::report_errors();
 }
@@ -71,7 +71,7 @@ struct random_value
 
     T operator()()
     {
-        return uid_(rng_);
+        return static_cast<T>(uid_(rng_));
     }
 
     T range_min() const noexcept
@@ -6,6 +6,7 @@
 // http://www.boost.org/LICENSE_1_0.txt
 //
 
+#include <boost/gil/execution.hpp>
 #include <boost/gil/extension/histogram/std.hpp>
 #include <boost/gil/image_view.hpp>
 #include <boost/gil/image.hpp>
@@ -162,11 +163,37 @@ void check_cumulative_histogram_map()
     BOOST_TEST(check);
 }
 
+void check_fill_histogram_parallel()
+{
+    gil::gray8_image_t img(5, 7);
+    auto v = gil::view(img);
+    for (std::ptrdiff_t y = 0; y < v.height(); ++y)
+        for (std::ptrdiff_t x = 0; x < v.width(); ++x)
+            v(x, y) = gil::gray8_pixel_t(static_cast<std::uint8_t>(x * y));
+
+    gil::execution::parallel_policy const policy(3);
+    std::vector<int> c1, c2;
+    gil::fill_histogram(v, c1);
+    gil::fill_histogram(policy, v, c2);
+    BOOST_TEST(c1 == c2);
+
+    std::vector<float> f1(256, 0.25f), f2(256, 0.25f);
+    gil::fill_histogram(v, f1, true);
+    gil::fill_histogram(policy, v, f2, true);
+    BOOST_TEST(f1 == f2);
+
+    std::array<int, 16> a1, a2;
+    gil::fill_histogram(v, a1);
+    gil::fill_histogram(policy, v, a2);
+    BOOST_TEST(a1 == a2);
+}
+
 int main()
 {
     check_fill_histogram_vector();
     check_fill_histogram_array();
     check_fill_histogram_map();
+    check_fill_histogram_parallel();
 
     check_cumulative_histogram_vector();
     check_cumulative_histogram_array();
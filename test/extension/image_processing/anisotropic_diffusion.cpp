@@ -8,14 +8,17 @@
 #include <core/test_fixture.hpp>
 #include <boost/gil/algorithm.hpp>
 #include <boost/gil/color_base_algorithm.hpp>
+#include <boost/gil/execution.hpp>
 #include <boost/gil/image.hpp>
 #include <boost/gil/extension/image_processing/diffusion.hpp>
 #include <boost/gil/image_view.hpp>
 #include <boost/gil/pixel.hpp>
+#include <boost/gil/planar_pixel_reference.hpp>
 #include <boost/gil/typedefs.hpp>
 
 #include <boost/core/lightweight_test.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <random>
@@ -267,6 +270,101 @@ void laplace_functions_test()
                          [](gil::float32_t value) { BOOST_TEST(value == 4.4375); });
 }
 
+// Forwards to a conductivity, which anisotropic_diffusion then applies to stencils of pixels
+template <typename Conductivity>
+struct stencil_conductivity
+{
+    Conductivity conductivity;
+    template <typename Pixel>
+    Pixel operator()(Pixel input)
+    {
+        return conductivity(input);
+    }
+};
+
+void exp_approximation_test()
+{
+    double max_error = 0.0;
+    for (float x = 0.0f; x < 90.0f; x += 0.001f)
+    {
+        double const expected = std::exp(-static_cast<double>(x));
+        double const error = std::abs(gil::detail::diffusion_exp_neg(x) - expected) / expected;
+        max_error = (std::max)(max_error, x < 87.0f ? error : 0.0);
+    }
+    BOOST_TEST_LT(max_error, 5e-7);
+    BOOST_TEST_GE(gil::detail::diffusion_exp_neg(1e30f), 0.0f);
+    BOOST_TEST_LT(gil::detail::diffusion_exp_neg(std::numeric_limits<float>::infinity()), 1e-37f);
+}
+
+// Rows of floats are diffused as the stencils of pixels, and alike in bands of rows
+template <typename ImageType, typename OutputImageType, typename LaplaceStrategy,
+          typename Conductivity>
+void float_rows_test(LaplaceStrategy laplace, Conductivity conductivity)
+{
+    static_assert(gil::detail::is_diffusion_float_rows<
+                      typename OutputImageType::view_t, LaplaceStrategy,
+                      gil::brightness_function::identity, Conductivity>::value,
+                  "diffused in rows of floats");
+
+    gil::test::fixture::random_value<std::uint32_t> dist(
+        31, 0, std::numeric_limits<gil::uint8_t>::max());
+    ImageType image(37, 29);
+    for (auto& pixel : gil::view(image))
+    {
+        for (std::size_t channel_index = 0; channel_index < gil::num_channels<ImageType>::value;
+             ++channel_index)
+        {
+            pixel[channel_index] = static_cast<gil::uint8_t>(dist());
+        }
+    }
+    auto const input = gil::const_view(image);
+
+    OutputImageType expected(input.dimensions());
+    gil::anisotropic_diffusion(input, gil::view(expected), 20, laplace,
+                               gil::brightness_function::identity{},
+                               stencil_conductivity<Conductivity>{conductivity});
+    OutputImageType output(input.dimensions());
+    gil::anisotropic_diffusion(input, gil::view(output), 20, laplace,
+                               gil::brightness_function::identity{}, conductivity);
+    double max_error = 0.0;
+    auto const e = gil::const_view(expected);
+    auto const o = gil::const_view(output);
+    for (std::ptrdiff_t y = 0; y < o.height(); ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < o.width(); ++x)
+        {
+            for (std::size_t c = 0; c < gil::num_channels<OutputImageType>::value; ++c)
+                max_error = (std::max)(max_error, std::abs(double(o(x, y)[c]) - e(x, y)[c]));
+        }
+    }
+    BOOST_TEST_LT(max_error, 1e-3);
+
+    OutputImageType parallel(input.dimensions());
+    gil::anisotropic_diffusion(gil::execution::parallel_policy(3), input, gil::view(parallel),
+                               20, laplace, gil::brightness_function::identity{}, conductivity);
+    BOOST_TEST(gil::equal_pixels(o, gil::const_view(parallel)));
+
+    OutputImageType parallel_stencils(input.dimensions());
+    gil::anisotropic_diffusion(gil::execution::parallel_policy(3), input,
+                               gil::view(parallel_stencils), 20, laplace,
+                               gil::brightness_function::identity{},
+                               stencil_conductivity<Conductivity>{conductivity});
+    BOOST_TEST(gil::equal_pixels(e, gil::const_view(parallel_stencils)));
+}
+
+template <typename LaplaceStrategy>
+void float_rows_tests(LaplaceStrategy laplace)
+{
+    float_rows_test<gil::gray8_image_t, gil::gray32f_image_t>(
+        laplace, gil::conductivity::perona_malik_conductivity{15});
+    float_rows_test<gil::rgb8_image_t, gil::rgb32f_image_t>(
+        laplace, gil::conductivity::gaussian_conductivity{30});
+    float_rows_test<gil::rgb8_image_t, gil::rgb32f_planar_image_t>(
+        laplace, gil::conductivity::wide_regions_conductivity{20});
+    float_rows_test<gil::gray8_image_t, gil::gray32f_image_t>(
+        laplace, gil::conductivity::more_wide_regions_conductivity{10});
+}
+
 int main()
 {
     for (std::uint32_t seed = 0; seed < 100; ++seed)
@@ -300,5 +398,9 @@ int main()
 
     laplace_functions_test();
 
+    exp_approximation_test();
+    float_rows_tests(gil::laplace_function::stencil_5points{});
+    float_rows_tests(gil::laplace_function::stencil_9points_standard{});
+
     return boost::report_errors();
 }
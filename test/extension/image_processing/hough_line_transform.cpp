@@ -8,7 +8,9 @@
 //
 #include <algorithm>
 #include <boost/core/lightweight_test.hpp>
+#include <boost/gil/algorithm.hpp>
 #include <boost/gil/detail/math.hpp>
+#include <boost/gil/execution.hpp>
 #include <boost/gil/image.hpp>
 #include <boost/gil/extension/image_processing/hough_transform.hpp>
 #include <boost/gil/image_view.hpp>
@@ -17,10 +19,13 @@
 #include <boost/gil/typedefs.hpp>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <sstream>
 #include <vector>
 
+#include "core/test_fixture.hpp"
+
 namespace gil = boost::gil;
 
 const std::ptrdiff_t width = 64;
@@ -87,8 +92,152 @@ void hough_line_test(std::ptrdiff_t height, std::ptrdiff_t intercept)
     BOOST_TEST(match_found);
 }
 
+// Votes of every edge pixel for every angle, as computed before the edge list and angle tables
+template <typename InputView, typename OutputView>
+void reference_hough_line_transform(InputView const& input_view,
+                                    OutputView const& accumulator_array,
+                                    gil::hough_parameter<double> const& theta,
+                                    gil::hough_parameter<std::ptrdiff_t> const& radius)
+{
+    std::ptrdiff_t r_lower_bound = radius.start_point;
+    std::ptrdiff_t r_upper_bound = r_lower_bound + radius.step_size * (radius.step_count - 1);
+    for (std::ptrdiff_t y = 0; y < input_view.height(); ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < input_view.width(); ++x)
+        {
+            if (!input_view(x, y)[0])
+            {
+                continue;
+            }
+            for (std::size_t theta_index = 0; theta_index < theta.step_count; ++theta_index)
+            {
+                double theta_current =
+                    theta.start_point + theta.step_size * static_cast<double>(theta_index);
+                std::ptrdiff_t current_r =
+                    std::llround(static_cast<double>(x) * std::cos(theta_current) +
+                                 static_cast<double>(y) * std::sin(theta_current));
+                if (current_r < r_lower_bound || current_r > r_upper_bound)
+                {
+                    continue;
+                }
+                std::size_t r_index =
+                    static_cast<std::size_t>((current_r - radius.start_point) / radius.step_size);
+                accumulator_array(static_cast<std::ptrdiff_t>(theta_index),
+                                  static_cast<std::ptrdiff_t>(r_index))[0] += 1;
+            }
+        }
+    }
+}
+
+void hough_line_votes_test(gil::hough_parameter<double> const& theta,
+                           gil::hough_parameter<std::ptrdiff_t> const& radius)
+{
+    gil::gray8_image_t image(97, 61, gil::gray8_pixel_t(0));
+    auto input = gil::view(image);
+    boost::gil::test::fixture::random_value<int> random(2020, 0, 15);
+    for (auto& pixel : input)
+    {
+        if (random() == 0)
+        {
+            pixel = 255;
+        }
+    }
+
+    // votes are added to the accumulator array
+    gil::point_t const dimensions(static_cast<std::ptrdiff_t>(theta.step_count),
+                                  static_cast<std::ptrdiff_t>(radius.step_count));
+    gil::gray32_image_t expected(dimensions, gil::gray32_pixel_t(7));
+    reference_hough_line_transform(input, gil::view(expected), theta, radius);
+
+    gil::gray32_image_t accumulator_array(dimensions, gil::gray32_pixel_t(7));
+    gil::hough_line_transform(input, gil::view(accumulator_array), theta, radius);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(accumulator_array), gil::const_view(expected)));
+
+    gil::gray32_image_t parallel(dimensions, gil::gray32_pixel_t(7));
+    gil::hough_line_transform(gil::execution::parallel_policy(3), input, gil::view(parallel),
+                              theta, radius);
+    BOOST_TEST(gil::equal_pixels(gil::const_view(parallel), gil::const_view(expected)));
+}
+
+void hough_peaks_test()
+{
+    gil::gray32_image_t image(12, 9, gil::gray32_pixel_t(0));
+    auto accumulator_array = gil::view(image);
+    accumulator_array(2, 2) = 50;
+    accumulator_array(3, 2) = 49; // next to a stronger peak
+    accumulator_array(4, 4) = 45; // within the suppression radius of (2, 2)
+    accumulator_array(9, 1) = 30;
+    accumulator_array(9, 7) = 30;
+    accumulator_array(6, 6) = 40;
+    accumulator_array(0, 8) = 12; // below the threshold
+
+    auto const peaks = gil::hough_peaks(gil::const_view(image), 10, 20, gil::point_t(2, 2));
+    BOOST_TEST_EQ(peaks.size(), 4u);
+    if (peaks.size() == 4)
+    {
+        BOOST_TEST(peaks[0] == gil::point_t(2, 2));
+        BOOST_TEST(peaks[1] == gil::point_t(6, 6));
+        // ties in row-major order
+        BOOST_TEST(peaks[2] == gil::point_t(9, 1));
+        BOOST_TEST(peaks[3] == gil::point_t(9, 7));
+    }
+
+    auto const strongest = gil::hough_peaks(gil::const_view(image), 2, 20, gil::point_t(1, 1));
+    BOOST_TEST_EQ(strongest.size(), 2u);
+    if (strongest.size() == 2)
+    {
+        BOOST_TEST(strongest[0] == gil::point_t(2, 2));
+        BOOST_TEST(strongest[1] == gil::point_t(4, 4));
+    }
+}
+
+// Lines of an edge map are the strongest peaks of their accumulator array
+void hough_line_peaks_test()
+{
+    gil::gray8_image_t image(width, width, gil::gray8_pixel_t(0));
+    auto input = gil::view(image);
+    for (std::ptrdiff_t i = 0; i < width; ++i)
+    {
+        input(i, 20) = 255;
+        input(45, i) = 255;
+    }
+
+    // angles in [0, pi), so that lines have a single peak
+    gil::hough_parameter<double> const theta{0.0, gil::detail::pi / 90, 90};
+    auto const radius = gil::hough_parameter<std::ptrdiff_t>::from_step_size(0, 2 * width, 1);
+    gil::gray32_image_t accumulator_array_image(
+        static_cast<std::ptrdiff_t>(theta.step_count),
+        static_cast<std::ptrdiff_t>(radius.step_count), gil::gray32_pixel_t(0));
+    gil::hough_line_transform(gil::execution::parallel_policy(2), input,
+                              gil::view(accumulator_array_image), theta, radius);
+    auto const peaks =
+        gil::hough_peaks(gil::const_view(accumulator_array_image), 2, width / 2, {4, 4});
+    BOOST_TEST_EQ(peaks.size(), 2u);
+    if (peaks.size() == 2)
+    {
+        // x = 45 at theta 0, y = 20 at theta pi / 2
+        bool const vertical_first = peaks[0].x == 0;
+        gil::point_t const vertical = vertical_first ? peaks[0] : peaks[1];
+        gil::point_t const horizontal = vertical_first ? peaks[1] : peaks[0];
+        BOOST_TEST_EQ(vertical.x, 0);
+        BOOST_TEST_EQ(vertical.y + radius.start_point, 45);
+        BOOST_TEST_EQ(horizontal.x, 45);
+        BOOST_TEST_EQ(horizontal.y + radius.start_point, 20);
+    }
+}
+
 int main()
 {
+    hough_line_votes_test(gil::hough_parameter<double>::from_step_count(0.3, 0.3, 20),
+                          gil::hough_parameter<std::ptrdiff_t>::from_step_size(0, 120, 1));
+    hough_line_votes_test(gil::hough_parameter<double>::from_step_count(1.5, 1.5, 50),
+                          gil::hough_parameter<std::ptrdiff_t>::from_step_size(10, 60, 3));
+    hough_line_votes_test(gil::make_theta_parameter(2.5, 0.6, {97, 61}),
+                          gil::hough_parameter<std::ptrdiff_t>::from_step_count(-20, 40, 8));
+    hough_peaks_test();
+    hough_line_peaks_test();
+
+
     for (std::ptrdiff_t height = 1; height < width; ++height)
     {
         for (std::ptrdiff_t intercept = 1; intercept < width - height; ++intercept)
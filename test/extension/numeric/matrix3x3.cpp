@@ -0,0 +1,166 @@
+//
+// Copyright 2026 Boost.GIL Contributors
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#include <boost/gil.hpp>
+#include <boost/gil/extension/numeric/affine.hpp>
+#include <boost/gil/extension/numeric/resample.hpp>
+#include <boost/gil/extension/numeric/sampler.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "test_utility_with_tolerance.hpp"
+
+#include <cmath>
+
+namespace gil = boost::gil;
+
+namespace {
+
+using tolerance = gil::test::utility::with_tolerance<double>;
+
+void check_point(gil::point<double> const& p, double x, double y)
+{
+    BOOST_TEST_WITH(p.x, x, tolerance(1e-9));
+    BOOST_TEST_WITH(p.y, y, tolerance(1e-9));
+}
+
+} // namespace
+
+void test_matrix3x3_default_constructor()
+{
+    gil::matrix3x3<int> m1;
+    BOOST_TEST_EQ(m1.a, 1);
+    BOOST_TEST_EQ(m1.b, 0);
+    BOOST_TEST_EQ(m1.c, 0);
+    BOOST_TEST_EQ(m1.d, 1);
+    BOOST_TEST_EQ(m1.e, 0);
+    BOOST_TEST_EQ(m1.f, 0);
+    BOOST_TEST_EQ(m1.g, 0);
+    BOOST_TEST_EQ(m1.h, 0);
+    BOOST_TEST_EQ(m1.i, 1);
+}
+
+void test_matrix3x3_from_matrix3x2()
+{
+    gil::matrix3x3<int> m1(gil::matrix3x2<int>(1, 2, 3, 4, 5, 6));
+    BOOST_TEST_EQ(m1.a, 1);
+    BOOST_TEST_EQ(m1.b, 2);
+    BOOST_TEST_EQ(m1.c, 3);
+    BOOST_TEST_EQ(m1.d, 4);
+    BOOST_TEST_EQ(m1.e, 5);
+    BOOST_TEST_EQ(m1.f, 6);
+    BOOST_TEST_EQ(m1.g, 0);
+    BOOST_TEST_EQ(m1.h, 0);
+    BOOST_TEST_EQ(m1.i, 1);
+}
+
+void test_matrix3x3_multiplication()
+{
+    // Products of affine matrices are those of matrix3x2
+    gil::matrix3x2<int> const a1(1, 2, 3, 4, 5, 6);
+    gil::matrix3x2<int> const a2(-2, 1, 0, 3, 7, -1);
+    gil::matrix3x2<int> const p2 = a1 * a2;
+    gil::matrix3x3<int> m = gil::matrix3x3<int>(a1);
+    m *= gil::matrix3x3<int>(a2);
+    BOOST_TEST_EQ(m.a, p2.a);
+    BOOST_TEST_EQ(m.b, p2.b);
+    BOOST_TEST_EQ(m.c, p2.c);
+    BOOST_TEST_EQ(m.d, p2.d);
+    BOOST_TEST_EQ(m.e, p2.e);
+    BOOST_TEST_EQ(m.f, p2.f);
+    BOOST_TEST_EQ(m.g, 0);
+    BOOST_TEST_EQ(m.h, 0);
+    BOOST_TEST_EQ(m.i, 1);
+
+    // Transforming by a product transforms by the first matrix, then by the second
+    gil::matrix3x3<double> const m1(1.0, 0.2, -0.1, 0.9, 3.0, 4.0, 0.001, 0.002, 1.0);
+    gil::matrix3x3<double> const m2(0.5, 0.0, 0.1, 2.0, -1.0, 1.0, -0.003, 0.0, 2.0);
+    gil::point<double> const p(7.0, -5.0);
+    gil::point<double> const q = gil::transform(m2, gil::transform(m1, p));
+    check_point(gil::transform(m1 * m2, p), q.x, q.y);
+}
+
+void test_matrix3x3_transform()
+{
+    gil::matrix3x3<double> const m(2.0, 0.0, 0.0, 3.0, 1.0, -1.0, 0.5, 0.0, 1.0);
+    // w = 0.5 * 2 + 1 = 2
+    check_point(gil::transform(m, gil::point<double>(2.0, 4.0)), 2.5, 5.5);
+    check_point(gil::point<int>(2, 4) * m, 2.5, 5.5);
+}
+
+void test_matrix3x3_inverse()
+{
+    gil::matrix3x3<double> const m(1.2, 0.3, -0.2, 0.8, 14.0, -6.0, 0.0015, -0.002, 1.1);
+    gil::point<double> const p(10.0, 20.0);
+    gil::point<double> const q = gil::transform(inverse(m), p);
+    check_point(gil::transform(m, q), p.x, p.y);
+
+    gil::matrix3x3<double> const identity = m * inverse(m);
+    BOOST_TEST_WITH(identity.a, 1.0, tolerance(1e-9));
+    BOOST_TEST_WITH(identity.i, 1.0, tolerance(1e-9));
+    BOOST_TEST_LT(std::abs(identity.g) + std::abs(identity.h) + std::abs(identity.e), 1e-9);
+}
+
+void test_matrix3x3_get_quad_to_quad()
+{
+    using point_t = gil::point<double>;
+    point_t const square[4] = {{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}, {0.0, 1.0}};
+    point_t const quad[4] = {{10.0, 5.0}, {90.0, 12.0}, {70.0, 60.0}, {20.0, 40.0}};
+    auto const to_quad = gil::matrix3x3<double>::get_square_to_quad(quad);
+    for (int k = 0; k < 4; ++k)
+        check_point(gil::transform(to_quad, square[k]), quad[k].x, quad[k].y);
+
+    point_t const rectangle[4] = {{0.0, 0.0}, {63.0, 0.0}, {63.0, 47.0}, {0.0, 47.0}};
+    auto const correct = gil::matrix3x3<double>::get_quad_to_quad(rectangle, quad);
+    for (int k = 0; k < 4; ++k)
+        check_point(gil::transform(correct, rectangle[k]), quad[k].x, quad[k].y);
+
+    // Parallelograms are mapped by affine transformations
+    point_t const parallelogram[4] = {{1.0, 2.0}, {5.0, 3.0}, {6.0, 7.0}, {2.0, 6.0}};
+    auto const affine = gil::matrix3x3<double>::get_square_to_quad(parallelogram);
+    BOOST_TEST_LT(std::abs(affine.g) + std::abs(affine.h), 1e-12);
+}
+
+// resample_pixels samples the source at the projected coordinates
+void test_matrix3x3_resample_pixels()
+{
+    gil::gray32f_image_t src(40, 30);
+    auto const s = gil::view(src);
+    for (std::ptrdiff_t y = 0; y < s.height(); ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < s.width(); ++x)
+            s(x, y)[0] = static_cast<float>(x + 100 * y);
+    }
+
+    gil::matrix3x3<double> const m(0.9, 0.05, -0.1, 0.8, 4.0, 3.0, 0.002, 0.001, 1.0);
+    gil::gray32f_image_t dst(30, 25);
+    gil::resample_pixels(gil::const_view(src), gil::view(dst), m, gil::bilinear_sampler());
+    auto const d = gil::const_view(dst);
+    double error = 0.0;
+    for (std::ptrdiff_t y = 0; y < d.height(); ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < d.width(); ++x)
+        {
+            gil::point<double> const p = gil::transform(m, gil::point<double>(x, y));
+            error = (std::max)(error, std::abs(d(x, y)[0] - (p.x + 100.0 * p.y)));
+        }
+    }
+    BOOST_TEST_LT(error, 1e-3);
+}
+
+int main()
+{
+    test_matrix3x3_default_constructor();
+    test_matrix3x3_from_matrix3x2();
+    test_matrix3x3_multiplication();
+    test_matrix3x3_transform();
+    test_matrix3x3_inverse();
+    test_matrix3x3_get_quad_to_quad();
+    test_matrix3x3_resample_pixels();
+
+    return ::boost::report_errors();
+}
@@ -0,0 +1,190 @@
+//
+// Copyright 2026 Boost.GIL Contributors
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#include <boost/gil.hpp>
+#include <boost/gil/extension/numeric/affine.hpp>
+#include <boost/gil/extension/numeric/remap.hpp>
+#include <boost/gil/extension/numeric/resample.hpp>
+#include <boost/gil/extension/numeric/sampler.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "core/image/test_fixture.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace gil = boost::gil;
+namespace fixture = boost::gil::test::fixture;
+
+// Radial distortion about the center of a camera image, mapping some corners far away
+struct undistort_fn
+{
+    double cx;
+    double cy;
+    double k;
+};
+
+namespace boost { namespace gil {
+
+template <>
+struct mapping_traits<undistort_fn>
+{
+    using result_type = point<double>;
+};
+
+template <typename I>
+inline point<double> transform(undistort_fn const& mf, point<I> const& src)
+{
+    double const x = static_cast<double>(src.x) - mf.cx;
+    double const y = static_cast<double>(src.y) - mf.cy;
+    double const scale = 1.0 + mf.k * (x * x + y * y);
+    if (scale > 1.5)
+        return {std::numeric_limits<double>::quiet_NaN(), 0.0};
+    return {mf.cx + x * scale, mf.cy + y * scale};
+}
+
+// Maps to the coordinates stored in a remap table
+struct stored_fn
+{
+    gil::remap_table const* table;
+};
+
+template <>
+struct mapping_traits<stored_fn>
+{
+    using result_type = point<double>;
+};
+
+template <typename I>
+inline point<double> transform(stored_fn const& mf, point<I> const& src)
+{
+    point<std::int32_t> const q = mf.table->coordinates(src.x, src.y);
+    return {q.x / 256.0, q.y / 256.0};
+}
+
+}} // namespace boost::gil
+
+void test_table()
+{
+    gil::remap_table const table(gil::point_t(5, 4),
+        gil::matrix3x2<double>::get_translate(-1.0 / 512, 2.75));
+    BOOST_TEST_EQ(table.width(), 5);
+    BOOST_TEST_EQ(table.height(), 4);
+    // Rounded to the nearest 1/256 of a pixel
+    BOOST_TEST_EQ(table.coordinates(3, 1).x, 3 * 256);
+    BOOST_TEST_EQ(table.coordinates(3, 1).y, 3 * 256 + 192);
+    BOOST_TEST_EQ(table.row_begin(2)[2 * 4], 4 * 256);
+
+    // Coordinates too far or not numbers
+    gil::remap_table const far(gil::point_t(2, 2),
+        gil::matrix3x2<double>::get_translate(1e9, 0.0));
+    BOOST_TEST_EQ(far.coordinates(1, 1).x, gil::remap_table::unmapped + 0);
+    BOOST_TEST_EQ(far.coordinates(1, 1).y, 256);
+    gil::remap_table const undefined(gil::point_t(61, 47), undistort_fn{30.0, 23.0, 4e-4});
+    BOOST_TEST_EQ(undefined.coordinates(0, 0).x, gil::remap_table::unmapped + 0);
+
+    gil::remap_table const parallel(gil::execution::parallel_policy(3), gil::point_t(61, 47),
+        undistort_fn{30.0, 23.0, 4e-4});
+    bool all_equal = true;
+    for (std::ptrdiff_t y = 0; y < parallel.height(); ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < parallel.width(); ++x)
+            all_equal = all_equal && parallel.coordinates(x, y) == undefined.coordinates(x, y);
+    }
+    BOOST_TEST(all_equal);
+}
+
+// Remapping samples the source at the stored coordinates, and so does the sampler for the
+// tabulated kernels, whose phases are the stored fractions
+template <typename Image, typename Sampler, typename MapFn>
+void test_remap(MapFn const& map, double tolerance)
+{
+    Image src(53, 41);
+    fixture::fill_random_channels(gil::view(src));
+    typename Image::value_type background;
+    for (std::size_t c = 0; c < gil::num_channels<Image>::value; ++c)
+        background[c] = typename gil::channel_type<Image>::type(1);
+
+    gil::remap_table const table(gil::point_t(61, 47), map);
+    Image expected(61, 47, background, 0);
+    gil::resample_pixels(gil::const_view(src), gil::view(expected), gil::stored_fn{&table},
+        Sampler());
+
+    Image dst(61, 47, background, 0);
+    gil::remap_pixels(gil::const_view(src), gil::view(dst), table, Sampler());
+    BOOST_TEST_LE(
+        fixture::max_difference(gil::const_view(dst), gil::const_view(expected)), tolerance);
+
+    if (gil::detail::is_kernel_sampler<Sampler>::value)
+    {
+        Image mapped(61, 47, background, 0);
+        gil::resample_pixels(gil::const_view(src), gil::view(mapped), map, Sampler());
+        BOOST_TEST(gil::equal_pixels(gil::const_view(dst), gil::const_view(mapped)));
+    }
+
+    // The table is reused for other sources
+    Image dst_parallel(61, 47, background, 0);
+    gil::remap_pixels(gil::execution::parallel_policy(3), gil::const_view(src),
+        gil::view(dst_parallel), table, Sampler());
+    BOOST_TEST(gil::equal_pixels(gil::const_view(dst), gil::const_view(dst_parallel)));
+}
+
+template <typename Image, typename Sampler>
+void test_remaps(double tolerance)
+{
+    // Perspective sampling across all borders of the source
+    gil::point<double> const corners[4] = {{0.0, 0.0}, {60.0, 0.0}, {60.0, 46.0}, {0.0, 46.0}};
+    gil::point<double> const quad[4] = {{-4.0, 3.0}, {49.0, -2.0}, {57.0, 44.0}, {2.0, 38.0}};
+    test_remap<Image, Sampler>(
+        gil::matrix3x3<double>::get_quad_to_quad(corners, quad), tolerance);
+
+    test_remap<Image, Sampler>(undistort_fn{30.0, 23.0, 4e-4}, tolerance);
+}
+
+// Views of different pixel types are sampled at the stored coordinates
+void test_remap_converted()
+{
+    gil::rgb8_image_t src(53, 41);
+    fixture::fill_random_channels(gil::view(src));
+    gil::remap_table const table(gil::point_t(61, 47), undistort_fn{30.0, 23.0, 4e-4});
+
+    gil::rgb32f_image_t expected(61, 47, gil::rgb32f_pixel_t(1.0f, 1.0f, 1.0f), 0);
+    gil::resample_pixels(gil::const_view(src), gil::view(expected), gil::stored_fn{&table},
+        gil::bilinear_sampler());
+    gil::rgb32f_image_t dst(61, 47, gil::rgb32f_pixel_t(1.0f, 1.0f, 1.0f), 0);
+    gil::remap_pixels(gil::const_view(src), gil::view(dst), table, gil::bilinear_sampler());
+    BOOST_TEST(gil::equal_pixels(gil::const_view(dst), gil::const_view(expected)));
+}
+
+int main()
+{
+    test_table();
+
+    test_remaps<gil::gray8_image_t, gil::nearest_neighbor_sampler>(0.0);
+    test_remaps<gil::rgb16_planar_image_t, gil::nearest_neighbor_sampler>(0.0);
+
+    test_remaps<gil::gray8_image_t, gil::bilinear_sampler>(1.0);
+    test_remaps<gil::rgb8_image_t, gil::bilinear_sampler>(1.0);
+    test_remaps<gil::rgba8_planar_image_t, gil::bilinear_sampler>(1.0);
+    test_remaps<gil::gray16_image_t, gil::bilinear_sampler>(1.0);
+    test_remaps<gil::rgb32f_image_t, gil::bilinear_sampler>(1e-5);
+
+    test_remaps<gil::gray8_image_t, gil::bicubic_sampler>(0.0);
+    test_remaps<gil::rgb8_image_t, gil::bicubic_sampler>(0.0);
+    test_remaps<gil::gray16_image_t, gil::bicubic_sampler>(0.0);
+    test_remaps<gil::rgb32f_image_t, gil::bicubic_sampler>(0.0);
+    test_remaps<gil::rgb8_image_t, gil::lanczos_sampler<3>>(0.0);
+
+    test_remap_converted();
+
+    return ::boost::report_errors();
+}
@@ -12,11 +12,17 @@
 
 #include <boost/core/lightweight_test.hpp>
 
+#include "core/image/test_fixture.hpp"
+
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
 
 #include "test_utility_output_stream.hpp"
 
 namespace gil = boost::gil;
+namespace fixture = boost::gil::test::fixture;
 
 // FIXME: Remove when https://github.com/boostorg/core/issues/38 happens
 #define BOOST_GIL_TEST_IS_CLOSE(a, b, epsilon) BOOST_TEST_LT(std::fabs((a) - (b)), (epsilon))
@@ -53,6 +59,25 @@ inline point<F> transform(test_map_fn<F, I> const &mf, point<I> const &src)
     return mf(src);
 }
 
+// Maps through a matrix one pixel at a time, as resample_pixels does with other mappings
+template <class F>
+struct per_pixel_map_fn
+{
+    gil::matrix3x2<F> matrix;
+};
+
+template <class F>
+struct mapping_traits<per_pixel_map_fn<F>>
+{
+    using result_type = point<F>;
+};
+
+template <class F, class I>
+inline point<F> transform(per_pixel_map_fn<F> const &mf, point<I> const &src)
+{
+    return transform(mf.matrix, src);
+}
+
 }} // namespace boost::gil
 
 void test_bilinear_sampler_test()
@@ -95,9 +120,142 @@ void test_bilinear_sampler_test()
     BOOST_TEST_EQ(gil::rgb8_pixel_t(0, 128, 0), dv(3, 3));
 }
 
+// resize_view resamples in separable passes and rounds, where the sampler truncates
+template <typename Image>
+void test_resize_view_separable(
+    std::ptrdiff_t src_width,
+    std::ptrdiff_t src_height,
+    std::ptrdiff_t dst_width,
+    std::ptrdiff_t dst_height,
+    double tolerance)
+{
+    Image src(src_width, src_height);
+    fixture::fill_random_channels(gil::view(src));
+
+    Image expected(dst_width, dst_height);
+    gil::resample_subimage(gil::const_view(src), gil::view(expected), 0.0, 0.0,
+        static_cast<double>(src_width), static_cast<double>(src_height), 0.0,
+        gil::bilinear_sampler());
+
+    Image dst(dst_width, dst_height);
+    gil::resize_view(gil::const_view(src), gil::view(dst), gil::bilinear_sampler());
+    BOOST_TEST_LE(
+        fixture::max_difference(gil::const_view(dst), gil::const_view(expected)), tolerance);
+
+    Image dst_parallel(dst_width, dst_height);
+    gil::resize_view(gil::execution::parallel_policy(3), gil::const_view(src),
+        gil::view(dst_parallel), gil::bilinear_sampler());
+    BOOST_TEST_EQ(
+        fixture::max_difference(gil::const_view(dst), gil::const_view(dst_parallel)), 0.0);
+}
+
+template <typename Image>
+void test_resize_view_sizes(double tolerance)
+{
+    test_resize_view_separable<Image>(37, 29, 101, 83, tolerance);
+    test_resize_view_separable<Image>(101, 83, 37, 29, tolerance);
+    test_resize_view_separable<Image>(64, 48, 64, 97, tolerance);
+    test_resize_view_separable<Image>(45, 30, 1, 7, tolerance);
+}
+
+void test_resize_view_constant()
+{
+    gil::rgb8_image_t src(23, 17, gil::rgb8_pixel_t(255, 7, 128));
+    gil::rgb8_image_t dst(61, 5);
+    gil::resize_view(gil::const_view(src), gil::view(dst), gil::bilinear_sampler());
+    gil::rgb8_image_t const expected(61, 5, gil::rgb8_pixel_t(255, 7, 128));
+    BOOST_TEST(gil::equal_pixels(gil::const_view(dst), gil::const_view(expected)));
+
+    // A single source pixel fills the destination
+    gil::rgb8_image_t one(1, 1, gil::rgb8_pixel_t(255, 7, 128));
+    gil::resize_view(gil::const_view(one), gil::view(dst), gil::bilinear_sampler());
+    BOOST_TEST(gil::equal_pixels(gil::const_view(dst), gil::const_view(expected)));
+}
+
+void test_resize_view_per_pixel()
+{
+    // Views of different pixel types are resampled through the sampler
+    gil::rgb8_image_t src(19, 13);
+    fixture::fill_random_channels(gil::view(src));
+    gil::rgb16_image_t expected(40, 31);
+    gil::resample_subimage(gil::const_view(src), gil::view(expected), 0.0, 0.0, 19.0, 13.0, 0.0,
+        gil::bilinear_sampler());
+    gil::rgb16_image_t dst(40, 31);
+    gil::resize_view(gil::const_view(src), gil::view(dst), gil::bilinear_sampler());
+    BOOST_TEST(gil::equal_pixels(gil::const_view(dst), gil::const_view(expected)));
+}
+
+// Affine warps step the source coordinates along the rows, and leave the destination pixels
+// mapped outside the source unchanged as the samplers do
+template <typename Image, typename Sampler>
+void test_affine_warp(gil::matrix3x2<double> const& matrix, double tolerance)
+{
+    Image src(53, 41);
+    fixture::fill_random_channels(gil::view(src));
+    typename Image::value_type background;
+    for (std::size_t c = 0; c < gil::num_channels<Image>::value; ++c)
+        background[c] = typename gil::channel_type<Image>::type(1);
+
+    Image expected(67, 59, background, 0);
+    gil::resample_pixels(gil::const_view(src), gil::view(expected),
+        gil::per_pixel_map_fn<double>{matrix}, Sampler());
+
+    Image dst(67, 59, background, 0);
+    gil::resample_pixels(gil::const_view(src), gil::view(dst), matrix, Sampler());
+    BOOST_TEST_LE(
+        fixture::max_difference(gil::const_view(dst), gil::const_view(expected)), tolerance);
+
+    Image dst_parallel(67, 59, background, 0);
+    gil::resample_pixels(gil::execution::parallel_policy(3), gil::const_view(src),
+        gil::view(dst_parallel), matrix, Sampler());
+    BOOST_TEST(gil::equal_pixels(gil::const_view(dst), gil::const_view(dst_parallel)));
+}
+
+template <typename Image, typename Sampler>
+void test_affine_warps(double tolerance)
+{
+    // Rotated about the center of the destination, sampling across all borders of the source
+    gil::matrix3x2<double> const rotate =
+        gil::matrix3x2<double>::get_translate(-33.0, -29.0) *
+        gil::matrix3x2<double>::get_rotate(0.3) *
+        gil::matrix3x2<double>::get_translate(26.1, 20.3);
+    test_affine_warp<Image, Sampler>(rotate, tolerance);
+
+    // Rows and columns stepping backwards
+    gil::matrix3x2<double> const flip(-0.7, 0.05, 0.1, -0.8, 50.2, 45.7);
+    test_affine_warp<Image, Sampler>(flip, tolerance);
+
+    // Coordinates halfway between pixels, and rows mapped to a single source row
+    test_affine_warp<Image, Sampler>(
+        gil::matrix3x2<double>::get_translate(-0.5, -0.5), tolerance);
+    test_affine_warp<Image, Sampler>(gil::matrix3x2<double>(1.0, 0.0, 0.0, 0.0, -3.0, 7.0),
+        tolerance);
+
+    // Far outside the source
+    test_affine_warp<Image, Sampler>(
+        gil::matrix3x2<double>::get_translate(1e12, -3.0), tolerance);
+}
+
 int main()
 {
     test_bilinear_sampler_test();
+    test_resize_view_sizes<gil::gray8_image_t>(1.0);
+    test_resize_view_sizes<gil::rgb8_image_t>(1.0);
+    test_resize_view_sizes<gil::rgba8_image_t>(1.0);
+    test_resize_view_sizes<gil::rgb8_planar_image_t>(1.0);
+    test_resize_view_sizes<gil::gray16_image_t>(1.0);
+    test_resize_view_sizes<gil::rgb32f_image_t>(1e-5);
+    test_resize_view_constant();
+    test_resize_view_per_pixel();
+
+    test_affine_warps<gil::gray8_image_t, gil::nearest_neighbor_sampler>(0.0);
+    test_affine_warps<gil::rgb8_image_t, gil::nearest_neighbor_sampler>(0.0);
+    test_affine_warps<gil::rgb16_planar_image_t, gil::nearest_neighbor_sampler>(0.0);
+    test_affine_warps<gil::gray8_image_t, gil::bilinear_sampler>(1.0);
+    test_affine_warps<gil::rgb8_image_t, gil::bilinear_sampler>(1.0);
+    test_affine_warps<gil::rgba8_planar_image_t, gil::bilinear_sampler>(1.0);
+    test_affine_warps<gil::gray16_image_t, gil::bilinear_sampler>(1.0);
+    test_affine_warps<gil::rgb32f_image_t, gil::bilinear_sampler>(1e-5);
 
     return ::boost::report_errors();
 }
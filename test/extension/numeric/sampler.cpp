@@ -0,0 +1,255 @@
+//
+// Copyright 2026 Boost.GIL Contributors
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//
+#include <boost/gil.hpp>
+#include <boost/gil/extension/numeric/resample.hpp>
+#include <boost/gil/extension/numeric/sampler.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "core/image/test_fixture.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace gil = boost::gil;
+namespace fixture = boost::gil::test::fixture;
+
+namespace boost { namespace gil {
+
+// Maps through a matrix one pixel at a time, as resample_pixels does with other mappings
+template <class F>
+struct per_pixel_map_fn
+{
+    gil::matrix3x2<F> matrix;
+};
+
+template <class F>
+struct mapping_traits<per_pixel_map_fn<F>>
+{
+    using result_type = point<F>;
+};
+
+template <class F, class I>
+inline point<F> transform(per_pixel_map_fn<F> const &mf, point<I> const &src)
+{
+    return transform(mf.matrix, src);
+}
+
+}} // namespace boost::gil
+
+// Translations by whole pixels copy the source, and leave the pixels mapped outside unchanged
+template <typename Image, typename Sampler>
+void test_translate()
+{
+    Image src(29, 23);
+    fixture::fill_random_channels(gil::view(src));
+    typename Image::value_type background;
+    for (std::size_t c = 0; c < gil::num_channels<Image>::value; ++c)
+        background[c] = typename gil::channel_type<Image>::type(1);
+
+    Image dst(31, 27, background, 0);
+    gil::resample_pixels(gil::const_view(src), gil::view(dst),
+        gil::matrix3x2<double>::get_translate(5.0, -3.0), Sampler());
+    auto const s = gil::const_view(src);
+    auto const d = gil::const_view(dst);
+    bool all_equal = true;
+    for (std::ptrdiff_t y = 0; y < d.height(); ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < d.width(); ++x)
+        {
+            std::ptrdiff_t const sx = x + 5;
+            std::ptrdiff_t const sy = y - 3;
+            if (sx >= -1 && sx < s.width() && sy >= -1 && sy < s.height())
+            {
+                all_equal = all_equal && d(x, y) == s(
+                    (std::max)(sx, std::ptrdiff_t(0)), (std::max)(sy, std::ptrdiff_t(0)));
+            }
+            else
+            {
+                all_equal = all_equal && d(x, y) == background;
+            }
+        }
+    }
+    BOOST_TEST(all_equal);
+}
+
+// Catmull-Rom interpolation reproduces linear ramps away from the borders, up to the rounding
+// of the coordinates to the nearest phase
+void test_bicubic_ramp()
+{
+    gil::gray32f_image_t src(40, 30);
+    auto const s = gil::view(src);
+    for (std::ptrdiff_t y = 0; y < s.height(); ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < s.width(); ++x)
+            s(x, y)[0] = static_cast<float>(3 * x + 5 * y);
+    }
+
+    gil::matrix3x2<double> const matrix(0.9, 0.2, -0.15, 0.85, 4.3, 2.7);
+    gil::gray32f_image_t dst(30, 25);
+    gil::resample_pixels(gil::const_view(src), gil::view(dst), matrix, gil::bicubic_sampler());
+    auto const d = gil::const_view(dst);
+    double error = 0.0;
+    for (std::ptrdiff_t y = 0; y < d.height(); ++y)
+    {
+        for (std::ptrdiff_t x = 0; x < d.width(); ++x)
+        {
+            gil::point<double> const p = gil::transform(
+                matrix, gil::point<double>(static_cast<double>(x), static_cast<double>(y)));
+            double const w = static_cast<double>(s.width());
+            double const h = static_cast<double>(s.height());
+            if (p.x >= 1.0 && p.x < w - 2.0 && p.y >= 1.0 && p.y < h - 2.0)
+            {
+                double const expected = 3.0 * p.x + 5.0 * p.y;
+                error = (std::max)(error, std::abs(static_cast<double>(d(x, y)[0]) - expected));
+            }
+        }
+    }
+    // Half a phase along both axes
+    BOOST_TEST_LE(error, 8.0 / 512.0 + 1e-3);
+}
+
+template <typename Image, typename Sampler>
+void test_kernel_warp(gil::matrix3x2<double> const& matrix, double tolerance)
+{
+    Image src(53, 41);
+    fixture::fill_random_channels(gil::view(src));
+    typename Image::value_type background;
+    for (std::size_t c = 0; c < gil::num_channels<Image>::value; ++c)
+        background[c] = typename gil::channel_type<Image>::type(1);
+
+    Image expected(67, 59, background, 0);
+    gil::resample_pixels(gil::const_view(src), gil::view(expected),
+        gil::per_pixel_map_fn<double>{matrix}, Sampler());
+
+    Image dst(67, 59, background, 0);
+    gil::resample_pixels(gil::const_view(src), gil::view(dst), matrix, Sampler());
+    BOOST_TEST_LE(
+        fixture::max_difference(gil::const_view(dst), gil::const_view(expected)), tolerance);
+
+    Image dst_parallel(67, 59, background, 0);
+    gil::resample_pixels(gil::execution::parallel_policy(3), gil::const_view(src),
+        gil::view(dst_parallel), matrix, Sampler());
+    BOOST_TEST(gil::equal_pixels(gil::const_view(dst), gil::const_view(dst_parallel)));
+}
+
+template <typename Image, typename Sampler>
+void test_kernel_warps(double tolerance)
+{
+    // Coordinates a quarter phase past the phases, which both paths round alike, sampling
+    // across all borders of the source
+    gil::matrix3x2<double> const shear(
+        0.8125, 0.25, -0.3125, 1.1875, -6.0 + 1.0 / 1024, -9.5 + 1.0 / 1024);
+    test_kernel_warp<Image, Sampler>(shear, 0.0);
+
+    // Rows and columns stepping backwards
+    gil::matrix3x2<double> const flip(
+        -0.75, 0.0625, 0.125, -0.8125, 51.25 + 1.0 / 1024, 45.5 + 1.0 / 1024);
+    test_kernel_warp<Image, Sampler>(flip, 0.0);
+
+    // Rows mapped to a single source row, and far outside the source
+    test_kernel_warp<Image, Sampler>(gil::matrix3x2<double>(1.0, 0.0, 0.0, 0.0, -3.0, 7.0), 0.0);
+    test_kernel_warp<Image, Sampler>(
+        gil::matrix3x2<double>::get_translate(1e12, -3.0), 0.0);
+
+    // Coordinates that may round to neighbouring phases in floating and fixed point
+    gil::matrix3x2<double> const rotate =
+        gil::matrix3x2<double>::get_translate(-33.0, -29.0) *
+        gil::matrix3x2<double>::get_rotate(0.3) *
+        gil::matrix3x2<double>::get_translate(26.1, 20.3);
+    test_kernel_warp<Image, Sampler>(rotate, tolerance);
+}
+
+template <typename Image, typename Sampler>
+void test_kernel_resize(
+    std::ptrdiff_t src_width,
+    std::ptrdiff_t src_height,
+    std::ptrdiff_t dst_width,
+    std::ptrdiff_t dst_height,
+    double tolerance)
+{
+    Image src(src_width, src_height);
+    fixture::fill_random_channels(gil::view(src));
+
+    Image expected(dst_width, dst_height);
+    gil::resample_subimage(gil::const_view(src), gil::view(expected), 0.0, 0.0,
+        static_cast<double>(src_width), static_cast<double>(src_height), 0.0, Sampler());
+
+    Image dst(dst_width, dst_height);
+    gil::resize_view(gil::const_view(src), gil::view(dst), Sampler());
+    BOOST_TEST_LE(
+        fixture::max_difference(gil::const_view(dst), gil::const_view(expected)), tolerance);
+
+    Image dst_parallel(dst_width, dst_height);
+    gil::resize_view(gil::execution::parallel_policy(3), gil::const_view(src),
+        gil::view(dst_parallel), Sampler());
+    BOOST_TEST(gil::equal_pixels(gil::const_view(dst), gil::const_view(dst_parallel)));
+}
+
+template <typename Image, typename Sampler>
+void test_kernel_resizes(double tolerance)
+{
+    test_kernel_resize<Image, Sampler>(37, 29, 101, 83, tolerance);
+    test_kernel_resize<Image, Sampler>(101, 83, 37, 29, tolerance);
+    test_kernel_resize<Image, Sampler>(3, 2, 17, 9, tolerance);
+    test_kernel_resize<Image, Sampler>(45, 30, 1, 7, tolerance);
+}
+
+template <typename Sampler>
+void test_constant()
+{
+    gil::rgb8_image_t src(23, 17, gil::rgb8_pixel_t(255, 7, 128), 0);
+    gil::rgb8_image_t const expected(41, 37, gil::rgb8_pixel_t(255, 7, 128), 0);
+
+    gil::rgb8_image_t resized(41, 37);
+    gil::resize_view(gil::const_view(src), gil::view(resized), Sampler());
+    BOOST_TEST(gil::equal_pixels(gil::const_view(resized), gil::const_view(expected)));
+
+    // Scaled down to lie within the source
+    gil::rgb8_image_t warped(41, 37);
+    gil::matrix3x2<double> const matrix =
+        gil::matrix3x2<double>::get_rotate(0.4) * gil::matrix3x2<double>::get_scale(0.3, 0.3) *
+        gil::matrix3x2<double>::get_translate(6.0, 2.0);
+    gil::resample_pixels(gil::const_view(src), gil::view(warped), matrix, Sampler());
+    BOOST_TEST(gil::equal_pixels(gil::const_view(warped), gil::const_view(expected)));
+}
+
+template <typename Sampler>
+void test_sampler()
+{
+    test_translate<gil::gray8_image_t, Sampler>();
+    test_translate<gil::rgb8_image_t, Sampler>();
+    test_translate<gil::rgb32f_planar_image_t, Sampler>();
+
+    test_kernel_warps<gil::gray8_image_t, Sampler>(2.0);
+    test_kernel_warps<gil::rgb8_image_t, Sampler>(2.0);
+    test_kernel_warps<gil::rgba8_planar_image_t, Sampler>(2.0);
+    test_kernel_warps<gil::gray16_image_t, Sampler>(512.0);
+    test_kernel_warps<gil::rgb32f_image_t, Sampler>(0.01);
+
+    test_kernel_resizes<gil::gray8_image_t, Sampler>(1.0);
+    test_kernel_resizes<gil::rgb8_image_t, Sampler>(1.0);
+    test_kernel_resizes<gil::rgb8_planar_image_t, Sampler>(1.0);
+    test_kernel_resizes<gil::gray16_image_t, Sampler>(1.0);
+    test_kernel_resizes<gil::rgb32f_image_t, Sampler>(1e-6);
+
+    test_constant<Sampler>();
+}
+
+int main()
+{
+    test_sampler<gil::bicubic_sampler>();
+    test_sampler<gil::lanczos_sampler<2>>();
+    test_sampler<gil::lanczos_sampler<3>>();
+    test_bicubic_ramp();
+
+    return ::boost::report_errors();
+}